@@ -0,0 +1,636 @@
+//------------------------------------------------------------------------
+// This file is part of Wasserstein, a C++ library with a Python wrapper
+// that computes the Wasserstein/EMD distance. If you use it for academic
+// research, please cite or acknowledge the following works:
+//
+//   - Komiske, Metodiev, Thaler (2019) arXiv:1902.02346
+//       https://doi.org/10.1103/PhysRevLett.123.041801
+//   - Komiske, Metodiev, Thaler (2020) arXiv:2004.04159
+//       https://doi.org/10.1007/JHEP07%282020%29006
+//   - Boneel, van de Panne, Paris, Heidrich (2011)
+//       https://doi.org/10.1145/2070781.2024192
+//   - LEMON graph library https://lemon.cs.elte.hu/trac/lemon
+//
+// Copyright (C) 2019-2022 Patrick T. Komiske III
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------
+
+// C++ standard library
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+// Wasserstein library
+#include "Wasserstein.hh"
+
+// events are random collections of 2D particles, so no dataset is needed
+using EMDParticle = emd::EuclideanParticle2D<>;
+using Event = emd::EuclideanEvent2D<double>;
+
+// EMD with a configurable network simplex
+template<template<typename> class NetworkSimplex>
+using EMD = emd::EMD<double, emd::EuclideanEvent2D, emd::EuclideanDistance2D, NetworkSimplex>;
+
+// network simplex with a configurable pivot rule
+template<class PivotRule>
+struct WithPivotRule {
+  template<typename Value>
+  using NetworkSimplex = emd::NetworkSimplex<Value, emd::index_type, int, char, emd::SeparateArcLayout, PivotRule>;
+};
+
+// network simplex that always uses index_type arcs, unlike the default one
+template<typename Value>
+using WideNetworkSimplex = emd::NetworkSimplex<Value, emd::index_type, int, char>;
+
+using Clock = std::chrono::steady_clock;
+
+double seconds_since(Clock::time_point start) {
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+// 1D events are placed along the x-axis when solved by the network simplex
+Event random_event(std::mt19937 & rng, int mult, bool one_dimensional = false, bool uniform = false) {
+  std::uniform_real_distribution<double> weight(0, 1), coord(-0.4, 0.4);
+  std::vector<EMDParticle> particles;
+  for (int i = 0; i < mult; i++)
+    particles.emplace_back(uniform ? 1 : weight(rng), coord(rng), one_dimensional ? 0 : coord(rng));
+  return Event(particles);
+}
+
+// same events as 1D particles
+emd::EuclideanEvent1D<double> to_1d(const Event & event) {
+  std::vector<emd::EuclideanParticleND<1, double>> particles;
+  for (const EMDParticle & p : event.particles())
+    particles.emplace_back(p.weight(), std::array<double, 1>{{p[0]}});
+  return emd::EuclideanEvent1D<double>(particles);
+}
+
+// millions of arcs priced per second with kernel by a sweep over an n x n problem
+template<class NetworkSimplex>
+double pricing_throughput(int n, std::mt19937 & rng, emd::PricingKernel kernel = emd::default_pricing_kernel()) {
+
+  typedef typename NetworkSimplex::Arc Arc;
+  std::uniform_real_distribution<double> uniform(0, 1);
+  std::uniform_int_distribution<int> state(-1, 1);
+
+  Arc arc_num(Arc(n)*n);
+  std::vector<double> costs(arc_num), pis(2*n);
+  for (double & c : costs) c = uniform(rng);
+  for (double & pi : pis) pi = uniform(rng);
+
+  typename NetworkSimplex::ArcStorage arcs;
+  arcs.reset(costs, arc_num + 2*n, arc_num);
+  for (Arc e = 0; e < arc_num; e++)
+    arcs.set_state(e, state(rng));
+
+  // sweep over all the rows until enough time has elapsed, rotating the
+  // source potentials so that each sweep finds a new minimum
+  double checksum(0), elapsed(0);
+  long long nsweeps(0);
+  auto start(Clock::now());
+  while (elapsed < 0.2) {
+    double min(0);
+    Arc min_arc(0);
+    for (int s = 0; s < n; s++)
+      arcs.price(kernel, Arc(s)*n, Arc(s + 1)*n, pis[(s + nsweeps) % n], pis.data() + n, min, min_arc);
+    checksum += min + min_arc;
+    nsweeps++;
+    elapsed = seconds_since(start);
+  }
+
+  // use the result so that the sweeps cannot be optimized away
+  if (checksum == 0.5) std::cout << checksum;
+
+  return 1e-6 * nsweeps * arc_num / elapsed;
+}
+
+// millions of ground distances per second filled between two array events of n particles
+// in dim dimensions, with the coordinates spread over a few periods in phi for the (y,phi)
+// distances
+template<class PairwiseDistance>
+double fill_throughput(int n, std::mt19937 & rng, int dim = 2, double beta = 1) {
+
+  std::uniform_real_distribution<double> coord(-10, 10);
+  std::vector<double> coords0(dim*n), coords1(dim*n), dists;
+  for (double & x : coords0) x = coord(rng);
+  for (double & x : coords1) x = coord(rng);
+  const typename PairwiseDistance::ParticleCollection ps0(coords0.data(), n, dim), ps1(coords1.data(), n, dim);
+  PairwiseDistance pairwise_distance(0.4, beta);
+
+  double checksum(0), elapsed(0);
+  long long nfills(0);
+  auto start(Clock::now());
+  while (elapsed < 0.2) {
+    pairwise_distance.fill_distances(ps0, ps1, dists, emd::ExtraParticle::Neither);
+    checksum += dists[nfills % dists.size()];
+    nfills++;
+    elapsed = seconds_since(start);
+  }
+
+  // use the result so that the fills cannot be optimized away
+  if (checksum == 0.5) std::cout << checksum;
+
+  return 1e-6 * nfills * n * n / elapsed;
+}
+
+// fill throughput of a pairwise distance, whose kernel is the default pricing kernel
+template<class PairwiseDistance>
+void print_fill_throughput(std::mt19937 & rng) {
+  std::cout << "\nGround distance fill throughput (million distances/s), "
+            << PairwiseDistance::name() << '\n' << std::setw(8) << "mult"
+            << std::setw(12) << emd::pricing_kernel_name(emd::default_pricing_kernel()) << '\n';
+  for (int mult : {25, 50, 100, 150, 400})
+    std::cout << std::setw(8) << mult << std::setw(12) << fill_throughput<PairwiseDistance>(mult, rng) << '\n';
+}
+
+// microseconds per EMD between pairs of random events with mult particles
+template<class EMDType, class EventType>
+double emd_time(const std::vector<EventType> & events, bool norm = false,
+                emd::EMDSolver solver = emd::EMDSolver::Auto) {
+
+  EMDType emd_obj(1, 1, norm);
+  emd_obj.set_solver(solver);
+  double total(0);
+  auto start(Clock::now());
+  for (std::size_t i = 0; i + 1 < events.size(); i += 2)
+    total += emd_obj(events[i], events[i + 1]);
+  double elapsed(seconds_since(start));
+
+  if (total < 0) std::cout << total;
+
+  return 1e6 * elapsed / (events.size()/2);
+}
+
+// with a network simplex whose arcs are priced with kernel
+template<template<typename> class NetworkSimplex>
+double emd_time(const std::vector<Event> & events, emd::PricingKernel kernel = emd::default_pricing_kernel()) {
+
+  EMD<NetworkSimplex> emd_obj;
+  emd_obj.network_simplex().set_pricing_kernel(kernel);
+  double total(0);
+  auto start(Clock::now());
+  for (std::size_t i = 0; i + 1 < events.size(); i += 2)
+    total += emd_obj(events[i], events[i + 1]);
+  double elapsed(seconds_since(start));
+
+  if (total < 0) std::cout << total;
+
+  return 1e6 * elapsed / (events.size()/2);
+}
+
+// microseconds per EMD in anytime mode with a relative gap, and the largest relative error of
+// the EMDs (upper bounds when approximate) compared to the exact ones
+std::pair<double, double> anytime_stats(const std::vector<Event> & events, double relative_gap) {
+
+  EMD<emd::DefaultNetworkSimplex> emd_obj, exact_obj;
+  emd_obj.set_anytime(relative_gap);
+  std::vector<double> emds;
+  auto start(Clock::now());
+  for (std::size_t i = 0; i + 1 < events.size(); i += 2)
+    emds.push_back(emd_obj(events[i], events[i + 1]));
+  double elapsed(seconds_since(start)), error(0);
+
+  for (std::size_t i = 0; i + 1 < events.size(); i += 2) {
+    double exact(exact_obj(events[i], events[i + 1]));
+    error = std::max(error, std::fabs(emds[i/2] - exact)/exact);
+  }
+
+  return std::make_pair(1e6 * elapsed / (events.size()/2), error);
+}
+
+// milliseconds per normalized EMD with the given solver, using all threads for each problem
+double threaded_emd_time(const std::vector<Event> & events, emd::EMDSolver solver = emd::EMDSolver::Auto) {
+
+  EMD<emd::DefaultNetworkSimplex> emd_obj(1, 1, true);
+  emd_obj.set_solver(solver);
+  emd_obj.set_num_threads(-1, 0);
+  double total(0);
+  auto start(Clock::now());
+  for (std::size_t i = 0; i + 1 < events.size(); i += 2)
+    total += emd_obj(events[i], events[i + 1]);
+  double elapsed(seconds_since(start));
+
+  if (total < 0) std::cout << total;
+
+  return 1e3 * elapsed / (events.size()/2);
+}
+
+// microseconds per decision of whether the EMD is below the given quantile of the exact EMDs
+double within_time(const std::vector<Event> & events, std::vector<double> exact_emds, double quantile) {
+
+  std::sort(exact_emds.begin(), exact_emds.end());
+  double threshold(exact_emds[std::size_t(quantile * (exact_emds.size() - 1))]);
+
+  EMD<emd::DefaultNetworkSimplex> emd_obj;
+  std::size_t num_within(0);
+  auto start(Clock::now());
+  for (std::size_t i = 0; i + 1 < events.size(); i += 2)
+    num_within += emd_obj.within(events[i], events[i + 1], threshold);
+  double elapsed(seconds_since(start));
+
+  if (num_within > events.size()) std::cout << num_within;
+
+  return 1e6 * elapsed / (events.size()/2);
+}
+
+// microseconds per pair for the EMDs at each (R, beta) point, computed separately or as one sweep
+double sweep_time(const std::vector<Event> & events,
+                  const std::vector<std::pair<double, double>> & params, bool sweep) {
+
+  EMD<emd::DefaultNetworkSimplex> emd_obj;
+  std::vector<double> emds;
+  double total(0);
+  auto start(Clock::now());
+  for (std::size_t i = 0; i + 1 < events.size(); i += 2) {
+    if (sweep) emd_obj.compute_sweep(events[i], events[i + 1], params, emds);
+    else {
+      emds.clear();
+      for (const std::pair<double, double> & param : params) {
+        emd_obj.set_R(param.first);
+        emd_obj.set_beta(param.second);
+        emds.push_back(emd_obj(events[i], events[i + 1]));
+      }
+    }
+    total += std::accumulate(emds.begin(), emds.end(), 0.0);
+  }
+  double elapsed(seconds_since(start));
+
+  if (total < 0) std::cout << total;
+
+  return 1e6 * elapsed / (events.size()/2);
+}
+
+// milliseconds per EMD with the sparse network simplex (on its own or at each level of multiscale)
+// and the percentage of the arcs of the finest level it used
+std::pair<double, double> sparse_stats(const std::vector<Event> & events, emd::EMDSolver solver) {
+
+  EMD<emd::DefaultNetworkSimplex> emd_obj(1, 1, true);
+  emd_obj.set_solver(solver);
+  const emd::SparseNetworkSimplex<double> & sparse(solver == emd::EMDSolver::Multiscale ?
+                                                     emd_obj.multiscale().sparse_network_simplex() :
+                                                     emd_obj.sparse_network_simplex());
+  double total(0), arcs(0);
+  auto start(Clock::now());
+  for (std::size_t i = 0; i + 1 < events.size(); i += 2) {
+    total += emd_obj(events[i], events[i + 1]);
+    arcs += double(sparse.n_arcs()) / (emd_obj.n0() * emd_obj.n1());
+  }
+  double elapsed(seconds_since(start));
+
+  if (total < 0) std::cout << total;
+
+  return std::make_pair(1e3 * elapsed / (events.size()/2), 100 * arcs / (events.size()/2));
+}
+
+// microseconds per EMD and mean relative deviation from the exact EMDs with the Sinkhorn solver
+std::pair<double, double> sinkhorn_stats(const std::vector<Event> & events,
+                                         const std::vector<double> & exact_emds,
+                                         double regularization, double tolerance) {
+
+  EMD<emd::Sinkhorn> emd_obj;
+  emd_obj.network_simplex().set_regularization(regularization);
+  emd_obj.network_simplex().set_tolerance(tolerance);
+  std::vector<double> emds;
+  auto start(Clock::now());
+  for (std::size_t i = 0; i + 1 < events.size(); i += 2)
+    emds.push_back(emd_obj(events[i], events[i + 1]));
+  double elapsed(seconds_since(start)), deviation(0);
+
+  for (std::size_t k = 0; k < emds.size(); k++)
+    deviation += emds[k]/exact_emds[k] - 1;
+
+  return std::make_pair(1e6 * elapsed / emds.size(), deviation / emds.size());
+}
+
+// microseconds per pair for both bounds on normalized EMDs once the signatures are cached,
+// and the mean ratios of the lower and upper bounds to the exact EMDs
+std::tuple<double, double, double> bounds_stats(std::vector<Event> events,
+                                                const std::vector<double> & exact_emds) {
+
+  EMD<emd::DefaultNetworkSimplex> emd_obj(1, 1, true);
+  for (Event & event : events)
+    event.normalize_weights();
+  for (std::size_t i = 0; i + 1 < events.size(); i += 2)
+    emd_obj.compute_lower_bound(events[i], events[i + 1]);
+
+  double lower(0), upper(0);
+  auto start(Clock::now());
+  for (std::size_t i = 0; i + 1 < events.size(); i += 2) {
+    lower += emd_obj.compute_lower_bound(events[i], events[i + 1]) / exact_emds[i/2];
+    upper += emd_obj.compute_upper_bound(events[i], events[i + 1]) / exact_emds[i/2];
+  }
+  double elapsed(seconds_since(start));
+
+  return std::make_tuple(1e6 * elapsed / exact_emds.size(), lower / exact_emds.size(), upper / exact_emds.size());
+}
+
+int main(int argc, char** argv) {
+
+  int num_pairs(argc > 1 ? std::atoi(argv[1]) : 100);
+  if (num_pairs <= 0) {
+    std::cerr << "usage: " << argv[0] << " [NUM_PAIRS]\n";
+    return 1;
+  }
+
+  // pricing kernels supported here, each solver and the ground distances start with the default one
+  std::vector<emd::PricingKernel> kernels;
+  for (int k = 0; k <= int(emd::best_pricing_kernel()); k++)
+    kernels.push_back(emd::PricingKernel(k));
+
+  std::mt19937 rng(1);
+  std::cout << std::fixed << std::setprecision(1)
+            << "Pricing throughput (million arcs/s)\n" << std::setw(8) << "mult";
+  for (emd::PricingKernel kernel : kernels)
+    std::cout << std::setw(12) << emd::pricing_kernel_name(kernel);
+  std::cout << std::setw(12) << "Packed" << std::setw(12) << "Mixed" << '\n';
+  for (int mult : {25, 50, 100, 200, 400, 800}) {
+    std::cout << std::setw(8) << mult;
+    for (emd::PricingKernel kernel : kernels)
+      std::cout << std::setw(12) << pricing_throughput<WideNetworkSimplex<double>>(mult, rng, kernel);
+    std::cout << std::setw(12) << pricing_throughput<emd::PackedNetworkSimplex<double>>(mult, rng)
+              << std::setw(12) << pricing_throughput<emd::MixedPrecisionNetworkSimplex<double>>(mult, rng) << '\n';
+  }
+
+  print_fill_throughput<emd::EuclideanArrayDistance<double>>(rng);
+  print_fill_throughput<emd::YPhiArrayDistance<double>>(rng);
+
+  // kernels are unrolled up to 8 dimensions, beyond which they loop over the coordinates, and
+  // betas other than 1 and 2 take their powers afterwards, with products and square roots for
+  // (half-)integer betas and an approximate exp and log otherwise
+  std::cout << "\nGround distance fill throughput (million distances/s) by dimension, "
+            << emd::EuclideanArrayDistance<double>::name() << ", 150 particles, "
+            << emd::pricing_kernel_name(emd::default_pricing_kernel()) << " kernel\n" << std::setw(8) << "beta";
+  for (int dim = 1; dim <= 10; dim++)
+    std::cout << std::setw(8) << dim;
+  std::cout << '\n';
+  for (double beta : {1.0, 2.0, 0.5, 1.5, 3.0, 1.7}) {
+    std::cout << std::setw(8) << beta;
+    for (int dim = 1; dim <= 10; dim++)
+      std::cout << std::setw(8) << std::setprecision(0)
+                << fill_throughput<emd::EuclideanArrayDistance<double>>(150, rng, dim, beta) << std::setprecision(1);
+    std::cout << '\n';
+  }
+
+  std::cout << "\nTime per EMD of random events (us), " << num_pairs << " pairs\n" << std::setw(8) << "mult";
+  for (emd::PricingKernel kernel : kernels)
+    std::cout << std::setw(12) << emd::pricing_kernel_name(kernel);
+  std::cout << std::setw(12) << "Wide" << std::setw(12) << "Packed" << std::setw(12) << "Mixed" << '\n';
+  for (int mult : {25, 50, 100, 200, 400}) {
+    std::vector<Event> events;
+    for (int i = 0; i < 2*num_pairs; i++)
+      events.push_back(random_event(rng, mult));
+    std::cout << std::setw(8) << mult;
+    for (emd::PricingKernel kernel : kernels)
+      std::cout << std::setw(12) << emd_time<emd::DefaultNetworkSimplex>(events, kernel);
+    std::cout << std::setw(12) << emd_time<WideNetworkSimplex>(events)
+              << std::setw(12) << emd_time<emd::PackedNetworkSimplex>(events)
+              << std::setw(12) << emd_time<emd::MixedPrecisionNetworkSimplex>(events) << '\n';
+  }
+
+  std::cout << "\nTime per EMD of random events (us) by pivot rule, " << num_pairs << " pairs\n"
+            << std::setw(8) << "mult" << std::setw(14) << emd::BlockSearchPivotRule::name()
+            << std::setw(14) << emd::CandidateListPivotRule::name()
+            << std::setw(24) << emd::AlteringCandidateListPivotRule::name()
+            << std::setw(14) << emd::FirstEligiblePivotRule::name() << '\n';
+  for (int mult : {20, 50, 100, 200, 500}) {
+    std::vector<Event> events;
+    for (int i = 0; i < 2*num_pairs; i++)
+      events.push_back(random_event(rng, mult));
+    std::cout << std::setw(8) << mult
+              << std::setw(14) << emd_time<WithPivotRule<emd::BlockSearchPivotRule>::NetworkSimplex>(events)
+              << std::setw(14) << emd_time<WithPivotRule<emd::CandidateListPivotRule>::NetworkSimplex>(events)
+              << std::setw(24) << emd_time<WithPivotRule<emd::AlteringCandidateListPivotRule>::NetworkSimplex>(events)
+              << std::setw(14) << emd_time<WithPivotRule<emd::FirstEligiblePivotRule>::NetworkSimplex>(events) << '\n';
+  }
+
+  std::cout << "\nTime per normalized EMD of random events (us) and its deviation from the exact EMD "
+            << "with quantized weights and distances, " << num_pairs << " pairs\n"
+            << std::setw(8) << "mult" << std::setw(18) << "NetworkSimplex" << std::setw(12) << "Quantized"
+            << std::setw(12) << "deviation" << '\n';
+  for (int mult : {25, 50, 100, 200, 400}) {
+    std::vector<Event> events;
+    for (int i = 0; i < 2*num_pairs; i++)
+      events.push_back(random_event(rng, mult, false, false));
+
+    EMD<emd::DefaultNetworkSimplex> emd_obj(1, 1, true);
+    EMD<emd::QuantizedNetworkSimplex> quantized_obj(1, 1, true);
+    double deviation(0);
+    for (std::size_t i = 0; i + 1 < events.size(); i += 2)
+      deviation = std::max(deviation, std::fabs(quantized_obj(events[i], events[i + 1]) - emd_obj(events[i], events[i + 1])));
+
+    std::cout << std::setw(8) << mult << std::setw(18) << emd_time<EMD<emd::DefaultNetworkSimplex>>(events, true)
+              << std::setw(12) << emd_time<EMD<emd::QuantizedNetworkSimplex>>(events, true)
+              << std::setw(12) << std::scientific << deviation << std::fixed << '\n';
+  }
+
+  std::cout << "\nTime per EMD of random events (us) in anytime mode with a relative gap, and the largest "
+            << "relative error, " << num_pairs << " pairs\n" << std::setw(8) << "mult" << std::setw(12) << "exact";
+  for (const char * gap : {"0.1", "0.01", "0.001"})
+    std::cout << std::setw(12) << gap << std::setw(12) << "error";
+  std::cout << '\n';
+  for (int mult : {50, 100, 200, 400}) {
+    std::vector<Event> events;
+    for (int i = 0; i < 2*num_pairs; i++)
+      events.push_back(random_event(rng, mult));
+    std::cout << std::setw(8) << mult << std::setw(12) << emd_time<emd::DefaultNetworkSimplex>(events);
+    for (double gap : {0.1, 0.01, 0.001}) {
+      std::pair<double, double> stats(anytime_stats(events, gap));
+      std::cout << std::setw(12) << stats.first << std::setw(12) << std::scientific << stats.second << std::fixed;
+    }
+    std::cout << '\n';
+  }
+
+  std::cout << "\nTime per decision of whether the EMD of random events is below a quantile of the "
+            << "exact EMDs (us), " << num_pairs << " pairs\n" << std::setw(8) << "mult" << std::setw(12) << "exact";
+  for (const char * quantile : {"0.1", "0.5", "0.9"})
+    std::cout << std::setw(12) << quantile;
+  std::cout << '\n';
+  for (int mult : {50, 100, 200, 400}) {
+    std::vector<Event> events;
+    for (int i = 0; i < 2*num_pairs; i++)
+      events.push_back(random_event(rng, mult));
+    EMD<emd::DefaultNetworkSimplex> emd_obj;
+    std::vector<double> exact_emds;
+    for (std::size_t i = 0; i + 1 < events.size(); i += 2)
+      exact_emds.push_back(emd_obj(events[i], events[i + 1]));
+    std::cout << std::setw(8) << mult << std::setw(12) << emd_time<emd::DefaultNetworkSimplex>(events);
+    for (double quantile : {0.1, 0.5, 0.9})
+      std::cout << std::setw(12) << within_time(events, exact_emds, quantile);
+    std::cout << '\n';
+  }
+
+  // normalized so that both solvers see the same problem without an extra particle
+  std::cout << "\nTime per normalized EMD of random 1D events (us), " << num_pairs << " pairs\n"
+            << std::setw(8) << "mult" << std::setw(12) << "Sorted" << std::setw(18) << "NetworkSimplex" << '\n';
+  for (int mult : {25, 50, 100, 200, 400, 800}) {
+    std::vector<Event> events;
+    std::vector<emd::EuclideanEvent1D<double>> events_1d;
+    for (int i = 0; i < 2*num_pairs; i++) {
+      events.push_back(random_event(rng, mult, true));
+      events_1d.push_back(to_1d(events.back()));
+    }
+    std::cout << std::setw(8) << mult
+              << std::setw(12) << emd_time<emd::EMD<double, emd::EuclideanEvent1D, emd::EuclideanDistance1D>>(events_1d, true)
+              << std::setw(18) << emd_time<EMD<emd::DefaultNetworkSimplex>>(events, true) << '\n';
+  }
+
+  std::cout << "\nTime per EMD of random events with equal weights (us), " << num_pairs << " pairs\n"
+            << std::setw(8) << "mult" << std::setw(12) << "Auction" << std::setw(18) << "NetworkSimplex" << '\n';
+  for (int mult : {25, 50, 100, 200, 400, 800}) {
+    std::vector<Event> events;
+    for (int i = 0; i < 2*num_pairs; i++)
+      events.push_back(random_event(rng, mult, false, true));
+    std::cout << std::setw(8) << mult
+              << std::setw(12) << emd_time<EMD<emd::DefaultNetworkSimplex>>(events, false, emd::EMDSolver::Auction)
+              << std::setw(18) << emd_time<EMD<emd::DefaultNetworkSimplex>>(events, false, emd::EMDSolver::NetworkSimplex)
+              << '\n';
+  }
+
+  std::cout << "\nTime per EMD of random events (us) and mean relative deviation with Sinkhorn, "
+            << num_pairs << " pairs\n" << std::setw(8) << "mult" << std::setw(16) << "NetworkSimplex";
+  std::vector<std::pair<double, double>> sinkhorn_params{{0.05, 1e-3}, {0.01, 1e-3}, {0.01, 1e-6}};
+  for (const auto & params : sinkhorn_params) {
+    std::ostringstream oss;
+    oss << "reg=" << params.first << ",tol=" << params.second;
+    std::cout << std::setw(26) << oss.str();
+  }
+  std::cout << '\n';
+  for (int mult : {50, 100, 200, 400}) {
+    std::vector<Event> events;
+    for (int i = 0; i < 2*num_pairs; i++)
+      events.push_back(random_event(rng, mult));
+
+    EMD<emd::DefaultNetworkSimplex> emd_obj;
+    std::vector<double> exact_emds;
+    for (std::size_t i = 0; i + 1 < events.size(); i += 2)
+      exact_emds.push_back(emd_obj(events[i], events[i + 1]));
+
+    std::cout << std::setw(8) << mult << std::setw(16) << emd_time<emd::DefaultNetworkSimplex>(events);
+    for (const auto & params : sinkhorn_params) {
+      std::pair<double, double> stats(sinkhorn_stats(events, exact_emds, params.first, params.second));
+      std::cout << std::setw(16) << stats.first << std::setw(9) << std::setprecision(3)
+                << stats.second << std::setprecision(1) << " ";
+    }
+    std::cout << '\n';
+  }
+
+  std::cout << "\nTime per normalized EMD of random events (us), time for both bounds with cached signatures "
+            << "(us) and their mean ratios to the EMD, " << num_pairs << " pairs\n"
+            << std::setw(8) << "mult" << std::setw(18) << "NetworkSimplex" << std::setw(10) << "Bounds"
+            << std::setw(10) << "lower" << std::setw(10) << "upper" << '\n';
+  for (int mult : {25, 50, 100, 200, 400}) {
+    std::vector<Event> events;
+    for (int i = 0; i < 2*num_pairs; i++)
+      events.push_back(random_event(rng, mult));
+
+    EMD<emd::DefaultNetworkSimplex> emd_obj(1, 1, true);
+    std::vector<double> exact_emds;
+    for (std::size_t i = 0; i + 1 < events.size(); i += 2)
+      exact_emds.push_back(emd_obj(events[i], events[i + 1]));
+
+    std::tuple<double, double, double> stats(bounds_stats(events, exact_emds));
+    std::cout << std::setw(8) << mult << std::setw(18) << emd_time<EMD<emd::DefaultNetworkSimplex>>(events, true)
+              << std::setw(10) << std::get<0>(stats) << std::setprecision(3)
+              << std::setw(10) << std::get<1>(stats) << std::setw(10) << std::get<2>(stats)
+              << std::setprecision(1) << '\n';
+  }
+
+  // few pairs since the dense problems take around a second each
+  int num_large_pairs(std::min(num_pairs, 5));
+  std::cout << "\nTime per normalized EMD of large random events (ms) and percentage of arcs used by "
+            << "the sparse network simplex and multiscale, " << num_large_pairs << " pairs\n"
+            << std::setw(8) << "mult" << std::setw(12) << "Sparse" << std::setw(8) << "arcs"
+            << std::setw(12) << "Multiscale" << std::setw(8) << "arcs"
+            << std::setw(18) << "NetworkSimplex" << '\n';
+  for (int mult : {500, 1000, 2000, 4000}) {
+    std::vector<Event> events;
+    for (int i = 0; i < 2*num_large_pairs; i++)
+      events.push_back(random_event(rng, mult));
+    std::pair<double, double> stats(sparse_stats(events, emd::EMDSolver::SparseNetworkSimplex)),
+                              ms_stats(sparse_stats(events, emd::EMDSolver::Multiscale));
+    std::cout << std::setw(8) << mult << std::setw(12) << stats.first << std::setw(7) << stats.second << '%'
+              << std::setw(12) << ms_stats.first << std::setw(7) << ms_stats.second << '%'
+              << std::setw(18) << 1e-3 * emd_time<EMD<emd::DefaultNetworkSimplex>>(events, true) << '\n';
+  }
+
+  // threads filling the ground distances and pricing the arcs of each problem
+  if (emd::COMPILED_WITH_OPENMP) {
+    int num_threads(emd::problem_threads(-1, 1, 0));
+    std::cout << "\nTime per normalized EMD of large random events (ms) with one thread and with "
+              << num_threads << " threads per EMD, with the network simplex and the sparse network simplex, "
+              << num_large_pairs << " pairs\n"
+              << std::setw(8) << "mult" << std::setw(12) << "1" << std::setw(12) << num_threads
+              << std::setw(12) << "Sparse 1" << std::setw(12) << "Sparse " + std::to_string(num_threads) << '\n';
+    for (int mult : {1000, 2000, 4000}) {
+      std::vector<Event> events;
+      for (int i = 0; i < 2*num_large_pairs; i++)
+        events.push_back(random_event(rng, mult));
+      std::cout << std::setw(8) << mult << std::setw(12) << 1e-3 * emd_time<EMD<emd::DefaultNetworkSimplex>>(events, true)
+                << std::setw(12) << threaded_emd_time(events)
+                << std::setw(12) << sparse_stats(events, emd::EMDSolver::SparseNetworkSimplex).first
+                << std::setw(12) << threaded_emd_time(events, emd::EMDSolver::SparseNetworkSimplex) << '\n';
+    }
+  }
+
+  // the plain distances of a sweep are filled once and each point starts from the previous tree
+  std::vector<std::pair<double, double>> beta_scan;
+  for (int p = 0; p < 10; p++)
+    beta_scan.emplace_back(1, 0.5 + 0.25*p);
+  std::cout << "\nTime per pair for EMDs at 10 betas from 0.5 to 2.75 of random events (us), "
+            << num_pairs << " pairs\n" << std::setw(8) << "mult" << std::setw(12) << "separate"
+            << std::setw(12) << "sweep" << '\n';
+  for (int mult : {25, 50, 100, 200, 400}) {
+    std::vector<Event> events;
+    for (int i = 0; i < 2*num_pairs; i++)
+      events.push_back(random_event(rng, mult));
+    std::cout << std::setw(8) << mult << std::setw(12) << sweep_time(events, beta_scan, false)
+              << std::setw(12) << sweep_time(events, beta_scan, true) << '\n';
+  }
+
+  // only collected when compiled with -DWASSERSTEIN_SOLVER_STATS
+  if (emd::COMPILED_WITH_SOLVER_STATS) {
+    std::cout << "\nNetwork simplex statistics per EMD of random events, " << num_pairs << " pairs\n"
+              << std::setw(8) << "mult" << std::setw(10) << "initial" << std::setw(10) << "pivots"
+              << std::setw(12) << "degenerate" << std::setw(14) << "priced/pivot" << std::setw(8) << "cycle"
+              << std::setw(8) << "stem" << std::setw(8) << "fill" << std::setw(10) << "allocs" << '\n';
+    for (int mult : {25, 50, 100, 200, 400}) {
+      EMD<emd::DefaultNetworkSimplex> emd_obj;
+      for (int i = 0; i < num_pairs; i++)
+        emd_obj(random_event(rng, mult), random_event(rng, mult));
+
+      emd::SolverStats stats(emd_obj.stats());
+      double pivots(std::max<std::size_t>(stats.pivots, 1));
+      std::cout << std::setw(8) << mult << std::setw(10) << double(stats.initial_pivots)/num_pairs
+                << std::setw(10) << double(stats.pivots)/num_pairs
+                << std::setw(11) << 100*stats.degenerate_pivots/pivots << '%'
+                << std::setw(14) << stats.arcs_priced/pivots << std::setw(8) << stats.cycle_length/pivots
+                << std::setw(8) << stats.stem_length/pivots
+                << std::setw(7) << 100*stats.fill_time/(stats.fill_time + stats.solve_time) << '%'
+                << std::setw(10) << stats.allocations << '\n';
+    }
+  }
+
+  return 0;
+}
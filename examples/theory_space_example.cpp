@@ -90,6 +90,9 @@ int main(int argc, char** argv) {
   // external dists are used by the default configuration
   emd::EMDFloat64<> sigmamd_obj(SigmaMD_R, SigmaMD_beta, SigmaMD_norm, SigmaMD_do_timing);
 
+  // the "events" are whole datasets here, so large ones are solved with all threads
+  sigmamd_obj.set_num_threads(-1);
+
   std::cout << sigmamd_obj.description() << '\n';
 
   // set distances
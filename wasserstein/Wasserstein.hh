@@ -45,6 +45,8 @@
 #include "internal/NetworkSimplex.hh"
 #include "internal/PairwiseDistance.hh"
 #include "internal/PairwiseEMD.hh"
+#include "internal/QuantizedNetworkSimplex.hh"
+#include "internal/Sinkhorn.hh"
 
 
 BEGIN_WASSERSTEIN_NAMESPACE
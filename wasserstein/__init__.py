@@ -61,17 +61,28 @@ __all__ = [
     'EMDStatus_Unbounded',
     'EMDStatus_MaxIterReached',
     'EMDStatus_Infeasible',
+    'EMDStatus_Approximate',
 
     # ExtraParticle enum constants
     'ExtraParticle_Neither',
     'ExtraParticle_Zero',
     'ExtraParticle_One',
 
+    # EMDSolver enum constants
+    'EMDSolver_Auto',
+    'EMDSolver_NetworkSimplex',
+    'EMDSolver_Sorted1D',
+    'EMDSolver_Auction',
+    'EMDSolver_SparseNetworkSimplex',
+    'EMDSolver_Multiscale',
+
     # EMDPairsStorage enum constants
     'EMDPairsStorage_Full',
     'EMDPairsStorage_FullSymmetric',
     'EMDPairsStorage_FlattenedSymmetric',
     'EMDPairsStorage_External',
+    'EMDPairsStorage_Threshold',
+    'EMDPairsStorage_Sweep',
 
     # other functions
     'check_emd_status',
@@ -0,0 +1,254 @@
+//------------------------------------------------------------------------
+// This file is part of Wasserstein, a C++ library with a Python wrapper
+// that computes the Wasserstein/EMD distance. If you use it for academic
+// research, please cite or acknowledge the following works:
+//
+//   - Komiske, Metodiev, Thaler (2019) arXiv:1902.02346
+//       https://doi.org/10.1103/PhysRevLett.123.041801
+//   - Komiske, Metodiev, Thaler (2020) arXiv:2004.04159
+//       https://doi.org/10.1007/JHEP07%282020%29006
+//   - Boneel, van de Panne, Paris, Heidrich (2011)
+//       https://doi.org/10.1145/2070781.2024192
+//   - LEMON graph library https://lemon.cs.elte.hu/trac/lemon
+//
+// Copyright (C) 2019-2022 Patrick T. Komiske III
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------
+
+/*            _    _   _____  _______  _____   ____   _   _
+ *     /\    | |  | | / ____||__   __||_   _| / __ \ | \ | |
+ *    /  \   | |  | || |        | |     | |  | |  | ||  \| |
+ *   / /\ \  | |  | || |        | |     | |  | |  | || . ` |
+ *  / ____ \ | |__| || |____    | |    _| |_ | |__| || |\  |
+ * /_/    \_\ \____/  \_____|   |_|   |_____| \____/ |_| \_|
+ */
+
+#ifndef WASSERSTEIN_AUCTION_HH
+#define WASSERSTEIN_AUCTION_HH
+
+// C++ standard library
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "EMDUtils.hh"
+
+BEGIN_WASSERSTEIN_NAMESPACE
+
+////////////////////////////////////////////////////////////////////////////////
+// Auction - Bertsekas auction with epsilon scaling for assignment problems
+////////////////////////////////////////////////////////////////////////////////
+
+// When both events have n particles of the same weight w, the EMD is w times
+// the cost of an optimal assignment between them. The forward auction lets
+// each unassigned source bid for its best sink, raising that sink's price by
+// the margin over the second best sink plus epsilon. Every assignment found
+// this way is within n*epsilon of the optimal assignment cost, so the EMD is
+// within w*n*epsilon (epsilon times the total weight) of the exact value.
+// Epsilon starts at the range of the costs over the scaling factor and is
+// divided by it again after each stage, keeping the prices, until it reaches
+// the final epsilon, which is relative_epsilon times the range of the costs.
+// Neither epsilon goes below a few ulps of the prices, since a smaller raise
+// would round to no change and two sources could then outbid each other
+// forever, and more than max_bids bids give up with MaxIterReached.
+//
+// The potentials follow the NetworkSimplex convention: the sources carry their
+// profits max_j(-C_ij - p_j) and the sinks their negated prices -p_j, which is
+// dual feasible and complementary slack up to epsilon.
+
+template<typename Value>
+class Auction {
+public:
+
+  Auction(Value relative_epsilon = 1e-9, Value epsilon_scaling = 10, std::size_t max_bids = 100000000) :
+    n_(0), n_bids_(0), total_cost_(0), final_epsilon_(0), have_flows_(false), assigned_(false)
+  {
+    set_params(relative_epsilon, epsilon_scaling, max_bids);
+  }
+
+  // the final epsilon relative to the range of the costs, the factor it is reduced by in each stage,
+  // and the number of bids after which the auction gives up
+  Value relative_epsilon() const { return relative_epsilon_; }
+  Value epsilon_scaling() const { return epsilon_scaling_; }
+  std::size_t max_bids() const { return max_bids_; }
+  void set_params(Value relative_epsilon, Value epsilon_scaling, std::size_t max_bids = 100000000) {
+    if (relative_epsilon <= 0) throw std::invalid_argument("relative_epsilon must be positive");
+    if (epsilon_scaling <= 1) throw std::invalid_argument("epsilon_scaling must be greater than 1");
+    relative_epsilon_ = relative_epsilon;
+    epsilon_scaling_ = epsilon_scaling;
+    max_bids_ = max_bids;
+  }
+
+  // costs is n x n in row-major order (sources by sinks), weight is that of every particle
+  EMDStatus compute(const std::vector<Value> & costs, index_type n, Value weight) {
+
+    n_ = n;
+    n_bids_ = 0;
+    have_flows_ = assigned_ = false;
+    if (n == 0) {
+      total_cost_ = final_epsilon_ = 0;
+      return EMDStatus::Empty;
+    }
+
+    auto minmax(std::minmax_element(costs.begin(), costs.begin() + n*n));
+    Value range(*minmax.second - *minmax.first);
+    Value eps_final(relative_epsilon_ * (range > 0 ? range : 1)), eps(std::max(range / epsilon_scaling_, eps_final));
+
+    prices_.assign(n, 0);
+    owners_.resize(n);
+    assignment_.resize(n);
+    while (true) {
+
+      // a raise of epsilon must change the prices, which stay within the range of the costs plus
+      // that of the previous stage of each other
+      Value max_price(0);
+      for (Value price : prices_)
+        max_price = std::max(max_price, std::fabs(price));
+      Value min_eps(4 * std::numeric_limits<Value>::epsilon() * (2*range + eps + max_price));
+      eps_final = std::max(eps_final, min_eps);
+      eps = std::max(eps, min_eps);
+
+      // each stage starts from scratch except for the prices
+      std::fill(owners_.begin(), owners_.end(), -1);
+      unassigned_.resize(n);
+      for (index_type i = 0; i < n; i++)
+        unassigned_[i] = n - 1 - i;
+
+      while (!unassigned_.empty()) {
+        index_type i(unassigned_.back());
+        unassigned_.pop_back();
+
+        // find the lowest and second lowest C_ij + p_j of the sinks for this source
+        const Value * row(costs.data() + i*n);
+        Value best(row[0] + prices_[0]), second(std::numeric_limits<Value>::max());
+        index_type best_j(0);
+        for (index_type j = 1; j < n; j++) {
+          Value value(row[j] + prices_[j]);
+          if (value < second) {
+            if (value < best) {
+              second = best;
+              best = value;
+              best_j = j;
+            }
+            else second = value;
+          }
+        }
+
+        // bid, raising the price by the margin (just epsilon with a single sink)
+        prices_[best_j] += (n > 1 ? second - best : 0) + eps;
+        if (owners_[best_j] >= 0)
+          unassigned_.push_back(owners_[best_j]);
+        owners_[best_j] = i;
+        assignment_[i] = best_j;
+        if (++n_bids_ >= max_bids_ && !unassigned_.empty()) {
+          total_cost_ = 0;
+          final_epsilon_ = eps;
+
+          // the results keep their sizes, as those of NetworkSimplex do, but are all zero
+          pis_.assign(2*n, 0);
+          flows_.assign(n*n, 0);
+          have_flows_ = true;
+          return EMDStatus::MaxIterReached;
+        }
+      }
+
+      if (eps <= eps_final) {
+        final_epsilon_ = eps;
+        break;
+      }
+      eps = std::max(eps / epsilon_scaling_, eps_final);
+    }
+
+    // cost of the assignment and dual potentials
+    total_cost_ = 0;
+    pis_.resize(2*n);
+    for (index_type i = 0; i < n; i++) {
+      const Value * row(costs.data() + i*n);
+      total_cost_ += row[assignment_[i]];
+      Value profit(-row[0] - prices_[0]);
+      for (index_type j = 1; j < n; j++)
+        profit = std::max(profit, -row[j] - prices_[j]);
+      pis_[i] = profit;
+      pis_[n + i] = -prices_[i];
+    }
+    total_cost_ *= weight;
+    weight_ = weight;
+    assigned_ = true;
+
+    return EMDStatus::Success;
+  }
+
+  // access results
+  Value total_cost() const { return total_cost_; }
+  std::size_t n_bids() const { return n_bids_; }
+  Value final_epsilon() const { return final_epsilon_; }
+  const std::vector<index_type> & assignment() const { return assignment_; }
+  const std::vector<Value> & potentials() const { return pis_; }
+
+  // dense n x n flows, in the same layout as NetworkSimplex::flows()
+  const std::vector<Value> & flows() const {
+    if (!have_flows_) {
+      flows_.assign(n_*n_, 0);
+      for (index_type i = 0; i < n_; i++)
+        flows_[i*n_ + assignment_[i]] = weight_;
+      have_flows_ = true;
+    }
+    return flows_;
+  }
+
+  // appends the flows of the assignment with their arcs i*n + j
+  void sparse_flows(std::vector<std::pair<std::size_t, Value>> & arc_flows) const {
+    if (!assigned_) return;
+    for (index_type i = 0; i < n_; i++)
+      arc_flows.emplace_back(std::size_t(i)*n_ + assignment_[i], weight_);
+  }
+
+  // free all memory
+  void free() {
+    free_vector(prices_);
+    free_vector(owners_);
+    free_vector(assignment_);
+    free_vector(unassigned_);
+    free_vector(pis_);
+    free_vector(flows_);
+    have_flows_ = false;
+  }
+
+private:
+
+  Value relative_epsilon_, epsilon_scaling_;
+  std::size_t max_bids_;
+  index_type n_;
+  std::size_t n_bids_;
+  Value total_cost_, final_epsilon_, weight_;
+
+  std::vector<Value> prices_, pis_;
+  std::vector<index_type> owners_, assignment_, unassigned_;
+
+  // dense flows, built on demand
+  mutable std::vector<Value> flows_;
+  mutable bool have_flows_;
+
+  // whether assignment_ holds a complete assignment, which it does not after giving up
+  bool assigned_;
+
+}; // Auction
+
+END_WASSERSTEIN_NAMESPACE
+
+#endif // WASSERSTEIN_AUCTION_HH
@@ -0,0 +1,237 @@
+//------------------------------------------------------------------------
+// This file is part of Wasserstein, a C++ library with a Python wrapper
+// that computes the Wasserstein/EMD distance. If you use it for academic
+// research, please cite or acknowledge the following works:
+//
+//   - Komiske, Metodiev, Thaler (2019) arXiv:1902.02346
+//       https://doi.org/10.1103/PhysRevLett.123.041801
+//   - Komiske, Metodiev, Thaler (2020) arXiv:2004.04159
+//       https://doi.org/10.1007/JHEP07%282020%29006
+//   - Boneel, van de Panne, Paris, Heidrich (2011)
+//       https://doi.org/10.1145/2070781.2024192
+//   - LEMON graph library https://lemon.cs.elte.hu/trac/lemon
+//
+// Copyright (C) 2019-2022 Patrick T. Komiske III
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------
+
+/*  ____    ____   _    _  _   _  _____    _____
+ * |  _ \  / __ \ | |  | || \ | ||  __ \  / ____|
+ * | |_) || |  | || |  | ||  \| || |  | || (___
+ * |  _ < | |  | || |  | || . ` || |  | | \___ \
+ * | |_) || |__| || |__| || |\  || |__| | ____) |
+ * |____/  \____/  \____/ |_| \_||_____/ |_____/
+ */
+
+#ifndef WASSERSTEIN_BOUNDS_HH
+#define WASSERSTEIN_BOUNDS_HH
+
+// C++ standard library
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "EMDUtils.hh"
+#include "Event.hh"
+
+BEGIN_WASSERSTEIN_NAMESPACE
+
+////////////////////////////////////////////////////////////////////////////////
+// Bounds - lower and upper bounds on the EMD that do not run a solver
+////////////////////////////////////////////////////////////////////////////////
+
+// The EMD between events of total weights W0 and W1 is the cost of moving
+// min(W0, W1) of weight between them plus |W1 - W0| for the extra particle (or
+// just the former with norm), so |W1 - W0| is always a lower bound. When the
+// events have the same total weight W, beta >= 1 and the ground distance is
+// euclidean in coordinates of the particles, convexity of the cost gives
+//   - W (|c0 - c1|/R)^beta, with c0 and c1 the centroids, and
+//   - the EMD between the events projected on any direction, which is computed
+//     exactly by merging the sorted projections,
+// and the largest of these is the lower bound. The upper bound is the cost of
+// the north-west corner flow that matches the particles in the order of each
+// projection (or as given without coordinates), the least of which is used.
+// The signatures of the events hold the centroids and sorted projections, so
+// once they are filled each bound takes time linear in the multiplicities. The
+// projection directions are the coordinate axes and the diagonals of each pair
+// of consecutive axes.
+
+// fills the signature of an event on first use
+template<class PairwiseDistance, class Event>
+const EventSignature<typename Event::value_type> & event_signature(const Event & event) {
+
+  typedef typename Event::value_type Value;
+  EventSignature<Value> & sig(event.signature());
+  if (sig.filled) return sig;
+  sig.filled = true;
+
+  std::vector<Value> xs;
+  index_type dim;
+  sig.centroid.clear();
+  sig.projections.clear();
+  sig.dimension = -1;
+  if (!PairwiseDistance::coordinates(event.particles(), xs, dim) || dim <= 0) return sig;
+  sig.dimension = dim;
+
+  // weighted mean of the coordinates
+  index_type n(xs.size()/dim);
+  Value total(0);
+  sig.centroid.assign(dim, 0);
+  for (index_type i = 0; i < n; i++) {
+    Value w(event.weights()[i]);
+    total += w;
+    for (index_type k = 0; k < dim; k++)
+      sig.centroid[k] += w * xs[i*dim + k];
+  }
+  if (total != 0)
+    for (Value & c : sig.centroid) c /= total;
+
+  // sorted projections on the axes and on the diagonals of consecutive axes
+  const Value inv_sqrt2(1/std::sqrt(Value(2)));
+  auto project([&](index_type k, Value diagonal) {
+    sig.projections.emplace_back(n);
+    std::vector<std::pair<Value, index_type>> & proj(sig.projections.back());
+    for (index_type i = 0; i < n; i++) {
+      const Value * x(xs.data() + i*dim);
+      proj[i] = std::make_pair(diagonal == 0 ? x[k] : (x[k] + diagonal * x[k + 1]) * inv_sqrt2, i);
+    }
+    std::sort(proj.begin(), proj.end());
+  });
+  for (index_type k = 0; k < dim; k++)
+    project(k, 0);
+  for (index_type k = 0; k + 1 < dim; k++) {
+    project(k, 1);
+    project(k, -1);
+  }
+
+  return sig;
+}
+
+// lower bound on the EMD between two events (preprocessed as they would be for it)
+template<class PairwiseDistance, class Event>
+typename Event::value_type emd_lower_bound(const PairwiseDistance & pairwise_distance,
+                                           const Event & ev0, const Event & ev1, bool norm) {
+
+  typedef typename Event::value_type Value;
+  Value W0(ev0.total_weight()), W1(ev1.total_weight());
+  Value bound(norm ? 0 : std::fabs(W1 - W0));
+  if (!(norm || W0 == W1) || pairwise_distance.beta() < 1 ||
+      ev0.weights().size() == 0 || ev1.weights().size() == 0)
+    return bound;
+
+  const EventSignature<Value> & sig0(event_signature<PairwiseDistance>(ev0)),
+                              & sig1(event_signature<PairwiseDistance>(ev1));
+  if (sig0.dimension <= 0 || sig0.dimension != sig1.dimension)
+    return bound;
+
+  // distance between the centroids
+  Value W(std::min(W0, W1)), plain(0);
+  for (index_type k = 0; k < sig0.dimension; k++) {
+    Value d(sig0.centroid[k] - sig1.centroid[k]);
+    plain += d*d;
+  }
+  bound = std::max(bound, W * pairwise_distance.distance_from_plain(plain));
+
+  // transport of the projections, matching the normalized weights in sorted order
+  for (std::size_t p = 0; p < sig0.projections.size(); p++) {
+    const std::vector<std::pair<Value, index_type>> & proj0(sig0.projections[p]), & proj1(sig1.projections[p]);
+    std::size_t i(0), j(0);
+    Value r0(ev0.weights()[proj0[0].second] / W0), r1(ev1.weights()[proj1[0].second] / W1), cost(0);
+    while (true) {
+      Value f(std::min(r0, r1)), d(proj0[i].first - proj1[j].first);
+      cost += f * pairwise_distance.distance_from_plain(d*d);
+      r0 -= f;
+      r1 -= f;
+      if (r0 <= r1) {
+        if (++i == proj0.size()) break;
+        r0 = ev0.weights()[proj0[i].second] / W0;
+      }
+      else {
+        if (++j == proj1.size()) break;
+        r1 = ev1.weights()[proj1[j].second] / W1;
+      }
+    }
+    bound = std::max(bound, W * cost);
+  }
+
+  return bound;
+}
+
+// upper bound on the EMD between two events (preprocessed as they would be for it)
+template<class PairwiseDistance, class Event>
+typename Event::value_type emd_upper_bound(const PairwiseDistance & pairwise_distance,
+                                           const Event & ev0, const Event & ev1, bool norm) {
+
+  typedef typename Event::value_type Value;
+  typedef typename PairwiseDistance::ParticleIterator ParticleIterator;
+
+  Value W0(ev0.total_weight()), W1(ev1.total_weight());
+  Value extra(norm ? 0 : std::fabs(W1 - W0));
+  index_type n0(ev0.weights().size()), n1(ev1.weights().size());
+  if (n0 == 0 || n1 == 0)
+    return extra;
+
+  std::vector<ParticleIterator> ps0, ps1;
+  for (ParticleIterator p = ev0.particles().begin(), end = ev0.particles().end(); p != end; ++p)
+    ps0.push_back(p);
+  for (ParticleIterator p = ev1.particles().begin(), end = ev1.particles().end(); p != end; ++p)
+    ps1.push_back(p);
+
+  // north-west corner flow between the particles in the given orders, until one event runs out
+  std::vector<index_type> order0(n0), order1(n1);
+  auto corner_cost([&]() {
+    index_type i(0), j(0);
+    Value r0(ev0.weights()[order0[0]]), r1(ev1.weights()[order1[0]]), cost(0);
+    while (true) {
+      Value f(std::min(r0, r1));
+      cost += f * pairwise_distance.distance(ps0[order0[i]], ps1[order1[j]]);
+      r0 -= f;
+      r1 -= f;
+      if (r0 <= r1) {
+        if (++i == n0) break;
+        r0 = ev0.weights()[order0[i]];
+      }
+      else {
+        if (++j == n1) break;
+        r1 = ev1.weights()[order1[j]];
+      }
+    }
+    return cost;
+  });
+
+  const EventSignature<Value> & sig0(event_signature<PairwiseDistance>(ev0)),
+                              & sig1(event_signature<PairwiseDistance>(ev1));
+  if (sig0.dimension <= 0 || sig0.dimension != sig1.dimension) {
+    std::iota(order0.begin(), order0.end(), 0);
+    std::iota(order1.begin(), order1.end(), 0);
+    return corner_cost() + extra;
+  }
+
+  Value bound(0);
+  for (std::size_t p = 0; p < sig0.projections.size(); p++) {
+    for (index_type i = 0; i < n0; i++) order0[i] = sig0.projections[p][i].second;
+    for (index_type j = 0; j < n1; j++) order1[j] = sig1.projections[p][j].second;
+    Value cost(corner_cost());
+    if (p == 0 || cost < bound) bound = cost;
+  }
+
+  return bound + extra;
+}
+
+END_WASSERSTEIN_NAMESPACE
+
+#endif // WASSERSTEIN_BOUNDS_HH
@@ -0,0 +1,898 @@
+//------------------------------------------------------------------------
+// This file is part of Wasserstein, a C++ library with a Python wrapper
+// that computes the Wasserstein/EMD distance. If you use it for academic
+// research, please cite or acknowledge the following works:
+//
+//   - Komiske, Metodiev, Thaler (2019) arXiv:1902.02346
+//       https://doi.org/10.1103/PhysRevLett.123.041801
+//   - Komiske, Metodiev, Thaler (2020) arXiv:2004.04159
+//       https://doi.org/10.1007/JHEP07%282020%29006
+//   - Boneel, van de Panne, Paris, Heidrich (2011)
+//       https://doi.org/10.1145/2070781.2024192
+//   - LEMON graph library https://lemon.cs.elte.hu/trac/lemon
+//
+// Copyright (C) 2019-2022 Patrick T. Komiske III
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------
+
+/*  _____   _____   _____  _______            _   _   _____  ______
+ * |  __ \ |_   _| / ____||__   __|    /\    | \ | | / ____||  ____|
+ * | |  | |  | |  | (___     | |      /  \   |  \| || |     | |__
+ * | |  | |  | |   \___ \    | |     / /\ \  | . ` || |     |  __|
+ * | |__| | _| |_  ____) |   | |    / ____ \ | |\  || |____ | |____
+ * |_____/ |_____||_____/    |_|   /_/    \_\|_| \_| \_____||______|
+ */
+
+#ifndef WASSERSTEIN_DISTANCEKERNELS_HH
+#define WASSERSTEIN_DISTANCEKERNELS_HH
+
+// C++ standard library
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "EMDUtils.hh"
+#include "PricingKernels.hh"
+
+
+BEGIN_WASSERSTEIN_NAMESPACE
+
+//-----------------------------------------------------------------------------
+// Kernels for filling a row of ground distances
+//-----------------------------------------------------------------------------
+
+// A row kernel computes the distances from one particle p to all n particles of the
+// other event, whose coordinates are stored by column (coordinate d of particle j at
+// columns[d*n + j]). The plain distances are raised to the power beta and divided by
+// the matching power of R for beta 1 and 2; for any other beta they are stored as they
+// are and the power kernels below are applied to the row afterwards. The kernels use the
+// same operations in the same order as the scalar distances, and use the instructions of
+// default_pricing_kernel(). The euclidean kernels take the dimension as a template parameter
+// Dim, so that the loop over the coordinates is unrolled, with Dim = 0 looping over the
+// runtime dimension dim instead.
+
+// betas are classified once, when they are set: integer and half-integer betas raise the
+// plain distances to their powers with products and square roots, and any other beta with
+// an approximate exp and log
+enum class BetaClass : char {
+  General = 0,
+  One = 1,
+  Two = 2,
+  Integer = 3,
+  HalfInteger = 4
+};
+
+// The approximate power x^b = exp(b log(x)) splits x = m 2^e with m in [sqrt(1/2), sqrt(2)),
+// takes log(m) = 2 atanh((m - 1)/(m + 1)) from its series, and exp(y) = 2^n exp(f) with n the
+// nearest integer to y/log(2), where the product n log(2) is split in two parts so that f is
+// accurate, and exp(f) is taken from its series. The relative error of the result is a few
+// units in the last place of log(x) times |b log(x)|, so it is about 1e-15 for doubles and
+// 1e-7 for floats when x is within a few orders of magnitude of 1. Results are clamped to
+// exp(+-700) for doubles and exp(+-86) for floats, and zero for x = 0.
+
+// constants of the approximate power for each floating point type
+template<typename Value>
+struct PowerApproximation;
+
+template<>
+struct PowerApproximation<double> {
+  typedef std::uint64_t Bits;
+  static const int mantissa_bits = 52, exponent_bias = 1023, log_terms = 11, exp_terms = 13;
+  static double min_normal() { return 2.2250738585072014e-308; }
+  static double subnormal_scale() { return 18014398509481984.0; } // 2^54
+  static double subnormal_shift() { return 54; }
+  static double max_exponent() { return 700; }
+  static double sqrt2() { return 1.41421356237309504880; }
+  static double ln2_hi() { return 6.93147180369123816490e-01; }
+  static double ln2_lo() { return 1.90821492927058770002e-10; }
+  static double inv_ln2() { return 1.44269504088896338700e+00; }
+};
+
+template<>
+struct PowerApproximation<float> {
+  typedef std::uint32_t Bits;
+  static const int mantissa_bits = 23, exponent_bias = 127, log_terms = 5, exp_terms = 7;
+  static float min_normal() { return 1.17549435e-38f; }
+  static float subnormal_scale() { return 33554432.0f; } // 2^25
+  static float subnormal_shift() { return 25; }
+  static float max_exponent() { return 86; }
+  static float sqrt2() { return 1.41421356f; }
+  static float ln2_hi() { return 6.9314575195e-01f; }
+  static float ln2_lo() { return 1.4286067653e-06f; }
+  static float inv_ln2() { return 1.4426950216e+00f; }
+};
+
+// the coefficients 1/k! of the series of exp(f) in f, exp_terms + 1 of them
+template<typename Value>
+inline void fill_exp_series(Value * exp_series) {
+  double inverse_factorial(1);
+  for (int k = 0; k <= PowerApproximation<Value>::exp_terms; k++) {
+    exp_series[k] = Value(inverse_factorial);
+    inverse_factorial /= k + 1;
+  }
+}
+
+// how the plain distances divided by R^2, x, are raised to the power beta/2: for the
+// (half-)integer classes, the product of whole factors of x, a factor of sqrt(x) if odd,
+// and a factor of x^(1/4) for half-integers
+template<typename Value>
+struct BetaPower {
+  BetaClass beta_class;
+  int whole;
+  bool odd;
+  Value halfbeta;
+
+  // coefficients of the series of atanh(s)/s in s^2 and of exp(f) in f, for the approximate power
+  Value log_series[PowerApproximation<Value>::log_terms], exp_series[PowerApproximation<Value>::exp_terms + 1];
+
+  BetaPower() : BetaPower(1) {}
+  BetaPower(Value beta) : beta_class(BetaClass::General), whole(0), odd(false), halfbeta(beta/2) {
+    for (int k = 0; k < PowerApproximation<Value>::log_terms; k++)
+      log_series[k] = Value(1)/Value(2*k + 1);
+    fill_exp_series(exp_series);
+
+    if (beta == 1) beta_class = BetaClass::One;
+    else if (beta == 2) beta_class = BetaClass::Two;
+
+    // larger betas would take too many products
+    else if (2*beta == std::floor(2*beta) && beta >= 0 && beta <= 64) {
+      int integer_part(static_cast<int>(beta));
+      beta_class = (beta == integer_part ? BetaClass::Integer : BetaClass::HalfInteger);
+      whole = integer_part/2;
+      odd = integer_part % 2;
+    }
+  }
+};
+
+// distance in phi accounting for periodicity, without the branches of fmod
+template<typename Value>
+inline Value periodic_dphi(Value absdphi) {
+  Value wrapped(absdphi - Value(TWOPI) * std::floor(absdphi * Value(1/TWOPI)));
+  return Value(PI) - std::fabs(wrapped - Value(PI));
+}
+
+template<typename Value>
+inline Value ground_from_plain(Value pd, BetaClass beta, Value denom) {
+  if (beta == BetaClass::One) return std::sqrt(pd)/denom;
+  if (beta == BetaClass::Two) return pd/denom;
+  return pd;
+}
+
+// x = m 2^e with m in [1, 2), for positive normal x
+template<typename Value>
+inline Value split_exponent(Value x, Value & e) {
+  typedef PowerApproximation<Value> A;
+  typename A::Bits bits;
+  std::memcpy(&bits, &x, sizeof(x));
+  e = Value(bits >> A::mantissa_bits) - Value(A::exponent_bias);
+  bits = (bits & ((typename A::Bits(1) << A::mantissa_bits) - 1)) |
+         (typename A::Bits(A::exponent_bias) << A::mantissa_bits);
+  std::memcpy(&x, &bits, sizeof(x));
+  return x;
+}
+
+// 2^n for integer n in the range of normal numbers
+template<typename Value>
+inline Value exp2_integer(Value n) {
+  typedef PowerApproximation<Value> A;
+  typename A::Bits bits(typename A::Bits(std::int64_t(n) + A::exponent_bias) << A::mantissa_bits);
+  Value x;
+  std::memcpy(&x, &bits, sizeof(x));
+  return x;
+}
+
+// the exp of the approximate power, clamped to exp(+-max_exponent)
+template<typename Value>
+inline Value approximate_exp(Value y, const Value * exp_series) {
+  typedef PowerApproximation<Value> A;
+  y = std::min(std::max(y, -A::max_exponent()), A::max_exponent());
+
+  Value n(std::floor(y*A::inv_ln2() + Value(0.5)));
+  Value f((y - n*A::ln2_hi()) - n*A::ln2_lo()), q(exp_series[A::exp_terms]);
+  for (int k = A::exp_terms - 1; k >= 0; k--)
+    q = q*f + exp_series[k];
+  return q * exp2_integer(n);
+}
+
+template<typename Value>
+inline Value approximate_power(Value x, const BetaPower<Value> & power) {
+  typedef PowerApproximation<Value> A;
+
+  // subnormals are scaled up before splitting off the exponent
+  Value e, m(split_exponent(x < A::min_normal() ? x * A::subnormal_scale() : x, e));
+  e = e - (x < A::min_normal() ? A::subnormal_shift() : Value(0));
+  e = A::sqrt2() < m ? e + Value(1) : e;
+  m = A::sqrt2() < m ? m * Value(0.5) : m;
+
+  Value s((m - Value(1))/(m + Value(1))), s2(s*s), p(power.log_series[A::log_terms - 1]);
+  for (int k = A::log_terms - 2; k >= 0; k--)
+    p = p*s2 + power.log_series[k];
+  Value y(power.halfbeta * (e*A::ln2_hi() + (e*A::ln2_lo() + Value(2)*s*p)));
+  return Value(0) < x ? approximate_exp(y, power.exp_series) : Value(0);
+}
+
+// x^(beta/2) for a beta of class C
+template<BetaClass C, typename Value>
+inline Value beta_power(Value x, const BetaPower<Value> & power) {
+  if (C == BetaClass::General) return approximate_power(x, power);
+  if (C == BetaClass::One) return std::sqrt(x);
+  if (C == BetaClass::Two) return x;
+  Value y(1);
+  for (int i = 0; i < power.whole; i++)
+    y *= x;
+  if (power.odd) y *= std::sqrt(x);
+  if (C == BetaClass::HalfInteger) y *= std::sqrt(std::sqrt(x));
+  return y;
+}
+
+template<typename Value>
+inline Value beta_power(Value x, const BetaPower<Value> & power) {
+  switch (power.beta_class) {
+    case BetaClass::One: return beta_power<BetaClass::One>(x, power);
+    case BetaClass::Two: return beta_power<BetaClass::Two>(x, power);
+    case BetaClass::Integer: return beta_power<BetaClass::Integer>(x, power);
+    case BetaClass::HalfInteger: return beta_power<BetaClass::HalfInteger>(x, power);
+    default: return beta_power<BetaClass::General>(x, power);
+  }
+}
+
+// stores the coordinates of n particles of dimension dim by column
+template<typename Value>
+inline void transpose_particles(const Value * ps, index_type n, index_type dim, std::vector<Value> & columns) {
+  columns.resize(std::size_t(n) * dim);
+  for (index_type j = 0; j < n; j++)
+    for (index_type d = 0; d < dim; d++)
+      columns[std::size_t(d) * n + j] = ps[std::size_t(j) * dim + d];
+}
+
+// plain euclidean distance between two particles
+template<int Dim, typename Value>
+inline Value euclidean_plain_distance(const Value * p0, const Value * p1, index_type dim) {
+  Value d(0);
+  for (index_type k = 0, end = (Dim > 0 ? Dim : dim); k < end; k++) {
+    Value dx(p0[k] - p1[k]);
+    d += dx*dx;
+  }
+  return d;
+}
+
+// the same for a runtime dimension, unrolled for dimensions 1 to 8
+template<typename Value>
+inline Value euclidean_plain_distance(const Value * p0, const Value * p1, index_type dim) {
+  switch (dim) {
+    case 1: return euclidean_plain_distance<1>(p0, p1, dim);
+    case 2: return euclidean_plain_distance<2>(p0, p1, dim);
+    case 3: return euclidean_plain_distance<3>(p0, p1, dim);
+    case 4: return euclidean_plain_distance<4>(p0, p1, dim);
+    case 5: return euclidean_plain_distance<5>(p0, p1, dim);
+    case 6: return euclidean_plain_distance<6>(p0, p1, dim);
+    case 7: return euclidean_plain_distance<7>(p0, p1, dim);
+    case 8: return euclidean_plain_distance<8>(p0, p1, dim);
+    default: return euclidean_plain_distance<0>(p0, p1, dim);
+  }
+}
+
+template<int Dim, typename Value>
+inline void euclidean_row_scalar(const Value * p, const Value * columns, index_type dim, index_type n,
+                                 index_type first, BetaClass beta, Value denom, Value * row) {
+  if (Dim > 0) dim = Dim;
+  for (index_type j = first; j < n; j++) {
+    Value d(0);
+    for (index_type k = 0; k < dim; k++) {
+      Value dx(p[k] - columns[std::size_t(k) * n + j]);
+      d += dx*dx;
+    }
+    row[j] = ground_from_plain(d, beta, denom);
+  }
+}
+
+template<typename Value>
+inline void yphi_row_scalar(const Value * p, const Value * columns, index_type n,
+                            index_type first, BetaClass beta, Value denom, Value * row) {
+  for (index_type j = first; j < n; j++) {
+    Value dy(p[0] - columns[j]), dphi(periodic_dphi(std::fabs(p[1] - columns[n + j])));
+    row[j] = ground_from_plain(dy*dy + dphi*dphi, beta, denom);
+  }
+}
+
+// types without vectorized kernels leave the whole row to the scalar ones
+template<typename Value>
+struct DistanceRowKernels {
+  template<int Dim>
+  static index_type euclidean(const Value *, const Value *, index_type, index_type,
+                              BetaClass, Value, Value *) { return 0; }
+  static index_type yphi(const Value *, const Value *, index_type, BetaClass, Value, Value *) { return 0; }
+  template<BetaClass C>
+  static index_type power(Value *, index_type, Value, const BetaPower<Value> &) { return 0; }
+  static index_type exp(Value, const Value *, const Value *, Value, index_type, const Value *, Value *) { return 0; }
+};
+
+#ifdef WASSERSTEIN_SIMD_PRICING
+
+// The vector types provide the few operations needed by the kernels below. Each kernel
+// fills the longest prefix of the row that is a whole number of vectors and returns its
+// length, the remainder is filled by the scalar kernel.
+
+struct AVX2Doubles {
+  typedef double value_type;
+  typedef __m256d vector_type;
+  static const index_type width = 4;
+  __attribute__((target("avx2"))) static __m256d set1(double x) { return _mm256_set1_pd(x); }
+  __attribute__((target("avx2"))) static __m256d load(const double * x) { return _mm256_loadu_pd(x); }
+  __attribute__((target("avx2"))) static void store(double * x, __m256d v) { _mm256_storeu_pd(x, v); }
+  __attribute__((target("avx2"))) static __m256d add(__m256d a, __m256d b) { return _mm256_add_pd(a, b); }
+  __attribute__((target("avx2"))) static __m256d sub(__m256d a, __m256d b) { return _mm256_sub_pd(a, b); }
+  __attribute__((target("avx2"))) static __m256d mul(__m256d a, __m256d b) { return _mm256_mul_pd(a, b); }
+  __attribute__((target("avx2"))) static __m256d div(__m256d a, __m256d b) { return _mm256_div_pd(a, b); }
+  __attribute__((target("avx2"))) static __m256d sqrt(__m256d a) { return _mm256_sqrt_pd(a); }
+  __attribute__((target("avx2"))) static __m256d floor(__m256d a) { return _mm256_floor_pd(a); }
+  __attribute__((target("avx2"))) static __m256d abs(__m256d a) { return _mm256_andnot_pd(_mm256_set1_pd(-0.0), a); }
+  __attribute__((target("avx2"))) static __m256d min(__m256d a, __m256d b) { return _mm256_min_pd(a, b); }
+  __attribute__((target("avx2"))) static __m256d max(__m256d a, __m256d b) { return _mm256_max_pd(a, b); }
+
+  // a < b ? x : y
+  __attribute__((target("avx2"))) static __m256d select_lt(__m256d a, __m256d b, __m256d x, __m256d y) {
+    return _mm256_blendv_pd(y, x, _mm256_cmp_pd(a, b, _CMP_LT_OQ));
+  }
+
+  // as split_exponent, with the exponent converted by placing it in the mantissa of 2^52
+  __attribute__((target("avx2"))) static __m256d split_exponent(__m256d x, __m256d & e) {
+    __m256i bits(_mm256_castpd_si256(x));
+    __m256d magic(_mm256_set1_pd(4503599627370496.0));
+    __m256i exponent(_mm256_or_si256(_mm256_srli_epi64(bits, 52), _mm256_castpd_si256(magic))),
+            mantissa(_mm256_and_si256(bits, _mm256_set1_epi64x(0x000fffffffffffff)));
+    e = _mm256_sub_pd(_mm256_sub_pd(_mm256_castsi256_pd(exponent), magic), _mm256_set1_pd(1023));
+    return _mm256_castsi256_pd(_mm256_or_si256(mantissa, _mm256_set1_epi64x(0x3ff0000000000000)));
+  }
+
+  // as exp2_integer, with n + bias placed in the mantissa of 2^52 and shifted into the exponent
+  __attribute__((target("avx2"))) static __m256d exp2_integer(__m256d n) {
+    __m256d shifted(_mm256_add_pd(n, _mm256_set1_pd(4503599627370496.0 + 1023)));
+    return _mm256_castsi256_pd(_mm256_slli_epi64(_mm256_castpd_si256(shifted), 52));
+  }
+};
+
+struct AVX2Floats {
+  typedef float value_type;
+  typedef __m256 vector_type;
+  static const index_type width = 8;
+  __attribute__((target("avx2"))) static __m256 set1(float x) { return _mm256_set1_ps(x); }
+  __attribute__((target("avx2"))) static __m256 load(const float * x) { return _mm256_loadu_ps(x); }
+  __attribute__((target("avx2"))) static void store(float * x, __m256 v) { _mm256_storeu_ps(x, v); }
+  __attribute__((target("avx2"))) static __m256 add(__m256 a, __m256 b) { return _mm256_add_ps(a, b); }
+  __attribute__((target("avx2"))) static __m256 sub(__m256 a, __m256 b) { return _mm256_sub_ps(a, b); }
+  __attribute__((target("avx2"))) static __m256 mul(__m256 a, __m256 b) { return _mm256_mul_ps(a, b); }
+  __attribute__((target("avx2"))) static __m256 div(__m256 a, __m256 b) { return _mm256_div_ps(a, b); }
+  __attribute__((target("avx2"))) static __m256 sqrt(__m256 a) { return _mm256_sqrt_ps(a); }
+  __attribute__((target("avx2"))) static __m256 floor(__m256 a) { return _mm256_floor_ps(a); }
+  __attribute__((target("avx2"))) static __m256 abs(__m256 a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+  __attribute__((target("avx2"))) static __m256 min(__m256 a, __m256 b) { return _mm256_min_ps(a, b); }
+  __attribute__((target("avx2"))) static __m256 max(__m256 a, __m256 b) { return _mm256_max_ps(a, b); }
+
+  // a < b ? x : y
+  __attribute__((target("avx2"))) static __m256 select_lt(__m256 a, __m256 b, __m256 x, __m256 y) {
+    return _mm256_blendv_ps(y, x, _mm256_cmp_ps(a, b, _CMP_LT_OQ));
+  }
+
+  // as split_exponent, with the exponent converted by placing it in the mantissa of 2^23
+  __attribute__((target("avx2"))) static __m256 split_exponent(__m256 x, __m256 & e) {
+    __m256i bits(_mm256_castps_si256(x));
+    __m256 magic(_mm256_set1_ps(8388608.0f));
+    __m256i exponent(_mm256_or_si256(_mm256_srli_epi32(bits, 23), _mm256_castps_si256(magic))),
+            mantissa(_mm256_and_si256(bits, _mm256_set1_epi32(0x007fffff)));
+    e = _mm256_sub_ps(_mm256_sub_ps(_mm256_castsi256_ps(exponent), magic), _mm256_set1_ps(127));
+    return _mm256_castsi256_ps(_mm256_or_si256(mantissa, _mm256_set1_epi32(0x3f800000)));
+  }
+
+  // as exp2_integer, with n + bias placed in the mantissa of 2^23 and shifted into the exponent
+  __attribute__((target("avx2"))) static __m256 exp2_integer(__m256 n) {
+    __m256 shifted(_mm256_add_ps(n, _mm256_set1_ps(8388608.0f + 127)));
+    return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_castps_si256(shifted), 23));
+  }
+};
+
+template<class V>
+__attribute__((target("avx2")))
+inline typename V::vector_type ground_from_plain_avx2(typename V::vector_type pd, BetaClass beta,
+                                                      typename V::vector_type denom) {
+  if (beta == BetaClass::One) return V::div(V::sqrt(pd), denom);
+  if (beta == BetaClass::Two) return V::div(pd, denom);
+  return pd;
+}
+
+// as approximate_exp
+template<class V>
+__attribute__((target("avx2")))
+inline typename V::vector_type approximate_exp_avx2(typename V::vector_type y,
+                                                 const typename V::value_type * exp_series) {
+  typedef typename V::value_type Value;
+  typedef typename V::vector_type Vec;
+  typedef PowerApproximation<Value> A;
+  y = V::min(V::max(y, V::set1(-A::max_exponent())), V::set1(A::max_exponent()));
+
+  Vec n(V::floor(V::add(V::mul(y, V::set1(A::inv_ln2())), V::set1(Value(0.5)))));
+  Vec f(V::sub(V::sub(y, V::mul(n, V::set1(A::ln2_hi()))), V::mul(n, V::set1(A::ln2_lo()))));
+  Vec q(V::set1(exp_series[A::exp_terms]));
+  for (int k = A::exp_terms - 1; k >= 0; k--)
+    q = V::add(V::mul(q, f), V::set1(exp_series[k]));
+  return V::mul(q, V::exp2_integer(n));
+}
+
+// as approximate_power
+template<class V>
+__attribute__((target("avx2")))
+inline typename V::vector_type approximate_power_avx2(typename V::vector_type x,
+                                                      const BetaPower<typename V::value_type> & power) {
+  typedef typename V::value_type Value;
+  typedef typename V::vector_type Vec;
+  typedef PowerApproximation<Value> A;
+
+  Vec zero(V::set1(0)), one(V::set1(1)), sqrt2(V::set1(A::sqrt2())), min_normal(V::set1(A::min_normal())), e;
+  Vec m(V::split_exponent(V::select_lt(x, min_normal, V::mul(x, V::set1(A::subnormal_scale())), x), e));
+  e = V::sub(e, V::select_lt(x, min_normal, V::set1(A::subnormal_shift()), zero));
+  e = V::select_lt(sqrt2, m, V::add(e, one), e);
+  m = V::select_lt(sqrt2, m, V::mul(m, V::set1(Value(0.5))), m);
+
+  Vec s(V::div(V::sub(m, one), V::add(m, one))), s2(V::mul(s, s)), p(V::set1(power.log_series[A::log_terms - 1]));
+  for (int k = A::log_terms - 2; k >= 0; k--)
+    p = V::add(V::mul(p, s2), V::set1(power.log_series[k]));
+  Vec y(V::mul(V::set1(power.halfbeta), V::add(V::mul(e, V::set1(A::ln2_hi())),
+                                V::add(V::mul(e, V::set1(A::ln2_lo())), V::mul(V::mul(V::set1(Value(2)), s), p)))));
+  return V::select_lt(zero, x, approximate_exp_avx2<V>(y, power.exp_series), zero);
+}
+
+// as approximate_exp on a row, row[j] = exp((shift + adds[j] - subs[j]) * scale)
+template<class V>
+__attribute__((target("avx2")))
+inline index_type exp_row_avx2(typename V::value_type shift, const typename V::value_type * adds,
+                              const typename V::value_type * subs, typename V::value_type scale, index_type n,
+                              const typename V::value_type * exp_series, typename V::value_type * row) {
+  typedef typename V::vector_type Vec;
+  index_type nv(n - n % V::width);
+  Vec vshift(V::set1(shift)), vscale(V::set1(scale));
+  for (index_type j = 0; j < nv; j += V::width) {
+    Vec y(V::mul(V::sub(V::add(vshift, V::load(adds + j)), V::load(subs + j)), vscale));
+    V::store(row + j, approximate_exp_avx2<V>(y, exp_series));
+  }
+  return nv;
+}
+
+// as beta_power on a row divided by denom, for the (half-)integer and general classes
+template<class V, BetaClass C>
+__attribute__((target("avx2")))
+inline index_type power_row_avx2(typename V::value_type * row, index_type n, typename V::value_type denom,
+                                  const BetaPower<typename V::value_type> & power) {
+  typedef typename V::vector_type Vec;
+  index_type nv(n - n % V::width);
+  Vec vdenom(V::set1(denom));
+  for (index_type j = 0; j < nv; j += V::width) {
+    Vec x(V::div(V::load(row + j), vdenom)), y(V::set1(1));
+    if (C == BetaClass::General)
+      y = approximate_power_avx2<V>(x, power);
+    else {
+      for (int i = 0; i < power.whole; i++)
+        y = V::mul(y, x);
+      if (power.odd) y = V::mul(y, V::sqrt(x));
+      if (C == BetaClass::HalfInteger) y = V::mul(y, V::sqrt(V::sqrt(x)));
+    }
+    V::store(row + j, y);
+  }
+  return nv;
+}
+
+template<class V, int Dim>
+__attribute__((target("avx2")))
+inline index_type euclidean_row_avx2(const typename V::value_type * p, const typename V::value_type * columns,
+                                     index_type dim, index_type n, BetaClass beta,
+                                     typename V::value_type denom, typename V::value_type * row) {
+  typedef typename V::vector_type Vec;
+  index_type nv(n - n % V::width);
+  Vec vdenom(V::set1(denom));
+  if (Dim > 0) dim = Dim;
+  for (index_type j = 0; j < nv; j += V::width) {
+    Vec d(V::set1(0));
+    for (index_type k = 0; k < dim; k++) {
+      Vec dx(V::sub(V::set1(p[k]), V::load(columns + std::size_t(k) * n + j)));
+      d = V::add(d, V::mul(dx, dx));
+    }
+    V::store(row + j, ground_from_plain_avx2<V>(d, beta, vdenom));
+  }
+  return nv;
+}
+
+template<class V>
+__attribute__((target("avx2")))
+inline index_type yphi_row_avx2(const typename V::value_type * p, const typename V::value_type * columns,
+                                index_type n, BetaClass beta,
+                                typename V::value_type denom, typename V::value_type * row) {
+  typedef typename V::value_type Value;
+  typedef typename V::vector_type Vec;
+  index_type nv(n - n % V::width);
+  Vec vdenom(V::set1(denom)), y(V::set1(p[0])), phi(V::set1(p[1])),
+      pi(V::set1(Value(PI))), twopi(V::set1(Value(TWOPI))), inv_twopi(V::set1(Value(1/TWOPI)));
+  for (index_type j = 0; j < nv; j += V::width) {
+    Vec dy(V::sub(y, V::load(columns + j))), absdphi(V::abs(V::sub(phi, V::load(columns + n + j))));
+    Vec wrapped(V::sub(absdphi, V::mul(twopi, V::floor(V::mul(absdphi, inv_twopi)))));
+    Vec dphi(V::sub(pi, V::abs(V::sub(wrapped, pi))));
+    V::store(row + j, ground_from_plain_avx2<V>(V::add(V::mul(dy, dy), V::mul(dphi, dphi)), beta, vdenom));
+  }
+  return nv;
+}
+
+// GCC's AVX-512 intrinsics trigger spurious -Wmaybe-uninitialized warnings (GCC bug 105593)
+#if defined(__GNUC__) && !defined(__clang__)
+# pragma GCC diagnostic push
+# pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+// AVX-512 has fused multiply-adds, which the compiler would form from the products and sums
+// below, so the products are made with an explicit rounding to keep them separate as in the
+// scalar distances
+
+struct AVX512Doubles {
+  typedef double value_type;
+  typedef __m512d vector_type;
+  static const index_type width = 8;
+  __attribute__((target("avx512f"))) static __m512d set1(double x) { return _mm512_set1_pd(x); }
+  __attribute__((target("avx512f"))) static __m512d load(const double * x) { return _mm512_loadu_pd(x); }
+  __attribute__((target("avx512f"))) static void store(double * x, __m512d v) { _mm512_storeu_pd(x, v); }
+  __attribute__((target("avx512f"))) static __m512d add(__m512d a, __m512d b) { return _mm512_add_pd(a, b); }
+  __attribute__((target("avx512f"))) static __m512d sub(__m512d a, __m512d b) { return _mm512_sub_pd(a, b); }
+  __attribute__((target("avx512f"))) static __m512d mul(__m512d a, __m512d b) {
+    return _mm512_mul_round_pd(a, b, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+  }
+  __attribute__((target("avx512f"))) static __m512d div(__m512d a, __m512d b) { return _mm512_div_pd(a, b); }
+  __attribute__((target("avx512f"))) static __m512d sqrt(__m512d a) { return _mm512_sqrt_pd(a); }
+  __attribute__((target("avx512f"))) static __m512d floor(__m512d a) {
+    return _mm512_roundscale_pd(a, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+  }
+  __attribute__((target("avx512f"))) static __m512d abs(__m512d a) { return _mm512_abs_pd(a); }
+  __attribute__((target("avx512f"))) static __m512d min(__m512d a, __m512d b) { return _mm512_min_pd(a, b); }
+  __attribute__((target("avx512f"))) static __m512d max(__m512d a, __m512d b) { return _mm512_max_pd(a, b); }
+
+  // a < b ? x : y
+  __attribute__((target("avx512f"))) static __m512d select_lt(__m512d a, __m512d b, __m512d x, __m512d y) {
+    return _mm512_mask_blend_pd(_mm512_cmp_pd_mask(a, b, _CMP_LT_OQ), y, x);
+  }
+
+  // as split_exponent, with the exponent converted by placing it in the mantissa of 2^52
+  __attribute__((target("avx512f"))) static __m512d split_exponent(__m512d x, __m512d & e) {
+    __m512i bits(_mm512_castpd_si512(x));
+    __m512d magic(_mm512_set1_pd(4503599627370496.0));
+    __m512i exponent(_mm512_or_si512(_mm512_srli_epi64(bits, 52), _mm512_castpd_si512(magic))),
+            mantissa(_mm512_and_si512(bits, _mm512_set1_epi64(0x000fffffffffffff)));
+    e = _mm512_sub_pd(_mm512_sub_pd(_mm512_castsi512_pd(exponent), magic), _mm512_set1_pd(1023));
+    return _mm512_castsi512_pd(_mm512_or_si512(mantissa, _mm512_set1_epi64(0x3ff0000000000000)));
+  }
+
+  // as exp2_integer, with n + bias placed in the mantissa of 2^52 and shifted into the exponent
+  __attribute__((target("avx512f"))) static __m512d exp2_integer(__m512d n) {
+    __m512d shifted(_mm512_add_pd(n, _mm512_set1_pd(4503599627370496.0 + 1023)));
+    return _mm512_castsi512_pd(_mm512_slli_epi64(_mm512_castpd_si512(shifted), 52));
+  }
+};
+
+struct AVX512Floats {
+  typedef float value_type;
+  typedef __m512 vector_type;
+  static const index_type width = 16;
+  __attribute__((target("avx512f"))) static __m512 set1(float x) { return _mm512_set1_ps(x); }
+  __attribute__((target("avx512f"))) static __m512 load(const float * x) { return _mm512_loadu_ps(x); }
+  __attribute__((target("avx512f"))) static void store(float * x, __m512 v) { _mm512_storeu_ps(x, v); }
+  __attribute__((target("avx512f"))) static __m512 add(__m512 a, __m512 b) { return _mm512_add_ps(a, b); }
+  __attribute__((target("avx512f"))) static __m512 sub(__m512 a, __m512 b) { return _mm512_sub_ps(a, b); }
+  __attribute__((target("avx512f"))) static __m512 mul(__m512 a, __m512 b) {
+    return _mm512_mul_round_ps(a, b, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+  }
+  __attribute__((target("avx512f"))) static __m512 div(__m512 a, __m512 b) { return _mm512_div_ps(a, b); }
+  __attribute__((target("avx512f"))) static __m512 sqrt(__m512 a) { return _mm512_sqrt_ps(a); }
+  __attribute__((target("avx512f"))) static __m512 floor(__m512 a) {
+    return _mm512_roundscale_ps(a, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+  }
+  __attribute__((target("avx512f"))) static __m512 abs(__m512 a) { return _mm512_abs_ps(a); }
+  __attribute__((target("avx512f"))) static __m512 min(__m512 a, __m512 b) { return _mm512_min_ps(a, b); }
+  __attribute__((target("avx512f"))) static __m512 max(__m512 a, __m512 b) { return _mm512_max_ps(a, b); }
+
+  // a < b ? x : y
+  __attribute__((target("avx512f"))) static __m512 select_lt(__m512 a, __m512 b, __m512 x, __m512 y) {
+    return _mm512_mask_blend_ps(_mm512_cmp_ps_mask(a, b, _CMP_LT_OQ), y, x);
+  }
+
+  // as split_exponent, with the exponent converted by placing it in the mantissa of 2^23
+  __attribute__((target("avx512f"))) static __m512 split_exponent(__m512 x, __m512 & e) {
+    __m512i bits(_mm512_castps_si512(x));
+    __m512 magic(_mm512_set1_ps(8388608.0f));
+    __m512i exponent(_mm512_or_si512(_mm512_srli_epi32(bits, 23), _mm512_castps_si512(magic))),
+            mantissa(_mm512_and_si512(bits, _mm512_set1_epi32(0x007fffff)));
+    e = _mm512_sub_ps(_mm512_sub_ps(_mm512_castsi512_ps(exponent), magic), _mm512_set1_ps(127));
+    return _mm512_castsi512_ps(_mm512_or_si512(mantissa, _mm512_set1_epi32(0x3f800000)));
+  }
+
+  // as exp2_integer, with n + bias placed in the mantissa of 2^23 and shifted into the exponent
+  __attribute__((target("avx512f"))) static __m512 exp2_integer(__m512 n) {
+    __m512 shifted(_mm512_add_ps(n, _mm512_set1_ps(8388608.0f + 127)));
+    return _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_castps_si512(shifted), 23));
+  }
+};
+
+template<class V>
+__attribute__((target("avx512f")))
+inline typename V::vector_type ground_from_plain_avx512(typename V::vector_type pd, BetaClass beta,
+                                                        typename V::vector_type denom) {
+  if (beta == BetaClass::One) return V::div(V::sqrt(pd), denom);
+  if (beta == BetaClass::Two) return V::div(pd, denom);
+  return pd;
+}
+
+// as approximate_exp
+template<class V>
+__attribute__((target("avx512f")))
+inline typename V::vector_type approximate_exp_avx512(typename V::vector_type y,
+                                                 const typename V::value_type * exp_series) {
+  typedef typename V::value_type Value;
+  typedef typename V::vector_type Vec;
+  typedef PowerApproximation<Value> A;
+  y = V::min(V::max(y, V::set1(-A::max_exponent())), V::set1(A::max_exponent()));
+
+  Vec n(V::floor(V::add(V::mul(y, V::set1(A::inv_ln2())), V::set1(Value(0.5)))));
+  Vec f(V::sub(V::sub(y, V::mul(n, V::set1(A::ln2_hi()))), V::mul(n, V::set1(A::ln2_lo()))));
+  Vec q(V::set1(exp_series[A::exp_terms]));
+  for (int k = A::exp_terms - 1; k >= 0; k--)
+    q = V::add(V::mul(q, f), V::set1(exp_series[k]));
+  return V::mul(q, V::exp2_integer(n));
+}
+
+// as approximate_power
+template<class V>
+__attribute__((target("avx512f")))
+inline typename V::vector_type approximate_power_avx512(typename V::vector_type x,
+                                                        const BetaPower<typename V::value_type> & power) {
+  typedef typename V::value_type Value;
+  typedef typename V::vector_type Vec;
+  typedef PowerApproximation<Value> A;
+
+  Vec zero(V::set1(0)), one(V::set1(1)), sqrt2(V::set1(A::sqrt2())), min_normal(V::set1(A::min_normal())), e;
+  Vec m(V::split_exponent(V::select_lt(x, min_normal, V::mul(x, V::set1(A::subnormal_scale())), x), e));
+  e = V::sub(e, V::select_lt(x, min_normal, V::set1(A::subnormal_shift()), zero));
+  e = V::select_lt(sqrt2, m, V::add(e, one), e);
+  m = V::select_lt(sqrt2, m, V::mul(m, V::set1(Value(0.5))), m);
+
+  Vec s(V::div(V::sub(m, one), V::add(m, one))), s2(V::mul(s, s)), p(V::set1(power.log_series[A::log_terms - 1]));
+  for (int k = A::log_terms - 2; k >= 0; k--)
+    p = V::add(V::mul(p, s2), V::set1(power.log_series[k]));
+  Vec y(V::mul(V::set1(power.halfbeta), V::add(V::mul(e, V::set1(A::ln2_hi())),
+                                V::add(V::mul(e, V::set1(A::ln2_lo())), V::mul(V::mul(V::set1(Value(2)), s), p)))));
+  return V::select_lt(zero, x, approximate_exp_avx512<V>(y, power.exp_series), zero);
+}
+
+// as approximate_exp on a row, row[j] = exp((shift + adds[j] - subs[j]) * scale)
+template<class V>
+__attribute__((target("avx512f")))
+inline index_type exp_row_avx512(typename V::value_type shift, const typename V::value_type * adds,
+                              const typename V::value_type * subs, typename V::value_type scale, index_type n,
+                              const typename V::value_type * exp_series, typename V::value_type * row) {
+  typedef typename V::vector_type Vec;
+  index_type nv(n - n % V::width);
+  Vec vshift(V::set1(shift)), vscale(V::set1(scale));
+  for (index_type j = 0; j < nv; j += V::width) {
+    Vec y(V::mul(V::sub(V::add(vshift, V::load(adds + j)), V::load(subs + j)), vscale));
+    V::store(row + j, approximate_exp_avx512<V>(y, exp_series));
+  }
+  return nv;
+}
+
+// as beta_power on a row divided by denom, for the (half-)integer and general classes
+template<class V, BetaClass C>
+__attribute__((target("avx512f")))
+inline index_type power_row_avx512(typename V::value_type * row, index_type n, typename V::value_type denom,
+                                    const BetaPower<typename V::value_type> & power) {
+  typedef typename V::vector_type Vec;
+  index_type nv(n - n % V::width);
+  Vec vdenom(V::set1(denom));
+  for (index_type j = 0; j < nv; j += V::width) {
+    Vec x(V::div(V::load(row + j), vdenom)), y(V::set1(1));
+    if (C == BetaClass::General)
+      y = approximate_power_avx512<V>(x, power);
+    else {
+      for (int i = 0; i < power.whole; i++)
+        y = V::mul(y, x);
+      if (power.odd) y = V::mul(y, V::sqrt(x));
+      if (C == BetaClass::HalfInteger) y = V::mul(y, V::sqrt(V::sqrt(x)));
+    }
+    V::store(row + j, y);
+  }
+  return nv;
+}
+
+template<class V, int Dim>
+__attribute__((target("avx512f")))
+inline index_type euclidean_row_avx512(const typename V::value_type * p, const typename V::value_type * columns,
+                                       index_type dim, index_type n, BetaClass beta,
+                                       typename V::value_type denom, typename V::value_type * row) {
+  typedef typename V::vector_type Vec;
+  index_type nv(n - n % V::width);
+  Vec vdenom(V::set1(denom));
+  if (Dim > 0) dim = Dim;
+  for (index_type j = 0; j < nv; j += V::width) {
+    Vec d(V::set1(0));
+    for (index_type k = 0; k < dim; k++) {
+      Vec dx(V::sub(V::set1(p[k]), V::load(columns + std::size_t(k) * n + j)));
+      d = V::add(d, V::mul(dx, dx));
+    }
+    V::store(row + j, ground_from_plain_avx512<V>(d, beta, vdenom));
+  }
+  return nv;
+}
+
+template<class V>
+__attribute__((target("avx512f")))
+inline index_type yphi_row_avx512(const typename V::value_type * p, const typename V::value_type * columns,
+                                  index_type n, BetaClass beta,
+                                  typename V::value_type denom, typename V::value_type * row) {
+  typedef typename V::value_type Value;
+  typedef typename V::vector_type Vec;
+  index_type nv(n - n % V::width);
+  Vec vdenom(V::set1(denom)), y(V::set1(p[0])), phi(V::set1(p[1])),
+      pi(V::set1(Value(PI))), twopi(V::set1(Value(TWOPI))), inv_twopi(V::set1(Value(1/TWOPI)));
+  for (index_type j = 0; j < nv; j += V::width) {
+    Vec dy(V::sub(y, V::load(columns + j))), absdphi(V::abs(V::sub(phi, V::load(columns + n + j))));
+    Vec wrapped(V::sub(absdphi, V::mul(twopi, V::floor(V::mul(absdphi, inv_twopi)))));
+    Vec dphi(V::sub(pi, V::abs(V::sub(wrapped, pi))));
+    V::store(row + j, ground_from_plain_avx512<V>(V::add(V::mul(dy, dy), V::mul(dphi, dphi)), beta, vdenom));
+  }
+  return nv;
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+# pragma GCC diagnostic pop
+#endif
+
+template<class AVX2Vector, class AVX512Vector>
+struct VectorizedDistanceRowKernels {
+  typedef typename AVX2Vector::value_type Value;
+
+  template<int Dim>
+  static index_type euclidean(const Value * p, const Value * columns, index_type dim, index_type n,
+                              BetaClass beta, Value denom, Value * row) {
+    switch (default_pricing_kernel()) {
+      case PricingKernel::AVX512:
+        return euclidean_row_avx512<AVX512Vector, Dim>(p, columns, dim, n, beta, denom, row);
+      case PricingKernel::AVX2:
+        return euclidean_row_avx2<AVX2Vector, Dim>(p, columns, dim, n, beta, denom, row);
+      default:
+        return 0;
+    }
+  }
+
+  static index_type yphi(const Value * p, const Value * columns, index_type n,
+                         BetaClass beta, Value denom, Value * row) {
+    switch (default_pricing_kernel()) {
+      case PricingKernel::AVX512:
+        return yphi_row_avx512<AVX512Vector>(p, columns, n, beta, denom, row);
+      case PricingKernel::AVX2:
+        return yphi_row_avx2<AVX2Vector>(p, columns, n, beta, denom, row);
+      default:
+        return 0;
+    }
+  }
+
+  template<BetaClass C>
+  static index_type power(Value * row, index_type n, Value denom, const BetaPower<Value> & power) {
+    switch (default_pricing_kernel()) {
+      case PricingKernel::AVX512:
+        return power_row_avx512<AVX512Vector, C>(row, n, denom, power);
+      case PricingKernel::AVX2:
+        return power_row_avx2<AVX2Vector, C>(row, n, denom, power);
+      default:
+        return 0;
+    }
+  }
+
+  static index_type exp(Value shift, const Value * adds, const Value * subs, Value scale, index_type n,
+                        const Value * exp_series, Value * row) {
+    switch (default_pricing_kernel()) {
+      case PricingKernel::AVX512:
+        return exp_row_avx512<AVX512Vector>(shift, adds, subs, scale, n, exp_series, row);
+      case PricingKernel::AVX2:
+        return exp_row_avx2<AVX2Vector>(shift, adds, subs, scale, n, exp_series, row);
+      default:
+        return 0;
+    }
+  }
+};
+
+template<>
+struct DistanceRowKernels<double> : public VectorizedDistanceRowKernels<AVX2Doubles, AVX512Doubles> {};
+
+template<>
+struct DistanceRowKernels<float> : public VectorizedDistanceRowKernels<AVX2Floats, AVX512Floats> {};
+
+#endif // WASSERSTEIN_SIMD_PRICING
+
+// fills row with the distances from the particle p, using the default kernel
+template<int Dim, typename Value>
+inline void euclidean_distance_row(const Value * p, const Value * columns, index_type dim, index_type n,
+                                   BetaClass beta, Value denom, Value * row) {
+  index_type first(DistanceRowKernels<Value>::template euclidean<Dim>(p, columns, dim, n, beta, denom, row));
+  euclidean_row_scalar<Dim>(p, columns, dim, n, first, beta, denom, row);
+}
+
+template<typename Value>
+using EuclideanRowKernel = void (*)(const Value *, const Value *, index_type, index_type, BetaClass, Value, Value *);
+
+// the row kernel for particles of dimension dim, unrolled for dimensions 1 to 8
+template<typename Value>
+inline EuclideanRowKernel<Value> euclidean_row_kernel(index_type dim) {
+  switch (dim) {
+    case 1: return &euclidean_distance_row<1, Value>;
+    case 2: return &euclidean_distance_row<2, Value>;
+    case 3: return &euclidean_distance_row<3, Value>;
+    case 4: return &euclidean_distance_row<4, Value>;
+    case 5: return &euclidean_distance_row<5, Value>;
+    case 6: return &euclidean_distance_row<6, Value>;
+    case 7: return &euclidean_distance_row<7, Value>;
+    case 8: return &euclidean_distance_row<8, Value>;
+    default: return &euclidean_distance_row<0, Value>;
+  }
+}
+
+// the same for (y,phi) coordinates, with phi periodic
+template<typename Value>
+inline void yphi_distance_row(const Value * p, const Value * columns, index_type n,
+                              BetaClass beta, Value denom, Value * row) {
+  index_type first(DistanceRowKernels<Value>::yphi(p, columns, n, beta, denom, row));
+  yphi_row_scalar(p, columns, n, first, beta, denom, row);
+}
+
+template<BetaClass C, typename Value>
+inline void beta_power_row(Value * row, index_type n, Value denom, const BetaPower<Value> & power) {
+  index_type first(DistanceRowKernels<Value>::template power<C>(row, n, denom, power));
+  for (index_type j = first; j < n; j++)
+    row[j] = beta_power<C>(row[j]/denom, power);
+}
+
+// row[j] = exp((shift + adds[j] - subs[j]) * scale) with the approximate exp, whose
+// coefficients are filled by fill_exp_series, as for the kernel of Sinkhorn
+template<typename Value>
+inline void approximate_exp_row(Value shift, const Value * adds, const Value * subs, Value scale, index_type n,
+                                const Value * exp_series, Value * row) {
+  index_type first(DistanceRowKernels<Value>::exp(shift, adds, subs, scale, n, exp_series, row));
+  for (index_type j = first; j < n; j++)
+    row[j] = approximate_exp((shift + adds[j] - subs[j]) * scale, exp_series);
+}
+
+// raises a row of plain distances divided by denom to the power beta/2
+template<typename Value>
+inline void beta_power_row(Value * row, index_type n, Value denom, const BetaPower<Value> & power) {
+  switch (power.beta_class) {
+    case BetaClass::Integer:
+      beta_power_row<BetaClass::Integer>(row, n, denom, power);
+      break;
+    case BetaClass::HalfInteger:
+      beta_power_row<BetaClass::HalfInteger>(row, n, denom, power);
+      break;
+    case BetaClass::General:
+      beta_power_row<BetaClass::General>(row, n, denom, power);
+      break;
+    default:
+      for (index_type j = 0; j < n; j++)
+        row[j] = beta_power(row[j]/denom, power);
+  }
+}
+
+END_WASSERSTEIN_NAMESPACE
+
+#endif // WASSERSTEIN_DISTANCEKERNELS_HH
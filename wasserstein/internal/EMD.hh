@@ -40,6 +40,9 @@
 
 // C++ standard library
 #include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
 #include <memory>
 #include <sstream>
 #include <stdexcept>
@@ -50,6 +53,11 @@
 // Wasserstein headers (required for EMD functionality)
 #include "EMDBase.hh"
 #include "ExternalEMDHandler.hh"
+#include "Auction.hh"
+#include "Bounds.hh"
+#include "Multiscale.hh"
+#include "SparseNetworkSimplex.hh"
+#include "Transport1D.hh"
 
 
 BEGIN_WASSERSTEIN_NAMESPACE
@@ -107,13 +115,9 @@ public:
   static_assert(std::is_base_of<PairwiseDistanceBase<PairwiseDistance, ParticleCollection, Value>,
                                 PairwiseDistance>::value,
                 "Second EMD template parameter should be derived from PairwiseDistanceBase<...>.");
-  static_assert(std::is_base_of<WASSERSTEIN_NAMESPACE::NetworkSimplex<
-                                                       typename NetworkSimplex::Value,
-                                                       typename NetworkSimplex::Arc, 
-                                                       typename NetworkSimplex::Node,
-                                                       typename NetworkSimplex::Bool>,
-                                NetworkSimplex>::value,
-                "This EMD template parameter should be derived from NetworkSimplex<...>.");
+  static_assert(std::is_same<Value, typename NetworkSimplex::value_type>::value,
+                "This EMD template parameter should be NetworkSimplex<...> or a solver with the "
+                "same interface (such as Sinkhorn) and the same value_type.");
 
   // constructor with entirely default arguments
   EMD(Value R = 1, Value beta = 1, bool norm = false,
@@ -127,8 +131,16 @@ public:
 
     // initialize contained objects
     pairwise_distance_(R, beta),
-    network_simplex_(n_iter_max, epsilon_large_factor, epsilon_small_factor)
+    network_simplex_(n_iter_max, epsilon_large_factor, epsilon_small_factor),
+    sparse_network_simplex_(n_iter_max, epsilon_large_factor, epsilon_small_factor),
+    solver_(EMDSolver::Auto),
+    last_solver_(EMDSolver::NetworkSimplex),
+    have_1d_ground_dists_(false),
+    num_threads_(1),
+    min_parallel_arcs_(DEFAULT_MIN_PARALLEL_ARCS)
   {
+    multiscale_.sparse_network_simplex().set_params(n_iter_max, epsilon_large_factor, epsilon_small_factor);
+
     // setup units correctly (only relevant here if norm = true)
     this->scale_ = 1;
 
@@ -149,8 +161,10 @@ public:
     using Base::scale;
   #endif
 
-  // access underlying network simplex and pairwise distance objects
+  // access underlying network simplex (whose own parameters, such as the resolutions of
+  // QuantizedNetworkSimplex, are set directly) and pairwise distance objects
   const NetworkSimplex & network_simplex() const { return network_simplex_; }
+  NetworkSimplex & network_simplex() { return network_simplex_; }
   const PairwiseDistance & pairwise_distance() const { return pairwise_distance_; }
 
   // return a description of this object
@@ -164,6 +178,10 @@ public:
         << '\n'
         << pairwise_distance().description()
         << network_simplex().description();
+    if (solver_ == EMDSolver::SparseNetworkSimplex)
+      oss << sparse_network_simplex().description();
+    else if (solver_ == EMDSolver::Multiscale)
+      oss << multiscale().description() << multiscale().sparse_network_simplex().description();
 
     if (write_preprocessors)
       output_preprocessors(oss);
@@ -187,6 +205,110 @@ public:
     return this->emd();
   }
 
+  // cheap lower and upper bounds on the EMD that never run a solver (see Bounds.hh), from
+  // anything that an Event can be constructed from, including preprocessing the events
+  template<class ProtoEvent0, class ProtoEvent1>
+  Value lower_bound(const ProtoEvent0 & pev0, const ProtoEvent1 & pev1) const {
+    Event ev0(pev0), ev1(pev1);
+    return compute_lower_bound(preprocess(ev0), preprocess(ev1));
+  }
+  template<class ProtoEvent0, class ProtoEvent1>
+  Value upper_bound(const ProtoEvent0 & pev0, const ProtoEvent1 & pev1) const {
+    Event ev0(pev0), ev1(pev1);
+    return compute_upper_bound(preprocess(ev0), preprocess(ev1));
+  }
+
+  // the same bounds on two events without any preprocessing, as for compute; the events cache
+  // the signatures the bounds need, so that reusing them takes time linear in the multiplicities
+  Value compute_lower_bound(const Event & ev0, const Event & ev1) const {
+    check_bounds_available();
+    return emd_lower_bound(pairwise_distance_, ev0, ev1, norm());
+  }
+  Value compute_upper_bound(const Event & ev0, const Event & ev1) const {
+    check_bounds_available();
+    return emd_upper_bound(pairwise_distance_, ev0, ev1, norm());
+  }
+
+  // decides whether the EMD is below threshold, from anything that an Event can be constructed
+  // from, including preprocessing the events
+  template<class ProtoEvent0, class ProtoEvent1>
+  bool within(const ProtoEvent0 & pev0, const ProtoEvent1 & pev1, Value threshold) {
+    Event ev0(pev0), ev1(pev1);
+    return compute_within(preprocess(ev0), preprocess(ev1), threshold);
+  }
+
+  // the same decision on two events without any preprocessing; the cheap bounds are tried first
+  // (unless the dists are external) and otherwise the network simplex stops as soon as its own
+  // bounds settle the question (see NetworkSimplex::set_cost_threshold), with status Approximate
+  // and emd_bounds() on the side of the threshold found; if the anytime mode stops it before
+  // that, its upper bound decides
+  bool compute_within(const Event & ev0, const Event & ev1, Value threshold) {
+    if (!external_dists()) {
+      if (compute_lower_bound(ev0, ev1) >= threshold) return false;
+      if (compute_upper_bound(ev0, ev1) < threshold) return true;
+    }
+
+    // the network simplex works with weights divided by the max total if not normed
+    Value s(norm() ? 1 : std::max(ev0.total_weight(), ev1.total_weight()));
+    network_simplex_.set_cost_threshold(s > 0 ? threshold / s : threshold);
+    EMDStatus status;
+    try { status = compute(ev0, ev1); }
+    catch (...) {
+      network_simplex_.set_cost_threshold(std::numeric_limits<Value>::max());
+      throw;
+    }
+    network_simplex_.set_cost_threshold(std::numeric_limits<Value>::max());
+    check_emd_status(status);
+
+    return this->emd() < threshold;
+  }
+
+  // computes the EMDs of two events without any preprocessing at each (R, beta) point of
+  // params, storing them in emds and returning the status of the first point that failed, or
+  // Success; unless the events are solved in 1D or another solver is chosen, the plain
+  // distances are computed once and the network simplex at each point is warm started from
+  // the optimal tree of the previous one, otherwise each point is computed as by compute;
+  // R and beta are restored afterwards
+  EMDStatus compute_sweep(const Event & ev0, const Event & ev1,
+                          const std::vector<std::pair<Value, Value>> & params, std::vector<Value> & emds) {
+    if (external_dists())
+      throw std::runtime_error("EMD - sweeps require particles rather than external dists");
+
+    Value R(this->R()), beta(this->beta());
+    bool reuse_dists(sweep_reuses_dists(ev0, ev1)), warm(warm_start());
+    EMDStatus sweep_status(EMDStatus::Success);
+    emds.resize(params.size());
+    try {
+      if (reuse_dists) {
+        if (!warm) set_warm_start(true);
+        set_weights(ev0, ev1);
+        WASSERSTEIN_SOLVER_STAT(auto fill_start(std::chrono::steady_clock::now());)
+        pairwise_distance_.fill_plain_distances(ev0.particles(), ev1.particles(), plain_dists_, this->extra(),
+                                                problem_threads(num_threads_, std::size_t(n0()) * n1(),
+                                                                min_parallel_arcs_));
+        WASSERSTEIN_SOLVER_STAT(
+          stats_.fill_time += std::chrono::duration<double>(std::chrono::steady_clock::now() - fill_start).count();
+        )
+      }
+
+      for (std::size_t p = 0; p < params.size(); p++) {
+        set_R(params[p].first);
+        set_beta(params[p].second);
+        EMDStatus status(reuse_dists ? compute_from_plain(ev0, ev1) : compute(ev0, ev1));
+        if (sweep_status == EMDStatus::Success && status != EMDStatus::Success && status != EMDStatus::Approximate)
+          sweep_status = status;
+        emds[p] = this->emd();
+      }
+    }
+    catch (...) {
+      restore_sweep(R, beta, reuse_dists && !warm);
+      throw;
+    }
+    restore_sweep(R, beta, reuse_dists && !warm);
+
+    return sweep_status;
+  }
+
   // runs the computation on two events without any preprocessing
   // returns the status enum value from the network simplex solver:
   //   - EMDStatus::Success = 0
@@ -195,69 +317,73 @@ public:
   //   - Unbounded = 3
   //   - MaxIterReached = 4
   //   - Infeasible = 5
+  //   - Approximate = 6
   EMDStatus compute(const Event & ev0, const Event & ev1) {
 
-    const WeightCollection & ws0(ev0.weights()), & ws1(ev1.weights());
-
     // check for timing request
     if (this->do_timing())
       this->start_timing();
 
-    // grab number of particles
-    this->n0_ = ws0.size();
-    this->n1_ = ws1.size();
-
-    // handle adding fictitious particle
-    this->weightdiff_ = ev1.total_weight() - ev0.total_weight();
-
-    // for norm or already equal or custom distance, don't add particle
-    if (norm() || external_dists() || weightdiff() == 0) {
-      this->extra_ = ExtraParticle::Neither;
-      weights().resize(n0() + n1() + 1); // + 1 is to match what network simplex will do anyway
-      std::copy(ws1.begin(), ws1.end(), std::copy(ws0.begin(), ws0.end(), weights().begin()));
+    set_weights(ev0, ev1);
+
+    // particles on a line with a convex ground distance are solved exactly by sorting
+    WASSERSTEIN_SOLVER_STAT(auto solve_start(std::chrono::steady_clock::now());)
+    last_solver_ = EMDSolver::NetworkSimplex;
+    if (sorts_1d() &&
+        !external_dists() && this->extra() == ExtraParticle::Neither && beta() >= 1 &&
+        PairwiseDistance::coordinates_1d(ev0.particles(), transport_1d_.coords0()) &&
+        PairwiseDistance::coordinates_1d(ev1.particles(), transport_1d_.coords1())) {
+      last_solver_ = EMDSolver::Sorted1D;
+      have_1d_ground_dists_ = false;
+      this->status_ = transport_1d_.compute(pairwise_distance_, weights(), network_simplex_.epsilon_large());
+      this->emd_ = transport_1d_.total_cost();
     }
 
-    // total weights unequal, add extra particle to event0 as it has less total weight
-    else if (weightdiff() > 0) {
-      this->extra_ = ExtraParticle::Zero;
-      this->n0_++;
-      weights().resize(n0() + n1() + 1); // +1 is to match what network simplex will do anyway
-
-      // put weight diff after ws0
-      auto it(std::copy(ws0.begin(), ws0.end(), weights().begin()));
-      *it = weightdiff();
-      std::copy(ws1.begin(), ws1.end(), ++it);
+    // large events without the memory for all n0*n1 arcs, the ground distances are computed as needed
+    else if ((solver_ == EMDSolver::SparseNetworkSimplex || solver_ == EMDSolver::Multiscale) &&
+             !external_dists()) {
+      last_solver_ = solver_;
+      compute_sparse(ev0.particles(), ev1.particles());
     }
 
-    // total weights unequal, add extra particle to event1 as it has less total weight
     else {
-      this->extra_ = ExtraParticle::One;
-      this->n1_++;
-      weights().resize(n0() + n1() + 1); // +1 is to match what network simplex will do anyway
-      *std::copy(ws1.begin(),
-                 ws1.end(),
-                 std::copy(ws0.begin(),
-                           ws0.end(),
-                           weights().begin())) = -weightdiff();
-    }
 
-    // if not norm, prepare to scale each weight by the max total
-    if (!norm()) {
-      this->scale_ = std::max(ev0.total_weight(), ev1.total_weight());
-      for (Value & w : weights()) w /= scale();
+      // store distances in network simplex if not externally provided
+      if (!external_dists()) {
+        WASSERSTEIN_SOLVER_STAT(std::size_t dists_capacity(network_simplex_.dists().capacity());)
+        pairwise_distance_.fill_distances(ev0.particles(), ev1.particles(),
+                                          network_simplex_.dists(), this->extra(),
+                                          problem_threads(num_threads_, std::size_t(n0()) * n1(),
+                                                          min_parallel_arcs_));
+        WASSERSTEIN_SOLVER_STAT(stats_.allocations += network_simplex_.dists().capacity() > dists_capacity;)
+      }
+      WASSERSTEIN_SOLVER_STAT(
+        auto fill_end(std::chrono::steady_clock::now());
+        stats_.fill_time += std::chrono::duration<double>(fill_end - solve_start).count();
+        solve_start = fill_end;
+      )
+
+      // events with the same number of equally weighted particles are an assignment problem
+      if (solver_ == EMDSolver::Auction && uniform_weights()) {
+        last_solver_ = EMDSolver::Auction;
+        this->status_ = auction_.compute(network_simplex_.dists(), n0(), Value(1)/n0());
+        this->emd_ = auction_.total_cost();
+      }
+
+      // run the EarthMoversDistance at this point
+      else {
+        this->status_ = network_simplex_.compute(n0(), n1());
+        this->emd_ = network_simplex_.total_cost();
+      }
     }
 
-    // store distances in network simplex if not externally provided
-    if (!external_dists())
-      pairwise_distance_.fill_distances(ev0.particles(), ev1.particles(),
-                                        ground_dists(), this->extra());
-
-    // run the EarthMoversDistance at this point
-    this->status_ = network_simplex_.compute(n0(), n1());
-    this->emd_ = network_simplex_.total_cost();
+    WASSERSTEIN_SOLVER_STAT(
+      stats_.solve_time += std::chrono::duration<double>(std::chrono::steady_clock::now() - solve_start).count();
+      stats_.n_solves++;
+    )
 
     // account for weight scale if not normed
-    if (this->status() == EMDStatus::Success && !norm())
+    if ((this->status() == EMDStatus::Success || this->status() == EMDStatus::Approximate) && !norm())
       this->emd_ *= scale();
 
     // end timing and get duration
@@ -268,9 +394,39 @@ public:
     return this->status();
   }
 
-  // access ground dists in network simplex directly
-  std::vector<Value> & ground_dists() { return network_simplex_.dists(); }
-  const std::vector<Value> & ground_dists() const { return network_simplex_.dists(); }
+  // access ground dists in network simplex directly (these are filled on the first request
+  // if the last problem was solved in 1D, such that they can be overwritten by external
+  // dists, and are not available if it was solved by the sparse network simplex or multiscale)
+  std::vector<Value> & ground_dists() {
+    if (last_solver_ == EMDSolver::Sorted1D && !have_1d_ground_dists_) {
+      network_simplex_.dists() = transport_1d_.dists();
+      have_1d_ground_dists_ = true;
+    }
+    else if (sparse_last_solver() && !external_dists())
+      throw_no_sparse_dists();
+    return network_simplex_.dists();
+  }
+  const std::vector<Value> & ground_dists() const {
+    if (sparse_last_solver())
+      throw_no_sparse_dists();
+    return last_solver_ == EMDSolver::Sorted1D ? transport_1d_.dists() : network_simplex_.dists();
+  }
+
+  // which solver the last computation actually used (never Auto)
+  EMDSolver last_solver() const { return last_solver_; }
+
+  // access the auction solver, whose parameters are set directly
+  const Auction<Value> & auction() const { return auction_; }
+  Auction<Value> & auction() { return auction_; }
+
+  // access the sparse network simplex, whose n_neighbors is set directly
+  const SparseNetworkSimplex<Value> & sparse_network_simplex() const { return sparse_network_simplex_; }
+  SparseNetworkSimplex<Value> & sparse_network_simplex() { return sparse_network_simplex_; }
+
+  // access the multiscale solver, whose parameters (including those of the sparse
+  // network simplex it uses at every level) are set directly
+  const Multiscale<Value> & multiscale() const { return multiscale_; }
+  Multiscale<Value> & multiscale() { return multiscale_; }
 
 // these functions should be private since Python will access them via the base class
 #ifdef SWIG
@@ -283,31 +439,103 @@ private:
   void set_R(Value R) { pairwise_distance_.set_R(R); }
   void set_beta(Value beta) { pairwise_distance_.set_beta(beta); }
 
-  // set network simplex parameters
+  // set network simplex parameters (the pivot rule parameters are described with each rule,
+  // where 0 keeps their current values; the sparse network simplex shares the others)
   void set_network_simplex_params(std::size_t n_iter_max=100000,
                                   Value epsilon_large_factor=1000,
-                                  Value epsilon_small_factor=1) {
-    network_simplex_.set_params(n_iter_max, epsilon_large_factor, epsilon_small_factor);
+                                  Value epsilon_small_factor=1,
+                                  Value pivot_param0=0,
+                                  Value pivot_param1=0) {
+    network_simplex_.set_params(n_iter_max, epsilon_large_factor, epsilon_small_factor,
+                                pivot_param0, pivot_param1);
+    sparse_network_simplex_.set_params(n_iter_max, epsilon_large_factor, epsilon_small_factor);
+    multiscale_.sparse_network_simplex().set_params(n_iter_max, epsilon_large_factor, epsilon_small_factor);
+  }
+
+  // warm start network simplex from the previously solved problem
+  bool warm_start() const { return network_simplex_.warm_start(); }
+  void set_warm_start(bool warm) { network_simplex_.set_warm_start(warm); }
+
+  // anytime mode of the network simplex (see NetworkSimplex::set_anytime), in which it may stop
+  // with status Approximate once the relative gap between its bounds is small enough or the time
+  // is up, emd() then being the upper bound
+  void set_anytime(double relative_gap, double max_seconds = 0) {
+    network_simplex_.set_anytime(relative_gap, max_seconds);
+  }
+
+  // threads for a single problem with at least min_parallel_arcs arcs (n0*n1), all of them if
+  // num_threads is -1, which fill the ground distances and price the arcs of the network
+  // simplex (see NetworkSimplex::set_num_threads), or compute the ground distances as the
+  // sparse network simplex and multiscale go through the complete graph; a single thread is
+  // used inside a parallel region, so this does not change the EMDs computed by PairwiseEMD
+  int num_threads() const { return num_threads_; }
+  std::size_t min_parallel_arcs() const { return min_parallel_arcs_; }
+  void set_num_threads(int num_threads, std::size_t min_parallel_arcs = DEFAULT_MIN_PARALLEL_ARCS) {
+    num_threads_ = num_threads;
+    min_parallel_arcs_ = min_parallel_arcs;
+    network_simplex_.set_num_threads(num_threads, min_parallel_arcs);
+    sparse_network_simplex_.set_num_threads(num_threads, min_parallel_arcs);
+    multiscale_.sparse_network_simplex().set_num_threads(num_threads, min_parallel_arcs);
+  }
+
+  // lower and upper bounds on the last EMD, which are both emd() unless the status was Approximate
+  std::pair<Value, Value> emd_bounds() const {
+    if (this->status() != EMDStatus::Approximate)
+      return std::make_pair(this->emd(), this->emd());
+    Value s(norm() ? 1 : scale());
+    if (sparse_last_solver()) {
+      Value error_bound(last_solver_ == EMDSolver::Multiscale ? multiscale_.error_bound() :
+                                                                sparse_network_simplex_.error_bound());
+      return std::make_pair(this->emd() - s * error_bound, this->emd());
+    }
+    return std::make_pair(s * network_simplex_.cost_lower_bound(), s * network_simplex_.cost_upper_bound());
   }
 
+  // choose the solver; Auto sorts 1D events when the network simplex is an exact floating
+  // point one (see is_exact_network_simplex) and otherwise uses the network simplex (as
+  // Sorted1D does when the events are 1D but their total weights differ, since the extra
+  // particle is not on the line, or beta < 1, where the ground distance is not convex), Auction
+  // applies to events with equal numbers of equally weighted particles (it is not the default
+  // as the network simplex is faster on typical events), SparseNetworkSimplex trades the
+  // ground distances being available for memory that grows linearly with the multiplicity,
+  // Multiscale does the same starting from the flow between clusters of particles, and a
+  // choice that does not apply (including with external dists) falls back to the
+  // network simplex
+  EMDSolver solver() const { return solver_; }
+  void set_solver(EMDSolver solver) { solver_ = solver; }
+
   // free all dynamic memory help by this object
   void clear() {
     preprocessors_.clear();
     network_simplex_.free();
+    transport_1d_.free();
+    auction_.free();
+    sparse_network_simplex_.free();
+    multiscale_.free();
+    pairwise_distance_.free();
+    free_vector(plain_dists_);
+  }
+
+  // reserves the network simplex buffers for events of up to n0 and n1 particles (and
+  // the extra particle), along with any scratch space of the pairwise distance, so that
+  // computing them does not allocate once the preprocessed events themselves do not;
+  // huge_pages asks for the ground distances and flows to be backed by transparent huge
+  // pages (linux only)
+  void reserve(std::size_t n0, std::size_t n1, bool huge_pages = false) {
+    network_simplex_.reserve(n0 + 1, n1 + 1, huge_pages);
+    pairwise_distance_.reserve(n1);
   }
 
   // access dists
   std::vector<Value> dists() const {
-    return std::vector<Value>(network_simplex().dists().begin(),
-                              network_simplex().dists().begin() + n0()*n1());
+    return std::vector<Value>(ground_dists().begin(), ground_dists().begin() + n0()*n1());
   }
 
   // returns all flows 
   std::vector<Value> flows() const {
 
     // copy flows in the valid range
-    std::vector<Value> unscaled_flows(network_simplex().flows().begin(), 
-                                      network_simplex().flows().begin() + n0()*n1());
+    std::vector<Value> unscaled_flows(raw_flows().begin(), raw_flows().begin() + n0()*n1());
     // unscale all values
     for (Value & f: unscaled_flows)
       f *= scale();
@@ -331,11 +559,61 @@ private:
 
   // "raw" access to EMD flow
   Value flow(std::size_t ind) const {
-    return network_simplex_.flows()[ind] * scale(); 
+    return raw_flows()[ind] * scale();
+  }
+
+  // nonzero flows in COO form, the (i, j) indices ordered by i then j and the flow values,
+  // which the solvers provide without forming the dense flows (a basic solution has at most
+  // n0 + n1 - 1 of them)
+  std::pair<std::vector<std::pair<index_type, index_type>>, std::vector<Value>> sparse_flows() const {
+
+    std::vector<std::pair<std::size_t, Value>> arc_flows;
+    switch (last_solver_) {
+      case EMDSolver::Sorted1D: transport_1d_.sparse_flows(arc_flows); break;
+      case EMDSolver::Auction: auction_.sparse_flows(arc_flows); break;
+      case EMDSolver::SparseNetworkSimplex: sparse_network_simplex_.sparse_flows(arc_flows); break;
+      case EMDSolver::Multiscale: multiscale_.sparse_flows(arc_flows); break;
+      default: network_simplex().sparse_flows(arc_flows);
+    }
+    std::sort(arc_flows.begin(), arc_flows.end(),
+              [](const std::pair<std::size_t, Value> & a, const std::pair<std::size_t, Value> & b) {
+                return a.first < b.first;
+              });
+
+    std::pair<std::vector<std::pair<index_type, index_type>>, std::vector<Value>> coo;
+    coo.first.reserve(arc_flows.size());
+    coo.second.reserve(arc_flows.size());
+    for (const std::pair<std::size_t, Value> & af : arc_flows) {
+      coo.first.emplace_back(index_type(af.first / n1()), index_type(af.first % n1()));
+      coo.second.push_back(af.second * scale());
+    }
+
+    return coo;
   }
 
   // access number of iterations of the network simplex solver
-  std::size_t n_iter() const { return network_simplex().n_iter(); }
+  // (the number of bids for the auction solver)
+  std::size_t n_iter() const {
+    switch (last_solver_) {
+      case EMDSolver::Sorted1D: return 0;
+      case EMDSolver::Auction: return auction_.n_bids();
+      case EMDSolver::SparseNetworkSimplex: return sparse_network_simplex_.n_iter();
+      case EMDSolver::Multiscale: return multiscale_.n_iter();
+      default: return network_simplex().n_iter();
+    }
+  }
+
+  // solver statistics accumulated since the last reset, only collected when compiled with
+  // WASSERSTEIN_SOLVER_STATS; the pivot and pricing counts are those of the network simplex
+  // while the times and number of solves include every solver
+  SolverStats stats() const {
+    SolverStats stats(stats_);
+    return stats += network_simplex_.stats();
+  }
+  void reset_stats() {
+    stats_.reset();
+    network_simplex_.reset_stats();
+  }
 
   // access node potentials of network simplex solver
   std::pair<std::vector<Value>, std::vector<Value>> node_potentials() const {
@@ -343,12 +621,14 @@ private:
     nps.first.resize(n0());
     nps.second.resize(n1());
 
-    std::copy(network_simplex().potentials().begin(),
-              network_simplex().potentials().begin() + n0(),
-              nps.first.begin());
-    std::copy(network_simplex().potentials().begin() + n0(),
-              network_simplex().potentials().begin() + n0() + n1(),
-              nps.second.begin());
+    const std::vector<Value> & pis(last_solver_ == EMDSolver::Sorted1D ? transport_1d_.potentials() :
+                                   last_solver_ == EMDSolver::Auction ? auction_.potentials() :
+                                   last_solver_ == EMDSolver::SparseNetworkSimplex ?
+                                     sparse_network_simplex_.potentials() :
+                                   last_solver_ == EMDSolver::Multiscale ?
+                                     multiscale_.potentials() : network_simplex().potentials());
+    std::copy(pis.begin(), pis.begin() + n0(), nps.first.begin());
+    std::copy(pis.begin() + n0(), pis.begin() + n0() + n1(), nps.second.begin());
 
     return nps;
   }
@@ -360,7 +640,184 @@ private:
 
   // access raw flows
   const std::vector<Value> & raw_flows() const {
-    return network_simplex().flows();
+    switch (last_solver_) {
+      case EMDSolver::Sorted1D: return transport_1d_.flows();
+      case EMDSolver::Auction: return auction_.flows();
+      case EMDSolver::SparseNetworkSimplex: return sparse_network_simplex_.flows();
+      case EMDSolver::Multiscale: return multiscale_.flows();
+      default: return network_simplex().flows();
+    }
+  }
+
+  // solves with the sparse network simplex or multiscale, the extra particle is at distance 1
+  // as in fill_distances (and infinitely far from the particles of its own event)
+  void compute_sparse(const ParticleCollection & ps0, const ParticleCollection & ps1) {
+    typedef typename ParticleCollection::const_iterator ParticleIterator;
+    std::vector<ParticleIterator> ps0_iters, ps1_iters;
+    for (ParticleIterator p = ps0.begin(), end = ps0.end(); p != end; ++p)
+      ps0_iters.push_back(p);
+    for (ParticleIterator p = ps1.begin(), end = ps1.end(); p != end; ++p)
+      ps1_iters.push_back(p);
+
+    index_type m0(ps0_iters.size()), m1(ps1_iters.size());
+    const PairwiseDistance & pairwise_distance(pairwise_distance_);
+    auto cost([&](index_type i, index_type j) -> Value {
+      return i == m0 || j == m1 ? 1 : pairwise_distance.distance(ps0_iters[i], ps1_iters[j]);
+    });
+
+    if (last_solver_ == EMDSolver::Multiscale) {
+      this->status_ = multiscale_.compute(weights(), n0(), n1(),
+        [&](index_type a, index_type b) -> Value {
+          return a == m0 || b == m0 ? std::numeric_limits<Value>::max() :
+                                      pairwise_distance.distance(ps0_iters[a], ps0_iters[b]);
+        },
+        [&](index_type a, index_type b) -> Value {
+          return a == m1 || b == m1 ? std::numeric_limits<Value>::max() :
+                                      pairwise_distance.distance(ps1_iters[a], ps1_iters[b]);
+        }, cost);
+      this->emd_ = multiscale_.total_cost();
+    }
+    else {
+      this->status_ = sparse_network_simplex_.compute(weights(), n0(), n1(), cost);
+      this->emd_ = sparse_network_simplex_.total_cost();
+    }
+  }
+
+  // sets the weights of the network simplex, with the extra particle if needed, and the
+  // number of particles and scale of the problem
+  void set_weights(const Event & ev0, const Event & ev1) {
+
+    const WeightCollection & ws0(ev0.weights()), & ws1(ev1.weights());
+
+    // grab number of particles
+    this->n0_ = ws0.size();
+    this->n1_ = ws1.size();
+
+    // handle adding fictitious particle
+    this->weightdiff_ = ev1.total_weight() - ev0.total_weight();
+
+    // for norm or already equal or custom distance, don't add particle
+    if (norm() || external_dists() || weightdiff() == 0) {
+      this->extra_ = ExtraParticle::Neither;
+      resize_vector(weights(), n0() + n1() + 1, stats_.allocations); // + 1 is to match what network simplex will do anyway
+      std::copy(ws1.begin(), ws1.end(), std::copy(ws0.begin(), ws0.end(), weights().begin()));
+    }
+
+    // total weights unequal, add extra particle to event0 as it has less total weight
+    else if (weightdiff() > 0) {
+      this->extra_ = ExtraParticle::Zero;
+      this->n0_++;
+      resize_vector(weights(), n0() + n1() + 1, stats_.allocations); // +1 is to match what network simplex will do anyway
+
+      // put weight diff after ws0
+      auto it(std::copy(ws0.begin(), ws0.end(), weights().begin()));
+      *it = weightdiff();
+      std::copy(ws1.begin(), ws1.end(), ++it);
+    }
+
+    // total weights unequal, add extra particle to event1 as it has less total weight
+    else {
+      this->extra_ = ExtraParticle::One;
+      this->n1_++;
+      resize_vector(weights(), n0() + n1() + 1, stats_.allocations); // +1 is to match what network simplex will do anyway
+      *std::copy(ws1.begin(),
+                 ws1.end(),
+                 std::copy(ws0.begin(),
+                           ws0.end(),
+                           weights().begin())) = -weightdiff();
+    }
+
+    // if not norm, prepare to scale each weight by the max total
+    if (!norm()) {
+      this->scale_ = std::max(ev0.total_weight(), ev1.total_weight());
+      for (Value & w : weights()) w /= scale();
+    }
+  }
+
+  // whether compute solves 1D events by sorting, which Auto only does if the network simplex
+  // would find the same exact transport
+  bool sorts_1d() const {
+    return solver_ == EMDSolver::Sorted1D ||
+           (solver_ == EMDSolver::Auto && is_exact_network_simplex<NetworkSimplex>::value);
+  }
+
+  // whether a sweep solves every point with the network simplex on the ground distances of
+  // all pairs of particles, as compute does unless told otherwise or the events lie on a line
+  bool sweep_reuses_dists(const Event & ev0, const Event & ev1) {
+    if (solver_ == EMDSolver::NetworkSimplex)
+      return true;
+    return solver_ == EMDSolver::Auto &&
+           !(sorts_1d() &&
+             PairwiseDistance::coordinates_1d(ev0.particles(), transport_1d_.coords0()) &&
+             PairwiseDistance::coordinates_1d(ev1.particles(), transport_1d_.coords1()));
+  }
+
+  // as compute with the network simplex, the ground distances being derived from plain_dists_
+  EMDStatus compute_from_plain(const Event & ev0, const Event & ev1) {
+
+    if (this->do_timing())
+      this->start_timing();
+
+    // the network simplex negates some of the weights it is given, so they are set each time
+    set_weights(ev0, ev1);
+
+    WASSERSTEIN_SOLVER_STAT(auto solve_start(std::chrono::steady_clock::now());)
+    last_solver_ = EMDSolver::NetworkSimplex;
+    pairwise_distance_.distances_from_plain(plain_dists_, network_simplex_.dists(),
+                                            ev0.particles().size(), ev1.particles().size(), this->extra());
+    WASSERSTEIN_SOLVER_STAT(
+      auto fill_end(std::chrono::steady_clock::now());
+      stats_.fill_time += std::chrono::duration<double>(fill_end - solve_start).count();
+      solve_start = fill_end;
+    )
+
+    this->status_ = network_simplex_.compute(n0(), n1());
+    this->emd_ = network_simplex_.total_cost();
+
+    WASSERSTEIN_SOLVER_STAT(
+      stats_.solve_time += std::chrono::duration<double>(std::chrono::steady_clock::now() - solve_start).count();
+      stats_.n_solves++;
+    )
+
+    if ((this->status() == EMDStatus::Success || this->status() == EMDStatus::Approximate) && !norm())
+      this->emd_ *= scale();
+
+    if (this->do_timing())
+      this->store_duration();
+
+    return this->status();
+  }
+
+  void restore_sweep(Value R, Value beta, bool cold) {
+    set_R(R);
+    set_beta(beta);
+    if (cold) set_warm_start(false);
+  }
+
+  bool sparse_last_solver() const {
+    return last_solver_ == EMDSolver::SparseNetworkSimplex || last_solver_ == EMDSolver::Multiscale;
+  }
+
+  void check_bounds_available() const {
+    if (external_dists())
+      throw std::runtime_error("EMD - bounds require particles rather than external dists");
+  }
+
+  static void throw_no_sparse_dists() {
+    throw std::runtime_error("EMD - ground distances are not stored by the sparse solvers");
+  }
+
+  // whether both events have the same number of particles, all with the same weight; the
+  // scaled weights are compared up to a few ulps since dividing by the scale may round them
+  // differently (e.g. a vectorized division with -ffast-math), and as they sum to one the
+  // common weight passed to the auction is 1/n
+  bool uniform_weights() {
+    if (n0() != n1() || n0() == 0) return false;
+    const std::vector<Value> & ws(weights());
+    Value tolerance(4 * std::numeric_limits<Value>::epsilon() * std::abs(ws[0]));
+    for (index_type i = 1; i < n0() + n1(); i++)
+      if (std::abs(ws[i] - ws[0]) > tolerance) return false;
+    return true;
   }
 
   // applies preprocessors to an event
@@ -397,6 +854,9 @@ private:
     ar & boost::serialization::base_object<Base>(*this)
        & pairwise_distance_ & network_simplex_;
   }
+  // the solver selection and the settings of the network simplex beyond its constructor
+  // parameters (pivot rule parameters, warm start, anytime mode, threshold, threads) are
+  // not archived, so a loaded EMD starts with their defaults
 #endif
 
   /////////////////////
@@ -406,6 +866,24 @@ private:
   // helper objects
   PairwiseDistance pairwise_distance_;
   NetworkSimplex network_simplex_;
+  Transport1D<PairwiseDistance> transport_1d_;
+  Auction<Value> auction_;
+  SparseNetworkSimplex<Value> sparse_network_simplex_;
+  Multiscale<Value> multiscale_;
+  EMDSolver solver_, last_solver_;
+
+  // whether ground_dists() has copied the distances of the last 1D problem to the network simplex
+  bool have_1d_ground_dists_;
+
+  // plain distances of the events of a sweep
+  std::vector<Value> plain_dists_;
+
+  // threads for a single large problem
+  int num_threads_;
+  std::size_t min_parallel_arcs_;
+
+  // times and number of solves (the network simplex counts its own pivots)
+  SolverStats stats_;
 
   // preprocessor objects
   std::vector<std::shared_ptr<Preprocessor<Self>>> preprocessors_;
@@ -94,7 +94,17 @@ public:
   // set network simplex parameters
   virtual void set_network_simplex_params(std::size_t n_iter_max=100000,
                                           Value epsilon_large_factor=1000,
-                                          Value epsilon_small_factor=1) = 0;
+                                          Value epsilon_small_factor=1,
+                                          Value pivot_param0=0,
+                                          Value pivot_param1=0) = 0;
+
+  // warm start each network simplex solve from the previous spanning tree
+  virtual bool warm_start() const = 0;
+  virtual void set_warm_start(bool warm) = 0;
+
+  // choose the solver, which falls back to the network simplex where it does not apply
+  virtual EMDSolver solver() const = 0;
+  virtual void set_solver(EMDSolver solver) = 0;
 
   bool norm() const { return norm_; }
   void set_norm(bool norm) { norm_ = norm; } 
@@ -123,6 +133,7 @@ public:
   virtual std::vector<Value> flows() const = 0;
   virtual Value flow(index_type i, index_type j) const = 0;
   virtual Value flow(std::size_t ind) const = 0;
+  virtual std::pair<std::vector<std::pair<index_type, index_type>>, std::vector<Value>> sparse_flows() const = 0;
   virtual std::pair<std::vector<Value>, std::vector<Value>> node_potentials() const = 0;
 
 #ifdef SWIG
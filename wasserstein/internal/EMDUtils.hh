@@ -40,8 +40,11 @@
 
 // C++ standard library
 #include <cstddef>
+#include <cstdint>
+#include <sstream>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 // serialization code based on boost serialization
@@ -60,6 +63,16 @@
 # endif
 #endif // WASSERSTEIN_SERIALIZATION
 
+// OpenMP for the threads used within a single problem
+#ifdef _OPENMP
+# include <omp.h>
+#endif
+
+// transparent huge pages are requested with madvise
+#ifdef __linux__
+# include <sys/mman.h>
+#endif
+
 // default namespace macros
 #ifndef BEGIN_WASSERSTEIN_NAMESPACE
 # define WASSERSTEIN_NAMESPACE emd
@@ -97,6 +110,14 @@
 # define WASSERSTEIN_INDEX_TYPE std::ptrdiff_t
 #endif
 
+// solver statistics are only collected if WASSERSTEIN_SOLVER_STATS is defined,
+// otherwise the statements counting them are compiled out
+#ifdef WASSERSTEIN_SOLVER_STATS
+# define WASSERSTEIN_SOLVER_STAT(...) __VA_ARGS__
+#else
+# define WASSERSTEIN_SOLVER_STAT(...)
+#endif
+
 
 BEGIN_WASSERSTEIN_NAMESPACE
 
@@ -118,6 +139,16 @@ constexpr bool COMPILED_WITH_OPENMP =
     false;
   #endif
 
+constexpr bool COMPILED_WITH_SOLVER_STATS =
+  #ifdef WASSERSTEIN_SOLVER_STATS
+    true;
+  #else
+    false;
+  #endif
+
+// number of arcs (n0*n1) from which a single problem uses several threads, if asked to
+constexpr std::size_t DEFAULT_MIN_PARALLEL_ARCS = std::size_t(1) << 22;
+
 ////////////////////////////////////////////////////////////////////////////////
 // Enums
 ////////////////////////////////////////////////////////////////////////////////
@@ -128,7 +159,8 @@ enum class EMDStatus : char {
   SupplyMismatch = 2,
   Unbounded = 3,
   MaxIterReached = 4,
-  Infeasible = 5
+  Infeasible = 5,
+  Approximate = 6 // the solver stopped early (anytime mode or max_rounds), with bounds on the cost
 };
 
 enum class ExtraParticle : char {
@@ -137,11 +169,27 @@ enum class ExtraParticle : char {
   One = 1
 };
 
+// which algorithm an EMD object uses (Auto picks the fastest one that applies, sorting
+// 1D events only when no extra particle is needed and the network simplex is an exact
+// floating point one, see EMD::set_solver); SparseNetworkSimplex and Multiscale are the lazy
+// ground distance mode, which computes the distances from the particles as they are needed
+// and keeps only those of the arcs added, so that no n0*n1 cost matrix is stored
+enum class EMDSolver : char {
+  Auto = 0,
+  NetworkSimplex = 1,
+  Sorted1D = 2,
+  Auction = 3,
+  SparseNetworkSimplex = 4,
+  Multiscale = 5
+};
+
 enum class EMDPairsStorage : char {
   Full = 0,
   FullSymmetric = 1,
   FlattenedSymmetric = 2,
-  External = 3
+  External = 3,
+  Threshold = 4,
+  Sweep = 5
 };
 
 
@@ -174,15 +222,64 @@ class PairwiseDistanceBase;
 // NetworkSimplex
 ////////////////////////////////////////////////////////////////////////////////
 
-template<typename Value, typename Arc, typename Node, typename Bool>
+struct SeparateArcLayout;
+struct PackedArcLayout;
+struct MixedPrecisionArcLayout;
+
+struct BlockSearchPivotRule;
+struct CandidateListPivotRule;
+struct AlteringCandidateListPivotRule;
+struct FirstEligiblePivotRule;
+
+template<typename Value, typename Arc, typename Node, typename Bool,
+         typename ArcLayout = SeparateArcLayout, typename PivotRule = BlockSearchPivotRule>
 class NetworkSimplex;
 
+// dispatches each problem to a narrow or wide arc index NetworkSimplex by its size
+template<class Small, class Large>
+class IndexDispatchNetworkSimplex;
+
+// 32-bit arc indices for problems small enough, index_type ones otherwise
+template<typename Value>
+using DefaultNetworkSimplex = IndexDispatchNetworkSimplex<NetworkSimplex<Value, int, int, char>,
+                                                          NetworkSimplex<Value, index_type, int, char>>;
+
+template<typename Value>
+using PackedNetworkSimplex = NetworkSimplex<Value, index_type, int, char, PackedArcLayout>;
+
+// prices double precision problems with costs rounded to float
+template<typename Value>
+using MixedPrecisionNetworkSimplex = NetworkSimplex<Value, index_type, int, char, MixedPrecisionArcLayout>;
+
+// entropically regularized alternative to NetworkSimplex
+template<typename Value>
+class Sinkhorn;
+
+// exact alternative to NetworkSimplex on weights and ground distances rounded to integers
 template<typename Value>
-using DefaultNetworkSimplex = NetworkSimplex<Value, index_type, int, char>;
+class QuantizedNetworkSimplex;
+
+// whether a network simplex finds the same exact floating point transport as sorting 1D events,
+// so that EMDSolver::Auto may sort them instead, which is not the case for Sinkhorn, whose
+// result is regularized, or QuantizedNetworkSimplex, whose result is that of rounded inputs
+template<class NetworkSimplex>
+struct is_exact_network_simplex : std::false_type {};
+
+template<typename Value, typename Arc, typename Node, typename Bool, typename ArcLayout, typename PivotRule>
+struct is_exact_network_simplex<NetworkSimplex<Value, Arc, Node, Bool, ArcLayout, PivotRule>>
+  : std::is_floating_point<Value> {};
+
+template<class Small, class Large>
+struct is_exact_network_simplex<IndexDispatchNetworkSimplex<Small, Large>>
+  : std::integral_constant<bool, is_exact_network_simplex<Small>::value && is_exact_network_simplex<Large>::value> {};
 
 #define WASSERSTEIN_NETWORKSIMPLEX_TEMPLATES \
+  WASSERSTEIN_TEMPLATE(NetworkSimplex<double, int, int, char>) \
   WASSERSTEIN_TEMPLATE(NetworkSimplex<double, index_type, int, char>) \
-  WASSERSTEIN_TEMPLATE_FLOAT32(NetworkSimplex<float, index_type, int, char>)
+  WASSERSTEIN_TEMPLATE(IndexDispatchNetworkSimplex<NetworkSimplex<double, int, int, char>, NetworkSimplex<double, index_type, int, char>>) \
+  WASSERSTEIN_TEMPLATE_FLOAT32(NetworkSimplex<float, int, int, char>) \
+  WASSERSTEIN_TEMPLATE_FLOAT32(NetworkSimplex<float, index_type, int, char>) \
+  WASSERSTEIN_TEMPLATE_FLOAT32(IndexDispatchNetworkSimplex<NetworkSimplex<float, int, int, char>, NetworkSimplex<float, index_type, int, char>>)
 
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -218,6 +315,9 @@ class EuclideanParticleDistance;
 template<typename Value>
 class YPhiParticleDistance;
 
+template<typename Value = default_value_type>
+using EuclideanDistance1D = EuclideanParticleDistance<EuclideanParticleND<1, Value>>;
+
 template<typename Value = default_value_type>
 using EuclideanDistance2D = EuclideanParticleDistance<EuclideanParticle2D<Value>>;
 
@@ -264,6 +364,9 @@ using DefaultArray2Event = ArrayEvent<Value, Array2ParticleCollection>;
 template<class Particle>
 struct EuclideanParticleEvent;
 
+template<typename Value = default_value_type>
+using EuclideanEvent1D = EuclideanParticleEvent<EuclideanParticleND<1, Value>>;
+
 template<typename Value = default_value_type>
 using EuclideanEvent2D = EuclideanParticleEvent<EuclideanParticle2D<Value>>;
 
@@ -320,9 +423,9 @@ class CenterWeightedCentroid;
 // Utility functions
 ////////////////////////////////////////////////////////////////////////////////
 
-// function that raises appropriate error from a status code
+// function that raises appropriate error from a status code (an approximate result is not an error)
 inline void check_emd_status(EMDStatus status) {
-  if (status != EMDStatus::Success)
+  if (status != EMDStatus::Success && status != EMDStatus::Approximate)
     switch (status) {
       case EMDStatus::Empty:
         throw std::runtime_error("EMDStatus - Empty");
@@ -351,6 +454,109 @@ void free_vector(std::vector<T> & vec) {
   std::vector<T>().swap(vec);
 }
 
+// reserves room for n elements in a vector, returning whether its buffer had to grow
+template<typename T>
+bool reserve_vector(std::vector<T> & vec, std::size_t n) {
+  if (n <= vec.capacity()) return false;
+  vec.reserve(n);
+  return true;
+}
+
+// resizes a vector, counting in allocations (see SolverStats) whether its buffer had to grow
+template<typename T>
+void resize_vector(std::vector<T> & vec, std::size_t n, std::size_t & allocations) {
+  (void) allocations;
+  WASSERSTEIN_SOLVER_STAT(allocations += n > vec.capacity();)
+  vec.resize(n);
+}
+
+// the number of threads for a single problem of the given size, which is num_threads (all of them
+// if it is -1) once the size reaches min_size, and one below that or inside a parallel region,
+// such as that of PairwiseEMD (always one without OpenMP)
+inline int problem_threads(int num_threads, std::size_t size, std::size_t min_size) {
+#ifdef _OPENMP
+  if (num_threads == 1 || size < min_size || omp_in_parallel()) return 1;
+  return (num_threads < 0 || num_threads > omp_get_max_threads() ? omp_get_max_threads() : num_threads);
+#else
+  return 1;
+#endif
+}
+
+// asks for the 2MB aligned part of the buffer of a vector to be backed by transparent huge
+// pages, which lasts until the buffer is reallocated (does nothing except on linux)
+template<typename T>
+void advise_huge_pages(std::vector<T> & vec) {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+  const std::uintptr_t huge_page(std::uintptr_t(1) << 21);
+  std::uintptr_t begin(reinterpret_cast<std::uintptr_t>(vec.data())),
+                 end(begin + vec.capacity() * sizeof(T));
+  begin = (begin + huge_page - 1) & ~(huge_page - 1);
+  end &= ~(huge_page - 1);
+  if (begin < end)
+    madvise(reinterpret_cast<void *>(begin), end - begin, MADV_HUGEPAGE);
+#endif
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// SolverStats - counters of the work done by the solvers
+////////////////////////////////////////////////////////////////////////////////
+
+// Accumulated over all computations since the last reset, and only collected
+// when compiled with WASSERSTEIN_SOLVER_STATS (they stay zero otherwise). The
+// pivot counts and lengths are those of the network simplex, the mean cycle
+// and stem lengths being cycle_length/pivots and stem_length/pivots, and the
+// times in seconds split each computation between filling the ground
+// distances and running the solver. Allocations counts the times a buffer of
+// the EMD or its network simplex had to grow, which stops once they have
+// reached the largest problem (or were reserved for it); it does not see any
+// other heap allocation, such as the copies of the events made by operator().
+struct SolverStats {
+
+  std::size_t n_solves, initial_pivots, pivots, degenerate_pivots, arcs_priced, cycle_length, stem_length,
+              allocations;
+  double fill_time, solve_time;
+
+  SolverStats() { reset(); }
+
+  void reset() {
+    n_solves = initial_pivots = pivots = degenerate_pivots = arcs_priced = cycle_length = stem_length = 0;
+    allocations = 0;
+    fill_time = solve_time = 0;
+  }
+
+  SolverStats & operator+=(const SolverStats & other) {
+    n_solves += other.n_solves;
+    initial_pivots += other.initial_pivots;
+    pivots += other.pivots;
+    degenerate_pivots += other.degenerate_pivots;
+    arcs_priced += other.arcs_priced;
+    cycle_length += other.cycle_length;
+    stem_length += other.stem_length;
+    allocations += other.allocations;
+    fill_time += other.fill_time;
+    solve_time += other.solve_time;
+    return *this;
+  }
+
+  std::string description() const {
+    std::ostringstream oss;
+    oss << "SolverStats" << (COMPILED_WITH_SOLVER_STATS ? "" : " (not collected)") << '\n'
+        << "  n_solves - "          << n_solves          << '\n'
+        << "  initial_pivots - "    << initial_pivots    << '\n'
+        << "  pivots - "            << pivots            << '\n'
+        << "  degenerate_pivots - " << degenerate_pivots << '\n'
+        << "  arcs_priced - "       << arcs_priced       << '\n'
+        << "  cycle_length - "      << cycle_length      << '\n'
+        << "  stem_length - "       << stem_length       << '\n'
+        << "  allocations - "       << allocations       << '\n'
+        << "  fill_time - "         << fill_time         << '\n'
+        << "  solve_time - "        << solve_time        << '\n';
+    return oss.str();
+  }
+
+}; // SolverStats
+
 
 ////////////////////////////////////////////////////////////////////////////////
 // Preprocessor - base class for preprocessing operations
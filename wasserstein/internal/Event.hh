@@ -43,6 +43,7 @@
 #include <stdexcept>
 #include <string>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 #include "EMDUtils.hh"
@@ -51,6 +52,29 @@
 
 BEGIN_WASSERSTEIN_NAMESPACE
 
+////////////////////////////////////////////////////////////////////////////////
+// EventSignature - summaries of an event used to bound EMDs without solving them
+////////////////////////////////////////////////////////////////////////////////
+
+// Filled on first use by EMD::lower_bound and EMD::upper_bound (see Bounds.hh),
+// and refilled after the particles or weights of the event are accessed for
+// modification or normalized (see EventBase::reset_signature). The dimension is -1
+// if the ground distance is not euclidean in coordinates of the particles, in
+// which case there is no centroid or projections.
+template<typename Value>
+struct EventSignature {
+
+  bool filled = false;
+  index_type dimension = -1;
+
+  // weighted mean of the coordinates
+  std::vector<Value> centroid;
+
+  // projected coordinates and particle index, sorted, for each projection direction
+  std::vector<std::vector<std::pair<Value, index_type>>> projections;
+
+}; // EventSignature
+
 ////////////////////////////////////////////////////////////////////////////////
 // EventBase - "events" constitute a weighted collection of "particles"
 ////////////////////////////////////////////////////////////////////////////////
@@ -92,17 +116,24 @@ struct EventBase {
   // access event_weight
   value_type event_weight() const { return event_weight_; }
 
-  // access particles
-  ParticleCollection & particles() { return particles_; }
+  // access particles, the modifiable access resets the signature
+  ParticleCollection & particles() { reset_signature(); return particles_; }
   const ParticleCollection & particles() const { return particles_; }
   index_type dimension() const { throw std::logic_error("shouldn't get here"); }
 
-  // access particle weights
-  WeightCollection & weights() { return weights_; }
+  // access particle weights, the modifiable access resets the signature
+  WeightCollection & weights() { reset_signature(); return weights_; }
   const WeightCollection & weights() const { return weights_; }
   value_type & total_weight() { return total_weight_; }
   const value_type & total_weight() const { return total_weight_; }
   bool has_weights() const { return has_weights_; }
+
+  // cached summaries for bounding EMDs, filled lazily on first use and reset by anything that
+  // can change the particles or weights; filling them is not thread safe, so PairwiseEMD fills
+  // them for all events before its parallel loop
+  EventSignature<value_type> & signature() const { return signature_; }
+  void reset_signature() { signature_.filled = false; }
+
   void ensure_weights() {
     if (!has_weights())
       throw std::logic_error("must have weights here");
@@ -114,6 +145,7 @@ struct EventBase {
       throw std::logic_error("Weights must be set prior to calling normalize_weights.");
 
     // normalize each weight
+    reset_signature();
     value_type norm_total(0);
     for (value_type & w : weights_)
       norm_total += (w /= total_weight_);
@@ -126,6 +158,7 @@ protected:
   WeightCollection weights_;
   value_type event_weight_, total_weight_;
   bool has_weights_;
+  mutable EventSignature<value_type> signature_;
 
 }; // EventBase
 
@@ -0,0 +1,321 @@
+//------------------------------------------------------------------------
+// This file is part of Wasserstein, a C++ library with a Python wrapper
+// that computes the Wasserstein/EMD distance. If you use it for academic
+// research, please cite or acknowledge the following works:
+//
+//   - Komiske, Metodiev, Thaler (2019) arXiv:1902.02346
+//       https://doi.org/10.1103/PhysRevLett.123.041801
+//   - Komiske, Metodiev, Thaler (2020) arXiv:2004.04159
+//       https://doi.org/10.1007/JHEP07%282020%29006
+//   - Boneel, van de Panne, Paris, Heidrich (2011)
+//       https://doi.org/10.1145/2070781.2024192
+//   - LEMON graph library https://lemon.cs.elte.hu/trac/lemon
+//
+// Copyright (C) 2019-2022 Patrick T. Komiske III
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------
+
+/*  __  __  _    _  _       _______  _____   _____   _____            _       ______
+ * |  \/  || |  | || |     |__   __||_   _| / ____| / ____|    /\    | |     |  ____|
+ * | \  / || |  | || |        | |     | |  | (___  | |        /  \   | |     | |__
+ * | |\/| || |  | || |        | |     | |   \___ \ | |       / /\ \  | |     |  __|
+ * | |  | || |__| || |____    | |    _| |_  ____) || |____  / ____ \ | |____ | |____
+ * |_|  |_| \____/ |______|   |_|   |_____||_____/  \_____|/_/    \_\|______||______|
+ */
+
+#ifndef WASSERSTEIN_MULTISCALE_HH
+#define WASSERSTEIN_MULTISCALE_HH
+
+// C++ standard library
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "EMDUtils.hh"
+#include "SparseNetworkSimplex.hh"
+
+BEGIN_WASSERSTEIN_NAMESPACE
+
+////////////////////////////////////////////////////////////////////////////////
+// Multiscale - coarse-to-fine EMD on nested clusterings of the particles
+////////////////////////////////////////////////////////////////////////////////
+
+// Each event is coarsened repeatedly by farthest point sampling: about one in
+// coarsening_factor clusters of a level becomes the center of a cluster of the
+// next level, every other cluster joins its nearest center, and the weights are
+// summed. Clusters are represented by the particle at their center, so costs at
+// any level are ground distances between particles. Coarsening stops once both
+// events have at most min_coarse_size clusters. That problem is solved by the
+// sparse network simplex from its nearest neighbor arcs, and each finer level
+// starts from the arcs between the children of every pair of clusters with
+// flow at the coarser level. Spreading the coarse flow over those arcs is a
+// feasible flow, so the restricted problem is feasible and usually close to
+// optimal, leaving few pricing rounds of the complete graph. Every level is
+// solved exactly unless max_rounds limits the rounds of the finest one, in
+// which case the status is EMDStatus::Approximate and error_bound() bounds
+// the excess over the optimal cost.
+//
+// A particle at distance numeric_limits<Value>::max() from all others, such as
+// the extra particle, is picked as a center right after the first one and so
+// remains a singleton at every level with at least two clusters.
+
+template<typename Value>
+class Multiscale {
+public:
+
+  // EMD-style typedefs
+  typedef Value value_type;
+
+  typedef index_type Node;
+  typedef index_type Arc;
+
+  Multiscale(index_type coarsening_factor = 4,
+             index_type min_coarse_size = 64,
+             std::size_t max_rounds = 0) :
+    max_rounds_(max_rounds),
+    n_levels_(0), n_iter_(0)
+  {
+    set_params(coarsening_factor, min_coarse_size);
+  }
+
+  // about one in coarsening_factor clusters is kept at each coarser level, and the
+  // coarsest level has at most min_coarse_size clusters in each event
+  index_type coarsening_factor() const { return coarsening_factor_; }
+  index_type min_coarse_size() const { return min_coarse_size_; }
+  void set_params(index_type coarsening_factor, index_type min_coarse_size) {
+    if (coarsening_factor < 2) throw std::invalid_argument("coarsening_factor must be at least 2");
+    if (min_coarse_size < 1) throw std::invalid_argument("min_coarse_size must be positive");
+    coarsening_factor_ = coarsening_factor;
+    min_coarse_size_ = min_coarse_size;
+  }
+
+  // most rounds of pricing the complete graph at the finest level, 0 for no limit
+  std::size_t max_rounds() const { return max_rounds_; }
+  void set_max_rounds(std::size_t max_rounds) { max_rounds_ = max_rounds; }
+
+  // the solver used at every level, whose parameters are set directly
+  const SparseNetworkSimplex<Value> & sparse_network_simplex() const { return solver_; }
+  SparseNetworkSimplex<Value> & sparse_network_simplex() { return solver_; }
+
+  // get description of this solver
+  std::string description() const {
+    std::ostringstream oss;
+    oss << "  Multiscale\n"
+        << "    coarsening_factor - " << coarsening_factor_ << '\n'
+        << "    min_coarse_size - "   << min_coarse_size_   << '\n'
+        << "    max_rounds - "        << max_rounds_        << '\n';
+    return oss.str();
+  }
+
+  // weights are those of the sources followed by the sinks, cost(i, j) returns the ground
+  // distance between source i and sink j, and dist0(a, b) and dist1(a, b) those between
+  // two particles of the same event
+  template<class Dist0, class Dist1, class Cost>
+  EMDStatus compute(const std::vector<Value> & weights, index_type n0, index_type n1,
+                    const Dist0 & dist0, const Dist1 & dist1, const Cost & cost) {
+
+    n_levels_ = 1;
+    n_iter_ = 0;
+    std::size_t solver_max_rounds(solver_.max_rounds());
+
+    // build the levels of both events, level 0 being the particles themselves
+    init_level(0, weights, 0, n0);
+    init_level(1, weights, n0, n1);
+    while (level_size(0, n_levels_ - 1) > min_coarse_size_ || level_size(1, n_levels_ - 1) > min_coarse_size_) {
+      coarsen(0, dist0);
+      coarsen(1, dist1);
+      n_levels_++;
+    }
+
+    // solve the coarsest level from the nearest neighbors and refine from its flow
+    EMDStatus status(EMDStatus::Success);
+    for (std::size_t l = n_levels_; l-- > 0;) {
+      const std::vector<Node> & reps0(reps_[0][l]), & reps1(reps_[1][l]);
+      auto level_cost([&](Node i, Node j) -> Value { return cost(reps0[i], reps1[j]); });
+      level_weights(l);
+      solver_.set_max_rounds(l == 0 ? max_rounds_ : 0);
+      if (l == n_levels_ - 1)
+        status = solver_.compute(weights_, reps0.size(), reps1.size(), level_cost);
+      else {
+        refined_arcs(l);
+        status = solver_.compute(weights_, reps0.size(), reps1.size(), level_cost, arcs_);
+      }
+      n_iter_ += solver_.n_iter();
+      if (status != EMDStatus::Success) break;
+    }
+
+    solver_.set_max_rounds(solver_max_rounds);
+    return status;
+  }
+
+  // access results, which are those of the finest level except for n_iter
+  Value total_cost() const { return solver_.total_cost(); }
+  Value error_bound() const { return solver_.error_bound(); }
+  std::size_t n_iter() const { return n_iter_; }
+  std::size_t n_rounds() const { return solver_.n_rounds(); }
+  std::size_t n_levels() const { return n_levels_; }
+  const std::vector<Value> & potentials() const { return solver_.potentials(); }
+  const std::vector<Value> & flows() const { return solver_.flows(); }
+  void sparse_flows(std::vector<std::pair<std::size_t, Value>> & arc_flows) const {
+    solver_.sparse_flows(arc_flows);
+  }
+
+  // free all memory
+  void free() {
+    solver_.free();
+    for (int e = 0; e < 2; e++) {
+      free_vector(reps_[e]);
+      free_vector(parents_[e]);
+      free_vector(cluster_weights_[e]);
+      free_vector(children_[e]);
+      free_vector(child_starts_[e]);
+    }
+    free_vector(weights_);
+    free_vector(arcs_);
+    free_vector(support_);
+    free_vector(min_dists_);
+    n_levels_ = 0;
+  }
+
+private:
+
+  std::size_t max_rounds_;
+  index_type coarsening_factor_, min_coarse_size_;
+  std::size_t n_levels_, n_iter_;
+
+  SparseNetworkSimplex<Value> solver_;
+
+  // for each event and level, the particle representing each cluster, the cluster
+  // of the next level it belongs to, and its weight
+  std::vector<std::vector<Node>> reps_[2], parents_[2];
+  std::vector<std::vector<Value>> cluster_weights_[2];
+
+  // weights of the current level, candidate arcs and scratch space
+  std::vector<Value> weights_, min_dists_;
+  std::vector<Arc> arcs_, support_;
+  std::vector<Node> children_[2], child_starts_[2];
+
+  index_type level_size(int e, std::size_t l) const { return reps_[e][l].size(); }
+
+  // the finest level of event e, whose weights start at weights[start]
+  void init_level(int e, const std::vector<Value> & weights, index_type start, index_type n) {
+    reps_[e].resize(1);
+    reps_[e][0].resize(n);
+    std::iota(reps_[e][0].begin(), reps_[e][0].end(), 0);
+    parents_[e].clear();
+    cluster_weights_[e].resize(1);
+    cluster_weights_[e][0].assign(weights.begin() + start, weights.begin() + start + n);
+  }
+
+  // adds a coarser level to event e by farthest point sampling of the current coarsest one
+  template<class Dist>
+  void coarsen(int e, const Dist & dist) {
+
+    std::size_t l(n_levels_ - 1);
+    const std::vector<Node> & reps(reps_[e][l]);
+    const std::vector<Value> & ws(cluster_weights_[e][l]);
+    index_type m(reps.size());
+
+    // an event that is already coarse enough keeps its clusters
+    if (m <= min_coarse_size_) {
+      std::vector<Node> coarse_reps(reps), parents(m);
+      std::vector<Value> coarse_weights(ws);
+      std::iota(parents.begin(), parents.end(), 0);
+      reps_[e].push_back(std::move(coarse_reps));
+      parents_[e].push_back(std::move(parents));
+      cluster_weights_[e].push_back(std::move(coarse_weights));
+      return;
+    }
+
+    index_type k(std::max((m + coarsening_factor_ - 1)/coarsening_factor_, min_coarse_size_));
+    std::vector<Node> coarse_reps(k), parents(m, 0);
+    min_dists_.assign(m, std::numeric_limits<Value>::infinity());
+    Node center(0);
+    for (Node c = 0; c < k; c++) {
+      coarse_reps[c] = reps[center];
+      parents[center] = c;
+      min_dists_[center] = -1;
+
+      // each cluster belongs to its nearest center so far, the next center is the farthest one
+      Node farthest(0);
+      for (Node p = 0; p < m; p++) {
+        if (min_dists_[p] < 0) continue;
+        Value d(dist(reps[p], reps[center]));
+        if (d < min_dists_[p]) {
+          min_dists_[p] = d;
+          parents[p] = c;
+        }
+        if (min_dists_[p] > min_dists_[farthest]) farthest = p;
+      }
+      center = farthest;
+    }
+
+    std::vector<Value> coarse_weights(k, 0);
+    for (Node p = 0; p < m; p++)
+      coarse_weights[parents[p]] += ws[p];
+
+    reps_[e].push_back(std::move(coarse_reps));
+    parents_[e].push_back(std::move(parents));
+    cluster_weights_[e].push_back(std::move(coarse_weights));
+  }
+
+  // weights of both events at level l, laid out as for the solver
+  void level_weights(std::size_t l) {
+    const std::vector<Value> & ws0(cluster_weights_[0][l]), & ws1(cluster_weights_[1][l]);
+    weights_.resize(ws0.size() + ws1.size());
+    std::copy(ws1.begin(), ws1.end(), std::copy(ws0.begin(), ws0.end(), weights_.begin()));
+  }
+
+  // arcs of level l between the children of each pair of clusters with flow at level l + 1
+  void refined_arcs(std::size_t l) {
+
+    support_.clear();
+    solver_.flow_support(support_);
+
+    // children of each coarse cluster, bucketed by parent
+    for (int e = 0; e < 2; e++) {
+      const std::vector<Node> & parents(parents_[e][l]);
+      std::vector<Node> & starts(child_starts_[e]), & children(children_[e]);
+      starts.assign(reps_[e][l + 1].size() + 1, 0);
+      for (Node p : parents)
+        starts[p + 1]++;
+      std::partial_sum(starts.begin(), starts.end(), starts.begin());
+      children.resize(parents.size());
+      for (Node c = 0, m = parents.size(); c < m; c++)
+        children[starts[parents[c]]++] = c;
+      std::rotate(starts.begin(), starts.end() - 1, starts.end());
+      starts[0] = 0;
+    }
+
+    Arc coarse_n1(reps_[1][l + 1].size()), n1(reps_[1][l].size());
+    arcs_.clear();
+    for (Arc a : support_) {
+      Node I(a / coarse_n1), J(a % coarse_n1);
+      for (Node ci = child_starts_[0][I]; ci < child_starts_[0][I + 1]; ci++)
+        for (Node cj = child_starts_[1][J]; cj < child_starts_[1][J + 1]; cj++)
+          arcs_.push_back(Arc(children_[0][ci])*n1 + children_[1][cj]);
+    }
+  }
+
+}; // Multiscale
+
+END_WASSERSTEIN_NAMESPACE
+
+#endif // WASSERSTEIN_MULTISCALE_HH
@@ -134,16 +134,22 @@ SOFTWARE.
 #define WASSERSTEIN_NETWORK_SIMPLEX_HH
 
 // C++ standard library
+#include <algorithm>
+#include <chrono>
 #include <cmath>
+#include <cstdlib>
 #include <iostream>
 #include <limits>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "EMDUtils.hh"
+#include "NetworkSimplexTree.hh"
+#include "PricingKernels.hh"
 
 
 BEGIN_WASSERSTEIN_NAMESPACE
@@ -154,21 +160,518 @@ BEGIN_WASSERSTEIN_NAMESPACE
 
 namespace {
 
-// main parameters of block search pivot rule, consider changing these to check for speed
-const double BLOCK_SIZE_FACTOR = 1.0;
-const int MIN_BLOCK_SIZE = 10;
 const int INVALID = -1;
 const double INVALID_COST_VALUE = -1.0;
 
 }
 
+//-----------------------------------------------------------------------------
+// Arc storage layouts for NetworkSimplex
+//-----------------------------------------------------------------------------
+
+// each layout provides a nested Arcs<Value, Arc> class holding the state of every
+// arc and the costs seen by the pricing loop, which calls `price` on runs of arcs
+// that share a source node (these are handed to the kernels in PricingKernels.hh),
+// and whose static member `exact` tells if those costs are the dists() themselves
+
+// states in their own vector, costs read directly from the dists() vector
+struct SeparateArcLayout {
+
+  template<typename Value, typename Arc>
+  class Arcs {
+  public:
+
+    static constexpr bool exact = true;
+
+    // prepare for a problem with num_arcs arcs, the first num_priced of which are priced
+    void reset(const std::vector<Value> & costs, Arc num_arcs, Arc num_priced) {
+      costs_ = costs.data();
+      states_.resize(num_arcs);
+      std::fill(states_.begin(), states_.begin() + num_priced, 1);
+    }
+
+    // makes room for a problem with up to num_arcs arcs, returning whether that allocated
+    bool reserve(Arc num_arcs, Arc) { return reserve_vector(states_, num_arcs); }
+
+    char state(Arc e) const { return states_[e]; }
+    void set_state(Arc e, char s) { states_[e] = s; }
+
+    // finds with the given kernel the minimum reduced cost among arcs [first, last), which
+    // share a source with potential pi_s, and whose targets have potentials starting at pis_t
+    void price(PricingKernel kernel, Arc first, Arc last, Value pi_s, const Value * pis_t,
+               Value & min, Arc & min_arc) const {
+      price_arcs(kernel, costs_ + first, states_.data() + first, pi_s, pis_t, first, last - first, min, min_arc);
+    }
+
+    void free() { free_vector(states_); }
+
+  private:
+    const Value * costs_;
+    std::vector<char> states_;
+  };
+};
+
+// costs and states interleaved in fixed-size blocks, so that pricing streams
+// through a single array (at the price of copying the costs for each problem)
+struct PackedArcLayout {
+
+  template<typename Value, typename Arc>
+  class Arcs {
+  public:
+
+    static constexpr bool exact = true;
+
+    // 64 arcs per block keeps blocks a whole number of 64-byte cache lines for float and double
+    static constexpr Arc BLOCK = 64;
+
+    void reset(const std::vector<Value> & costs, Arc num_arcs, Arc num_priced) {
+      blocks_.resize((num_arcs + BLOCK - 1)/BLOCK);
+      for (Arc e = 0; e < num_priced; e++) {
+        Block & block(blocks_[e/BLOCK]);
+        block.costs[e % BLOCK] = costs[e];
+        block.states[e % BLOCK] = 1;
+      }
+    }
+
+    bool reserve(Arc num_arcs, Arc) { return reserve_vector(blocks_, (num_arcs + BLOCK - 1)/BLOCK); }
+
+    char state(Arc e) const { return blocks_[e/BLOCK].states[e % BLOCK]; }
+    void set_state(Arc e, char s) { blocks_[e/BLOCK].states[e % BLOCK] = s; }
+
+    void price(PricingKernel kernel, Arc first, Arc last, Value pi_s, const Value * pis_t,
+               Value & min, Arc & min_arc) const {
+      while (first < last) {
+        const Block & block(blocks_[first/BLOCK]);
+        Arc k0(first % BLOCK), n(std::min(BLOCK - k0, last - first));
+        price_arcs(kernel, block.costs + k0, block.states + k0, pi_s, pis_t, first, n, min, min_arc);
+        first += n;
+        pis_t += n;
+      }
+    }
+
+    void free() { free_vector(blocks_); }
+
+  private:
+    struct Block {
+      Value costs[BLOCK];
+      char states[BLOCK];
+    };
+    std::vector<Block> blocks_;
+  };
+};
+
+// costs rounded to float in their own vector, so that pricing a double precision
+// problem reads half as many bytes of costs while the flows, potentials and total cost
+// stay in double precision; the float copy sits next to the double dists, which are
+// kept for the exact checks, so this saves pricing bandwidth rather than memory; an
+// arc priced with the rounded costs only enters the basis if its exact reduced cost
+// makes it eligible, and once the pivot rule runs out of arcs NetworkSimplex prices
+// every arc exactly, pivoting again if any is still eligible
+struct MixedPrecisionArcLayout {
+
+  template<typename Value, typename Arc>
+  class Arcs {
+  public:
+
+    static constexpr bool exact = false;
+
+    void reset(const std::vector<Value> & costs, Arc num_arcs, Arc num_priced) {
+      costs_.resize(num_priced);
+      std::copy(costs.begin(), costs.begin() + num_priced, costs_.begin());
+      states_.resize(num_arcs);
+      std::fill(states_.begin(), states_.begin() + num_priced, 1);
+    }
+
+    bool reserve(Arc num_arcs, Arc num_priced) {
+      bool grew(reserve_vector(costs_, num_priced));
+      return reserve_vector(states_, num_arcs) || grew;
+    }
+
+    char state(Arc e) const { return states_[e]; }
+    void set_state(Arc e, char s) { states_[e] = s; }
+
+    void price(PricingKernel kernel, Arc first, Arc last, Value pi_s, const Value * pis_t,
+               Value & min, Arc & min_arc) const {
+      price_arcs(kernel, costs_.data() + first, states_.data() + first, pi_s, pis_t, first, last - first, min, min_arc);
+    }
+
+    void free() {
+      free_vector(costs_);
+      free_vector(states_);
+    }
+
+  private:
+    std::vector<float> costs_;
+    std::vector<char> states_;
+  };
+};
+
+//-----------------------------------------------------------------------------
+// Pivot rules for NetworkSimplex
+//-----------------------------------------------------------------------------
+
+// each pivot rule provides a nested Rule<NetworkSimplex> class that selects the
+// entering arc, storing it in in_arc_ and returning false when no arc is eligible
+// - set_params takes two rule-specific parameters, a positive value sets the parameter,
+//   0 keeps its current value and a negative value restores its default (see pivot_param)
+// - reset is called at the start of every problem
+// an arc is eligible if its reduced cost is negative relative to the scale of the
+// problem, as determined by NetworkSimplex::isEnteringArc
+
+// the new value of a pivot rule parameter that is currently current, given param
+inline double pivot_param(double param, double current, double default_value) {
+  return param > 0 ? param : (param < 0 ? default_value : current);
+}
+
+// LEMON's block search: scans blocks of arcs and picks the best arc of the first
+// block that contains an eligible arc; with several threads (see
+// NetworkSimplex::set_num_threads) each of them scans one of the next blocks and
+// the best arc of those is picked if it is eligible
+// - param0: block_size_factor, block size is this times sqrt(number of arcs) (default 1)
+// - param1: min_block_size (default 10)
+struct BlockSearchPivotRule {
+
+  static const char * name() { return "BlockSearch"; }
+
+  template<class NetworkSimplex>
+  class Rule {
+    typedef typename NetworkSimplex::Value Value;
+    typedef typename NetworkSimplex::Arc Arc;
+    typedef typename NetworkSimplex::Node Node;
+
+    double block_size_factor_, min_block_size_;
+    Arc next_arc_, block_size_;
+    int num_threads_;
+    std::vector<Value> thread_mins_;
+    std::vector<Arc> thread_arcs_;
+
+  public:
+
+    Rule() { set_params(-1, -1); }
+
+    void set_params(double block_size_factor, double min_block_size) {
+      block_size_factor_ = pivot_param(block_size_factor, block_size_factor_, 1.0);
+      min_block_size_ = pivot_param(min_block_size, min_block_size_, 10);
+    }
+
+    std::string description() const {
+      std::ostringstream oss;
+      oss << name() << " (block_size_factor " << block_size_factor_
+          << ", min_block_size " << min_block_size_ << ')';
+      return oss.str();
+    }
+
+    void reset(const NetworkSimplex & ns) {
+      next_arc_ = 0;
+      block_size_ = std::max(Arc(block_size_factor_ * std::sqrt(double(ns.arcNum()))), Arc(min_block_size_));
+      num_threads_ = problem_threads(ns.num_threads(), ns.arcNum(), ns.min_parallel_arcs());
+      if (num_threads_ > 1) {
+        thread_mins_.resize(num_threads_);
+        thread_arcs_.resize(num_threads_);
+      }
+    }
+
+    // arcs are priced in runs that end at a row of the complete bipartite graph
+    // (so the source potential is fixed and the target potentials are contiguous),
+    // at the end of a block, or after every arc has been seen
+    bool findEnteringArc(NetworkSimplex & ns) {
+      Arc arc_num(ns.arcNum());
+      if (arc_num == 0) return false;
+      if (num_threads_ > 1) return findEnteringArcParallel(ns);
+
+      Value min(0);
+      Arc e(next_arc_ == arc_num ? 0 : next_arc_), remaining(arc_num), cnt(block_size_);
+      while (remaining > 0) {
+
+        Node s(ns.source(e)), t(ns.target(e));
+        Arc len(std::min(Arc(ns.nodeNum() - t), std::min(cnt, remaining)));
+        ns.arcs_.price(ns.pricing_kernel_, e, e + len, ns.pis_[s], ns.pis_.data() + t, min, ns.in_arc_);
+        WASSERSTEIN_SOLVER_STAT(ns.stats_.arcs_priced += len;)
+        e += len;
+        remaining -= len;
+
+        // check the block, next_arc_ is the last arc priced
+        if ((cnt -= len) == 0) {
+          if (min < 0 && ns.isEnteringArc(ns.in_arc_, ns.exactReducedCost(ns.in_arc_, min))) {
+            next_arc_ = e - 1;
+            return true;
+          }
+          cnt = block_size_;
+        }
+
+        // wrap around after the last arc
+        if (e == arc_num) e = 0;
+      }
+      if (min < 0 && ns.isEnteringArc(ns.in_arc_, ns.exactReducedCost(ns.in_arc_, min))) {
+        next_arc_ = e;
+        return true;
+      }
+      return false;
+    }
+
+  private:
+
+    // each round the threads price the next num_threads_ blocks, one each, and the best arc
+    // seen so far enters if it is eligible, otherwise the search goes on until every arc
+    // has been seen; ties go to the earlier block so that the pivots do not depend on timing
+    bool findEnteringArcParallel(NetworkSimplex & ns) {
+      Arc arc_num(ns.arcNum()), e(next_arc_ == arc_num ? 0 : next_arc_), remaining(arc_num);
+      Value min(0);
+      while (remaining > 0) {
+        Arc round_len(std::min(remaining, num_threads_ * block_size_));
+
+        #pragma omp parallel for num_threads(num_threads_) schedule(static, 1)
+        for (int k = 0; k < num_threads_; k++) {
+          Value thread_min(0);
+          Arc thread_arc(0), f(e + k * block_size_), len(std::min(block_size_, round_len - k * block_size_));
+          if (f >= arc_num) f -= arc_num;
+          while (len > 0) {
+            Node s(ns.source(f)), t(ns.target(f));
+            Arc n(std::min(Arc(ns.nodeNum() - t), len));
+            ns.arcs_.price(ns.pricing_kernel_, f, f + n, ns.pis_[s], ns.pis_.data() + t, thread_min, thread_arc);
+            len -= n;
+            if ((f += n) == arc_num) f = 0;
+          }
+          thread_mins_[k] = thread_min;
+          thread_arcs_[k] = thread_arc;
+        }
+
+        for (int k = 0; k < num_threads_; k++)
+          if (thread_mins_[k] < min) {
+            min = thread_mins_[k];
+            ns.in_arc_ = thread_arcs_[k];
+          }
+        WASSERSTEIN_SOLVER_STAT(ns.stats_.arcs_priced += round_len;)
+        remaining -= round_len;
+        if ((e += round_len) >= arc_num) e -= arc_num;
+
+        if (min < 0 && ns.isEnteringArc(ns.in_arc_, ns.exactReducedCost(ns.in_arc_, min))) {
+          next_arc_ = e;
+          return true;
+        }
+      }
+      return false;
+    }
+  };
+};
+
+// LEMON's candidate list: a major iteration collects eligible arcs until the list is
+// full, then minor iterations pick the best arc of the list (dropping arcs that are
+// no longer eligible) until it is empty or the minor limit is reached
+// - param0: list_length_factor, list length is this times sqrt(number of arcs) (default 0.25)
+// - param1: minor_limit_factor, minor limit is this times the list length (default 0.1)
+struct CandidateListPivotRule {
+
+  static const char * name() { return "CandidateList"; }
+
+  template<class NetworkSimplex>
+  class Rule {
+    typedef typename NetworkSimplex::Value Value;
+    typedef typename NetworkSimplex::Arc Arc;
+
+    double list_length_factor_, minor_limit_factor_;
+    Arc next_arc_, list_length_, minor_limit_, curr_length_, minor_count_;
+    std::vector<Arc> candidates_;
+
+  public:
+
+    Rule() { set_params(-1, -1); }
+
+    void set_params(double list_length_factor, double minor_limit_factor) {
+      list_length_factor_ = pivot_param(list_length_factor, list_length_factor_, 0.25);
+      minor_limit_factor_ = pivot_param(minor_limit_factor, minor_limit_factor_, 0.1);
+    }
+
+    std::string description() const {
+      std::ostringstream oss;
+      oss << name() << " (list_length_factor " << list_length_factor_
+          << ", minor_limit_factor " << minor_limit_factor_ << ')';
+      return oss.str();
+    }
+
+    void reset(const NetworkSimplex & ns) {
+      next_arc_ = curr_length_ = minor_count_ = 0;
+      list_length_ = std::max(Arc(list_length_factor_ * std::sqrt(double(ns.arcNum()))), Arc(10));
+      minor_limit_ = std::max(Arc(minor_limit_factor_ * list_length_), Arc(3));
+      candidates_.resize(list_length_);
+    }
+
+    bool findEnteringArc(NetworkSimplex & ns) {
+
+      // minor iteration: best arc of the current list
+      if (curr_length_ > 0 && minor_count_ < minor_limit_) {
+        minor_count_++;
+        Value min(0);
+        Arc best(INVALID);
+        for (Arc i = 0; i < curr_length_; i++) {
+          Arc e(candidates_[i]);
+          Value c(ns.reducedCost(e));
+          if (c < min && ns.isEnteringArc(e, c)) {
+            min = c;
+            best = e;
+          }
+          else if (c >= 0) candidates_[i--] = candidates_[--curr_length_];
+        }
+        if (best != INVALID) {
+          ns.in_arc_ = best;
+          return true;
+        }
+      }
+
+      // major iteration: build a new list
+      Arc arc_num(ns.arcNum());
+      if (arc_num == 0) return false;
+      Arc first(next_arc_ == arc_num ? 0 : next_arc_);
+      Value min(0);
+      curr_length_ = 0;
+      Arc nseen(ns.scanArcs(first, arc_num, [&](Arc e, Value c) {
+        if (c < 0 && ns.isEnteringArc(e, c)) {
+          candidates_[curr_length_++] = e;
+          if (c < min) {
+            min = c;
+            ns.in_arc_ = e;
+          }
+          return curr_length_ == list_length_;
+        }
+        return false;
+      }));
+      if (curr_length_ == 0) return false;
+
+      next_arc_ = (first + nseen) % arc_num;
+      minor_count_ = 1;
+      return true;
+    }
+  };
+};
+
+// LEMON's altering candidate list: eligible arcs found while scanning blocks are
+// added to a list that is partially sorted, the best arc enters and the next best
+// ones (the head of the list) are kept for the following iterations
+// - param0: block_size_factor, block size is this times sqrt(number of arcs) (default 1)
+// - param1: head_length_factor, head length is this times the block size (default 0.01)
+struct AlteringCandidateListPivotRule {
+
+  static const char * name() { return "AlteringCandidateList"; }
+
+  template<class NetworkSimplex>
+  class Rule {
+    typedef typename NetworkSimplex::Value Value;
+    typedef typename NetworkSimplex::Arc Arc;
+
+    double block_size_factor_, head_length_factor_;
+    Arc next_arc_, block_size_, head_length_;
+    std::vector<std::pair<Value, Arc>> candidates_;
+
+  public:
+
+    Rule() { set_params(-1, -1); }
+
+    void set_params(double block_size_factor, double head_length_factor) {
+      block_size_factor_ = pivot_param(block_size_factor, block_size_factor_, 1.0);
+      head_length_factor_ = pivot_param(head_length_factor, head_length_factor_, 0.01);
+    }
+
+    std::string description() const {
+      std::ostringstream oss;
+      oss << name() << " (block_size_factor " << block_size_factor_
+          << ", head_length_factor " << head_length_factor_ << ')';
+      return oss.str();
+    }
+
+    void reset(const NetworkSimplex & ns) {
+      next_arc_ = 0;
+      block_size_ = std::max(Arc(block_size_factor_ * std::sqrt(double(ns.arcNum()))), Arc(10));
+      head_length_ = std::max(Arc(head_length_factor_ * block_size_), Arc(3));
+      candidates_.clear();
+      candidates_.reserve(head_length_ + block_size_);
+    }
+
+    bool findEnteringArc(NetworkSimplex & ns) {
+
+      // update the reduced costs of the current list, dropping arcs that are no longer eligible
+      std::size_t curr_length(0);
+      for (const std::pair<Value, Arc> & cand : candidates_) {
+        Value c(ns.reducedCost(cand.second));
+        if (c < 0 && ns.isEnteringArc(cand.second, c))
+          candidates_[curr_length++] = std::make_pair(c, cand.second);
+      }
+      candidates_.resize(curr_length);
+
+      // extend the list block by block until it grows past the head length
+      Arc arc_num(ns.arcNum());
+      if (arc_num == 0) return false;
+      Arc first(next_arc_ == arc_num ? 0 : next_arc_), cnt(block_size_), limit(head_length_);
+      Arc nseen(ns.scanArcs(first, arc_num, [&](Arc e, Value c) {
+        if (c < 0 && ns.isEnteringArc(e, c))
+          candidates_.emplace_back(c, e);
+        if (--cnt == 0) {
+          if (Arc(candidates_.size()) > limit) return true;
+          limit = 0;
+          cnt = block_size_;
+        }
+        return false;
+      }));
+      if (candidates_.empty()) return false;
+      next_arc_ = (first + nseen) % arc_num;
+
+      // the best arc enters, the next best ones are kept
+      std::size_t new_length(std::min(std::size_t(head_length_ + 1), candidates_.size()));
+      std::partial_sort(candidates_.begin(), candidates_.begin() + new_length, candidates_.end());
+      ns.in_arc_ = candidates_[0].second;
+      candidates_[0] = candidates_[new_length - 1];
+      candidates_.resize(new_length - 1);
+      return true;
+    }
+  };
+};
+
+// LEMON's first eligible: the first eligible arc after the previous entering arc
+// - no parameters
+struct FirstEligiblePivotRule {
+
+  static const char * name() { return "FirstEligible"; }
+
+  template<class NetworkSimplex>
+  class Rule {
+    typedef typename NetworkSimplex::Value Value;
+    typedef typename NetworkSimplex::Arc Arc;
+
+    Arc next_arc_;
+
+  public:
+
+    void set_params(double, double) {}
+    std::string description() const { return name(); }
+    void reset(const NetworkSimplex &) { next_arc_ = 0; }
+
+    bool findEnteringArc(NetworkSimplex & ns) {
+      Arc arc_num(ns.arcNum());
+      if (arc_num == 0) return false;
+      Arc first(next_arc_ == arc_num ? 0 : next_arc_), in_arc(INVALID);
+      ns.scanArcs(first, arc_num, [&](Arc e, Value c) {
+        if (c < 0 && ns.isEnteringArc(e, c)) {
+          in_arc = e;
+          return true;
+        }
+        return false;
+      });
+      if (in_arc == INVALID) return false;
+      ns.in_arc_ = in_arc;
+      next_arc_ = in_arc + 1;
+      return true;
+    }
+  };
+};
+
 // templated NetworkSimplex class
 // - Value: floating point type that is used for computations
 // - Node: signed integer type that indexes particles
 // - Arc: signed integer type that (roughly) can hold the product of two Nodes
 // - Bool: boolean type (often not "bool" to avoid std::vector<bool> being slow)
-template<typename V, typename A, typename N, typename B>
-class NetworkSimplex {
+// - L: arc storage layout used by the pricing loop (see SeparateArcLayout, PackedArcLayout)
+// - P: pivot rule (see BlockSearchPivotRule and the other rules above)
+template<typename V, typename A, typename N, typename B, typename L, typename P>
+class NetworkSimplex : private NetworkSimplexTree<NetworkSimplex<V, A, N, B, L, P>, V, A, N, B> {
 
 #ifdef WASSERSTEIN_SERIALIZATION
   friend class boost::serialization::access;
@@ -176,6 +679,8 @@ class NetworkSimplex {
   void serialize(Archive & ar, const unsigned int version) {
     ar & n_iter_max_ & epsilon_large_ & epsilon_small_;
   }
+  // only the constructor parameters are archived: the pivot rule parameters, warm start,
+  // anytime mode, cost threshold, threads and pricing kernel return to their defaults
 #endif
 
 public:
@@ -188,6 +693,8 @@ public:
   typedef A Arc;
   typedef V Value;
   typedef B Bool;
+  typedef L ArcLayout;
+  typedef P PivotRule;
 
   // rough type checking
   static_assert(std::is_integral<Node>::value && std::is_signed<Node>::value,
@@ -195,7 +702,8 @@ public:
   static_assert(std::is_integral<Arc>::value && std::is_signed<Arc>::value,
                 "Arc should be a signed integral type.");
   static_assert(sizeof(Arc) >= sizeof(Node), "Arc type should be bigger-than-or-equal-to Node type");
-  static_assert(std::is_floating_point<Value>::value, "Value should be a floating point type.");
+  static_assert(std::is_floating_point<Value>::value || (std::is_integral<Value>::value && std::is_signed<Value>::value),
+                "Value should be a floating point or signed integral type.");
   static_assert(std::is_integral<Bool>::value, "Bool should be an integral type.");
 
   // vector typedefs
@@ -203,12 +711,28 @@ public:
   typedef std::vector<Arc> ArcVector;
   typedef std::vector<Value> ValueVector;
   typedef std::vector<Bool> BoolVector;
-  typedef std::vector<char> StateVector;
+  typedef typename ArcLayout::template Arcs<Value, Arc> ArcStorage;
+  typedef typename PivotRule::template Rule<NetworkSimplex> PivotRuleImpl;
+
+  typedef NetworkSimplexTree<NetworkSimplex, Value, Arc, Node, Bool> Tree;
+
+  // the pivot rule and the spanning tree updates need access to the internals
+  friend PivotRuleImpl;
+  friend Tree;
 
   // default constructor
   NetworkSimplex() :
+    relative_gap_(0),
+    max_seconds_(0),
+    cost_threshold_(std::numeric_limits<Value>::max()),
+    num_threads_(1),
+    min_parallel_arcs_(DEFAULT_MIN_PARALLEL_ARCS),
+    pricing_kernel_(default_pricing_kernel()),
+    warm_start_(false),
+    have_basis_(false),
     MAX(std::numeric_limits<Value>::max()),
-    INF(std::numeric_limits<Value>::has_infinity ? std::numeric_limits<Value>::infinity() : MAX)
+    INF(std::numeric_limits<Value>::has_infinity ? std::numeric_limits<Value>::infinity() : MAX),
+    n0_(0), n1_(0), node_num_(0), arc_num_(0)
   {}
 
   // constructor
@@ -218,10 +742,14 @@ public:
     set_params(n_iter_max, epsilon_large_factor, epsilon_small_factor);
   }
 
-  void set_params(std::size_t n_iter_max, Value epsilon_large_factor, Value epsilon_small_factor) {
+  // the meaning of the pivot rule parameters depends on the rule, 0 (the default) keeps
+  // their current values and a negative value restores the rule's default
+  void set_params(std::size_t n_iter_max, Value epsilon_large_factor, Value epsilon_small_factor,
+                  double pivot_param0 = 0, double pivot_param1 = 0) {
     n_iter_max_ = n_iter_max;
     epsilon_large_ = epsilon_large_factor * std::numeric_limits<Value>::epsilon();
     epsilon_small_ = epsilon_small_factor * std::numeric_limits<Value>::epsilon();
+    pivot_rule_.set_params(pivot_param0, pivot_param1);
   }
 
   // get description of this network simplex
@@ -230,10 +758,66 @@ public:
     oss << "  NetworkSimplex\n"
         << "    n_iter_max - "    << n_iter_max_    << '\n'
         << "    epsilon_large - " << epsilon_large_ << '\n'
-        << "    epsilon_small - " << epsilon_small_ << '\n';
+        << "    epsilon_small - " << epsilon_small_ << '\n'
+        << "    warm_start - "    << (warm_start_ ? "true" : "false") << '\n';
+    if (anytime())
+      oss << "    relative_gap - "  << relative_gap_ << '\n'
+          << "    max_seconds - "   << max_seconds_  << '\n';
+    if (has_cost_threshold())
+      oss << "    cost_threshold - " << cost_threshold_ << '\n';
+    if (num_threads_ != 1)
+      oss << "    num_threads - " << num_threads_ << " from " << min_parallel_arcs_ << " arcs\n";
+    oss << "    pivot_rule - "    << pivot_rule_.description() << '\n'
+        << "    pricing_kernel - " << pricing_kernel_name(pricing_kernel_) << '\n';
     return oss.str();
   }
 
+  // warm starting seeds the spanning tree from the previously solved problem
+  bool warm_start() const { return warm_start_; }
+  void set_warm_start(bool warm) {
+    warm_start_ = warm;
+    have_basis_ = false;
+  }
+
+  // anytime mode, enabled by a positive relative_gap or max_seconds, returns EMDStatus::Approximate
+  // with bounds on the optimal cost instead of running to optimality, once the upper bound minus
+  // the lower bound is at most relative_gap times the upper bound (checked after nodeNum() pivots
+  // and then whenever their number has doubled, as each check takes two passes over the arcs),
+  // once max_seconds have passed since the start of the computation, or when n_iter_max is reached
+  double relative_gap() const { return relative_gap_; }
+  double max_seconds() const { return max_seconds_; }
+  bool anytime() const { return relative_gap_ > 0 || max_seconds_ > 0; }
+  void set_anytime(double relative_gap, double max_seconds) {
+    relative_gap_ = relative_gap;
+    max_seconds_ = max_seconds;
+  }
+
+  // threshold decision mode, which also returns EMDStatus::Approximate, as soon as the bounds
+  // tell whether the optimal cost is below cost_threshold, i.e. once the upper bound is below it
+  // or the lower bound is not (checked on the same schedule as the relative gap); it is disabled
+  // by the largest Value, which is the default
+  Value cost_threshold() const { return cost_threshold_; }
+  bool has_cost_threshold() const { return cost_threshold_ < std::numeric_limits<Value>::max(); }
+  void set_cost_threshold(Value threshold) { cost_threshold_ = threshold; }
+
+  // threads pricing the arcs of a single problem once it has min_parallel_arcs arcs, all of
+  // them if num_threads is -1; only the default BlockSearchPivotRule uses more than one, and
+  // never inside a parallel region such as that of PairwiseEMD or without OpenMP
+  int num_threads() const { return num_threads_; }
+  std::size_t min_parallel_arcs() const { return min_parallel_arcs_; }
+  void set_num_threads(int num_threads, std::size_t min_parallel_arcs = DEFAULT_MIN_PARALLEL_ARCS) {
+    num_threads_ = num_threads;
+    min_parallel_arcs_ = min_parallel_arcs;
+  }
+
+  // kernel pricing the arcs of this network simplex (see PricingKernels.hh), which starts
+  // as default_pricing_kernel(); an unsupported kernel is replaced by the best supported
+  // one, which is returned
+  PricingKernel pricing_kernel() const { return pricing_kernel_; }
+  PricingKernel set_pricing_kernel(PricingKernel kernel) {
+    return pricing_kernel_ = supported_pricing_kernel(kernel);
+  }
+
   // set dists and weights
   ValueVector & weights() { return supplies_; }
   ValueVector & dists() { return costs_; }
@@ -241,16 +825,26 @@ public:
   // run computation given init, weights, dists
   EMDStatus compute(std::size_t n0, std::size_t n1) {
 
+    if (max_seconds_ > 0)
+      start_time_ = std::chrono::steady_clock::now();
     construct_graph(n0, n1);
     EMDStatus status(run());
 
-    // store total cost if network simplex had success
+    // remember the shape of the problem if we can warm start from it
+    have_basis_ = warm_start_ && (status == EMDStatus::Success || status == EMDStatus::Approximate);
+    prev_n0_ = n0_;
+    prev_n1_ = n1_;
+
+    // store total cost if network simplex had success, or its upper bound if it stopped early
     if (status == EMDStatus::Success) {
       total_cost_ = 0;
       for (Arc a = 0; a < arcNum(); a++)
         total_cost_ += flows_[a] * costs_[a];
+      lower_bound_ = upper_bound_ = total_cost_;
     }
-    else total_cost_ = INVALID_COST_VALUE;
+    else if (status == EMDStatus::Approximate)
+      total_cost_ = upper_bound_;
+    else total_cost_ = lower_bound_ = upper_bound_ = INVALID_COST_VALUE;
 
     return status;
   }
@@ -258,22 +852,45 @@ public:
   // access total cost
   Value total_cost() const { return total_cost_; }
 
+  // bounds on the optimal cost, which equal the total cost unless the status was Approximate: the
+  // cost of the current flows with the supply they leave unmatched moved at the largest cost,
+  // and the dual objective of the current potentials once the sink potentials are lowered until
+  // no reduced cost is negative
+  Value cost_lower_bound() const { return lower_bound_; }
+  Value cost_upper_bound() const { return upper_bound_; }
+
+  // access tolerance on the total supply
+  Value epsilon_large() const { return epsilon_large_; }
+
   // access number of iterations required
   std::size_t n_iter() const { return n_iter_; }
 
+  // access solver statistics accumulated since the last reset (see SolverStats)
+  const SolverStats & stats() const { return stats_; }
+  SolverStats & stats() { return stats_; }
+  void reset_stats() { stats_.reset(); }
+
   // flow and ground_dist vectors, only first n0_*n0_ values should be used
   const ValueVector & dists() const { return costs_; }
   const ValueVector & flows() const { return flows_; }
   const ValueVector & potentials() const { return pis_; }
 
+  // appends the nonzero flows with their arcs i*n1 + j, the arcs being uncapacitated only
+  // those of the spanning tree carry flow, so this takes time linear in the number of nodes
+  void sparse_flows(std::vector<std::pair<std::size_t, Value>> & arc_flows) const {
+    for (Node u = 0; u < nodeNum(); u++) {
+      Arc a(preds_[u]);
+      if (a < arcNum() && flows_[a] != 0)
+        arc_flows.emplace_back(a, flows_[a]);
+    }
+  }
+
   // free all memory (rarely used, probably only relevant when doing massive computations)
   void free() {
     free_vector(costs_);
     free_vector(supplies_);
     free_vector(flows_);
     free_vector(pis_);
-    free_vector(sources_);
-    free_vector(targets_);
     free_vector(parents_);
     free_vector(threads_);
     free_vector(rev_threads_);
@@ -283,7 +900,45 @@ public:
     free_vector(preds_);
     free_vector(arc_mins_);
     free_vector(forwards_);
-    free_vector(states_);
+    arcs_.free();
+    free_vector(warm_nodes_);
+    free_vector(warm_children_);
+    free_vector(warm_arcs_);
+    free_vector(warm_sums_);
+    free_vector(col_mins_);
+    have_basis_ = false;
+  }
+
+  // reserves the buffers for problems with up to n0 x n1 nodes, so that computing them
+  // does not allocate, optionally backing the arc vectors with huge pages
+  void reserve(std::size_t n0, std::size_t n1, bool huge_pages = false) {
+    std::size_t all_node_num(n0 + n1 + 1), all_arc_num(n0*n1 + n0 + n1);
+    supplies_.reserve(all_node_num);
+    pis_.reserve(all_node_num);
+    parents_.reserve(all_node_num);
+    threads_.reserve(all_node_num);
+    rev_threads_.reserve(all_node_num);
+    succ_nums_.reserve(all_node_num);
+    last_succs_.reserve(all_node_num);
+    preds_.reserve(all_node_num);
+    forwards_.reserve(all_node_num);
+    dirty_revs_.reserve(all_node_num);
+    arc_mins_.reserve(n1);
+    costs_.reserve(all_arc_num);
+    flows_.reserve(all_arc_num);
+    arcs_.reserve(all_arc_num, n0*n1);
+    if (warm_start_) {
+      warm_nodes_.reserve(all_node_num);
+      warm_arcs_.reserve(all_node_num);
+      warm_children_.reserve(all_node_num);
+      warm_sums_.reserve(all_node_num);
+    }
+    if (anytime() || has_cost_threshold())
+      col_mins_.reserve(3*n1);
+    if (huge_pages) {
+      advise_huge_pages(costs_);
+      advise_huge_pages(flows_);
+    }
   }
 
 private:
@@ -293,11 +948,9 @@ private:
   //---------------------------------------------------------------------------
 
   // State constants for arcs
-  enum ArcState : char {
-    STATE_UPPER = -1,
-    STATE_TREE  =  0,
-    STATE_LOWER =  1
-  };
+  using Tree::STATE_UPPER;
+  using Tree::STATE_TREE;
+  using Tree::STATE_LOWER;
 
   //---------------------------------------------------------------------------
   // Data storage
@@ -307,6 +960,28 @@ private:
   std::size_t n_iter_max_, n_iter_;
   Value epsilon_large_, epsilon_small_;
 
+  // anytime mode parameters, the start of the current computation and the bounds found
+  double relative_gap_, max_seconds_;
+  std::size_t next_check_;
+  Value cost_threshold_;
+  std::chrono::steady_clock::time_point start_time_;
+  Value lower_bound_, upper_bound_, max_cost_;
+  ValueVector col_mins_;
+
+  // threads for pricing a single large problem
+  int num_threads_;
+  std::size_t min_parallel_arcs_;
+
+  // kernel used by the pricing loop of the arc layout
+  PricingKernel pricing_kernel_;
+
+  // warm start settings and the shape of the last successfully solved problem
+  bool warm_start_, have_basis_;
+
+  // statistics, mutable so that the const pricing functions may count
+  mutable SolverStats stats_;
+  Node prev_n0_, prev_n1_;
+
   // large consts initialized in constructor
   Value MAX, INF;
 
@@ -315,26 +990,42 @@ private:
   ValueVector flows_; // flow along each arc
   ValueVector supplies_; // supply values of the nodes
   ValueVector pis_; // potentials of the nodes
-  NodeVector sources_; // ids of the source nodes
-  NodeVector targets_; // ids of the target nodes
 
   // spanning tree structure vectors
-  NodeVector parents_, threads_, rev_threads_, succ_nums_, last_succs_, dirty_revs_;
-  ArcVector preds_, arc_mins_;
-  BoolVector forwards_;
-  StateVector states_;
+  using Tree::parents_;
+  using Tree::threads_;
+  using Tree::rev_threads_;
+  using Tree::succ_nums_;
+  using Tree::last_succs_;
+  using Tree::dirty_revs_;
+  using Tree::preds_;
+  using Tree::forwards_;
+
+  // cheapest incoming arc of each demand node, for the initial pivots
+  ArcVector arc_mins_;
+
+  // arc states, and costs as laid out for pricing
+  ArcStorage arcs_;
 
-  // variables of BlockSearchPivotRule
-  Arc next_arc_;
-  Node block_size_;
+  // scratch space used when warm starting
+  NodeVector warm_nodes_, warm_children_;
+  ArcVector warm_arcs_;
+  ValueVector warm_sums_;
+
+  // pivot rule, which keeps its own state between iterations
+  PivotRuleImpl pivot_rule_;
 
   // other variables
   Value sum_supplies_, total_cost_;
 
   // Temporary data used in the current pivot iteration
-  Arc in_arc_;
-  Node join_, u_in_, v_in_, u_out_, v_out_;
-  Value delta_;
+  using Tree::in_arc_;
+  using Tree::join_;
+  using Tree::u_in_;
+  using Tree::v_in_;
+  using Tree::u_out_;
+  using Tree::v_out_;
+  using Tree::delta_;
 
   //---------------------------------------------------------------------------
   // FullBipartiteGraph functionality
@@ -375,7 +1066,9 @@ private:
   Node maxNodeId() const { return node_num_ - 1; }
   Arc maxArcId() const { return arc_num_ - 1; }
 
-  // get node from arc
+  // get node from arc, valid for the arcs of the bipartite graph only
+  // (artificial arc arcNum() + u joins u to the root, in the direction given by forwards_[u]
+  // while it is in the tree, and its endpoints are never needed otherwise)
   Node source(Arc arc) const { return arc / n1_; }
   Node target(Arc arc) const { return (arc % n1_) + n0_; }
 
@@ -401,35 +1094,35 @@ private:
 
   EMDStatus run() {
 
+    // carry the previous spanning tree over to the node/arc indices of this problem
+    bool warm(warm_start_ && have_basis_ && nodeNum() > 0);
+    if (warm) mapPreviousTree();
+
     // reset vectors that are sized according to number of nodes
     Node all_node_num(nodeNum() + 1); // includes extra 1 for root node
-    supplies_.resize(all_node_num);
-    pis_.resize(all_node_num);
-    parents_.resize(all_node_num);
-    threads_.resize(all_node_num);
-    rev_threads_.resize(all_node_num);
-    succ_nums_.resize(all_node_num);
-    last_succs_.resize(all_node_num);
-    preds_.resize(all_node_num);
-    forwards_.resize(all_node_num);
+    std::size_t & allocs(stats_.allocations);
+    resize_vector(supplies_, all_node_num, allocs);
+    resize_vector(pis_, all_node_num, allocs);
+    resize_vector(parents_, all_node_num, allocs);
+    resize_vector(threads_, all_node_num, allocs);
+    resize_vector(rev_threads_, all_node_num, allocs);
+    resize_vector(succ_nums_, all_node_num, allocs);
+    resize_vector(last_succs_, all_node_num, allocs);
+    resize_vector(preds_, all_node_num, allocs);
+    resize_vector(forwards_, all_node_num, allocs);
+
+    // the stem of a pivot never has more nodes than the tree
+    WASSERSTEIN_SOLVER_STAT(allocs += std::size_t(all_node_num) > dirty_revs_.capacity();)
+    dirty_revs_.reserve(all_node_num);
 
     // reset vectors sized according to number of arcs
     Arc all_arc_num(arcNum() + nodeNum()); // preparing for EQ constraints in init
-    costs_.resize(all_arc_num);
-    flows_.resize(all_arc_num);
-    sources_.resize(all_arc_num); // look into storing this since they will be recomputed many times
-    targets_.resize(all_arc_num); // look into storing this since they will be recomputed many times
-    states_.resize(all_arc_num);
+    resize_vector(costs_, all_arc_num, allocs);
+    resize_vector(flows_, all_arc_num, allocs);
 
     // zero out flow (later nodes are initialized below)
     std::fill(flows_.begin(), flows_.begin() + arcNum(), 0);
 
-    // store the arcs in the original order
-    for (Arc a = 0; a < arcNum(); a++) {
-      sources_[a] = source(a);
-      targets_[a] = target(a);
-    }
-
     // check for empty problem
     if (nodeNum() == 0) return EMDStatus::Empty;
 
@@ -439,76 +1132,88 @@ private:
       sum_supplies_ += supplies_[i];
     for (Node i = nsource(); i < nodeNum(); i++)
       sum_supplies_ += (supplies_[i] *= -1);
-    if (std::fabs(sum_supplies_) > epsilon_large_) {
+    if (std::abs(sum_supplies_) > epsilon_large_) {
       std::cerr << "sumsupplies_ " << sum_supplies_ << '\n';
       return EMDStatus::SupplyMismatch;
     }
     sum_supplies_ = 0;
 
-    // initialize artificial cost
-    Value artcosts;
-    if (std::numeric_limits<Value>::is_exact)
-      artcosts = std::numeric_limits<Value>::max() / 2 + 1;
-    else
-      artcosts = (*std::max_element(costs_.begin(), costs_.end()) + 1) * nodeNum();
-
-    // initialize arc maps
-    std::fill(states_.begin(), states_.begin() + arcNum(), STATE_LOWER);
-
-    // set data for the artificial root node
-    Node root(nodeNum());
-    parents_[root] = -1;
-    preds_[root] = -1;
-    threads_[root] = 0;
-    rev_threads_[0] = root;
-    succ_nums_[root] = nodeNum() + 1;
-    last_succs_[root] = root - 1;
-    supplies_[root] = -sum_supplies_;
-    pis_[root] = 0;
-
-    // EQ supply constraints
-    Arc e(arcNum());
-    for (Node u = 0; u < nodeNum(); u++, e++) {
-      parents_[u] = root;
-      preds_[u] = e;
-      threads_[u] = u + 1;
-      rev_threads_[u + 1] = u;
-      succ_nums_[u] = 1;
-      last_succs_[u] = u;
-      states_[e] = STATE_TREE;
-      if (supplies_[u] >= 0) {
-        forwards_[u] = true;
-        pis_[u] = 0;
-        sources_[e] = u;
-        targets_[e] = root;
-        flows_[e] = supplies_[u];
-        costs_[e] = 0;
-      } else {
-        forwards_[u] = false;
-        pis_[u] = artcosts;
-        sources_[e] = root;
-        targets_[e] = u;
-        flows_[e] = -supplies_[u];
-        costs_[e] = artcosts;
+    // initialize artificial cost, which also bounds the potentials for integral costs
+    // (LEMON's max/2 + 1 would overflow when the reduced costs of the artificial arcs are taken)
+    max_cost_ = arcNum() > 0 ? *std::max_element(costs_.begin(), costs_.begin() + arcNum()) : 0;
+    Value artcosts((max_cost_ + 1) * nodeNum());
+
+    // initialize arc maps (all arcs of the bipartite graph start at STATE_LOWER)
+    WASSERSTEIN_SOLVER_STAT(allocs += arcs_.reserve(all_arc_num, arcNum());)
+    arcs_.reset(costs_, all_arc_num, arcNum());
+
+    // initialize pivot rule
+    pivot_rule_.reset(*this);
+
+    // seed the spanning tree from the previous problem instead of the artificial one
+    if (warm) warmStartTree(artcosts);
+    else {
+
+      // set data for the artificial root node
+      Node root(nodeNum());
+      parents_[root] = -1;
+      preds_[root] = -1;
+      threads_[root] = 0;
+      rev_threads_[0] = root;
+      succ_nums_[root] = nodeNum() + 1;
+      last_succs_[root] = root - 1;
+      supplies_[root] = -sum_supplies_;
+      pis_[root] = 0;
+
+      // EQ supply constraints
+      Arc e(arcNum());
+      for (Node u = 0; u < nodeNum(); u++, e++) {
+        parents_[u] = root;
+        preds_[u] = e;
+        threads_[u] = u + 1;
+        rev_threads_[u + 1] = u;
+        succ_nums_[u] = 1;
+        last_succs_[u] = u;
+        arcs_.set_state(e, STATE_TREE);
+        if (supplies_[u] >= 0) {
+          forwards_[u] = true;
+          pis_[u] = 0;
+          flows_[e] = supplies_[u];
+          costs_[e] = 0;
+        } else {
+          forwards_[u] = false;
+          pis_[u] = artcosts;
+          flows_[e] = -supplies_[u];
+          costs_[e] = artcosts;
+        }
       }
     }
 
-    // initialize block search pivot rule
-    next_arc_ = 0;
-    block_size_ = std::max(Node(BLOCK_SIZE_FACTOR * std::sqrt(Value(arcNum()))), MIN_BLOCK_SIZE);
-
     // perform heuristic initial pivots
     if (!initialPivots()) return EMDStatus::Unbounded;
 
     // Execute the Network Simplex algorithm
+    return start();
+  }
+
+  // main pivoting loop followed by a check that no flow remains on artificial arcs
+  EMDStatus start() {
+
     n_iter_ = 0;
-    while (findEnteringArc()) {
-      if (n_iter_++ >= n_iter_max_)
-        return EMDStatus::MaxIterReached;
+    next_check_ = nodeNum();
+    while (pivot_rule_.findEnteringArc(*this) || (!ArcStorage::exact && findEnteringArcExactly())) {
+      if (n_iter_++ >= n_iter_max_) {
+        if (!anytime()) return EMDStatus::MaxIterReached;
+        findBounds();
+        return EMDStatus::Approximate;
+      }
+      if ((anytime() || has_cost_threshold()) && stopEarly())
+        return EMDStatus::Approximate;
 
       findJoinNode();
       bool change(findLeavingArc());
       if (delta_ >= MAX) return EMDStatus::Unbounded;
+      WASSERSTEIN_SOLVER_STAT(stats_.pivots++; if (delta_ == 0) stats_.degenerate_pivots++;)
       changeFlow(change);
       if (change) {
         updateTreeStructure();
@@ -517,9 +1222,9 @@ private:
     }
 
     // Check feasibility
-    for (Arc e = arcNum(); e != all_arc_num; e++) {
+    for (Arc e = arcNum(), all_arc_num = arcNum() + nodeNum(); e != all_arc_num; e++) {
       if (flows_[e] != 0) {
-        if (std::fabs(flows_[e]) > epsilon_large_) {
+        if (std::abs(flows_[e]) > epsilon_large_) {
           std::cerr << "Bad flow: " << flows_[e] << '\n';
           return EMDStatus::Infeasible;
         }
@@ -530,46 +1235,280 @@ private:
     return EMDStatus::Success;
   }
 
+  // in anytime or threshold mode, finds the bounds and tells whether to stop if the time is up
+  // (checked every 32 pivots), if the gap between the bounds is small enough or if they settle
+  // which side of the threshold the optimal cost is on
+  bool stopEarly() {
+    if (max_seconds_ > 0 && n_iter_ % 32 == 0 &&
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time_).count() >= max_seconds_) {
+      findBounds();
+      return true;
+    }
+    if ((relative_gap_ > 0 || has_cost_threshold()) && n_iter_ >= next_check_) {
+      next_check_ *= 2;
+      findBounds();
+      return (has_cost_threshold() && (upper_bound_ < cost_threshold_ || lower_bound_ >= cost_threshold_)) ||
+             upper_bound_ - lower_bound_ <= relative_gap_ * std::abs(upper_bound_);
+    }
+    return false;
+  }
+
+  // bounds on the optimal cost from the current flows and potentials (see cost_lower_bound),
+  // summed in at least double precision as the potentials of an integral problem can be large
+  void findBounds() {
+    typedef typename std::common_type<Value, double>::type Sum;
+    resize_vector(col_mins_, 3*ntarget(), stats_.allocations);
+    Value * cost_col_mins(col_mins_.data() + ntarget()), * col_flows(cost_col_mins + ntarget());
+    std::fill(col_mins_.begin(), col_mins_.begin() + 2*ntarget(), MAX);
+    std::fill(col_flows, col_flows + ntarget(), 0);
+
+    // cost and amount of the flow between the events, the flow in excess of the supply of a node
+    // (which a tree seeded from the previous problem may have), the largest sink potentials that
+    // keep every reduced cost non-negative, and the cheapest arc out of each source and into each
+    // sink, which are dual solutions in their own right
+    Sum cost(0), moved(0), excess(0), supply(0), dual(0), row_dual(0), col_dual(0);
+    Value min_cost(MAX);
+    for (Node i = 0; i < nsource(); i++) {
+      Value pi(pis_[i]), row_min(MAX);
+      Sum out(0);
+      for (Arc a = Arc(i)*ntarget(), j = 0; j < ntarget(); a++, j++) {
+        cost += Sum(flows_[a]) * costs_[a];
+        out += flows_[a];
+        col_flows[j] += flows_[a];
+        row_min = std::min(row_min, costs_[a]);
+        col_mins_[j] = std::min(col_mins_[j], costs_[a] + pi);
+        cost_col_mins[j] = std::min(cost_col_mins[j], costs_[a]);
+      }
+      moved += out;
+      excess += std::max(out - supplies_[i], Sum(0));
+      supply += supplies_[i];
+      row_dual += Sum(supplies_[i]) * row_min;
+      min_cost = std::min(min_cost, row_min);
+    }
+    if (nsource() > 0)
+      for (Node j = 0; j < ntarget(); j++) {
+        Sum demand(-supplies_[nsource() + j]);
+        excess += std::max(col_flows[j] - demand, Sum(0));
+        dual += demand * col_mins_[j];
+        col_dual += demand * cost_col_mins[j];
+      }
+
+    // the source potentials as large as those sink potentials allow, which is at least as good
+    // as the current ones
+    for (Node i = 0; i < nsource(); i++) {
+      Value u(MAX);
+      for (Arc a = Arc(i)*ntarget(), j = 0; j < ntarget(); a++, j++)
+        u = std::min(u, costs_[a] - col_mins_[j]);
+      dual += Sum(supplies_[i]) * u;
+    }
+
+    // removing the excess flow, at most excess units, and moving whatever supply is left
+    // unmatched at the largest cost gives a transport plan costing at most upper
+    Sum upper(cost + (supply - moved) * max_cost_);
+    if (excess > 0) upper += excess * (Sum(max_cost_) - min_cost);
+    upper_bound_ = Value(upper);
+    lower_bound_ = Value(std::min(std::max(dual, std::max(row_dual, col_dual)), upper));
+  }
+
   //---------------------------------------------------------------------------
-  // BlockSearchPivotRule functionality
+  // Pricing functionality used by the pivot rules
   //---------------------------------------------------------------------------
 
-  // find next entering arc
-  bool findEnteringArc() {
-    Value a, c, min(0);
-    Arc e(next_arc_);
-    Node cnt(block_size_);
-    for (Arc ind = 0; ind < arcNum(); ind++, e++) {
-      if (e == arcNum()) e -= arcNum();
+  // reduced cost of an arc of the bipartite graph, signed so that it is negative if the arc may enter
+  Value reducedCost(Arc e) const {
+    return arcs_.state(e) * (costs_[e] + pis_[source(e)] - pis_[target(e)]);
+  }
+
+  // reduced cost c of arc e as found by the pricing loop of the arc layout, recomputed if it is inexact
+  Value exactReducedCost(Arc e, Value c) const {
+    return ArcStorage::exact ? c : reducedCost(e);
+  }
+
+  // prices every arc with the exact costs, entering the best one if it is eligible, which
+  // confirms optimality (or not) after the layout's pricing loop finds no entering arc
+  bool findEnteringArcExactly() {
+    if (arcNum() == 0) return false;
 
-      c = states_[e] * (costs_[e] + pis_[sources_[e]] - pis_[targets_[e]]);
+    Value min(0);
+    Arc min_arc(INVALID);
+    scanArcs(0, arcNum(), [&](Arc e, Value c) {
       if (c < min) {
         min = c;
-        in_arc_ = e;
+        min_arc = e;
       }
-      if (--cnt == 0) {
-        Value pisources__in_arc_(std::fabs(pis_[sources_[in_arc_]])),
-              pitargets__in_arc_(std::fabs(pis_[targets_[in_arc_]])),
-              cost_in_arc_(std::fabs(costs_[in_arc_]));
-        a = pisources__in_arc_ > pitargets__in_arc_ ? pisources__in_arc_ : pitargets__in_arc_;
-        if (a < cost_in_arc_) a = cost_in_arc_;
-        if (min < -epsilon_small_*a) {
-          next_arc_ = e;
-          return true;
+      return false;
+    });
+    if (min_arc == INVALID || !isEnteringArc(min_arc, min)) return false;
+    in_arc_ = min_arc;
+    return true;
+  }
+
+  // calls f(e, reduced cost of e) for count arcs starting at first, wrapping around after
+  // the last arc, and stops early if f returns true; returns the number of arcs seen
+  // (the endpoints are tracked along the rows so they are never divided out)
+  template<class F>
+  Arc scanArcs(Arc first, Arc count, F f) const {
+    Arc e(first);
+    Node s(source(e)), t(target(e));
+    for (Arc ind = 0; ind < count; ind++) {
+      if (f(e, arcs_.state(e) * (costs_[e] + pis_[s] - pis_[t]))) {
+        WASSERSTEIN_SOLVER_STAT(stats_.arcs_priced += ind + 1;)
+        return ind + 1;
+      }
+      e++;
+      if (++t == nodeNum()) {
+        t = nsource();
+        if (++s == nsource()) {
+          s = 0;
+          e = 0;
         }
-        cnt = block_size_;
       }
     }
-    Value pisources__in_arc_(std::fabs(pis_[sources_[in_arc_]])),
-          pitargets__in_arc_(std::fabs(pis_[targets_[in_arc_]])),
-          cost_in_arc_(std::fabs(costs_[in_arc_]));
-    a = pisources__in_arc_ > pitargets__in_arc_ ? pisources__in_arc_ : pitargets__in_arc_;
-    if (a < cost_in_arc_) a = cost_in_arc_;
-    if (min < -epsilon_small_*a) {
-      next_arc_ = e;
-      return true;
+    WASSERSTEIN_SOLVER_STAT(stats_.arcs_priced += count;)
+    return count;
+  }
+
+  // checks that the reduced cost c of arc e is negative relative to the scale of the problem
+  bool isEnteringArc(Arc e, Value c) const {
+    Value pisource(std::abs(pis_[source(e)])),
+          pitarget(std::abs(pis_[target(e)])),
+          cost(std::abs(costs_[e]));
+    Value a(pisource > pitarget ? pisource : pitarget);
+    if (a < cost) a = cost;
+    return c < -epsilon_small_*a;
+  }
+
+  //---------------------------------------------------------------------------
+  // Warm start functionality
+  //---------------------------------------------------------------------------
+
+  // translates the parent and pred of each node of the previous spanning tree
+  // into the node and arc indices of the current problem, storing them in
+  // warm_nodes_ and warm_arcs_ (an index of -1 means "attach to the root")
+  // - sources keep their index i, sinks keep their index j within their event
+  // - nodes or arcs without a counterpart in the current problem are dropped
+  void mapPreviousTree() {
+
+    Node prev_node_num(prev_n0_ + prev_n1_);
+    Arc prev_arc_num(Arc(prev_n0_)*Arc(prev_n1_));
+    resize_vector(warm_nodes_, nodeNum(), stats_.allocations);
+    resize_vector(warm_arcs_, nodeNum(), stats_.allocations);
+    std::fill(warm_nodes_.begin(), warm_nodes_.end(), INVALID);
+    std::fill(warm_arcs_.begin(), warm_arcs_.end(), INVALID);
+
+    for (Node u = 0; u < prev_node_num; u++) {
+
+      // index of u in the current problem
+      Node v(u < prev_n0_ ? (u < nsource() ? u : INVALID)
+                          : (u - prev_n0_ < ntarget() ? u - prev_n0_ + nsource() : INVALID));
+      if (v == INVALID || parents_[u] == prev_node_num || preds_[u] >= prev_arc_num)
+        continue;
+
+      // endpoints of pred arc in the current problem
+      Node i(preds_[u] / prev_n1_), j(preds_[u] % prev_n1_);
+      if (i >= nsource() || j >= ntarget())
+        continue;
+
+      warm_nodes_[v] = (u < prev_n0_ ? j + nsource() : i);
+      warm_arcs_[v] = Arc(i)*ntarget() + j;
+    }
+  }
+
+  // rebuilds threads_, rev_threads_, succ_nums_ and last_succs_ from parents_
+  // using a preorder traversal starting at the root, which is stored in warm_nodes_
+  void rebuildThreads() {
+
+    Node root(nodeNum()), all_node_num(nodeNum() + 1);
+
+    // children of each node in compressed form, reusing succ_nums_ as counters
+    std::fill(succ_nums_.begin(), succ_nums_.end(), 0);
+    for (Node u = 0; u < nodeNum(); u++)
+      succ_nums_[parents_[u]]++;
+    last_succs_[0] = 0;
+    for (Node u = 1; u < all_node_num; u++)
+      last_succs_[u] = last_succs_[u - 1] + succ_nums_[u - 1];
+    resize_vector(warm_children_, nodeNum(), stats_.allocations);
+    for (Node u = nodeNum() - 1; u >= 0; u--)
+      warm_children_[last_succs_[parents_[u]] + --succ_nums_[parents_[u]]] = u;
+
+    // preorder traversal with an explicit stack (rev_threads_ is free to use here)
+    resize_vector(warm_nodes_, all_node_num, stats_.allocations);
+    Node nstack(0), norder(0);
+    rev_threads_[nstack++] = root;
+    while (nstack > 0) {
+      Node u(rev_threads_[--nstack]);
+      warm_nodes_[norder++] = u;
+      Node end(u == root ? nodeNum() : last_succs_[u + 1]);
+      for (Node c = end - 1; c >= last_succs_[u]; c--)
+        rev_threads_[nstack++] = warm_children_[c];
+    }
+
+    // threads_ follow the preorder, subtrees are contiguous in it
+    for (Node k = 0; k < all_node_num; k++) {
+      Node u(warm_nodes_[k]), next(warm_nodes_[k + 1 == all_node_num ? 0 : k + 1]);
+      threads_[u] = next;
+      rev_threads_[next] = u;
+      succ_nums_[u] = 1;
+      last_succs_[u] = u;
+    }
+    for (Node k = all_node_num - 1; k > 0; k--) {
+      Node u(warm_nodes_[k]), p(parents_[u]);
+      succ_nums_[p] += succ_nums_[u];
+      if (last_succs_[p] == p)
+        last_succs_[p] = last_succs_[u];
+    }
+  }
+
+  // sets up a feasible spanning tree from the mapped previous one
+  // - subtrees whose required flow would be negative are cut and hung from the root
+  // - flows are then determined by the supplies and potentials by the tree arcs
+  void warmStartTree(Value artcosts) {
+
+    Node root(nodeNum());
+    parents_[root] = -1;
+    preds_[root] = -1;
+    supplies_[root] = 0;
+    pis_[root] = 0;
+
+    // mapped tree, with artificial arcs for every node attached to the root
+    for (Node u = 0; u < nodeNum(); u++) {
+      Arc e(arcNum() + u);
+      parents_[u] = warm_nodes_[u] == INVALID ? root : warm_nodes_[u];
+      preds_[u] = warm_arcs_[u] == INVALID ? e : warm_arcs_[u];
+      forwards_[u] = (u < nsource());
+      arcs_.set_state(e, STATE_LOWER);
+      flows_[e] = costs_[e] = 0;
+    }
+    rebuildThreads();
+
+    // accumulate supplies up the tree, cutting subtrees that cannot be fed
+    resize_vector(warm_sums_, root + 1, stats_.allocations);
+    std::copy(supplies_.begin(), supplies_.begin() + root + 1, warm_sums_.begin());
+    for (Node k = root; k > 0; k--) {
+      Node u(warm_nodes_[k]), p(parents_[u]);
+      Value sum(warm_sums_[u]);
+      if (p != root && (forwards_[u] ? sum : -sum) < 0) {
+        parents_[u] = p = root;
+        preds_[u] = arcNum() + u;
+      }
+      if (p == root)
+        forwards_[u] = (sum >= 0);
+      else warm_sums_[p] += sum;
+      flows_[preds_[u]] = (forwards_[u] ? sum : -sum);
+      arcs_.set_state(preds_[u], STATE_TREE);
+    }
+    rebuildThreads();
+
+    // artificial arcs in the tree pointing away from the root carry the artificial cost
+    for (Node u = 0; u < nodeNum(); u++)
+      if (parents_[u] == root && !forwards_[u])
+        costs_[arcNum() + u] = artcosts;
+
+    // potentials make the reduced costs of tree arcs vanish
+    for (Node k = 1; k <= root; k++) {
+      Node u(warm_nodes_[k]);
+      pis_[u] = pis_[parents_[u]] + (forwards_[u] ? -costs_[preds_[u]] : costs_[preds_[u]]);
     }
-    return false;
   }
 
   //---------------------------------------------------------------------------
@@ -581,6 +1520,7 @@ private:
 
     // Find the min. cost incomming arc for each demand node
     arc_mins_.clear();
+    WASSERSTEIN_SOLVER_STAT(stats_.allocations += std::size_t(ntarget()) > arc_mins_.capacity();)
     arc_mins_.reserve(ntarget());
     for (Node v = nsource(); v < nodeNum(); v++) {
       Value c, mincosts_ = std::numeric_limits<Value>::max();
@@ -599,10 +1539,11 @@ private:
     // Perform heuristic initial pivots
     for (Arc a : arc_mins_) {
       in_arc_ = a;
-      if (states_[in_arc_] * (costs_[in_arc_] + pis_[sources_[in_arc_]] - pis_[targets_[in_arc_]]) >= 0) continue;
+      if (arcs_.state(in_arc_) * (costs_[in_arc_] + pis_[source(in_arc_)] - pis_[target(in_arc_)]) >= 0) continue;
       findJoinNode();
       bool change(findLeavingArc());
       if (delta_ >= MAX) return false;
+      WASSERSTEIN_SOLVER_STAT(stats_.initial_pivots++;)
       changeFlow(change);
       if (change) {
         updateTreeStructure();
@@ -612,193 +1553,215 @@ private:
     return true;
   }
 
-  // Find the join_ node
-  void findJoinNode() {
-    Node u(sources_[in_arc_]), v(targets_[in_arc_]);
-    while (u != v) {
-      if (succ_nums_[u] < succ_nums_[v]) u = parents_[u];
-      else v = parents_[v];
-    }
-    join_ = u;
+  // spanning tree updates (see NetworkSimplexTree)
+  using Tree::findJoinNode;
+  using Tree::findLeavingArc;
+  using Tree::changeFlow;
+  using Tree::updateTreeStructure;
+  using Tree::updatePotential;
+
+  // arc states and statistics for the spanning tree updates
+  char arc_state(Arc e) const { return arcs_.state(e); }
+  void set_arc_state(Arc e, char s) { arcs_.set_state(e, s); }
+  void count_cycle_node() { WASSERSTEIN_SOLVER_STAT(stats_.cycle_length++;) }
+  void count_stem_length(std::size_t length) {
+    (void) length;
+    WASSERSTEIN_SOLVER_STAT(stats_.stem_length += length;)
   }
 
-  // Find the leaving arc of the cycle and returns true if the
-  // leaving arc is not the same as the entering arc
-  bool findLeavingArc() {
+}; // NetworkSimplex
 
-    // Initialize first and second nodes according to the direction of the cycle
-    Node first, second;
-    if (states_[in_arc_] == STATE_LOWER) {
-      first  = sources_[in_arc_];
-      second = targets_[in_arc_];
-    } else {
-      first  = targets_[in_arc_];
-      second = sources_[in_arc_];
-    }
+//-----------------------------------------------------------------------------
+// IndexDispatchNetworkSimplex
+//-----------------------------------------------------------------------------
 
-    delta_ = INF;
-    char result(0);
-    Value d;
+// holds a NetworkSimplex with narrow (typically 32-bit) arc indices and one with wide
+// arc indices, choosing per problem the narrow one whenever all of its arcs, including
+// the artificial ones, fit in its Arc type, so the arc vectors of typical events are
+// half the size; the wide solver keeps the usual overflow checks for larger problems.
+// The weights and dists live here and are swapped into the chosen solver for the
+// duration of compute, so they are filled once and their capacity is shared
+template<class Small, class Large>
+class IndexDispatchNetworkSimplex {
 
-    // Search the cycle along the path from the first node to the root
-    for (Node u = first; u != join_; u = parents_[u]) {
-      d = forwards_[u] ? flows_[preds_[u]] : INF;
-      if (d < delta_) {
-        delta_ = d;
-        u_out_ = u;
-        result = 1;
-      }
+#ifdef WASSERSTEIN_SERIALIZATION
+  friend class boost::serialization::access;
+  template<class Archive>
+  void serialize(Archive & ar, const unsigned int version) {
+    ar & small_ & large_;
+  }
+#endif
+
+public:
+
+  typedef typename Large::value_type value_type;
+  typedef typename Large::Value Value;
+  typedef std::vector<Value> ValueVector;
+
+  static_assert(std::is_same<Value, typename Small::Value>::value,
+                "both solvers should have the same Value type");
+  static_assert(std::is_same<typename Small::Node, typename Large::Node>::value,
+                "both solvers should have the same Node type");
+
+  IndexDispatchNetworkSimplex() : last_small_(true) {}
+  IndexDispatchNetworkSimplex(std::size_t n_iter_max, Value epsilon_large_factor, Value epsilon_small_factor) :
+    small_(n_iter_max, epsilon_large_factor, epsilon_small_factor),
+    large_(n_iter_max, epsilon_large_factor, epsilon_small_factor),
+    last_small_(true)
+  {}
+
+  void set_params(std::size_t n_iter_max, Value epsilon_large_factor, Value epsilon_small_factor,
+                  double pivot_param0 = 0, double pivot_param1 = 0) {
+    small_.set_params(n_iter_max, epsilon_large_factor, epsilon_small_factor, pivot_param0, pivot_param1);
+    large_.set_params(n_iter_max, epsilon_large_factor, epsilon_small_factor, pivot_param0, pivot_param1);
+  }
+
+  std::string description() const {
+    std::ostringstream oss;
+    oss << large_.description()
+        << "    arc_index_bytes - " << sizeof(typename Small::Arc) << " up to "
+                                    << max_small_arcs() << " arcs, else "
+                                    << sizeof(typename Large::Arc) << '\n';
+    return oss.str();
+  }
+
+  bool warm_start() const { return large_.warm_start(); }
+  void set_warm_start(bool warm) {
+    small_.set_warm_start(warm);
+    large_.set_warm_start(warm);
+  }
+
+  double relative_gap() const { return large_.relative_gap(); }
+  double max_seconds() const { return large_.max_seconds(); }
+  bool anytime() const { return large_.anytime(); }
+  void set_anytime(double relative_gap, double max_seconds) {
+    small_.set_anytime(relative_gap, max_seconds);
+    large_.set_anytime(relative_gap, max_seconds);
+  }
+  Value cost_threshold() const { return large_.cost_threshold(); }
+  bool has_cost_threshold() const { return large_.has_cost_threshold(); }
+  void set_cost_threshold(Value threshold) {
+    small_.set_cost_threshold(threshold);
+    large_.set_cost_threshold(threshold);
+  }
+
+  int num_threads() const { return large_.num_threads(); }
+  std::size_t min_parallel_arcs() const { return large_.min_parallel_arcs(); }
+  void set_num_threads(int num_threads, std::size_t min_parallel_arcs = DEFAULT_MIN_PARALLEL_ARCS) {
+    small_.set_num_threads(num_threads, min_parallel_arcs);
+    large_.set_num_threads(num_threads, min_parallel_arcs);
+  }
+
+  PricingKernel pricing_kernel() const { return large_.pricing_kernel(); }
+  PricingKernel set_pricing_kernel(PricingKernel kernel) {
+    small_.set_pricing_kernel(kernel);
+    return large_.set_pricing_kernel(kernel);
+  }
+
+  ValueVector & weights() { return supplies_; }
+  ValueVector & dists() { return costs_; }
+
+  // largest number of arcs, artificial ones included, handled by the narrow solver
+  static std::size_t max_small_arcs() {
+    return std::size_t(std::numeric_limits<typename Small::Arc>::max());
+  }
+  static bool fits_small(std::size_t n0, std::size_t n1) {
+    return n0 + n1 <= std::size_t(std::numeric_limits<typename Small::Node>::max()) &&
+           (n1 == 0 || n0 <= (max_small_arcs() - n0 - n1) / n1);
+  }
+
+  EMDStatus compute(std::size_t n0, std::size_t n1) {
+    bool small(fits_small(n0, n1));
+
+    // a basis left in the other solver is from an older problem, don't warm start from it
+    if (small != last_small_ && warm_start()) {
+      if (small) small_.set_warm_start(true);
+      else large_.set_warm_start(true);
     }
+    last_small_ = small;
 
-    // Search the cycle along the path form the second node to the root
-    for (Node u = second; u != join_; u = parents_[u]) {
-      d = forwards_[u] ? INF : flows_[preds_[u]];
-      if (d <= delta_) {
-        delta_ = d;
-        u_out_ = u;
-        result = 2;
-      }
+    return small ? compute(small_, n0, n1) : compute(large_, n0, n1);
+  }
+
+  // whether the last problem went to the narrow solver
+  bool last_small() const { return last_small_; }
+  const Small & small_network_simplex() const { return small_; }
+  const Large & large_network_simplex() const { return large_; }
+
+  Value total_cost() const { return last_small_ ? small_.total_cost() : large_.total_cost(); }
+  Value cost_lower_bound() const { return last_small_ ? small_.cost_lower_bound() : large_.cost_lower_bound(); }
+  Value cost_upper_bound() const { return last_small_ ? small_.cost_upper_bound() : large_.cost_upper_bound(); }
+  Value epsilon_large() const { return large_.epsilon_large(); }
+  std::size_t n_iter() const { return last_small_ ? small_.n_iter() : large_.n_iter(); }
+
+  // statistics are summed over both solvers
+  SolverStats stats() const {
+    SolverStats stats(small_.stats());
+    return stats += large_.stats();
+  }
+  void reset_stats() {
+    small_.reset_stats();
+    large_.reset_stats();
+  }
+
+  const ValueVector & dists() const { return costs_; }
+  const ValueVector & flows() const { return last_small_ ? small_.flows() : large_.flows(); }
+  const ValueVector & potentials() const { return last_small_ ? small_.potentials() : large_.potentials(); }
+  void sparse_flows(std::vector<std::pair<std::size_t, Value>> & arc_flows) const {
+    if (last_small_) small_.sparse_flows(arc_flows);
+    else large_.sparse_flows(arc_flows);
+  }
+
+  void free() {
+    small_.free();
+    large_.free();
+    free_vector(supplies_);
+    free_vector(costs_);
+  }
+
+  // reserves the solver that problems of up to n0 x n1 nodes go to, along with the
+  // shared weights and dists (problems too large for the narrow solver are rare
+  // enough that only the wide one is reserved for them)
+  void reserve(std::size_t n0, std::size_t n1, bool huge_pages = false) {
+    if (fits_small(n0, n1)) {
+      swap_buffers(small_);
+      small_.reserve(n0, n1, huge_pages);
+      swap_buffers(small_);
+    }
+    else {
+      swap_buffers(large_);
+      large_.reserve(n0, n1, huge_pages);
+      swap_buffers(large_);
     }
+  }
+
+private:
 
-    if (result == 1) {
-      u_in_ = first;
-      v_in_ = second;
-    } else {
-      u_in_ = second;
-      v_in_ = first;
-    }
-
-    return result != 0;
-  }
-
-  // Change flows_ and states_ vectors
-  void changeFlow(bool change) {
-
-    // Augment along the cycle
-    if (delta_ > 0) {
-      Value val = states_[in_arc_] * delta_;
-      flows_[in_arc_] += val;
-      for (Node u = sources_[in_arc_]; u != join_; u = parents_[u])
-        flows_[preds_[u]] += forwards_[u] ? -val : val;
-      for (Node u = targets_[in_arc_]; u != join_; u = parents_[u])
-        flows_[preds_[u]] += forwards_[u] ? val : -val;
-    }
-
-    // Update the state of the entering and leaving arcs
-    if (change) {
-      states_[in_arc_] = STATE_TREE;
-      states_[preds_[u_out_]] = (flows_[preds_[u_out_]] == 0) ? STATE_LOWER : STATE_UPPER;
-    }
-    else states_[in_arc_] = -states_[in_arc_];
-  }
-
-  // Update the tree structure
-  void updateTreeStructure() {
-    Node w, u(last_succs_[u_in_]), oldrev_threads_(rev_threads_[u_out_]), 
-         oldsucc_nums_(succ_nums_[u_out_]), oldlast_succs_(last_succs_[u_out_]),
-         right(threads_[u]), stem(u_in_), par_stem(v_in_), new_stem, last;
-    v_out_ = parents_[u_out_];
-
-    // Handle the case when oldrev_threads_ equals to v_in_ (it also means that join_ and v_out_ coincide)
-    if (oldrev_threads_ == v_in_) last = threads_[last_succs_[u_out_]];
-    else last = threads_[v_in_];
-
-    // Update threads_ and parents_ along the stem nodes (i.e. the nodes
-    // between u_in_ and u_out_, whose parent have to be changed)
-    threads_[v_in_] = u_in_;
-    dirty_revs_.clear();
-    dirty_revs_.push_back(v_in_);
-    while (stem != u_out_) {
-
-      // Insert the next stem node into the thread list
-      new_stem = parents_[stem];
-      threads_[u] = new_stem;
-      dirty_revs_.push_back(u);
-
-      // Remove the subtree of stem from the thread list
-      w = rev_threads_[stem];
-      threads_[w] = right;
-      rev_threads_[right] = w;
-
-      // Change the parent node and shift stem nodes
-      parents_[stem] = par_stem;
-      par_stem = stem;
-      stem = new_stem;
-
-      // Update u and right
-      u = last_succs_[stem] == last_succs_[par_stem] ? rev_threads_[par_stem] : last_succs_[stem];
-      right = threads_[u];
-    }
-    parents_[u_out_] = par_stem;
-    threads_[u] = last;
-    rev_threads_[last] = last_succs_[u_out_] = u;
-
-    // Remove the subtree of u_out_ from the thread list except for
-    // the case when oldrev_threads_ equals to v_in_
-    // (it also means that join_ and v_out_ coincide)
-    if (oldrev_threads_ != v_in_) {
-      threads_[oldrev_threads_] = right;
-      rev_threads_[right] = oldrev_threads_;
-    }
-
-    // Update rev_threads_ using the new threads_ values
-    for (Node u : dirty_revs_)
-      rev_threads_[threads_[u]] = u;
-
-    // Update preds_, forwards_, last_succs_ and succ_nums_ for the
-    // stem nodes from u_out_ to u_in_
-    Node tmp_sc(0), tmp_ls(last_succs_[u_out_]);
-    u = u_out_;
-    while (u != u_in_) {
-      w = parents_[u];
-      preds_[u] = preds_[w];
-      forwards_[u] = !forwards_[w];
-      tmp_sc += succ_nums_[u] - succ_nums_[w];
-      succ_nums_[u] = tmp_sc;
-      last_succs_[w] = tmp_ls;
-      u = w;
-    }
-    preds_[u_in_] = in_arc_;
-    forwards_[u_in_] = (u_in_ == sources_[in_arc_]);
-    succ_nums_[u_in_] = oldsucc_nums_;
-
-    // Set limits for updating last_succs_ from v_in_ and v_out_ towards the root
-    Node up_limit_in(-1), up_limit_out(-1);
-    if (last_succs_[join_] == v_in_) up_limit_out = join_;
-    else up_limit_in = join_;
-
-    // Update last_succs_ from v_in_ towards the root
-    for (u = v_in_; u != up_limit_in && last_succs_[u] == v_in_; u = parents_[u])
-      last_succs_[u] = last_succs_[u_out_];
-
-    // Update last_succs_ from v_out_ towards the root
-    if (join_ != oldrev_threads_ && v_in_ != oldrev_threads_)
-      for (u = v_out_; u != up_limit_out && last_succs_[u] == oldlast_succs_; u = parents_[u])
-        last_succs_[u] = oldrev_threads_;
-    else 
-      for (u = v_out_; u != up_limit_out && last_succs_[u] == oldlast_succs_; u = parents_[u])
-        last_succs_[u] = last_succs_[u_out_];
-
-    // Update succ_nums_ from v_in_ to join_
-    for (u = v_in_; u != join_; u = parents_[u])
-      succ_nums_[u] += oldsucc_nums_;
-
-    // Update succ_nums_ from v_out_ to join_
-    for (u = v_out_; u != join_; u = parents_[u])
-      succ_nums_[u] -= oldsucc_nums_;
-  }
-
-  // Update potentials
-  void updatePotential() {
-    Value sigma = forwards_[u_in_] ? pis_[v_in_] - pis_[u_in_] - costs_[preds_[u_in_]] : pis_[v_in_] - pis_[u_in_] + costs_[preds_[u_in_]];
-
-    // Update potentials in the subtree, which has been moved
-    Node end = threads_[last_succs_[u_in_]];
-    for (Node u = u_in_; u != end; u = threads_[u])
-      pis_[u] += sigma;
+  Small small_;
+  Large large_;
+  ValueVector supplies_, costs_;
+  bool last_small_;
+
+  template<class NS>
+  void swap_buffers(NS & ns) {
+    ns.weights().swap(supplies_);
+    ns.dists().swap(costs_);
   }
 
-}; // NetworkSimplex
+  template<class NS>
+  EMDStatus compute(NS & ns, std::size_t n0, std::size_t n1) {
+    swap_buffers(ns);
+    EMDStatus status;
+    try { status = ns.compute(n0, n1); }
+    catch (...) {
+      swap_buffers(ns);
+      throw;
+    }
+    swap_buffers(ns);
+    return status;
+  }
+
+}; // IndexDispatchNetworkSimplex
 
 END_WASSERSTEIN_NAMESPACE
 
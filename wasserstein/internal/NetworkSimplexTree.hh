@@ -0,0 +1,314 @@
+//------------------------------------------------------------------------
+// This file is part of Wasserstein, a C++ library with a Python wrapper
+// that computes the Wasserstein/EMD distance. If you use it for academic
+// research, please cite or acknowledge the following works:
+//
+//   - Komiske, Metodiev, Thaler (2019) arXiv:1902.02346
+//       https://doi.org/10.1103/PhysRevLett.123.041801
+//   - Komiske, Metodiev, Thaler (2020) arXiv:2004.04159
+//       https://doi.org/10.1007/JHEP07%282020%29006
+//   - Boneel, van de Panne, Paris, Heidrich (2011)
+//       https://doi.org/10.1145/2070781.2024192
+//   - LEMON graph library https://lemon.cs.elte.hu/trac/lemon
+//
+// Copyright (C) 2019-2022 Patrick T. Komiske III
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------
+
+// Copyright notice from network_simplex_simple.h
+/* -*- mode: C++; indent-tabs-mode: nil; -*-
+*
+*
+* This file has been adapted by Nicolas Bonneel (2013),
+* from network_simplex.h from LEMON, a generic C++ optimization library,
+* to implement a lightweight network simplex for mass transport, more
+* memory efficient than the original file. A previous version of this file
+* is used as part of the Displacement Interpolation project,
+* Web: http://www.cs.ubc.ca/labs/imager/tr/2011/DisplacementInterpolation/
+*
+* Revisions:
+* March 2015: added OpenMP parallelization
+* March 2017: included Antoine Rolet's trick to make it more robust
+* April 2018: IMPORTANT bug fix + uses 64bit integers (slightly slower but 
+* less risks of overflows), updated to a newer version of the algo by LEMON,
+* sparse flow by default + minor edits.
+*
+*
+**** Original file Copyright Notice :
+*
+* Copyright (C) 2003-2010
+* Egervary Jeno Kombinatorikus Optimalizalasi Kutatocsoport
+* (Egervary Research Group on Combinatorial Optimization, EGRES).
+*
+* Permission to use, modify and distribute this software is granted
+* provided that this copyright notice appears in all copies. For
+* precise terms see the accompanying LICENSE file.
+*
+* This software is provided "AS IS" with no warranty of any kind,
+* express or implied, and with no claim as to its suitability for any
+* purpose.
+*
+*/
+
+#ifndef WASSERSTEIN_NETWORKSIMPLEXTREE_HH
+#define WASSERSTEIN_NETWORKSIMPLEXTREE_HH
+
+// C++ standard library
+#include <cstddef>
+#include <vector>
+
+#include "EMDUtils.hh"
+
+BEGIN_WASSERSTEIN_NAMESPACE
+
+////////////////////////////////////////////////////////////////////////////////
+// NetworkSimplexTree - spanning tree updates shared by the network simplex solvers
+////////////////////////////////////////////////////////////////////////////////
+
+// NetworkSimplex and SparseNetworkSimplex store and price their arcs differently but
+// pivot the same kind of spanning tree, which this base class holds together with
+// LEMON's updates of it. The solver passes itself as Derived and makes this class a
+// friend, providing source(arc) and target(arc) for the arcs that may enter the tree,
+// arc_state(arc) and set_arc_state(arc, state), and flows_, costs_, pis_ and INF, and
+// may hide count_cycle_node and count_stem_length to gather statistics.
+
+template<class Derived, typename Value, typename Arc, typename Node, typename Bool>
+class NetworkSimplexTree {
+protected:
+
+  // State constants for arcs
+  enum ArcState : char {
+    STATE_UPPER = -1,
+    STATE_TREE  =  0,
+    STATE_LOWER =  1
+  };
+
+  // spanning tree structure vectors
+  std::vector<Node> parents_, threads_, rev_threads_, succ_nums_, last_succs_, dirty_revs_;
+  std::vector<Arc> preds_;
+  std::vector<Bool> forwards_;
+
+  // Temporary data used in the current pivot iteration
+  Arc in_arc_;
+  Node join_, u_in_, v_in_, u_out_, v_out_;
+  Value delta_;
+
+  // called for each node of the cycle of a pivot and with the number of stem nodes moved
+  void count_cycle_node() {}
+  void count_stem_length(std::size_t) {}
+
+  // Find the join_ node
+  void findJoinNode() {
+    Derived & ns(derived());
+    Node u(ns.source(in_arc_)), v(ns.target(in_arc_));
+    while (u != v) {
+      if (succ_nums_[u] < succ_nums_[v]) u = parents_[u];
+      else v = parents_[v];
+    }
+    join_ = u;
+  }
+
+  // Find the leaving arc of the cycle and returns true if the
+  // leaving arc is not the same as the entering arc
+  bool findLeavingArc() {
+    Derived & ns(derived());
+
+    // Initialize first and second nodes according to the direction of the cycle
+    Node first, second;
+    if (ns.arc_state(in_arc_) == STATE_LOWER) {
+      first  = ns.source(in_arc_);
+      second = ns.target(in_arc_);
+    } else {
+      first  = ns.target(in_arc_);
+      second = ns.source(in_arc_);
+    }
+
+    delta_ = ns.INF;
+    char result(0);
+    Value d;
+
+    // Search the cycle along the path from the first node to the root
+    for (Node u = first; u != join_; u = parents_[u]) {
+      ns.count_cycle_node();
+      d = forwards_[u] ? ns.flows_[preds_[u]] : ns.INF;
+      if (d < delta_) {
+        delta_ = d;
+        u_out_ = u;
+        result = 1;
+      }
+    }
+
+    // Search the cycle along the path form the second node to the root
+    for (Node u = second; u != join_; u = parents_[u]) {
+      ns.count_cycle_node();
+      d = forwards_[u] ? ns.INF : ns.flows_[preds_[u]];
+      if (d <= delta_) {
+        delta_ = d;
+        u_out_ = u;
+        result = 2;
+      }
+    }
+
+    if (result == 1) {
+      u_in_ = first;
+      v_in_ = second;
+    } else {
+      u_in_ = second;
+      v_in_ = first;
+    }
+
+    return result != 0;
+  }
+
+  // Change flows_ and arc states
+  void changeFlow(bool change) {
+    Derived & ns(derived());
+
+    // Augment along the cycle
+    if (delta_ > 0) {
+      Value val = ns.arc_state(in_arc_) * delta_;
+      ns.flows_[in_arc_] += val;
+      for (Node u = ns.source(in_arc_); u != join_; u = parents_[u])
+        ns.flows_[preds_[u]] += forwards_[u] ? -val : val;
+      for (Node u = ns.target(in_arc_); u != join_; u = parents_[u])
+        ns.flows_[preds_[u]] += forwards_[u] ? val : -val;
+    }
+
+    // Update the state of the entering and leaving arcs
+    if (change) {
+      ns.set_arc_state(in_arc_, STATE_TREE);
+      ns.set_arc_state(preds_[u_out_], (ns.flows_[preds_[u_out_]] == 0) ? STATE_LOWER : STATE_UPPER);
+    }
+    else ns.set_arc_state(in_arc_, -ns.arc_state(in_arc_));
+  }
+
+  // Update the tree structure
+  void updateTreeStructure() {
+    Derived & ns(derived());
+    Node w, u(last_succs_[u_in_]), oldrev_threads_(rev_threads_[u_out_]), 
+         oldsucc_nums_(succ_nums_[u_out_]), oldlast_succs_(last_succs_[u_out_]),
+         right(threads_[u]), stem(u_in_), par_stem(v_in_), new_stem, last;
+    v_out_ = parents_[u_out_];
+
+    // Handle the case when oldrev_threads_ equals to v_in_ (it also means that join_ and v_out_ coincide)
+    if (oldrev_threads_ == v_in_) last = threads_[last_succs_[u_out_]];
+    else last = threads_[v_in_];
+
+    // Update threads_ and parents_ along the stem nodes (i.e. the nodes
+    // between u_in_ and u_out_, whose parent have to be changed)
+    threads_[v_in_] = u_in_;
+    dirty_revs_.clear();
+    dirty_revs_.push_back(v_in_);
+    while (stem != u_out_) {
+
+      // Insert the next stem node into the thread list
+      new_stem = parents_[stem];
+      threads_[u] = new_stem;
+      dirty_revs_.push_back(u);
+
+      // Remove the subtree of stem from the thread list
+      w = rev_threads_[stem];
+      threads_[w] = right;
+      rev_threads_[right] = w;
+
+      // Change the parent node and shift stem nodes
+      parents_[stem] = par_stem;
+      par_stem = stem;
+      stem = new_stem;
+
+      // Update u and right
+      u = last_succs_[stem] == last_succs_[par_stem] ? rev_threads_[par_stem] : last_succs_[stem];
+      right = threads_[u];
+    }
+    ns.count_stem_length(dirty_revs_.size() - 1);
+    parents_[u_out_] = par_stem;
+    threads_[u] = last;
+    rev_threads_[last] = last_succs_[u_out_] = u;
+
+    // Remove the subtree of u_out_ from the thread list except for
+    // the case when oldrev_threads_ equals to v_in_
+    // (it also means that join_ and v_out_ coincide)
+    if (oldrev_threads_ != v_in_) {
+      threads_[oldrev_threads_] = right;
+      rev_threads_[right] = oldrev_threads_;
+    }
+
+    // Update rev_threads_ using the new threads_ values
+    for (Node u : dirty_revs_)
+      rev_threads_[threads_[u]] = u;
+
+    // Update preds_, forwards_, last_succs_ and succ_nums_ for the
+    // stem nodes from u_out_ to u_in_
+    Node tmp_sc(0), tmp_ls(last_succs_[u_out_]);
+    u = u_out_;
+    while (u != u_in_) {
+      w = parents_[u];
+      preds_[u] = preds_[w];
+      forwards_[u] = !forwards_[w];
+      tmp_sc += succ_nums_[u] - succ_nums_[w];
+      succ_nums_[u] = tmp_sc;
+      last_succs_[w] = tmp_ls;
+      u = w;
+    }
+    preds_[u_in_] = in_arc_;
+    forwards_[u_in_] = (u_in_ == ns.source(in_arc_));
+    succ_nums_[u_in_] = oldsucc_nums_;
+
+    // Set limits for updating last_succs_ from v_in_ and v_out_ towards the root
+    Node up_limit_in(-1), up_limit_out(-1);
+    if (last_succs_[join_] == v_in_) up_limit_out = join_;
+    else up_limit_in = join_;
+
+    // Update last_succs_ from v_in_ towards the root
+    for (u = v_in_; u != up_limit_in && last_succs_[u] == v_in_; u = parents_[u])
+      last_succs_[u] = last_succs_[u_out_];
+
+    // Update last_succs_ from v_out_ towards the root
+    if (join_ != oldrev_threads_ && v_in_ != oldrev_threads_)
+      for (u = v_out_; u != up_limit_out && last_succs_[u] == oldlast_succs_; u = parents_[u])
+        last_succs_[u] = oldrev_threads_;
+    else 
+      for (u = v_out_; u != up_limit_out && last_succs_[u] == oldlast_succs_; u = parents_[u])
+        last_succs_[u] = last_succs_[u_out_];
+
+    // Update succ_nums_ from v_in_ to join_
+    for (u = v_in_; u != join_; u = parents_[u])
+      succ_nums_[u] += oldsucc_nums_;
+
+    // Update succ_nums_ from v_out_ to join_
+    for (u = v_out_; u != join_; u = parents_[u])
+      succ_nums_[u] -= oldsucc_nums_;
+  }
+
+  // Update potentials
+  void updatePotential() {
+    Derived & ns(derived());
+    Value sigma = forwards_[u_in_] ? ns.pis_[v_in_] - ns.pis_[u_in_] - ns.costs_[preds_[u_in_]] : ns.pis_[v_in_] - ns.pis_[u_in_] + ns.costs_[preds_[u_in_]];
+
+    // Update potentials in the subtree, which has been moved
+    Node end = threads_[last_succs_[u_in_]];
+    for (Node u = u_in_; u != end; u = threads_[u])
+      ns.pis_[u] += sigma;
+  }
+
+private:
+
+  Derived & derived() { return static_cast<Derived &>(*this); }
+
+}; // NetworkSimplexTree
+
+END_WASSERSTEIN_NAMESPACE
+
+#endif // WASSERSTEIN_NETWORKSIMPLEXTREE_HH
@@ -45,8 +45,12 @@
 #define WASSERSTEIN_PAIRWISEDISTANCE_HH
 
 // C++ standard library
+#include <algorithm>
 #include <cmath>
+#include <cstddef>
+#include <vector>
 
+#include "DistanceKernels.hh"
 #include "EMDUtils.hh"
 
 
@@ -102,7 +106,7 @@ public:
   void set_beta(Value beta) {
     if (beta < 0) throw std::invalid_argument("beta must be non-negative.");
     beta_ = beta;
-    halfbeta_ = beta/2;
+    power_ = BetaPower<Value>(beta);
   }
 
   // computes symmetric pairwise distances matrix between all particles in a collection
@@ -120,51 +124,84 @@ public:
     }
   }*/
 
-  // computes pairwise distances between two particle collections
+  // computes pairwise distances between two particle collections, the rows of ps0 being split
+  // among num_threads threads if it is more than one
   void fill_distances(const ParticleCollection & ps0, const ParticleCollection & ps1,
-                      std::vector<Value> & dists, ExtraParticle extra) {
+                      std::vector<Value> & dists, ExtraParticle extra, int num_threads = 1) {
+    fill_rows(ps0, ps1, dists, extra, num_threads, false);
+  }
 
-    std::size_t k(0);
-    const PairwiseDistance * pd(static_cast<const PairwiseDistance *>(this));
+  // the same with the plain distances (without the square root), from which
+  // distances_from_plain derives the pairwise distances for any R and beta
+  void fill_plain_distances(const ParticleCollection & ps0, const ParticleCollection & ps1,
+                            std::vector<Value> & plain_dists, ExtraParticle extra, int num_threads = 1) {
+    fill_rows(ps0, ps1, plain_dists, extra, num_threads, true);
+  }
 
-    if (extra == ExtraParticle::Neither) {
-      dists.resize(ps0.size() * ps1.size());
-      for (ParticleIterator p0 = ps0.begin(), end0 = ps0.end(), end1 = ps1.end(); p0 != end0; ++p0)
-        for (ParticleIterator p1 = ps1.begin(); p1 != end1; ++p1)
-          dists[k++] = pd->distance(p0, p1);
+  // sets dists to the pairwise distances that fill_distances would have computed with the
+  // current R and beta, from the plain distances of n0 and n1 particles (not counting the
+  // extra particle) filled by fill_plain_distances
+  void distances_from_plain(const std::vector<Value> & plain_dists, std::vector<Value> & dists,
+                            std::size_t n0, std::size_t n1, ExtraParticle extra) const {
+    std::size_t row_len(n1 + (extra == ExtraParticle::One));
+    dists.assign(plain_dists.begin(), plain_dists.end());
+    for (std::size_t i = 0; i < n0; i++) {
+      Value * row(dists.data() + i * row_len);
+      if (power_.beta_class == BetaClass::One)
+        for (std::size_t j = 0; j < n1; j++)
+          row[j] = std::sqrt(row[j])/R_;
+      else if (power_.beta_class == BetaClass::Two)
+        for (std::size_t j = 0; j < n1; j++)
+          row[j] /= R2_;
+      else beta_power_row(row, index_type(n1), R2_, power_);
     }
+  }
 
-    else if (extra == ExtraParticle::Zero) {
-      dists.resize((ps0.size() + 1) * ps1.size());
-      for (ParticleIterator p0 = ps0.begin(), end0 = ps0.end(), end1 = ps1.end(); p0 != end0; ++p0)
-        for (ParticleIterator p1 = ps1.begin(); p1 != end1; ++p1)
-          dists[k++] = pd->distance(p0, p1);
-      for (std::size_t j = 0, end = ps1.size(); j < end; j++)
-        dists[k++] = 1;
-    }
+  // called once per fill_distances before any rows are filled, to set up any per-event state
+  void prepare_rows(const ParticleCollection &) {}
 
-    // extra == ExtraParticle::One
-    else {
-      dists.resize(ps0.size() * (ps1.size() + 1));
-      for (ParticleIterator p0 = ps0.begin(), end0 = ps0.end(), end1 = ps1.end(); p0 != end0; ++p0) {
-        for (ParticleIterator p1 = ps1.begin(); p1 != end1; ++p1)
-          dists[k++] = pd->distance(p0, p1);
-        dists[k++] = 1;
-      }
-    }
+  // reserve and free any per-event state for events of up to n1 particles
+  void reserve(std::size_t) {}
+  void free() {}
+
+  // fills row with the distances from p0 to all the particles of ps1, one pair at a time unless
+  // a derived class can do better
+  void fill_row(const ParticleIterator & p0, const ParticleCollection & ps1, Value * row) const {
+    const PairwiseDistance * pd(static_cast<const PairwiseDistance *>(this));
+    for (ParticleIterator p1 = ps1.begin(), end1 = ps1.end(); p1 != end1; ++p1)
+      *row++ = pd->distance(p0, p1);
+  }
+
+  // fills row with the plain distances from p0 to all the particles of ps1
+  void fill_plain_row(const ParticleIterator & p0, const ParticleCollection & ps1, Value * row) const {
+    for (ParticleIterator p1 = ps1.begin(), end1 = ps1.end(); p1 != end1; ++p1)
+      *row++ = PairwiseDistance::plain_distance_from_iterator(p0, p1);
   }
 
   // returns the distance divided by R, all to beta power
   Value distance(const ParticleIterator & p0, const ParticleIterator & p1) const {
-    Value pd(PairwiseDistance::plain_distance_from_iterator(p0, p1));
+    return distance_from_plain(PairwiseDistance::plain_distance_from_iterator(p0, p1));
+  }
 
-    if (this->beta() == 1.0)
+  // converts a plain distance (without the square root) to the distance divided by R, all to beta power
+  Value distance_from_plain(Value pd) const {
+    if (power_.beta_class == BetaClass::One)
       return std::sqrt(pd)/R_;
 
-    if (this->beta() == 2.0)
+    if (power_.beta_class == BetaClass::Two)
       return pd/R2_;
 
-    return std::pow(pd/R2_, halfbeta_);
+    return beta_power(pd/R2_, power_);
+  }
+
+  // how the row kernels finish the plain distances, and what they divide them by
+  BetaClass row_beta() const { return power_.beta_class; }
+  Value row_denominator() const { return power_.beta_class == BetaClass::One ? R_ : R2_; }
+
+  // takes the power for betas the row kernels leave as plain distances
+  void finish_row(Value * row, index_type n) const {
+    if (power_.beta_class != BetaClass::One && power_.beta_class != BetaClass::Two)
+      beta_power_row(row, n, R2_, power_);
   }
 
   // return the plain distance, without the square root
@@ -178,19 +215,73 @@ public:
     return -1;
   }
 
+  // fills the coordinates of particles that live on a line, for which the plain distance is
+  // the squared difference of their coordinates, returning false if this is not the case
+  static bool coordinates_1d(const ParticleCollection &, std::vector<Value> &) {
+    return false;
+  }
+
+  // fills the coordinates of all particles, particle by particle, for which the plain distance
+  // is the squared euclidean distance, returning false if there are no such coordinates
+  static bool coordinates(const ParticleCollection &, std::vector<Value> &, index_type &) {
+    return false;
+  }
+
 protected:
 
   ~PairwiseDistanceBase() = default;
 
 private:
 
-  Value R_, R2_, beta_, halfbeta_;
+  // fills the rows of dists with the pairwise distances, or the plain distances if plain is true
+  void fill_rows(const ParticleCollection & ps0, const ParticleCollection & ps1,
+                 std::vector<Value> & dists, ExtraParticle extra, int num_threads, bool plain) {
+
+    PairwiseDistance * pd(static_cast<PairwiseDistance *>(this));
+    pd->prepare_rows(ps1);
+
+    std::size_t n0(ps0.size()), row_len(ps1.size() + (extra == ExtraParticle::One));
+    dists.resize((n0 + (extra == ExtraParticle::Zero)) * row_len);
+
+    if (num_threads > 1) {
+
+      // each thread fills whole rows, starting from iterators found beforehand
+      std::vector<ParticleIterator> rows;
+      rows.reserve(n0);
+      for (ParticleIterator p0 = ps0.begin(), end0 = ps0.end(); p0 != end0; ++p0)
+        rows.push_back(p0);
+
+      #pragma omp parallel for num_threads(num_threads) schedule(static)
+      for (std::ptrdiff_t i = 0; i < std::ptrdiff_t(n0); i++) {
+        if (plain) pd->fill_plain_row(rows[i], ps1, dists.data() + i * row_len);
+        else pd->fill_row(rows[i], ps1, dists.data() + i * row_len);
+        if (extra == ExtraParticle::One)
+          dists[(i + 1) * row_len - 1] = 1;
+      }
+    }
+    else {
+      std::size_t i(0);
+      for (ParticleIterator p0 = ps0.begin(), end0 = ps0.end(); p0 != end0; ++p0, i++) {
+        if (plain) pd->fill_plain_row(p0, ps1, dists.data() + i * row_len);
+        else pd->fill_row(p0, ps1, dists.data() + i * row_len);
+        if (extra == ExtraParticle::One)
+          dists[(i + 1) * row_len - 1] = 1;
+      }
+    }
+
+    if (extra == ExtraParticle::Zero)
+      std::fill(dists.begin() + n0 * row_len, dists.end(), 1);
+  }
+
+  Value R_, R2_, beta_;
+  BetaPower<Value> power_;
 
 #ifdef WASSERSTEIN_SERIALIZATION
   friend class boost::serialization::access;
   template<class Archive>
   void serialize(Archive & ar, const unsigned int version) {
-    ar & R_ & R2_ & beta_ & halfbeta_;
+    ar & R_ & R2_ & beta_ & power_.halfbeta;
+    power_ = BetaPower<Value>(beta_);
   }
 #endif
 
@@ -214,7 +305,7 @@ public:
   using PairwiseDistanceBase<DefaultPairwiseDistance<Value>, ParticleCollection, Value>::PairwiseDistanceBase;
 
   static std::string name() { return "DefaultPairwiseDistance (none)"; }
-  static Value plain_distance_from_iterator(const ParticleIterator & p0, const ParticleIterator & p1) {
+  static Value plain_distance_from_iterator(const ParticleIterator &, const ParticleIterator &) {
     return -1;
   }
 
@@ -240,19 +331,47 @@ public:
 
   static std::string name() { return "EuclideanArrayDistance"; }
   static Value plain_distance_from_iterator(const ParticleIterator & p0, const ParticleIterator & p1) {
-    if (p0.stride() == 2) {
-      Value dx((*p0)[0] - (*p1)[0]), dy((*p0)[1] - (*p1)[1]);
-      return dx*dx + dy*dy;
-    }
-    else {
-      Value d(0);
-      for (int i = 0; i < p0.stride(); i++) {
-        Value dx((*p0)[i] - (*p1)[i]);
-        d += dx*dx;
-      }
-      return d;
-    }
+    return euclidean_plain_distance(*p0, *p1, p0.stride());
+  }
+  void prepare_rows(const ParticleCollection & ps1) {
+    dimension_ = ps1.stride();
+    row_kernel_ = euclidean_row_kernel<Value>(dimension_);
+    transpose_particles(*ps1.begin(), ps1.size(), ps1.stride(), columns_);
+  }
+  void reserve(std::size_t n1) { columns_.reserve(n1 * dimension_); }
+  void free() { free_vector(columns_); }
+  void fill_row(const ParticleIterator & p0, const ParticleCollection & ps1, Value * row) const {
+    row_kernel_(*p0, columns_.data(), ps1.stride(), ps1.size(), this->row_beta(), this->row_denominator(), row);
+    this->finish_row(row, ps1.size());
+  }
+  void fill_plain_row(const ParticleIterator & p0, const ParticleCollection & ps1, Value * row) const {
+    row_kernel_(*p0, columns_.data(), ps1.stride(), ps1.size(), BetaClass::General, Value(1), row);
   }
+  static bool coordinates_1d(const ParticleCollection & ps, std::vector<Value> & xs) {
+    if (ps.stride() != 1) return false;
+    xs.clear();
+    for (ParticleIterator p = ps.begin(), end = ps.end(); p != end; ++p)
+      xs.push_back((*p)[0]);
+    return true;
+  }
+  static bool coordinates(const ParticleCollection & ps, std::vector<Value> & xs, index_type & dim) {
+    dim = ps.stride();
+    xs.clear();
+    for (ParticleIterator p = ps.begin(), end = ps.end(); p != end; ++p)
+      xs.insert(xs.end(), *p, *p + dim);
+    return true;
+  }
+
+private:
+
+  // coordinates of the particles of the second event, by column, and their dimension, which
+  // is taken to be 2 when reserving before any events have been seen
+  std::vector<Value> columns_;
+  index_type dimension_ = 2;
+
+  // row kernel unrolled for that dimension
+  EuclideanRowKernel<Value> row_kernel_ = euclidean_row_kernel<Value>(2);
+
 }; // EuclideanArrayDistance
 
 
@@ -276,11 +395,28 @@ public:
 
   static std::string name() { return "YPhiArrayDistance"; }
   static Value plain_distance_from_iterator(const ParticleIterator & p0, const ParticleIterator & p1) {
-    Value dy((*p0)[0] - (*p1)[0]), absdphi(std::fabs((*p0)[1] - (*p1)[1]));
-    Value dphi(PI - std::fabs(std::fmod(absdphi, TWOPI) - PI));
+    Value dy((*p0)[0] - (*p1)[0]), dphi(periodic_dphi(std::fabs((*p0)[1] - (*p1)[1])));
     return dy*dy + dphi*dphi;
   }
-}; // EuclideanArrayDistance
+  void prepare_rows(const ParticleCollection & ps1) {
+    transpose_particles(*ps1.begin(), ps1.size(), 2, columns_);
+  }
+  void reserve(std::size_t n1) { columns_.reserve(2*n1); }
+  void free() { free_vector(columns_); }
+  void fill_row(const ParticleIterator & p0, const ParticleCollection & ps1, Value * row) const {
+    yphi_distance_row(*p0, columns_.data(), ps1.size(), this->row_beta(), this->row_denominator(), row);
+    this->finish_row(row, ps1.size());
+  }
+  void fill_plain_row(const ParticleIterator & p0, const ParticleCollection & ps1, Value * row) const {
+    yphi_distance_row(*p0, columns_.data(), ps1.size(), BetaClass::General, Value(1), row);
+  }
+
+private:
+
+  // coordinates of the particles of the second event, by column
+  std::vector<Value> columns_;
+
+}; // YPhiArrayDistance
 
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -304,6 +440,21 @@ public:
   static value_type plain_distance(const Particle & p0, const Particle & p1) {
     return Particle::plain_distance(p0, p1);
   }
+  static bool coordinates_1d(const std::vector<Particle> & ps, std::vector<value_type> & xs) {
+    if (Particle::dimension() != 1) return false;
+    xs.clear();
+    for (const Particle & p : ps)
+      xs.push_back(p[0]);
+    return true;
+  }
+  static bool coordinates(const std::vector<Particle> & ps, std::vector<value_type> & xs, index_type & dim) {
+    dim = Particle::dimension();
+    xs.clear();
+    for (const Particle & p : ps)
+      for (index_type k = 0; k < dim; k++)
+        xs.push_back(p[k]);
+    return true;
+  }
 }; // EuclideanParticleDistance
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -325,8 +476,7 @@ public:
 
   static std::string name() { return "YPhiParticleDistance"; }
   static Value plain_distance(const Particle & p0, const Particle & p1) {
-    Value dy(p0[0] - p1[0]), absdphi(std::fabs(p0[1] - p1[1]));
-    Value dphi(PI - std::fabs(std::fmod(absdphi, TWOPI) - PI));
+    Value dy(p0[0] - p1[0]), dphi(periodic_dphi(std::fabs(p0[1] - p1[1])));
     return dy*dy + dphi*dphi;
   }
 }; // EuclideanParticleDistance
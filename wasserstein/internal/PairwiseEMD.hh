@@ -45,12 +45,16 @@
 #define WASSERSTEIN_PAIRWISEEMD_HH
 
 // C++ standard library
+#include <algorithm>
 #include <iomanip>
 #include <iostream>
 #include <iterator>
+#include <limits>
 #include <stdexcept>
 #include <type_traits>
+#include <utility>
 
+#include "Bounds.hh"
 #include "PairwiseEMDBase.hh"
 
 
@@ -85,6 +89,16 @@ private:
   std::ostringstream oss_;
   index_type emd_counter_;
 
+  // threshold mode and the pairs of events found within it
+  Value threshold_;
+  std::vector<std::pair<index_type, index_type>> close_pairs_;
+
+  // sweep mode, its (R, beta) points and the EMDs of each pair at all of them, stored
+  // contiguously per pair, or the handler of each point
+  std::vector<std::pair<Value, Value>> sweep_;
+  std::vector<ExternalEMDHandler<Value> *> sweep_handlers_;
+  std::vector<Value> sweep_emds_;
+
 #ifdef WASSERSTEIN_SERIALIZATION
   friend class boost::serialization::access;
 
@@ -124,7 +138,8 @@ public:
          request_mode, store_sym_emds_raw, throw_on_error,
          os),
     emd_objs_(this->num_threads(), EMD(R, beta, norm, false, false,
-                                       n_iter_max, epsilon_large_factor, epsilon_small_factor))
+                                       n_iter_max, epsilon_large_factor, epsilon_small_factor)),
+    threshold_(std::numeric_limits<Value>::max())
   {
     clear(false);
   }
@@ -146,7 +161,8 @@ public:
          verbose, omp_dynamic_chunksize,
          request_mode, store_sym_emds_raw, throw_on_error,
          os),
-    emd_objs_(this->num_threads(), emd)
+    emd_objs_(this->num_threads(), emd),
+    threshold_(std::numeric_limits<Value>::max())
   {
     if (emd.external_dists())
       throw std::invalid_argument("Cannot use PairwiseEMD with external distances");
@@ -191,8 +207,20 @@ public:
         << "  store_sym_emds_raw - " << this->store_sym_emds_raw_ << '\n'
         << "  throw_on_error - " << this->throw_on_error_ << '\n'
         << "  omp_dynamic_chunksize - " << this->omp_dynamic_chunksize() << '\n'
-        << '\n'
-        << (this->handler_ ? this->handler_->description() : "  Pairwise EMD distance matrix stored internally\n");
+        << '\n';
+    if (has_threshold())
+      oss << "  Pairs with EMD below " << threshold_ << " stored internally\n";
+    else if (has_sweep()) {
+      oss << "  Sweep over " << sweep_.size() << " (R, beta) points, ";
+      if (sweep_handlers_.empty()) oss << "EMDs stored internally\n";
+      else {
+        oss << "handled by\n";
+        for (const ExternalEMDHandler<Value> * handler : sweep_handlers_)
+          oss << handler->description();
+      }
+    }
+    else
+      oss << (this->handler_ ? this->handler_->description() : "  Pairwise EMD distance matrix stored internally\n");
       
     // this will not print preprocessors if there aren't any  
     emd_objs_[0].output_preprocessors(oss);
@@ -276,10 +304,14 @@ public:
     Base::clear(free_memory);
 
     events().clear();
+    close_pairs_.clear();
+    sweep_emds_.clear();
     emd_counter_ = 0;
 
     if (free_memory) {
       free_vector(events());
+      free_vector(close_pairs_);
+      free_vector(sweep_emds_);
       for (EMD & emd_obj : emd_objs_)
         emd_obj.clear();
     }
@@ -292,6 +324,71 @@ public:
     construct();
   }
 
+  // solver statistics (see SolverStats) of the EMD object used by a thread,
+  // or summed over all of them if thread is negative
+  SolverStats stats(int thread = -1) const {
+    if (thread >= int(emd_objs_.size()))
+      throw std::out_of_range("PairwiseEMD::stats - thread out of range");
+    if (thread >= 0) return emd_objs_[thread].stats();
+
+    SolverStats stats;
+    for (const EMD & emd_obj : emd_objs_)
+      stats += emd_obj.stats();
+    return stats;
+  }
+  void reset_stats() {
+    for (EMD & emd_obj : emd_objs_) emd_obj.reset_stats();
+  }
+
+  // reserves the buffers of the EMD object of every thread for events of up to max_mult
+  // particles (see EMD::reserve), each from the thread that will use it
+  void reserve(std::size_t max_mult, bool huge_pages = false) {
+    #pragma omp parallel for num_threads(this->num_threads()) schedule(static, 1)
+    for (int thread = 0; thread < int(emd_objs_.size()); thread++)
+      emd_objs_[thread].reserve(max_mult, max_mult, huge_pages);
+  }
+
+  // threshold mode, in which compute() only decides whether each EMD is below threshold (see
+  // EMD::within) and stores the pairs of events that are instead of the EMDs, as (i, j) with
+  // i < j for a single set of events and i indexing eventsA otherwise; it is disabled by the
+  // largest Value, which is the default
+  Value threshold() const { return threshold_; }
+  bool has_threshold() const { return threshold_ < std::numeric_limits<Value>::max(); }
+  void set_threshold(Value threshold = std::numeric_limits<Value>::max()) { threshold_ = threshold; }
+  const std::vector<std::pair<index_type, index_type>> & close_pairs() const { return close_pairs_; }
+
+  // sweep mode, in which compute() finds the EMD of each pair at every (R, beta) point of the
+  // sweep (see EMD::compute_sweep), the squared distances of a pair being computed once and each
+  // point warm started from the previous one; the EMDs of a point are stored unless a handler is
+  // given for every point, and a sweep is disabled by setting no points, which is the default
+  const std::vector<std::pair<Value, Value>> & sweep() const { return sweep_; }
+  bool has_sweep() const { return !sweep_.empty(); }
+  void set_sweep(const std::vector<std::pair<Value, Value>> & params = {},
+                 const std::vector<ExternalEMDHandler<Value> *> & handlers = {}) {
+    if (!handlers.empty() && handlers.size() != params.size())
+      throw std::invalid_argument("PairwiseEMD::set_sweep - need one handler per parameter point");
+    sweep_ = params;
+    sweep_handlers_ = handlers;
+  }
+
+  // EMDs at point p of the sweep, laid out as by emds()
+  std::vector<Value> sweep_emds(std::size_t p, bool raw = false) const {
+    if (this->emd_storage_ != EMDPairsStorage::Sweep || !sweep_handlers_.empty())
+      throw std::invalid_argument("No sweep EMDs stored");
+    if (p >= sweep_.size())
+      throw std::out_of_range("PairwiseEMD::sweep_emds - parameter point out of range");
+
+    std::vector<Value> emds;
+    if (!two_event_sets_ && !raw)
+      this->expand_symmetric(sweep_emds_.data() + p, sweep_.size(), emds);
+    else {
+      emds.resize(num_emds());
+      for (index_type k = 0; k < num_emds(); k++)
+        emds[k] = sweep_emds_[k*sweep_.size() + p];
+    }
+    return emds;
+  }
+
 // these should be private for the SWIG Python wrappers and public otherwise
 #ifdef SWIG
 private:
@@ -312,9 +409,30 @@ private:
   }
   void set_network_simplex_params(std::size_t n_iter_max,
                                    Value epsilon_large_factor,
-                                   Value epsilon_small_factor) {
+                                   Value epsilon_small_factor,
+                                   Value pivot_param0,
+                                   Value pivot_param1) {
     for (EMD & emd_obj : emd_objs_)
-      emd_obj.set_network_simplex_params(n_iter_max, epsilon_large_factor, epsilon_small_factor);
+      emd_obj.set_network_simplex_params(n_iter_max, epsilon_large_factor, epsilon_small_factor,
+                                         pivot_param0, pivot_param1);
+  }
+
+  // warm starting is most effective when consecutive pairs share an event,
+  // which is the case for the row-by-row traversal used in compute()
+  bool warm_start() const { return emd_objs_[0].warm_start(); }
+  void set_warm_start(bool warm) {
+    for (EMD & emd_obj : emd_objs_) emd_obj.set_warm_start(warm);
+  }
+
+  // anytime mode of each EMD object, approximate EMDs are stored as their upper bounds
+  void set_anytime(double relative_gap, double max_seconds = 0) {
+    for (EMD & emd_obj : emd_objs_) emd_obj.set_anytime(relative_gap, max_seconds);
+  }
+
+  // solver used by each EMD object
+  EMDSolver solver() const { return emd_objs_[0].solver(); }
+  void set_solver(EMDSolver solver) {
+    for (EMD & emd_obj : emd_objs_) emd_obj.set_solver(solver);
   }
 
   // timing
@@ -345,7 +463,11 @@ private:
 
     // resize emds
     this->num_emds_ = nev*(nev - 1)/2;
-    if (!this->have_external_emd_handler() && !this->request_mode()) {
+    if (has_threshold() && !this->request_mode())
+      this->emd_storage_ = EMDPairsStorage::Threshold;
+    else if (has_sweep() && !this->request_mode())
+      init_sweep();
+    else if (!this->have_external_emd_handler() && !this->request_mode()) {
       this->emd_storage_ = (this->store_sym_emds_raw_ ? EMDPairsStorage::FlattenedSymmetric : EMDPairsStorage::FullSymmetric);
       this->emds_.resize(this->emd_storage_ == EMDPairsStorage::FullSymmetric ? nevA()*nevB() : num_emds());
     }
@@ -366,7 +488,11 @@ private:
 
     // resize emds
     this->num_emds_ = nevA * nevB;
-    if (!this->have_external_emd_handler() && !this->request_mode()) {
+    if (has_threshold() && !this->request_mode())
+      this->emd_storage_ = EMDPairsStorage::Threshold;
+    else if (has_sweep() && !this->request_mode())
+      init_sweep();
+    else if (!this->have_external_emd_handler() && !this->request_mode()) {
       this->emd_storage_ = EMDPairsStorage::Full;
       this->emds_.resize(num_emds());  
     }
@@ -396,6 +522,18 @@ private:
       *(this->print_stream_) << oss_.str() << std::endl;
     }
 
+    // the bounds tried first in threshold mode fill the signatures of the events, which is not
+    // thread safe, and each thread collects its close pairs separately
+    std::vector<std::vector<std::pair<index_type, index_type>>> thread_close_pairs;
+    if (this->emd_storage_ == EMDPairsStorage::Threshold) {
+      for (const Event & event : events_)
+        event_signature<typename EMD::PairwiseDistance>(event);
+      thread_close_pairs.resize(this->num_threads());
+    }
+
+    // the EMDs of a pair at each point of a sweep
+    std::vector<std::vector<Value>> thread_sweep_emds(this->num_threads());
+
     // iterate over emd pairs
     std::mutex failure_mutex;
     index_type begin(0);
@@ -419,8 +557,16 @@ private:
 
             // run and check for failure
             const Event & eventA(events()[i]), & eventB(events()[nevA() + j]);
+            if (this->emd_storage_ == EMDPairsStorage::Threshold) {
+              evaluate_within(emd_obj, eventA, eventB, i, j, thread_close_pairs, failure_mutex);
+              continue;
+            }
+            if (this->emd_storage_ == EMDPairsStorage::Sweep) {
+              evaluate_sweep(emd_obj, eventA, eventB, k, i, j, thread_sweep_emds, failure_mutex);
+              continue;
+            }
             EMDStatus status(emd_obj.compute(eventA, eventB));
-            if (status != EMDStatus::Success)
+            if (status != EMDStatus::Success && status != EMDStatus::Approximate)
               record_failure(failure_mutex, status, i, j);
 
             if (this->emd_storage_ == EMDPairsStorage::External)
@@ -437,8 +583,18 @@ private:
 
             // run and check for failure
             const Event & eventA(events()[i]), & eventB(events()[j]);
+            if (this->emd_storage_ == EMDPairsStorage::Threshold) {
+              evaluate_within(emd_obj, eventA, eventB, std::min(i, j), std::max(i, j),
+                              thread_close_pairs, failure_mutex);
+              continue;
+            }
+            if (this->emd_storage_ == EMDPairsStorage::Sweep) {
+              evaluate_sweep(emd_obj, eventA, eventB, this->index_symmetric(i, j), i, j,
+                             thread_sweep_emds, failure_mutex);
+              continue;
+            }
             EMDStatus status(emd_obj.compute(eventA, eventB));
-            if (status != EMDStatus::Success)
+            if (status != EMDStatus::Success && status != EMDStatus::Approximate)
               record_failure(failure_mutex, status, i, j);
 
             // store emd value
@@ -461,6 +617,11 @@ private:
       print_update();
     }
 
+    // gather the close pairs in order
+    for (const std::vector<std::pair<index_type, index_type>> & pairs : thread_close_pairs)
+      close_pairs_.insert(close_pairs_.end(), pairs.begin(), pairs.end());
+    std::sort(close_pairs_.begin(), close_pairs_.end());
+
     if (this->throw_on_error_ && this->errored())
       throw std::runtime_error(this->error_messages().front());
   }
@@ -487,6 +648,45 @@ private:
     return emd_objs_[thread].emd();
   }
 
+  // decides whether a pair is close in threshold mode, failures are recorded instead of thrown
+  void evaluate_within(EMD & emd_obj, const Event & eventA, const Event & eventB,
+                       index_type i, index_type j,
+                       std::vector<std::vector<std::pair<index_type, index_type>>> & thread_close_pairs,
+                       std::mutex & failure_mutex) {
+    try {
+      if (emd_obj.compute_within(eventA, eventB, threshold_))
+        thread_close_pairs[get_thread_id()].emplace_back(i, j);
+    }
+    catch (const std::runtime_error &) {
+      record_failure(failure_mutex, emd_obj.status(), i, j);
+    }
+  }
+
+  void init_sweep() {
+    this->emd_storage_ = EMDPairsStorage::Sweep;
+    if (sweep_handlers_.empty())
+      sweep_emds_.resize(num_emds() * sweep_.size());
+  }
+
+  // runs a pair over the sweep, storing its EMDs at index or passing them to the handlers
+  void evaluate_sweep(EMD & emd_obj, const Event & eventA, const Event & eventB,
+                      index_type index, index_type i, index_type j,
+                      std::vector<std::vector<Value>> & thread_sweep_emds,
+                      std::mutex & failure_mutex) {
+    std::vector<Value> & emds(thread_sweep_emds[get_thread_id()]);
+    EMDStatus status(emd_obj.compute_sweep(eventA, eventB, sweep_, emds));
+    if (status != EMDStatus::Success && status != EMDStatus::Approximate)
+      record_failure(failure_mutex, status, i, j);
+
+    if (sweep_handlers_.empty())
+      std::copy(emds.begin(), emds.end(), sweep_emds_.begin() + std::size_t(index) * sweep_.size());
+    else {
+      Value weight(eventA.event_weight() * eventB.event_weight());
+      for (std::size_t p = 0; p < emds.size(); p++)
+        (*sweep_handlers_[p])(emds[p], weight);
+    }
+  }
+
   // store events
   template<class ProtoEventIt>
   void store_proto_events(ProtoEventIt proto_events_first,
@@ -151,7 +151,13 @@ public:
   virtual void set_norm(bool norm) = 0;
   virtual void set_network_simplex_params(std::size_t n_iter_max=100000,
                                           Value epsilon_large_factor=1000,
-                                          Value epsilon_small_factor=1) = 0;
+                                          Value epsilon_small_factor=1,
+                                          Value pivot_param0=0,
+                                          Value pivot_param1=0) = 0;
+  virtual bool warm_start() const = 0;
+  virtual void set_warm_start(bool warm) = 0;
+  virtual EMDSolver solver() const = 0;
+  virtual void set_solver(EMDSolver solver) = 0;
 
   // set a handler to process EMDs on the fly instead of storing them
   void set_external_emd_handler(ExternalEMDHandler<Value> & handler) {
@@ -206,24 +212,13 @@ public:
   const std::vector<Value> & emds(bool raw = false) {
 
     // check for having no emds stored
-    if (emd_storage_ == EMDPairsStorage::External)
+    if (emd_storage_ == EMDPairsStorage::External || emd_storage_ == EMDPairsStorage::Threshold ||
+        emd_storage_ == EMDPairsStorage::Sweep)
       throw std::invalid_argument("No EMDs stored");
 
     // check if we need to construct a new full matrix from a raw symmetric one
     if (emd_storage_ == EMDPairsStorage::FlattenedSymmetric && !raw) {
-
-      // allocate a new vector for holding the full emds
-      full_emds_.resize(nevA()*nevB());
-
-      // zeros on the diagonal
-      for (index_type i = 0; i < nevA(); i++)
-        full_emds_[i*i] = 0;
-
-      // fill out matrix (index into upper triangular part)
-      for (index_type i = 0; i < nevA(); i++)
-        for (index_type j = i + 1; j < nevB(); j++)
-          full_emds_[i*nevB() + j] = full_emds_[j*nevB() + i] = emds_[index_symmetric(i, j)];
-
+      expand_symmetric(emds_.data(), 1, full_emds_);
       return full_emds_;
     }
 
@@ -259,6 +254,10 @@ public:
     // check for External handling, in which case we don't have any emds stored
     if (emd_storage_ == EMDPairsStorage::External)
       throw std::invalid_argument("EMD requested but external handler provided, so no EMDs stored");
+    if (emd_storage_ == EMDPairsStorage::Threshold)
+      throw std::invalid_argument("EMD requested in threshold mode, so no EMDs stored");
+    if (emd_storage_ == EMDPairsStorage::Sweep)
+      throw std::invalid_argument("EMD requested in sweep mode, so EMDs stored per parameter point");
 
     // index into emd vector (j always bigger than i because upper triangular storage)
     if (emd_storage_ == EMDPairsStorage::FlattenedSymmetric)
@@ -290,7 +289,7 @@ protected:
 
   // indexes upper triangle of symmetric matrix with zeros on diagonal that has been raw into 1D
   // see scipy's squareform function
-  index_type index_symmetric(index_type i, index_type j) {
+  index_type index_symmetric(index_type i, index_type j) const {
 
     // treat i as the row and j as the column
     if (j > i)
@@ -303,6 +302,23 @@ protected:
     return -1;
   }
 
+  // fills the full symmetric matrix from EMDs raw into 1D as by index_symmetric, reading
+  // every stride-th value
+  void expand_symmetric(const Value * flattened, std::size_t stride, std::vector<Value> & full) const {
+
+    // allocate a new vector for holding the full emds
+    full.resize(nevA()*nevB());
+
+    // zeros on the diagonal
+    for (index_type i = 0; i < nevA(); i++)
+      full[i*nevB() + i] = 0;
+
+    // fill out matrix (index into upper triangular part)
+    for (index_type i = 0; i < nevA(); i++)
+      for (index_type j = i + 1; j < nevB(); j++)
+        full[i*nevB() + j] = full[j*nevB() + i] = flattened[index_symmetric(i, j)*stride];
+  }
+
 private:
 
   // determine the number of threads to use
@@ -0,0 +1,456 @@
+//------------------------------------------------------------------------
+// This file is part of Wasserstein, a C++ library with a Python wrapper
+// that computes the Wasserstein/EMD distance. If you use it for academic
+// research, please cite or acknowledge the following works:
+//
+//   - Komiske, Metodiev, Thaler (2019) arXiv:1902.02346
+//       https://doi.org/10.1103/PhysRevLett.123.041801
+//   - Komiske, Metodiev, Thaler (2020) arXiv:2004.04159
+//       https://doi.org/10.1007/JHEP07%282020%29006
+//   - Boneel, van de Panne, Paris, Heidrich (2011)
+//       https://doi.org/10.1145/2070781.2024192
+//   - LEMON graph library https://lemon.cs.elte.hu/trac/lemon
+//
+// Copyright (C) 2019-2022 Patrick T. Komiske III
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------
+
+/*  _____   _____   _____   _____  _____  _   _   _____
+ * |  __ \ |  __ \ |_   _| / ____||_   _|| \ | | / ____|
+ * | |__) || |__) |  | |  | |       | |  |  \| || |  __
+ * |  ___/ |  _  /   | |  | |       | |  | . ` || | |_ |
+ * | |     | | \ \  _| |_ | |____  _| |_ | |\  || |__| |
+ * |_|     |_|  \_\|_____| \_____||_____||_| \_| \_____|
+ */
+
+#ifndef WASSERSTEIN_PRICINGKERNELS_HH
+#define WASSERSTEIN_PRICINGKERNELS_HH
+
+// C++ standard library
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#include "EMDUtils.hh"
+
+// vectorized kernels need GCC or clang on x86, define WASSERSTEIN_NO_SIMD to disable them
+#if !defined(WASSERSTEIN_NO_SIMD) && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+# define WASSERSTEIN_SIMD_PRICING
+# include <immintrin.h>
+#endif
+
+
+BEGIN_WASSERSTEIN_NAMESPACE
+
+//-----------------------------------------------------------------------------
+// Kernels for pricing arcs of a row of the complete bipartite graph
+//-----------------------------------------------------------------------------
+
+// All kernels find the minimum reduced cost states[k] * (costs[k] + pi_s - pis_t[k])
+// over k in [0, n). It replaces min (and min_arc with first + k) only if it is strictly
+// smaller, with ties going to the lowest k. The reduced costs are evaluated with the
+// same operations in the same order, so every kernel makes the same pivot choices.
+// The costs may be stored in a narrower type than the potentials (float costs with
+// double potentials), in which case they are converted exactly before the arithmetic.
+
+enum class PricingKernel : char {
+  Scalar = 0,
+  AVX2 = 1,
+  AVX512 = 2
+};
+
+inline std::string pricing_kernel_name(PricingKernel kernel) {
+  if (kernel == PricingKernel::AVX512) return "AVX512";
+  if (kernel == PricingKernel::AVX2) return "AVX2";
+  return "Scalar";
+}
+
+// the most capable kernel supported by the compiler and the cpu
+inline PricingKernel best_pricing_kernel() {
+#ifdef WASSERSTEIN_SIMD_PRICING
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f")) return PricingKernel::AVX512;
+  if (__builtin_cpu_supports("avx2")) return PricingKernel::AVX2;
+#endif
+  return PricingKernel::Scalar;
+}
+
+// the kernel NetworkSimplex objects start with and the one the ground distances are filled
+// with, detected once: AVX2 when supported, as the AVX-512 kernels measured no faster on
+// pricing (wider loads of the same memory, at a lower clock), unless WASSERSTEIN_PREFER_AVX512
+// is defined and the cpu supports them
+inline PricingKernel default_pricing_kernel() {
+#ifdef WASSERSTEIN_PREFER_AVX512
+  static const PricingKernel kernel(best_pricing_kernel());
+#else
+  static const PricingKernel kernel(std::min(best_pricing_kernel(), PricingKernel::AVX2));
+#endif
+  return kernel;
+}
+
+// the kernel itself if supported, otherwise the best supported one
+inline PricingKernel supported_pricing_kernel(PricingKernel kernel) {
+  return std::min(kernel, best_pricing_kernel());
+}
+
+template<typename Cost, typename Value, typename Arc>
+inline void price_arcs_scalar(const Cost * costs, const char * states, Value pi_s, const Value * pis_t,
+                              Arc first, Arc n, Value & min, Arc & min_arc) {
+  for (Arc k = 0; k < n; k++) {
+    Value c(states[k] * (Value(costs[k]) + pi_s - pis_t[k]));
+    if (c < min) {
+      min = c;
+      min_arc = first + k;
+    }
+  }
+}
+
+#ifdef WASSERSTEIN_SIMD_PRICING
+
+// merges the per-lane minima into min, lanes with a negative index never improved on it
+template<typename Value, typename Index, typename Arc>
+inline void reduce_pricing_lanes(const Value * mins, const Index * ks, int nlanes,
+                                 Arc first, Value & min, Arc & min_arc) {
+  Arc best_k(-1);
+  for (int l = 0; l < nlanes; l++) {
+    if (ks[l] < 0) continue;
+    if (mins[l] < min || (mins[l] == min && Arc(ks[l]) < best_k)) {
+      min = mins[l];
+      best_k = Arc(ks[l]);
+    }
+  }
+  if (best_k >= 0) min_arc = first + best_k;
+}
+
+// types without a vectorized kernel
+template<typename Cost, typename Value, typename Arc>
+inline void price_arcs_avx2(const Cost * costs, const char * states, Value pi_s, const Value * pis_t,
+                            Arc first, Arc n, Value & min, Arc & min_arc) {
+  price_arcs_scalar(costs, states, pi_s, pis_t, first, n, min, min_arc);
+}
+
+template<typename Cost, typename Value, typename Arc>
+inline void price_arcs_avx512(const Cost * costs, const char * states, Value pi_s, const Value * pis_t,
+                              Arc first, Arc n, Value & min, Arc & min_arc) {
+  price_arcs_scalar(costs, states, pi_s, pis_t, first, n, min, min_arc);
+}
+
+// The vectorized kernels price one vector of arcs per step, keeping in each lane the
+// minimum over its arcs and the first index attaining it (min(c, vmin) selects c only
+// if it is strictly smaller). Two independent sets of lanes hide the latency of the
+// running minimum. The lanes are merged and the remainder is priced by the scalar kernel.
+
+// costs of 4 arcs as doubles, either loaded directly or widened from floats
+__attribute__((target("avx2")))
+inline __m256d load_costs_avx2(const double * costs) { return _mm256_loadu_pd(costs); }
+__attribute__((target("avx2")))
+inline __m256d load_costs_avx2(const float * costs) { return _mm256_cvtps_pd(_mm_loadu_ps(costs)); }
+
+// 4 doubles per vector, lane indices are held as doubles (exact for any row length)
+template<typename Cost>
+__attribute__((target("avx2")))
+inline void price_step_avx2(const Cost * costs, const char * states, const double * pis_t,
+                             __m256d vpi, __m256d vk, __m256d & vmin, __m256d & vks) {
+  int s;
+  std::memcpy(&s, states, 4);
+  __m256d vs(_mm256_cvtepi32_pd(_mm_cvtepi8_epi32(_mm_cvtsi32_si128(s))));
+  __m256d c(_mm256_mul_pd(vs, _mm256_sub_pd(_mm256_add_pd(load_costs_avx2(costs), vpi), _mm256_loadu_pd(pis_t))));
+  vks = _mm256_blendv_pd(vks, vk, _mm256_cmp_pd(c, vmin, _CMP_LT_OQ));
+  vmin = _mm256_min_pd(c, vmin);
+}
+
+template<typename Cost, typename Arc>
+__attribute__((target("avx2")))
+inline void price_arcs_avx2(const Cost * costs, const char * states, double pi_s, const double * pis_t,
+                            Arc first, Arc n, double & min, Arc & min_arc) {
+  const int W(4);
+  Arc nv(n - n % W);
+  if (nv > 0) {
+    __m256d vpi(_mm256_set1_pd(pi_s)), vmin[2] = {_mm256_set1_pd(min), _mm256_set1_pd(min)};
+    __m256d vk(_mm256_setr_pd(0, 1, 2, 3)), vks[2] = {_mm256_set1_pd(-1), _mm256_set1_pd(-1)}, vstep(_mm256_set1_pd(W));
+    Arc k(0);
+    for (; k + 2*W <= nv; k += 2*W) {
+      price_step_avx2(costs + k, states + k, pis_t + k, vpi, vk, vmin[0], vks[0]);
+      vk = _mm256_add_pd(vk, vstep);
+      price_step_avx2(costs + k + W, states + k + W, pis_t + k + W, vpi, vk, vmin[1], vks[1]);
+      vk = _mm256_add_pd(vk, vstep);
+    }
+    if (k < nv)
+      price_step_avx2(costs + k, states + k, pis_t + k, vpi, vk, vmin[0], vks[0]);
+
+    double mins[2*W];
+    double ks[2*W];
+    for (int a = 0; a < 2; a++) {
+      _mm256_storeu_pd(mins + a*W, vmin[a]);
+      _mm256_storeu_pd(ks + a*W, vks[a]);
+    }
+    reduce_pricing_lanes(mins, ks, 2*W, first, min, min_arc);
+  }
+  price_arcs_scalar(costs + nv, states + nv, pi_s, pis_t + nv, first + nv, n - nv, min, min_arc);
+}
+
+// 8 floats per vector, lane indices are held as 32-bit integers
+__attribute__((target("avx2")))
+inline void price_step_avx2(const float * costs, const char * states, const float * pis_t,
+                             __m256 vpi, __m256i vk, __m256 & vmin, __m256i & vks) {
+  __m256 vs(_mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(_mm_loadl_epi64((const __m128i *) states))));
+  __m256 c(_mm256_mul_ps(vs, _mm256_sub_ps(_mm256_add_ps(_mm256_loadu_ps(costs), vpi), _mm256_loadu_ps(pis_t))));
+  vks = _mm256_blendv_epi8(vks, vk, _mm256_castps_si256(_mm256_cmp_ps(c, vmin, _CMP_LT_OQ)));
+  vmin = _mm256_min_ps(c, vmin);
+}
+
+template<typename Arc>
+__attribute__((target("avx2")))
+inline void price_arcs_avx2(const float * costs, const char * states, float pi_s, const float * pis_t,
+                            Arc first, Arc n, float & min, Arc & min_arc) {
+  const int W(8);
+  Arc nv(n - n % W);
+  if (nv > 0) {
+    __m256 vpi(_mm256_set1_ps(pi_s)), vmin[2] = {_mm256_set1_ps(min), _mm256_set1_ps(min)};
+    __m256i vk(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7)), vks[2] = {_mm256_set1_epi32(-1), _mm256_set1_epi32(-1)}, vstep(_mm256_set1_epi32(W));
+    Arc k(0);
+    for (; k + 2*W <= nv; k += 2*W) {
+      price_step_avx2(costs + k, states + k, pis_t + k, vpi, vk, vmin[0], vks[0]);
+      vk = _mm256_add_epi32(vk, vstep);
+      price_step_avx2(costs + k + W, states + k + W, pis_t + k + W, vpi, vk, vmin[1], vks[1]);
+      vk = _mm256_add_epi32(vk, vstep);
+    }
+    if (k < nv)
+      price_step_avx2(costs + k, states + k, pis_t + k, vpi, vk, vmin[0], vks[0]);
+
+    float mins[2*W];
+    int ks[2*W];
+    for (int a = 0; a < 2; a++) {
+      _mm256_storeu_ps(mins + a*W, vmin[a]);
+      _mm256_storeu_si256((__m256i *) (ks + a*W), vks[a]);
+    }
+    reduce_pricing_lanes(mins, ks, 2*W, first, min, min_arc);
+  }
+  price_arcs_scalar(costs + nv, states + nv, pi_s, pis_t + nv, first + nv, n - nv, min, min_arc);
+}
+
+// 4 64-bit integers per vector, lane indices are held as 64-bit integers; there is no
+// 64-bit multiply, so the reduced cost is negated where the state is -1 and zeroed where it is 0
+__attribute__((target("avx2")))
+inline void price_step_avx2(const std::int64_t * costs, const char * states, const std::int64_t * pis_t,
+                             __m256i vpi, __m256i vk, __m256i & vmin, __m256i & vks) {
+  int s;
+  std::memcpy(&s, states, 4);
+  __m256i zero(_mm256_setzero_si256()), vs(_mm256_cvtepi8_epi64(_mm_cvtsi32_si128(s)));
+  __m256i x(_mm256_sub_epi64(_mm256_add_epi64(_mm256_loadu_si256((const __m256i *) costs), vpi),
+                             _mm256_loadu_si256((const __m256i *) pis_t)));
+  __m256i neg(_mm256_cmpgt_epi64(zero, vs));
+  __m256i c(_mm256_andnot_si256(_mm256_cmpeq_epi64(vs, zero), _mm256_sub_epi64(_mm256_xor_si256(x, neg), neg)));
+  __m256i lt(_mm256_cmpgt_epi64(vmin, c));
+  vks = _mm256_blendv_epi8(vks, vk, lt);
+  vmin = _mm256_blendv_epi8(vmin, c, lt);
+}
+
+template<typename Arc>
+__attribute__((target("avx2")))
+inline void price_arcs_avx2(const std::int64_t * costs, const char * states, std::int64_t pi_s, const std::int64_t * pis_t,
+                            Arc first, Arc n, std::int64_t & min, Arc & min_arc) {
+  const int W(4);
+  Arc nv(n - n % W);
+  if (nv > 0) {
+    __m256i vpi(_mm256_set1_epi64x(pi_s)), vmin[2] = {_mm256_set1_epi64x(min), _mm256_set1_epi64x(min)};
+    __m256i vk(_mm256_setr_epi64x(0, 1, 2, 3)), vks[2] = {_mm256_set1_epi64x(-1), _mm256_set1_epi64x(-1)}, vstep(_mm256_set1_epi64x(W));
+    Arc k(0);
+    for (; k + 2*W <= nv; k += 2*W) {
+      price_step_avx2(costs + k, states + k, pis_t + k, vpi, vk, vmin[0], vks[0]);
+      vk = _mm256_add_epi64(vk, vstep);
+      price_step_avx2(costs + k + W, states + k + W, pis_t + k + W, vpi, vk, vmin[1], vks[1]);
+      vk = _mm256_add_epi64(vk, vstep);
+    }
+    if (k < nv)
+      price_step_avx2(costs + k, states + k, pis_t + k, vpi, vk, vmin[0], vks[0]);
+
+    std::int64_t mins[2*W], ks[2*W];
+    for (int a = 0; a < 2; a++) {
+      _mm256_storeu_si256((__m256i *) (mins + a*W), vmin[a]);
+      _mm256_storeu_si256((__m256i *) (ks + a*W), vks[a]);
+    }
+    reduce_pricing_lanes(mins, ks, 2*W, first, min, min_arc);
+  }
+  price_arcs_scalar(costs + nv, states + nv, pi_s, pis_t + nv, first + nv, n - nv, min, min_arc);
+}
+
+// GCC's AVX-512 intrinsics trigger spurious -Wmaybe-uninitialized warnings (GCC bug 105593)
+#if defined(__GNUC__) && !defined(__clang__)
+# pragma GCC diagnostic push
+# pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+// costs of 8 arcs as doubles, either loaded directly or widened from floats
+__attribute__((target("avx512f")))
+inline __m512d load_costs_avx512(const double * costs) { return _mm512_loadu_pd(costs); }
+__attribute__((target("avx512f")))
+inline __m512d load_costs_avx512(const float * costs) { return _mm512_cvtps_pd(_mm256_loadu_ps(costs)); }
+
+// 8 doubles per vector, lane indices are held as 64-bit integers
+template<typename Cost>
+__attribute__((target("avx512f")))
+inline void price_step_avx512(const Cost * costs, const char * states, const double * pis_t,
+                             __m512d vpi, __m512i vk, __m512d & vmin, __m512i & vks) {
+  __m512d vs(_mm512_cvtepi32_pd(_mm256_cvtepi8_epi32(_mm_loadl_epi64((const __m128i *) states))));
+  __m512d c(_mm512_mul_pd(vs, _mm512_sub_pd(_mm512_add_pd(load_costs_avx512(costs), vpi), _mm512_loadu_pd(pis_t))));
+  vks = _mm512_mask_mov_epi64(vks, _mm512_cmp_pd_mask(c, vmin, _CMP_LT_OQ), vk);
+  vmin = _mm512_min_pd(c, vmin);
+}
+
+template<typename Cost, typename Arc>
+__attribute__((target("avx512f")))
+inline void price_arcs_avx512(const Cost * costs, const char * states, double pi_s, const double * pis_t,
+                            Arc first, Arc n, double & min, Arc & min_arc) {
+  const int W(8);
+  Arc nv(n - n % W);
+  if (nv > 0) {
+    __m512d vpi(_mm512_set1_pd(pi_s)), vmin[2] = {_mm512_set1_pd(min), _mm512_set1_pd(min)};
+    __m512i vk(_mm512_setr_epi64(0, 1, 2, 3, 4, 5, 6, 7)), vks[2] = {_mm512_set1_epi64(-1), _mm512_set1_epi64(-1)}, vstep(_mm512_set1_epi64(W));
+    Arc k(0);
+    for (; k + 2*W <= nv; k += 2*W) {
+      price_step_avx512(costs + k, states + k, pis_t + k, vpi, vk, vmin[0], vks[0]);
+      vk = _mm512_add_epi64(vk, vstep);
+      price_step_avx512(costs + k + W, states + k + W, pis_t + k + W, vpi, vk, vmin[1], vks[1]);
+      vk = _mm512_add_epi64(vk, vstep);
+    }
+    if (k < nv)
+      price_step_avx512(costs + k, states + k, pis_t + k, vpi, vk, vmin[0], vks[0]);
+
+    double mins[2*W];
+    long long ks[2*W];
+    for (int a = 0; a < 2; a++) {
+      _mm512_storeu_pd(mins + a*W, vmin[a]);
+      _mm512_storeu_si512(ks + a*W, vks[a]);
+    }
+    reduce_pricing_lanes(mins, ks, 2*W, first, min, min_arc);
+  }
+  price_arcs_scalar(costs + nv, states + nv, pi_s, pis_t + nv, first + nv, n - nv, min, min_arc);
+}
+
+// 16 floats per vector, lane indices are held as 32-bit integers
+__attribute__((target("avx512f")))
+inline void price_step_avx512(const float * costs, const char * states, const float * pis_t,
+                             __m512 vpi, __m512i vk, __m512 & vmin, __m512i & vks) {
+  __m512 vs(_mm512_cvtepi32_ps(_mm512_cvtepi8_epi32(_mm_loadu_si128((const __m128i *) states))));
+  __m512 c(_mm512_mul_ps(vs, _mm512_sub_ps(_mm512_add_ps(_mm512_loadu_ps(costs), vpi), _mm512_loadu_ps(pis_t))));
+  vks = _mm512_mask_mov_epi32(vks, _mm512_cmp_ps_mask(c, vmin, _CMP_LT_OQ), vk);
+  vmin = _mm512_min_ps(c, vmin);
+}
+
+template<typename Arc>
+__attribute__((target("avx512f")))
+inline void price_arcs_avx512(const float * costs, const char * states, float pi_s, const float * pis_t,
+                            Arc first, Arc n, float & min, Arc & min_arc) {
+  const int W(16);
+  Arc nv(n - n % W);
+  if (nv > 0) {
+    __m512 vpi(_mm512_set1_ps(pi_s)), vmin[2] = {_mm512_set1_ps(min), _mm512_set1_ps(min)};
+    __m512i vk(_mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15)), vks[2] = {_mm512_set1_epi32(-1), _mm512_set1_epi32(-1)}, vstep(_mm512_set1_epi32(W));
+    Arc k(0);
+    for (; k + 2*W <= nv; k += 2*W) {
+      price_step_avx512(costs + k, states + k, pis_t + k, vpi, vk, vmin[0], vks[0]);
+      vk = _mm512_add_epi32(vk, vstep);
+      price_step_avx512(costs + k + W, states + k + W, pis_t + k + W, vpi, vk, vmin[1], vks[1]);
+      vk = _mm512_add_epi32(vk, vstep);
+    }
+    if (k < nv)
+      price_step_avx512(costs + k, states + k, pis_t + k, vpi, vk, vmin[0], vks[0]);
+
+    float mins[2*W];
+    int ks[2*W];
+    for (int a = 0; a < 2; a++) {
+      _mm512_storeu_ps(mins + a*W, vmin[a]);
+      _mm512_storeu_si512(ks + a*W, vks[a]);
+    }
+    reduce_pricing_lanes(mins, ks, 2*W, first, min, min_arc);
+  }
+  price_arcs_scalar(costs + nv, states + nv, pi_s, pis_t + nv, first + nv, n - nv, min, min_arc);
+}
+
+// 8 64-bit integers per vector, lane indices are held as 64-bit integers
+__attribute__((target("avx512f")))
+inline void price_step_avx512(const std::int64_t * costs, const char * states, const std::int64_t * pis_t,
+                              __m512i vpi, __m512i vk, __m512i & vmin, __m512i & vks) {
+  __m512i zero(_mm512_setzero_si512()), vs(_mm512_cvtepi8_epi64(_mm_loadl_epi64((const __m128i *) states)));
+  __m512i x(_mm512_sub_epi64(_mm512_add_epi64(_mm512_loadu_si512(costs), vpi), _mm512_loadu_si512(pis_t)));
+  __m512i c(_mm512_mask_sub_epi64(x, _mm512_cmplt_epi64_mask(vs, zero), zero, x));
+  c = _mm512_mask_mov_epi64(c, _mm512_cmpeq_epi64_mask(vs, zero), zero);
+  __mmask8 lt(_mm512_cmplt_epi64_mask(c, vmin));
+  vks = _mm512_mask_mov_epi64(vks, lt, vk);
+  vmin = _mm512_mask_mov_epi64(vmin, lt, c);
+}
+
+template<typename Arc>
+__attribute__((target("avx512f")))
+inline void price_arcs_avx512(const std::int64_t * costs, const char * states, std::int64_t pi_s, const std::int64_t * pis_t,
+                              Arc first, Arc n, std::int64_t & min, Arc & min_arc) {
+  const int W(8);
+  Arc nv(n - n % W);
+  if (nv > 0) {
+    __m512i vpi(_mm512_set1_epi64(pi_s)), vmin[2] = {_mm512_set1_epi64(min), _mm512_set1_epi64(min)};
+    __m512i vk(_mm512_setr_epi64(0, 1, 2, 3, 4, 5, 6, 7)), vks[2] = {_mm512_set1_epi64(-1), _mm512_set1_epi64(-1)}, vstep(_mm512_set1_epi64(W));
+    Arc k(0);
+    for (; k + 2*W <= nv; k += 2*W) {
+      price_step_avx512(costs + k, states + k, pis_t + k, vpi, vk, vmin[0], vks[0]);
+      vk = _mm512_add_epi64(vk, vstep);
+      price_step_avx512(costs + k + W, states + k + W, pis_t + k + W, vpi, vk, vmin[1], vks[1]);
+      vk = _mm512_add_epi64(vk, vstep);
+    }
+    if (k < nv)
+      price_step_avx512(costs + k, states + k, pis_t + k, vpi, vk, vmin[0], vks[0]);
+
+    std::int64_t mins[2*W], ks[2*W];
+    for (int a = 0; a < 2; a++) {
+      _mm512_storeu_si512(mins + a*W, vmin[a]);
+      _mm512_storeu_si512(ks + a*W, vks[a]);
+    }
+    reduce_pricing_lanes(mins, ks, 2*W, first, min, min_arc);
+  }
+  price_arcs_scalar(costs + nv, states + nv, pi_s, pis_t + nv, first + nv, n - nv, min, min_arc);
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+# pragma GCC diagnostic pop
+#endif
+
+#endif // WASSERSTEIN_SIMD_PRICING
+
+// prices n arcs starting at arc first with the given kernel, short runs are
+// left to the scalar kernel since merging the lanes would dominate
+template<typename Cost, typename Value, typename Arc>
+inline void price_arcs(PricingKernel kernel, const Cost * costs, const char * states, Value pi_s, const Value * pis_t,
+                       Arc first, Arc n, Value & min, Arc & min_arc) {
+#ifdef WASSERSTEIN_SIMD_PRICING
+  if (n >= 32) switch (kernel) {
+    case PricingKernel::AVX512:
+      price_arcs_avx512(costs, states, pi_s, pis_t, first, n, min, min_arc);
+      return;
+    case PricingKernel::AVX2:
+      price_arcs_avx2(costs, states, pi_s, pis_t, first, n, min, min_arc);
+      return;
+    default:
+      break;
+  }
+#else
+  (void) kernel;
+#endif
+  price_arcs_scalar(costs, states, pi_s, pis_t, first, n, min, min_arc);
+}
+
+END_WASSERSTEIN_NAMESPACE
+
+#endif // WASSERSTEIN_PRICINGKERNELS_HH
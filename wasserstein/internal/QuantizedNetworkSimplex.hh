@@ -0,0 +1,364 @@
+//------------------------------------------------------------------------
+// This file is part of Wasserstein, a C++ library with a Python wrapper
+// that computes the Wasserstein/EMD distance. If you use it for academic
+// research, please cite or acknowledge the following works:
+//
+//   - Komiske, Metodiev, Thaler (2019) arXiv:1902.02346
+//       https://doi.org/10.1103/PhysRevLett.123.041801
+//   - Komiske, Metodiev, Thaler (2020) arXiv:2004.04159
+//       https://doi.org/10.1007/JHEP07%282020%29006
+//   - Boneel, van de Panne, Paris, Heidrich (2011)
+//       https://doi.org/10.1145/2070781.2024192
+//   - LEMON graph library https://lemon.cs.elte.hu/trac/lemon
+//
+// Copyright (C) 2019-2022 Patrick T. Komiske III
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------
+
+/*   ____   _    _            _   _  _______  _____  ______ ______  _____
+ *  / __ \ | |  | |    /\    | \ | ||__   __||_   _||___  /|  ____||  __ \
+ * | |  | || |  | |   /  \   |  \| |   | |     | |     / / | |__   | |  | |
+ * | |  | || |  | |  / /\ \  | . ` |   | |     | |    / /  |  __|  | |  | |
+ * | |__| || |__| | / ____ \ | |\  |   | |    _| |_  / /__ | |____ | |__| |
+ *  \___\_\ \____/ /_/    \_\|_| \_|   |_|   |_____|/_____||______||_____/
+ */
+
+#ifndef WASSERSTEIN_QUANTIZEDNETWORKSIMPLEX_HH
+#define WASSERSTEIN_QUANTIZEDNETWORKSIMPLEX_HH
+
+// C++ standard library
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "EMDUtils.hh"
+#include "NetworkSimplex.hh"
+
+BEGIN_WASSERSTEIN_NAMESPACE
+
+////////////////////////////////////////////////////////////////////////////////
+// QuantizedNetworkSimplex - exact transport of weights and ground distances
+//                           rounded to 64-bit integers, usable in place of
+//                           NetworkSimplex
+////////////////////////////////////////////////////////////////////////////////
+
+// The weights are rounded to multiples of weight_resolution and the ground
+// distances to multiples of dist_resolution, both in the units handed to the
+// solver (EMD scales the weights to a total of 1 unless norm is set). Each side
+// is rounded down and the remaining units go to the largest remainders (ties to
+// the lowest index), so that both sides have exactly the same integer total.
+// The integer problem is then solved by NetworkSimplex<std::int64_t>, which
+// compares reduced costs and flows exactly instead of against epsilons, and its
+// solution is converted back to Value. Given the same weights and distances the
+// result is the same bit for bit, whatever the machine or number of threads.
+// Quantities that could overflow the 64-bit arithmetic throw std::overflow_error,
+// in which case coarser resolutions are needed. EMD only solves 1D events by
+// sorting instead if its solver is set to EMDSolver::Sorted1D.
+
+template<typename V>
+class QuantizedNetworkSimplex {
+
+#ifdef WASSERSTEIN_SERIALIZATION
+  friend class boost::serialization::access;
+  template<class Archive>
+  void serialize(Archive & ar, const unsigned int version) {
+    ar & epsilon_large_ & weight_resolution_ & dist_resolution_ & network_simplex_;
+  }
+#endif
+
+public:
+
+  typedef V value_type;
+  typedef V Value;
+  typedef std::vector<Value> ValueVector;
+  typedef std::int64_t Integer;
+  typedef NetworkSimplex<Integer, index_type, int, char> IntegerNetworkSimplex;
+
+  static_assert(std::is_floating_point<Value>::value, "Value should be a floating point type.");
+
+  // default constructor
+  QuantizedNetworkSimplex() :
+    weight_resolution_(DEFAULT_RESOLUTION),
+    dist_resolution_(DEFAULT_RESOLUTION),
+    cost_threshold_(std::numeric_limits<Value>::max()),
+    total_cost_(INVALID_COST)
+  {}
+
+  // constructor with the same arguments as NetworkSimplex
+  QuantizedNetworkSimplex(std::size_t n_iter_max, Value epsilon_large_factor, Value epsilon_small_factor) :
+    QuantizedNetworkSimplex()
+  {
+    set_params(n_iter_max, epsilon_large_factor, epsilon_small_factor);
+  }
+
+  // epsilon_large is the tolerance on the totals of the unrounded weights, the integer
+  // problem needs no tolerances so epsilon_small is not used; the pivot rule parameters
+  // are passed on to the integer network simplex
+  void set_params(std::size_t n_iter_max, Value epsilon_large_factor, Value,
+                  double pivot_param0 = 0, double pivot_param1 = 0) {
+    epsilon_large_ = epsilon_large_factor * std::numeric_limits<Value>::epsilon();
+    network_simplex_.set_params(n_iter_max, 0, 0, pivot_param0, pivot_param1);
+  }
+
+  // weights and ground distances are rounded to multiples of these
+  Value weight_resolution() const { return weight_resolution_; }
+  Value dist_resolution() const { return dist_resolution_; }
+  void set_resolutions(Value weight_resolution, Value dist_resolution) {
+    if (!(weight_resolution > 0) || !(dist_resolution > 0))
+      throw std::invalid_argument("resolutions must be positive");
+    weight_resolution_ = weight_resolution;
+    dist_resolution_ = dist_resolution;
+  }
+
+  // get description of this solver
+  std::string description() const {
+    std::string ns(network_simplex_.description());
+    std::ostringstream oss;
+    oss << "  QuantizedNetworkSimplex\n"
+        << "    weight_resolution - " << weight_resolution_ << '\n'
+        << "    dist_resolution - "   << dist_resolution_   << '\n'
+        << ns.substr(ns.find('\n') + 1);
+    return oss.str();
+  }
+
+  // warm starting is done by the integer network simplex
+  bool warm_start() const { return network_simplex_.warm_start(); }
+  void set_warm_start(bool warm) { network_simplex_.set_warm_start(warm); }
+
+  // so is the anytime mode (see NetworkSimplex::set_anytime)
+  double relative_gap() const { return network_simplex_.relative_gap(); }
+  double max_seconds() const { return network_simplex_.max_seconds(); }
+  bool anytime() const { return network_simplex_.anytime(); }
+  void set_anytime(double relative_gap, double max_seconds) {
+    network_simplex_.set_anytime(relative_gap, max_seconds);
+  }
+
+  // and the threshold decision mode, the threshold being converted to the units of the
+  // resolutions when computing (see NetworkSimplex::set_cost_threshold)
+  Value cost_threshold() const { return cost_threshold_; }
+  bool has_cost_threshold() const { return cost_threshold_ < std::numeric_limits<Value>::max(); }
+  void set_cost_threshold(Value threshold) { cost_threshold_ = threshold; }
+
+  // and the threads pricing a single large problem (see NetworkSimplex::set_num_threads)
+  int num_threads() const { return network_simplex_.num_threads(); }
+  std::size_t min_parallel_arcs() const { return network_simplex_.min_parallel_arcs(); }
+  void set_num_threads(int num_threads, std::size_t min_parallel_arcs = DEFAULT_MIN_PARALLEL_ARCS) {
+    network_simplex_.set_num_threads(num_threads, min_parallel_arcs);
+  }
+
+  // and the kernel pricing its arcs (see NetworkSimplex::set_pricing_kernel)
+  PricingKernel pricing_kernel() const { return network_simplex_.pricing_kernel(); }
+  PricingKernel set_pricing_kernel(PricingKernel kernel) { return network_simplex_.set_pricing_kernel(kernel); }
+
+  // set dists and weights
+  ValueVector & weights() { return weights_; }
+  ValueVector & dists() { return costs_; }
+
+  // run computation given weights and dists
+  EMDStatus compute(std::size_t n0, std::size_t n1) {
+
+    std::size_t n(n0 + n1), arc_num(n0*n1);
+    total_cost_ = INVALID_COST;
+
+    // the totals have to agree before they are rounded
+    Value sum0(0), sum1(0);
+    for (std::size_t i = 0; i < n0; i++) sum0 += weights_[i];
+    for (std::size_t j = n0; j < n; j++) sum1 += weights_[j];
+    if (std::abs(sum0 - sum1) > epsilon_large_) return EMDStatus::SupplyMismatch;
+
+    // round the weights, the network simplex needs room for the root node
+    Value scaled_total((sum0 + sum1) / (2*weight_resolution_));
+    check_range(scaled_total);
+    Integer total(std::llround(scaled_total));
+    network_simplex_.weights().resize(n + 1);
+    quantize_weights(0, n0, total);
+    quantize_weights(n0, n1, total);
+
+    // round the ground distances
+    std::vector<Integer> & costs(network_simplex_.dists());
+    costs.resize(arc_num);
+    Integer max_cost(0);
+    for (std::size_t a = 0; a < arc_num; a++) {
+      Value scaled_cost(costs_[a] / dist_resolution_);
+      check_range(scaled_cost);
+      costs[a] = std::llround(scaled_cost);
+      max_cost = std::max(max_cost, std::abs(costs[a]));
+    }
+
+    // the total cost is at most total*max_cost and the potentials stay within a few times the
+    // artificial cost, (max_cost + 1)*(n0 + n1)
+    if (double(total) * double(max_cost) > limit() || double(max_cost + 1) * double(n + 1) > limit())
+      throw_overflow();
+
+    // an integer cost is below the threshold exactly when it is below its ceiling in these units
+    double threshold(std::ceil(double(cost_threshold_) / (double(weight_resolution_) * dist_resolution_)));
+    network_simplex_.set_cost_threshold(has_cost_threshold() && threshold < limit() ?
+                                        Integer(threshold) : std::numeric_limits<Integer>::max());
+
+    EMDStatus status(network_simplex_.compute(n0, n1));
+    if (status != EMDStatus::Success && status != EMDStatus::Approximate) return status;
+
+    // convert the solution back
+    total_cost_ = Value(network_simplex_.total_cost()) * weight_resolution_ * dist_resolution_;
+    flows_.resize(arc_num);
+    for (std::size_t a = 0; a < arc_num; a++)
+      flows_[a] = Value(network_simplex_.flows()[a]) * weight_resolution_;
+    pis_.resize(n);
+    for (std::size_t u = 0; u < n; u++)
+      pis_[u] = Value(network_simplex_.potentials()[u]) * dist_resolution_;
+
+    return status;
+  }
+
+  // access total cost
+  Value total_cost() const { return total_cost_; }
+
+  // bounds on the cost of the rounded problem, see NetworkSimplex::cost_lower_bound
+  Value cost_lower_bound() const {
+    return Value(network_simplex_.cost_lower_bound()) * weight_resolution_ * dist_resolution_;
+  }
+  Value cost_upper_bound() const {
+    return Value(network_simplex_.cost_upper_bound()) * weight_resolution_ * dist_resolution_;
+  }
+
+  // access tolerance on the total supply
+  Value epsilon_large() const { return epsilon_large_; }
+
+  // access number of iterations required
+  std::size_t n_iter() const { return network_simplex_.n_iter(); }
+
+  // access solver statistics of the integer network simplex
+  const SolverStats & stats() const { return network_simplex_.stats(); }
+  SolverStats & stats() { return network_simplex_.stats(); }
+  void reset_stats() { network_simplex_.reset_stats(); }
+
+  // the integer problem as last solved, its flows and costs are in units of the resolutions
+  const IntegerNetworkSimplex & network_simplex() const { return network_simplex_; }
+
+  // flow and ground_dist vectors, only first n0_*n1_ values should be used
+  const ValueVector & dists() const { return costs_; }
+  const ValueVector & flows() const { return flows_; }
+  const ValueVector & potentials() const { return pis_; }
+
+  // appends the nonzero flows with their arcs i*n1 + j, from the tree of the integer problem
+  void sparse_flows(std::vector<std::pair<std::size_t, Value>> & arc_flows) const {
+    std::vector<std::pair<std::size_t, Integer>> integer_flows;
+    network_simplex_.sparse_flows(integer_flows);
+    for (const std::pair<std::size_t, Integer> & af : integer_flows)
+      arc_flows.emplace_back(af.first, Value(af.second) * weight_resolution_);
+  }
+
+  // free all memory
+  void free() {
+    free_vector(weights_);
+    free_vector(costs_);
+    free_vector(flows_);
+    free_vector(pis_);
+    free_vector(remainders_);
+    free_vector(order_);
+    network_simplex_.free();
+  }
+
+  // reserves the buffers for problems with up to n0 x n1 nodes, along with those of
+  // the integer network simplex
+  void reserve(std::size_t n0, std::size_t n1, bool huge_pages = false) {
+    weights_.reserve(n0 + n1 + 1);
+    costs_.reserve(n0*n1 + n0 + n1);
+    flows_.reserve(n0*n1);
+    pis_.reserve(n0 + n1);
+    remainders_.reserve(n0 + n1);
+    order_.reserve(n0 + n1);
+    network_simplex_.reserve(n0, n1, huge_pages);
+    if (huge_pages) {
+      advise_huge_pages(costs_);
+      advise_huge_pages(flows_);
+    }
+  }
+
+private:
+
+  static constexpr double DEFAULT_RESOLUTION = 1e-8;
+  static constexpr Value INVALID_COST = -1;
+
+  // largest magnitude of the integer quantities, leaving room for the arithmetic on them
+  static double limit() { return double(std::numeric_limits<Integer>::max()) / 4; }
+
+  static void throw_overflow() {
+    throw std::overflow_error("QuantizedNetworkSimplex - weights or ground distances too large "
+                              "for their resolutions");
+  }
+
+  // checks a weight or distance in units of its resolution before it is converted to Integer,
+  // which would be undefined beyond the range of Integer (or for nan)
+  static void check_range(Value x) {
+    if (!(std::fabs(double(x)) <= limit())) throw_overflow();
+  }
+
+  // rounds the n weights starting at begin down to integers, then adds the units missing
+  // from total to the largest remainders (or removes the excess from the smallest)
+  void quantize_weights(std::size_t begin, std::size_t n, Integer total) {
+
+    std::vector<Integer> & qs(network_simplex_.weights());
+    remainders_.resize(n);
+    order_.resize(n);
+    Integer sum(0);
+    for (std::size_t i = 0; i < n; i++) {
+      Value x(weights_[begin + i] / weight_resolution_), f(std::floor(x));
+      check_range(x);
+      qs[begin + i] = Integer(f);
+      remainders_[i] = x - f;
+      order_[i] = i;
+      sum += qs[begin + i];
+    }
+    if (n == 0 || sum == total) return;
+
+    std::sort(order_.begin(), order_.end(), [this](std::size_t i, std::size_t j) {
+      return remainders_[i] > remainders_[j] || (remainders_[i] == remainders_[j] && i < j);
+    });
+    for (std::size_t k = 0; sum < total; k = (k + 1) % n, sum++)
+      qs[begin + order_[k]]++;
+    for (std::size_t k = n - 1; sum > total; k = (k + n - 1) % n)
+      if (qs[begin + order_[k]] > 0) {
+        qs[begin + order_[k]]--;
+        sum--;
+      }
+  }
+
+  // parameters
+  Value epsilon_large_, weight_resolution_, dist_resolution_, cost_threshold_;
+
+  // problem data and results
+  Value total_cost_;
+  ValueVector weights_, costs_, flows_, pis_, remainders_;
+  std::vector<std::size_t> order_;
+
+  // solves the rounded problem
+  IntegerNetworkSimplex network_simplex_;
+
+}; // QuantizedNetworkSimplex
+
+// definitions of the static constants, needed when they are bound to references
+template<typename V> constexpr double QuantizedNetworkSimplex<V>::DEFAULT_RESOLUTION;
+template<typename V> constexpr V QuantizedNetworkSimplex<V>::INVALID_COST;
+
+END_WASSERSTEIN_NAMESPACE
+
+#endif // WASSERSTEIN_QUANTIZEDNETWORKSIMPLEX_HH
@@ -0,0 +1,555 @@
+//------------------------------------------------------------------------
+// This file is part of Wasserstein, a C++ library with a Python wrapper
+// that computes the Wasserstein/EMD distance. If you use it for academic
+// research, please cite or acknowledge the following works:
+//
+//   - Komiske, Metodiev, Thaler (2019) arXiv:1902.02346
+//       https://doi.org/10.1103/PhysRevLett.123.041801
+//   - Komiske, Metodiev, Thaler (2020) arXiv:2004.04159
+//       https://doi.org/10.1007/JHEP07%282020%29006
+//   - Boneel, van de Panne, Paris, Heidrich (2011)
+//       https://doi.org/10.1145/2070781.2024192
+//   - LEMON graph library https://lemon.cs.elte.hu/trac/lemon
+//
+// Copyright (C) 2019-2022 Patrick T. Komiske III
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------
+
+/*   _____  _____  _   _  _  __ _    _   ____   _____   _   _
+ *  / ____||_   _|| \ | || |/ /| |  | | / __ \ |  __ \ | \ | |
+ * | (___    | |  |  \| || ' / | |__| || |  | || |__) ||  \| |
+ *  \___ \   | |  | . ` ||  <  |  __  || |  | ||  _  / | . ` |
+ *  ____) | _| |_ | |\  || . \ | |  | || |__| || | \ \ | |\  |
+ * |_____/ |_____||_| \_||_|\_\|_|  |_| \____/ |_|  \_\|_| \_|
+ */
+
+#ifndef WASSERSTEIN_SINKHORN_HH
+#define WASSERSTEIN_SINKHORN_HH
+
+// C++ standard library
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "DistanceKernels.hh"
+#include "EMDUtils.hh"
+
+BEGIN_WASSERSTEIN_NAMESPACE
+
+////////////////////////////////////////////////////////////////////////////////
+// Sinkhorn - entropically regularized transport, usable in place of NetworkSimplex
+////////////////////////////////////////////////////////////////////////////////
+
+// Solves min_P sum_ij P_ij C_ij - eps H(P) with the same interface as
+// NetworkSimplex, so it can be used as the last template parameter of EMD.
+// The plan is kept in the log-domain stabilized form
+//   P_ij = u_i K_ij v_j,  K_ij = exp((f_i + g_j - C_ij)/eps),
+// where the Sinkhorn iterations only update the scalings u and v, which are
+// dense matrix-vector products over K. Whenever u or v grow too large or too
+// small they are absorbed into the dual potentials f and g and K is rebuilt,
+// so that nothing overflows or underflows even for small eps.
+//
+// The regularization eps is relative to the largest cost. With epsilon scaling,
+// eps starts at the largest cost and is reduced geometrically, with a single
+// log-domain iteration at each intermediate eps to carry the potentials along.
+//
+// The flows are the (dense) regularized plan and total_cost() is its transport
+// cost, which approaches the EMD from above as the regularization decreases.
+// The potentials follow the NetworkSimplex convention: -f for the sources and
+// g for the sinks.
+//
+// Every pass goes over whole rows of the costs (the row passes) or over a range
+// of columns of every row (the column passes), so that with set_num_threads the
+// rows or columns are split among the threads, and the kernel is rebuilt with the
+// approximate exp of DistanceKernels.hh using the default pricing kernel.
+template<typename V>
+class Sinkhorn {
+
+#ifdef WASSERSTEIN_SERIALIZATION
+  friend class boost::serialization::access;
+  template<class Archive>
+  void serialize(Archive & ar, const unsigned int version) {
+    ar & n_iter_max_ & epsilon_large_ & regularization_ & tolerance_ & epsilon_scaling_;
+  }
+#endif
+
+public:
+
+  typedef V value_type;
+  typedef V Value;
+  typedef std::vector<Value> ValueVector;
+
+  static_assert(std::is_floating_point<Value>::value, "Value should be a floating point type.");
+
+  // default constructor
+  Sinkhorn() :
+    n_iter_max_(100000), n_iter_(0),
+    epsilon_large_(1000 * std::numeric_limits<Value>::epsilon()),
+    regularization_(DEFAULT_REGULARIZATION),
+    tolerance_(DEFAULT_TOLERANCE),
+    epsilon_scaling_(DEFAULT_EPSILON_SCALING),
+    warm_start_(false),
+    have_potentials_(false),
+    num_threads_(1), threads_(1),
+    min_parallel_arcs_(DEFAULT_MIN_PARALLEL_ARCS),
+    n0_(0), n1_(0),
+    total_cost_(INVALID_COST), lower_bound_(INVALID_COST)
+  {
+    fill_exp_series(exp_series_);
+  }
+
+  // constructor with the same arguments as NetworkSimplex
+  Sinkhorn(std::size_t n_iter_max, Value epsilon_large_factor, Value epsilon_small_factor) :
+    Sinkhorn()
+  {
+    set_params(n_iter_max, epsilon_large_factor, epsilon_small_factor);
+  }
+
+  // there is no epsilon_small or pivot rule, so those parameters are not used (see
+  // set_regularization and set_tolerance)
+  void set_params(std::size_t n_iter_max, Value epsilon_large_factor, Value,
+                  double = 0, double = 0) {
+    n_iter_max_ = n_iter_max;
+    epsilon_large_ = epsilon_large_factor * std::numeric_limits<Value>::epsilon();
+  }
+
+  // regularization eps, as a fraction of the largest cost (0 selects the default)
+  Value regularization() const { return regularization_; }
+  void set_regularization(double regularization) {
+    regularization_ = regularization > 0 ? regularization : DEFAULT_REGULARIZATION;
+  }
+
+  // iterations stop when the summed marginal violation is below this (in units of the total
+  // weight, 0 selects the default)
+  Value tolerance() const { return tolerance_; }
+  void set_tolerance(double tolerance) {
+    tolerance_ = tolerance > 0 ? tolerance : DEFAULT_TOLERANCE;
+  }
+
+  // factor by which eps is reduced between stages, a value outside of (0, 1) disables epsilon scaling
+  Value epsilon_scaling() const { return epsilon_scaling_; }
+  void set_epsilon_scaling(double factor) {
+    epsilon_scaling_ = factor > 0 && factor < 1 ? factor : 0;
+  }
+
+  // get description of this solver
+  std::string description() const {
+    std::ostringstream oss;
+    oss << "  Sinkhorn\n"
+        << "    n_iter_max - "      << n_iter_max_      << '\n'
+        << "    epsilon_large - "   << epsilon_large_   << '\n'
+        << "    regularization - "  << regularization_  << '\n'
+        << "    tolerance - "       << tolerance_       << '\n'
+        << "    epsilon_scaling - " << epsilon_scaling_ << '\n'
+        << "    warm_start - "      << (warm_start_ ? "true" : "false") << '\n';
+    if (num_threads_ != 1)
+      oss << "    num_threads - " << num_threads_ << " from " << min_parallel_arcs_ << " arcs\n";
+    return oss.str();
+  }
+
+  // warm starting reuses the potentials of the previous problem if it had the same shape
+  bool warm_start() const { return warm_start_; }
+  void set_warm_start(bool warm) {
+    warm_start_ = warm;
+    have_potentials_ = false;
+  }
+
+  // there is no threshold decision mode (see NetworkSimplex::set_cost_threshold), the converged
+  // cost is compared to the threshold
+  Value cost_threshold() const { return std::numeric_limits<Value>::max(); }
+  bool has_cost_threshold() const { return false; }
+  void set_cost_threshold(Value) {}
+
+  // there is no anytime mode either (see NetworkSimplex::set_anytime), the iterations always
+  // run until the tolerance or n_iter_max is reached
+  double relative_gap() const { return 0; }
+  double max_seconds() const { return 0; }
+  bool anytime() const { return false; }
+  void set_anytime(double, double) {}
+
+  // threads splitting the rows or columns of each pass once the problem has min_parallel_arcs
+  // arcs, all of them if num_threads is -1 (see NetworkSimplex::set_num_threads)
+  int num_threads() const { return num_threads_; }
+  std::size_t min_parallel_arcs() const { return min_parallel_arcs_; }
+  void set_num_threads(int num_threads, std::size_t min_parallel_arcs = DEFAULT_MIN_PARALLEL_ARCS) {
+    num_threads_ = num_threads;
+    min_parallel_arcs_ = min_parallel_arcs;
+  }
+
+  // set dists and weights
+  ValueVector & weights() { return weights_; }
+  ValueVector & dists() { return costs_; }
+
+  // run computation given weights and dists
+  EMDStatus compute(std::size_t n0, std::size_t n1) {
+
+    bool warm(warm_start_ && have_potentials_ && n0 == n0_ && n1 == n1_);
+    n0_ = n0;
+    n1_ = n1;
+    n_iter_ = 0;
+    total_cost_ = lower_bound_ = INVALID_COST;
+    flows_.assign(n0*n1, 0);
+    threads_ = problem_threads(num_threads_, n0*n1, min_parallel_arcs_);
+
+    EMDStatus status(run(warm));
+    have_potentials_ = warm_start_ && status == EMDStatus::Success;
+
+    return status;
+  }
+
+  // access total cost
+  Value total_cost() const { return total_cost_; }
+
+  // bounds on the EMD: the dual objective of the sink potentials once the source potentials
+  // are lowered until no reduced cost is negative, and the total cost, which is an upper bound
+  // up to the marginal violation allowed by the tolerance
+  Value cost_lower_bound() const { return lower_bound_; }
+  Value cost_upper_bound() const { return total_cost_; }
+
+  // access tolerance on the total supply
+  Value epsilon_large() const { return epsilon_large_; }
+
+  // access number of iterations required
+  std::size_t n_iter() const { return n_iter_; }
+
+  // there are no pivots to count, the statistics stay empty
+  const SolverStats & stats() const { return stats_; }
+  SolverStats & stats() { return stats_; }
+  void reset_stats() { stats_.reset(); }
+
+  // flow and ground_dist vectors, only first n0_*n1_ values should be used
+  const ValueVector & dists() const { return costs_; }
+  const ValueVector & flows() const { return flows_; }
+  const ValueVector & potentials() const { return pis_; }
+
+  // appends the nonzero flows with their arcs i*n1 + j, which for the regularized plan
+  // are generally all of them
+  void sparse_flows(std::vector<std::pair<std::size_t, Value>> & arc_flows) const {
+    for (std::size_t a = 0, num_arcs = std::size_t(n0_)*n1_; a < num_arcs; a++)
+      if (flows_[a] != 0)
+        arc_flows.emplace_back(a, flows_[a]);
+  }
+
+  // free all memory
+  void free() {
+    free_vector(costs_);
+    free_vector(weights_);
+    free_vector(flows_);
+    free_vector(pis_);
+    free_vector(fs_);
+    free_vector(gs_);
+    free_vector(scalings_);
+    free_vector(kernel_);
+    free_vector(col_shifts_);
+    free_vector(col_sums_);
+    free_vector(rows_);
+    free_vector(thread_sums_);
+    have_potentials_ = false;
+  }
+
+  // reserves the buffers for problems with up to n0 x n1 nodes, optionally backing
+  // the ground distances, kernel and flows with huge pages
+  void reserve(std::size_t n0, std::size_t n1, bool huge_pages = false) {
+    weights_.reserve(n0 + n1 + 1);
+    costs_.reserve(n0*n1 + n0 + n1);
+    flows_.reserve(n0*n1);
+    pis_.reserve(n0 + n1);
+    fs_.reserve(n0);
+    gs_.reserve(n1);
+    scalings_.reserve(n0 + n1);
+    kernel_.reserve(n0*n1);
+    col_shifts_.reserve(n1);
+    col_sums_.reserve(n1);
+    int threads(problem_threads(num_threads_, n0*n1, min_parallel_arcs_));
+    rows_.reserve(threads * n1);
+    thread_sums_.reserve(threads);
+    if (huge_pages) {
+      advise_huge_pages(costs_);
+      advise_huge_pages(kernel_);
+      advise_huge_pages(flows_);
+    }
+  }
+
+private:
+
+  static constexpr double DEFAULT_REGULARIZATION = 0.01;
+  static constexpr double DEFAULT_TOLERANCE = 1e-6;
+  static constexpr double DEFAULT_EPSILON_SCALING = 0.5;
+  static constexpr Value INVALID_COST = -1;
+
+  // stands in for log(0), finite so that it is safe with -ffast-math
+  static constexpr Value LOG_ZERO = -std::numeric_limits<Value>::max()/4;
+
+  // scalings beyond this (or below its inverse) are absorbed into the potentials
+  static constexpr Value ABSORB_LIMIT = 1e10;
+
+  EMDStatus run(bool warm) {
+
+    if (n0_ + n1_ == 0) return EMDStatus::Empty;
+
+    // check supply total
+    Value sum0(0), sum1(0);
+    for (std::size_t i = 0; i < n0_; i++) sum0 += weights_[i];
+    for (std::size_t j = 0; j < n1_; j++) sum1 += weights_[n0_ + j];
+    if (std::fabs(sum0 - sum1) > epsilon_large_) return EMDStatus::SupplyMismatch;
+
+    // nothing to transport
+    pis_.assign(n0_ + n1_, 0);
+    if (sum0 <= 0 || n0_ == 0 || n1_ == 0) {
+      total_cost_ = lower_bound_ = 0;
+      return EMDStatus::Success;
+    }
+
+    rows_.resize(threads_ * n1_);
+    thread_sums_.resize(threads_);
+
+    // regularization is relative to the largest cost
+    Value max_cost(*std::max_element(costs_.begin(), costs_.begin() + n0_*n1_));
+    Value eps_final(regularization_ * (max_cost > 0 ? max_cost : 1)), eps(eps_final);
+    if (!warm) {
+      fs_.assign(n0_, 0);
+      gs_.assign(n1_, 0);
+      if (epsilon_scaling_ > 0)
+        eps = std::max(max_cost, eps_final);
+    }
+
+    // with epsilon scaling, a single log-domain iteration is done at each intermediate eps
+    while (eps > eps_final) {
+      log_domain_update(eps);
+      n_iter_++;
+      eps = std::max(eps * epsilon_scaling_, eps_final);
+    }
+
+    // a log-domain iteration makes K well-conditioned before iterating on the scalings
+    log_domain_update(eps);
+    reset_kernel(eps);
+
+    // the violation of the source marginals is measured as part of updating u
+    Value tol(tolerance_ * sum0);
+    while (update_us() > tol) {
+      if (n_iter_++ >= n_iter_max_) return EMDStatus::MaxIterReached;
+      update_vs();
+
+      for (std::size_t k = 0; k < n0_ + n1_; k++)
+        if (scalings_[k] > ABSORB_LIMIT || (scalings_[k] > 0 && scalings_[k] < 1/ABSORB_LIMIT)) {
+          fold_scalings(eps);
+          reset_kernel(eps);
+          break;
+        }
+    }
+
+    // store the plan and its cost
+    split(n0_, [this](int k, std::size_t first, std::size_t last) {
+      Value cost(0);
+      for (std::size_t i = first; i < last; i++) {
+        const Value * kernel(kernel_.data() + i*n1_), * costs(costs_.data() + i*n1_), * vs(scalings_.data() + n0_);
+        Value * flows(flows_.data() + i*n1_), u(scalings_[i]);
+        for (std::size_t j = 0; j < n1_; j++) {
+          flows[j] = u * kernel[j] * vs[j];
+          cost += flows[j] * costs[j];
+        }
+      }
+      thread_sums_[k] = cost;
+    });
+    total_cost_ = sum_threads();
+
+    // the potentials include the scalings, and are kept to warm start the next problem
+    fold_scalings(eps);
+    for (std::size_t i = 0; i < n0_; i++)
+      pis_[i] = -fs_[i];
+    std::copy(gs_.begin(), gs_.end(), pis_.begin() + n0_);
+
+    // the sink potentials with the largest feasible source potentials bound the EMD from below
+    split(n0_, [this](int k, std::size_t first, std::size_t last) {
+      Value dual(0);
+      for (std::size_t i = first; i < last; i++) {
+        const Value * costs(costs_.data() + i*n1_);
+        Value f(costs[0] - gs_[0]);
+        for (std::size_t j = 1; j < n1_; j++)
+          f = std::min(f, costs[j] - gs_[j]);
+        dual += weights_[i] * f;
+      }
+      thread_sums_[k] = dual;
+    });
+    lower_bound_ = sum_threads();
+    for (std::size_t j = 0; j < n1_; j++)
+      lower_bound_ += weights_[n0_ + j] * gs_[j];
+    lower_bound_ = std::min(lower_bound_, total_cost_);
+
+    return EMDStatus::Success;
+  }
+
+  // calls pass(k, first, last) for each thread k with its part [first, last) of [0, n), all
+  // of it when there is a single thread
+  template<class Pass>
+  void split(std::size_t n, const Pass & pass) {
+    if (threads_ == 1) pass(0, 0, n);
+    else {
+      #pragma omp parallel for num_threads(threads_) schedule(static, 1)
+      for (int k = 0; k < threads_; k++)
+        pass(k, n * k / threads_, n * (k + 1) / threads_);
+    }
+  }
+
+  // sum of the values found by the threads, in the same order each time
+  Value sum_threads() const {
+    Value sum(0);
+    for (int k = 0; k < threads_; k++)
+      sum += thread_sums_[k];
+    return sum;
+  }
+
+  // makes both marginals exact in turn by updating the potentials directly,
+  // the columns being accumulated row by row to keep memory access contiguous
+  void log_domain_update(Value eps) {
+    Value inv_eps(1/eps);
+
+    // f_i = eps log a_i - eps logsumexp_j (g_j - C_ij)/eps, with a_i = 1 standing in for empty sources
+    split(n0_, [this, eps, inv_eps](int k, std::size_t first, std::size_t last) {
+      Value * row(rows_.data() + k*n1_);
+      for (std::size_t i = first; i < last; i++) {
+        const Value * costs(costs_.data() + i*n1_);
+        Value m(LOG_ZERO), s(0);
+        for (std::size_t j = 0; j < n1_; j++)
+          m = std::max(m, gs_[j] - costs[j]);
+        approximate_exp_row(-m, gs_.data(), costs, inv_eps, n1_, exp_series_, row);
+        for (std::size_t j = 0; j < n1_; j++)
+          s += row[j];
+        fs_[i] = (weights_[i] > 0 ? eps * std::log(weights_[i]) : 0) - m - eps * std::log(s);
+      }
+    });
+
+    // same for g, with col_shifts_ holding minus the largest f_i - C_ij of each column
+    col_shifts_.resize(n1_);
+    col_sums_.resize(n1_);
+    split(n1_, [this, eps, inv_eps](int k, std::size_t first, std::size_t last) {
+      Value * row(rows_.data() + k*n1_), * shifts(col_shifts_.data() + first), * sums(col_sums_.data() + first);
+      std::size_t n(last - first);
+      std::fill(shifts, shifts + n, -LOG_ZERO);
+      std::fill(sums, sums + n, 0);
+      for (std::size_t i = 0; i < n0_; i++) {
+        const Value * costs(costs_.data() + i*n1_ + first);
+        for (std::size_t j = 0; j < n; j++)
+          shifts[j] = std::min(shifts[j], costs[j] - fs_[i]);
+      }
+      for (std::size_t i = 0; i < n0_; i++) {
+        approximate_exp_row(fs_[i], shifts, costs_.data() + i*n1_ + first, inv_eps, n, exp_series_, row);
+        for (std::size_t j = 0; j < n; j++)
+          sums[j] += row[j];
+      }
+      for (std::size_t j = first; j < last; j++)
+        gs_[j] = (weights_[n0_ + j] > 0 ? eps * std::log(weights_[n0_ + j]) : 0)
+                 + col_shifts_[j] - eps * std::log(col_sums_[j]);
+    });
+  }
+
+  // moves the scalings into the potentials
+  void fold_scalings(Value eps) {
+    for (std::size_t i = 0; i < n0_; i++)
+      if (scalings_[i] > 0) fs_[i] += eps * std::log(scalings_[i]);
+    for (std::size_t j = 0; j < n1_; j++)
+      if (scalings_[n0_ + j] > 0) gs_[j] += eps * std::log(scalings_[n0_ + j]);
+  }
+
+  // builds the kernel from the potentials, with unit scalings (zero for empty sources and sinks)
+  void reset_kernel(Value eps) {
+    scalings_.resize(n0_ + n1_);
+    for (std::size_t k = 0; k < n0_ + n1_; k++)
+      scalings_[k] = weights_[k] > 0 ? 1 : 0;
+
+    kernel_.resize(n0_*n1_);
+    split(n0_, [this, eps](int, std::size_t first, std::size_t last) {
+      for (std::size_t i = first; i < last; i++)
+        approximate_exp_row(fs_[i], gs_.data(), costs_.data() + i*n1_, 1/eps, n1_, exp_series_,
+                            kernel_.data() + i*n1_);
+    });
+  }
+
+  // u_i = a_i / (K v)_i, returning the violation of the source marginals beforehand
+  Value update_us() {
+    split(n0_, [this](int k, std::size_t first, std::size_t last) {
+      const Value * vs(scalings_.data() + n0_);
+      Value err(0);
+      for (std::size_t i = first; i < last; i++) {
+        const Value * kernel(kernel_.data() + i*n1_);
+        Value kv(0);
+        for (std::size_t j = 0; j < n1_; j++)
+          kv += kernel[j] * vs[j];
+        if (weights_[i] > 0) {
+          err += std::fabs(scalings_[i] * kv - weights_[i]);
+          scalings_[i] = weights_[i] / kv;
+        }
+      }
+      thread_sums_[k] = err;
+    });
+    return sum_threads();
+  }
+
+  // v_j = b_j / (K^T u)_j, accumulating row by row
+  void update_vs() {
+    col_sums_.resize(n1_);
+    split(n1_, [this](int, std::size_t first, std::size_t last) {
+      Value * sums(col_sums_.data() + first);
+      std::size_t n(last - first);
+      std::fill(sums, sums + n, 0);
+      for (std::size_t i = 0; i < n0_; i++) {
+        const Value * kernel(kernel_.data() + i*n1_ + first);
+        Value u(scalings_[i]);
+        for (std::size_t j = 0; j < n; j++)
+          sums[j] += kernel[j] * u;
+      }
+      for (std::size_t j = first; j < last; j++)
+        if (weights_[n0_ + j] > 0)
+          scalings_[n0_ + j] = weights_[n0_ + j] / col_sums_[j];
+    });
+  }
+
+  // parameters
+  std::size_t n_iter_max_, n_iter_;
+  Value epsilon_large_, regularization_, tolerance_, epsilon_scaling_;
+  bool warm_start_, have_potentials_;
+  int num_threads_, threads_;
+  std::size_t min_parallel_arcs_;
+  SolverStats stats_;
+
+  // problem data and results
+  std::size_t n0_, n1_;
+  Value total_cost_, lower_bound_;
+  ValueVector weights_, costs_, flows_, pis_;
+
+  // potentials, scalings of the sources followed by the sinks, and the kernel
+  ValueVector fs_, gs_, scalings_, kernel_, col_shifts_, col_sums_;
+
+  // a row of exps for each thread, the sums found by each thread, and the series of the exp
+  ValueVector rows_, thread_sums_;
+  Value exp_series_[PowerApproximation<Value>::exp_terms + 1];
+
+}; // Sinkhorn
+
+// definitions of the static constants, needed when they are bound to references
+template<typename V> constexpr double Sinkhorn<V>::DEFAULT_REGULARIZATION;
+template<typename V> constexpr double Sinkhorn<V>::DEFAULT_TOLERANCE;
+template<typename V> constexpr double Sinkhorn<V>::DEFAULT_EPSILON_SCALING;
+template<typename V> constexpr V Sinkhorn<V>::INVALID_COST;
+template<typename V> constexpr V Sinkhorn<V>::LOG_ZERO;
+template<typename V> constexpr V Sinkhorn<V>::ABSORB_LIMIT;
+
+END_WASSERSTEIN_NAMESPACE
+
+#endif // WASSERSTEIN_SINKHORN_HH
@@ -0,0 +1,835 @@
+//------------------------------------------------------------------------
+// This file is part of Wasserstein, a C++ library with a Python wrapper
+// that computes the Wasserstein/EMD distance. If you use it for academic
+// research, please cite or acknowledge the following works:
+//
+//   - Komiske, Metodiev, Thaler (2019) arXiv:1902.02346
+//       https://doi.org/10.1103/PhysRevLett.123.041801
+//   - Komiske, Metodiev, Thaler (2020) arXiv:2004.04159
+//       https://doi.org/10.1007/JHEP07%282020%29006
+//   - Boneel, van de Panne, Paris, Heidrich (2011)
+//       https://doi.org/10.1145/2070781.2024192
+//   - LEMON graph library https://lemon.cs.elte.hu/trac/lemon
+//
+// Copyright (C) 2019-2022 Patrick T. Komiske III
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------
+
+// SparseNetworkSimplex pivots with the spanning tree updates of NetworkSimplexTree.hh and
+// prices with LEMON's block search, both adapted from network_simplex.h from LEMON.
+/*
+**** Original file Copyright Notice :
+*
+* Copyright (C) 2003-2010
+* Egervary Jeno Kombinatorikus Optimalizalasi Kutatocsoport
+* (Egervary Research Group on Combinatorial Optimization, EGRES).
+*
+* Permission to use, modify and distribute this software is granted
+* provided that this copyright notice appears in all copies. For
+* precise terms see the accompanying LICENSE file.
+*
+* This software is provided "AS IS" with no warranty of any kind,
+* express or implied, and with no claim as to its suitability for any
+* purpose.
+*
+*/
+
+/*   _____  _____             _____    _____  ______
+ *  / ____||  __ \     /\    |  __ \  / ____||  ____|
+ * | (___  | |__) |   /  \   | |__) || (___  | |__
+ *  \___ \ |  ___/   / /\ \  |  _  /  \___ \ |  __|
+ *  ____) || |      / ____ \ | | \ \  ____) || |____
+ * |_____/ |_|     /_/    \_\|_|  \_\|_____/ |______|
+ *  _   _ ______ _________          ______  _____  _  __
+ * | \ | |  ____|__   __\ \        / / __ \|  __ \| |/ /
+ * |  \| | |__     | |   \ \  /\  / / |  | | |__) | ' /
+ * | . ` |  __|    | |    \ \/  \/ /| |  | |  _  /|  <
+ * | |\  | |____   | |     \  /\  / | |__| | | \ \| . \
+ * |_| \_|______|  |_|      \/  \/   \____/|_|  \_\_|\_\
+ *   _____ _____ __  __ _____  _      ________   __
+ *  / ____|_   _|  \/  |  __ \| |    |  ____\ \ / /
+ * | (___   | | | \  / | |__) | |    | |__   \ V /
+ *  \___ \  | | | |\/| |  ___/| |    |  __|   > <
+ *  ____) |_| |_| |  | | |    | |____| |____ / . \
+ * |_____/|_____|_|  |_|_|    |______|______/_/ \_\
+ */
+
+#ifndef WASSERSTEIN_SPARSENETWORKSIMPLEX_HH
+#define WASSERSTEIN_SPARSENETWORKSIMPLEX_HH
+
+// C++ standard library
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "EMDUtils.hh"
+#include "NetworkSimplexTree.hh"
+
+BEGIN_WASSERSTEIN_NAMESPACE
+
+////////////////////////////////////////////////////////////////////////////////
+// SparseNetworkSimplex - network simplex on a growing set of candidate arcs
+////////////////////////////////////////////////////////////////////////////////
+
+// NetworkSimplex stores a cost, a flow and a state for every one of the n0*n1
+// arcs, which limits it to events of a few thousand particles. This solver
+// instead starts from the arcs joining each particle to its n_neighbors nearest
+// particles in the other event, and solves the problem restricted to them from
+// the usual artificial spanning tree. The potentials of that solution are then
+// used to price every arc of the complete graph, recomputing the costs on the
+// fly, and up to n_neighbors of the most negative arcs of each source are added.
+// Pivoting resumes from the current tree, and once no arc of the complete graph
+// may enter the solution is optimal for the full problem, with the same
+// tolerances as NetworkSimplex. Memory is proportional to the number of arcs
+// that were ever added, and each pricing round computes as many ground
+// distances as filling the dense problem does. Limiting the number of rounds
+// gives an approximate solution instead, whose excess over the optimal cost is
+// bounded using a dual feasible solution built from the last potentials.
+// Only the arcs that were added store their costs, so the ground distances take
+// memory linear in the multiplicity, and with set_num_threads the passes over the
+// complete graph are split among threads by sources (finding the nearest
+// particles then computes the costs twice, once by sources and once by sinks),
+// each thread needing scratch space for one row of the costs. The arcs added and
+// so the solution do not depend on the number of threads.
+
+template<typename Value>
+class SparseNetworkSimplex : private NetworkSimplexTree<SparseNetworkSimplex<Value>, Value, index_type,
+                                                        index_type, char> {
+public:
+
+  // EMD-style typedefs
+  typedef Value value_type;
+
+  typedef index_type Node;
+  typedef index_type Arc;
+
+  static_assert(std::is_floating_point<Value>::value, "Value should be a floating point type.");
+
+  SparseNetworkSimplex(std::size_t n_iter_max = 100000,
+                       Value epsilon_large_factor = 1000,
+                       Value epsilon_small_factor = 1,
+                       index_type n_neighbors = 16,
+                       std::size_t max_rounds = 0) :
+    max_rounds_(max_rounds),
+    num_threads_(1),
+    min_parallel_arcs_(DEFAULT_MIN_PARALLEL_ARCS),
+    n0_(0), n1_(0), node_num_(0),
+    n_iter_(0), n_rounds_(0),
+    total_cost_(INVALID_COST), error_bound_(0),
+    have_flows_(false)
+  {
+    set_params(n_iter_max, epsilon_large_factor, epsilon_small_factor);
+    set_n_neighbors(n_neighbors);
+  }
+
+  // same meaning as for NetworkSimplex, n_iter_max limits the pivots of all rounds together
+  void set_params(std::size_t n_iter_max, Value epsilon_large_factor, Value epsilon_small_factor) {
+    n_iter_max_ = n_iter_max;
+    epsilon_large_ = epsilon_large_factor * std::numeric_limits<Value>::epsilon();
+    epsilon_small_ = epsilon_small_factor * std::numeric_limits<Value>::epsilon();
+  }
+
+  // number of nearest particles each particle starts with arcs to, which is
+  // also the most arcs added to a source in each pricing round
+  index_type n_neighbors() const { return n_neighbors_; }
+  void set_n_neighbors(index_type n_neighbors) {
+    if (n_neighbors < 1) throw std::invalid_argument("n_neighbors must be positive");
+    n_neighbors_ = n_neighbors;
+  }
+
+  // get description of this solver
+  std::string description() const {
+    std::ostringstream oss;
+    oss << "  SparseNetworkSimplex\n"
+        << "    n_iter_max - "    << n_iter_max_    << '\n'
+        << "    epsilon_large - " << epsilon_large_ << '\n'
+        << "    epsilon_small - " << epsilon_small_ << '\n'
+        << "    n_neighbors - "   << n_neighbors_   << '\n'
+        << "    max_rounds - "    << max_rounds_    << '\n';
+    if (num_threads_ != 1)
+      oss << "    num_threads - " << num_threads_ << " from " << min_parallel_arcs_ << " arcs\n";
+    return oss.str();
+  }
+
+  // threads for the passes over the complete graph once it has min_parallel_arcs arcs, all
+  // of them if num_threads is -1 (see NetworkSimplex::set_num_threads), the cost functions
+  // given to compute are then called concurrently
+  int num_threads() const { return num_threads_; }
+  std::size_t min_parallel_arcs() const { return min_parallel_arcs_; }
+  void set_num_threads(int num_threads, std::size_t min_parallel_arcs = DEFAULT_MIN_PARALLEL_ARCS) {
+    num_threads_ = num_threads;
+    min_parallel_arcs_ = min_parallel_arcs;
+  }
+
+  // weights are those of the sources followed by the sinks, as in NetworkSimplex::weights(),
+  // and cost(i, j) returns the ground distance between source i and sink j
+  template<class Cost>
+  EMDStatus compute(const std::vector<Value> & weights, index_type n0, index_type n1, const Cost & cost) {
+
+    EMDStatus status(reset(weights, n0, n1));
+    if (status != EMDStatus::Success) return status;
+
+    // restricted problem on the nearest neighbors
+    return solve(cost, find_candidates(cost));
+  }
+
+  // starts from the given arcs instead, as indices i*n1 + j into the complete graph
+  // (the artificial cost is set by the largest of their costs, so the problem restricted
+  // to them should be feasible and the other arcs not much more costly)
+  template<class Cost>
+  EMDStatus compute(const std::vector<Value> & weights, index_type n0, index_type n1, const Cost & cost,
+                    const std::vector<Arc> & arcs) {
+
+    EMDStatus status(reset(weights, n0, n1));
+    if (status != EMDStatus::Success) return status;
+
+    candidates_.clear();
+    for (Arc a : arcs)
+      candidates_.emplace_back(a, cost(a / n1_, a % n1_));
+    return solve(cost, set_candidate_arcs());
+  }
+
+  // most rounds of pricing the complete graph, 0 for no limit; a solve that runs out of
+  // rounds has a feasible but possibly suboptimal flow, returns EMDStatus::Approximate, and
+  // error_bound() says by how much
+  std::size_t max_rounds() const { return max_rounds_; }
+  void set_max_rounds(std::size_t max_rounds) { max_rounds_ = max_rounds; }
+
+  // access results
+  Value total_cost() const { return total_cost_; }
+
+  // upper bound on total_cost() minus the optimal cost, from a dual feasible solution
+  // found in the last pricing round (0 if that round certified optimality)
+  Value error_bound() const { return error_bound_; }
+  Value epsilon_large() const { return epsilon_large_; }
+  std::size_t n_iter() const { return n_iter_; }
+  std::size_t n_rounds() const { return n_rounds_; }
+  const std::vector<Value> & potentials() const { return pis_; }
+
+  // number of arcs of the complete graph that were considered
+  Arc n_arcs() const { return arcNum() - node_num_; }
+
+  // dense n0 x n1 flows, in the same layout as NetworkSimplex::flows()
+  const std::vector<Value> & flows() const {
+    if (!have_flows_) {
+      dense_flows_.assign(std::size_t(n0_)*n1_, 0);
+      for (Arc e = node_num_; e < arcNum(); e++)
+        if (flows_[e] != 0)
+          dense_flows_[std::size_t(sources_[e])*n1_ + targets_[e] - n0_] += flows_[e];
+      have_flows_ = true;
+    }
+    return dense_flows_;
+  }
+
+  // appends the nonzero flows with their arcs i*n1 + j into the complete graph
+  void sparse_flows(std::vector<std::pair<std::size_t, Value>> & arc_flows) const {
+    for (Arc e = node_num_; e < arcNum(); e++)
+      if (flows_[e] != 0)
+        arc_flows.emplace_back(std::size_t(sources_[e])*n1_ + targets_[e] - n0_, flows_[e]);
+  }
+
+  // appends the arcs carrying flow, as indices i*n1 + j into the complete graph
+  void flow_support(std::vector<Arc> & arcs) const {
+    for (Arc e = node_num_; e < arcNum(); e++)
+      if (flows_[e] > 0)
+        arcs.push_back(Arc(sources_[e])*n1_ + targets_[e] - n0_);
+  }
+
+  // free all memory
+  void free() {
+    free_vector(costs_);
+    free_vector(flows_);
+    free_vector(supplies_);
+    free_vector(pis_);
+    free_vector(sources_);
+    free_vector(targets_);
+    free_vector(states_);
+    free_vector(parents_);
+    free_vector(threads_);
+    free_vector(rev_threads_);
+    free_vector(succ_nums_);
+    free_vector(last_succs_);
+    free_vector(dirty_revs_);
+    free_vector(preds_);
+    free_vector(forwards_);
+    free_vector(candidates_);
+    free_vector(neighbors_);
+    free_vector(sink_pis_);
+    free_vector(row_bounds_);
+    free_vector(order_);
+    free_vector(row_arcs_);
+    free_vector(row_starts_);
+    free_vector(scratch_);
+    free_vector(dense_flows_);
+    have_flows_ = false;
+  }
+
+private:
+
+  static constexpr Value INVALID_COST = -1;
+  static constexpr Arc INVALID_ARC = -1;
+  static constexpr Value INF = std::numeric_limits<Value>::infinity();
+
+  // the spanning tree updates need access to the internals
+  typedef NetworkSimplexTree<SparseNetworkSimplex, Value, Arc, Node, char> Tree;
+  friend Tree;
+
+  // State constants for arcs
+  using Tree::STATE_UPPER;
+  using Tree::STATE_TREE;
+  using Tree::STATE_LOWER;
+
+  // parameters
+  std::size_t n_iter_max_;
+  Value epsilon_large_, epsilon_small_;
+  index_type n_neighbors_;
+  std::size_t max_rounds_;
+  int num_threads_;
+  std::size_t min_parallel_arcs_;
+
+  // nodes are the n0 sources, then the n1 sinks, then the root
+  // arc u < node_num_ is the artificial arc of node u, the others join sources_ to targets_
+  Node n0_, n1_, node_num_;
+  std::vector<Value> costs_, flows_, supplies_, pis_;
+  std::vector<Node> sources_, targets_;
+  std::vector<char> states_;
+
+  // spanning tree structure vectors
+  using Tree::parents_;
+  using Tree::threads_;
+  using Tree::rev_threads_;
+  using Tree::succ_nums_;
+  using Tree::last_succs_;
+  using Tree::dirty_revs_;
+  using Tree::preds_;
+  using Tree::forwards_;
+
+  // block search
+  Arc next_arc_, block_size_;
+
+  // scratch space of each thread for the sources it goes through, the arcs it finds
+  // are added once all threads are done
+  struct RowScratch {
+    std::vector<Value> row, sink_pis;
+    std::vector<Node> order;
+    std::vector<char> present;
+    std::vector<std::pair<Value, Node>> entering;
+    std::vector<std::pair<Arc, Value>> arcs;
+    Value max_cost;
+  };
+
+  // scratch space for finding arcs
+  std::vector<std::pair<Arc, Value>> candidates_;
+  std::vector<std::pair<Value, Node>> neighbors_;
+  std::vector<Value> sink_pis_, row_bounds_;
+  std::vector<Node> order_;
+  std::vector<Arc> row_starts_, row_arcs_;
+  std::vector<RowScratch> scratch_;
+
+  // results
+  std::size_t n_iter_, n_rounds_;
+  Value total_cost_, error_bound_, lower_bound_;
+  mutable std::vector<Value> dense_flows_;
+  mutable bool have_flows_;
+
+  // Temporary data used in the current pivot iteration
+  using Tree::in_arc_;
+  using Tree::join_;
+  using Tree::u_in_;
+  using Tree::v_in_;
+  using Tree::u_out_;
+  using Tree::v_out_;
+  using Tree::delta_;
+
+  Arc arcNum() const { return costs_.size(); }
+
+  // whether flow remains on any artificial arc
+  bool artificial_flow() const {
+    for (Arc e = 0; e < node_num_; e++)
+      if (std::fabs(flows_[e]) > epsilon_large_) return true;
+    return false;
+  }
+
+  // appends an arc with no flow
+  void add_arc(Node s, Node t, Value cost) {
+    sources_.push_back(s);
+    targets_.push_back(t);
+    costs_.push_back(cost);
+    flows_.push_back(0);
+    states_.push_back(STATE_LOWER);
+  }
+
+  // sets up the nodes of a new problem
+  EMDStatus reset(const std::vector<Value> & weights, index_type n0, index_type n1) {
+
+    n0_ = n0;
+    n1_ = n1;
+    node_num_ = n0 + n1;
+    n_iter_ = n_rounds_ = 0;
+    total_cost_ = INVALID_COST;
+    error_bound_ = 0;
+    have_flows_ = false;
+    if (node_num_ == 0) return EMDStatus::Empty;
+
+    // same supply check as the network simplex, the sinks have negative supplies
+    supplies_.resize(node_num_ + 1);
+    Value sum_supplies(0);
+    for (Node u = 0; u < node_num_; u++)
+      sum_supplies += (supplies_[u] = (u < n0_ ? weights[u] : -weights[u]));
+    if (std::fabs(sum_supplies) > epsilon_large_) return EMDStatus::SupplyMismatch;
+
+    return EMDStatus::Success;
+  }
+
+  // number of threads for a pass over the complete graph, with scratch space for each
+  int scratch_threads() {
+    int num_threads(problem_threads(num_threads_, std::size_t(n0_)*n1_, min_parallel_arcs_));
+    if (scratch_.size() < std::size_t(num_threads))
+      scratch_.resize(num_threads);
+    for (int k = 0; k < num_threads; k++) {
+      scratch_[k].row.resize(n1_);
+      scratch_[k].order.resize(n1_);
+    }
+    return num_threads;
+  }
+
+  // first of the nodes [0, n) given to thread k of num_threads
+  static Node first_node(Node n, int k, int num_threads) {
+    return Node(std::size_t(n) * k / num_threads);
+  }
+
+  // solves starting from the candidate arcs, whose largest cost is max_cost
+  template<class Cost>
+  EMDStatus solve(const Cost & cost, Value max_cost) {
+
+    init_tree((max_cost + 1) * node_num_);
+    if (!initialPivots()) return EMDStatus::Unbounded;
+
+    // alternate between pivoting and pricing the complete graph
+    // (rounds are only limited once the flow no longer uses the artificial arcs)
+    bool optimal;
+    while (true) {
+      EMDStatus status(start());
+      if (status != EMDStatus::Success) return status;
+      n_rounds_++;
+      bool add(max_rounds_ == 0 || n_rounds_ < max_rounds_ || artificial_flow());
+      optimal = !price_complete_graph(cost, add);
+      if (optimal || !add) break;
+    }
+
+    // check that no flow remains on the artificial arcs
+    if (artificial_flow()) return EMDStatus::Infeasible;
+    for (Arc e = 0; e < node_num_; e++)
+      flows_[e] = 0;
+
+    total_cost_ = 0;
+    for (Arc e = node_num_; e < arcNum(); e++)
+      total_cost_ += flows_[e] * costs_[e];
+    error_bound_ = optimal ? 0 : std::max(total_cost_ - lower_bound_, Value(0));
+
+    return optimal ? EMDStatus::Success : EMDStatus::Approximate;
+  }
+
+  //---------------------------------------------------------------------------
+  // Candidate arcs
+  //---------------------------------------------------------------------------
+
+  // adds the arcs from each source to its nearest sinks and to each sink from its
+  // nearest sources, returning the largest cost of the complete graph
+  template<class Cost>
+  Value find_candidates(const Cost & cost) {
+
+    Node k0(std::min(n_neighbors_, n1_)), k1(std::min(n_neighbors_, n0_));
+    int num_threads(scratch_threads());
+    candidates_.clear();
+
+    // the nearest sources of each sink are kept in a max heap of size k1
+    neighbors_.resize(std::size_t(n1_)*k1);
+
+    Value max_cost(0);
+    if (num_threads == 1) {
+      RowScratch & scratch(scratch_[0]);
+      for (Node i = 0; i < n0_; i++) {
+        for (Node j = 0; j < n1_; j++) {
+          Value c(cost(i, j));
+          scratch.row[j] = c;
+          if (c > max_cost) max_cost = c;
+          push_neighbor(j, k1, i, c);
+        }
+        nearest_sinks(i, k0, scratch, candidates_);
+      }
+    }
+
+    // each thread goes through its sources and then through its sinks
+    else {
+      #pragma omp parallel for num_threads(num_threads) schedule(static, 1)
+      for (int k = 0; k < num_threads; k++) {
+        RowScratch & scratch(scratch_[k]);
+        scratch.arcs.clear();
+        scratch.max_cost = 0;
+        for (Node i = first_node(n0_, k, num_threads), end = first_node(n0_, k + 1, num_threads); i < end; i++) {
+          for (Node j = 0; j < n1_; j++) {
+            Value c(cost(i, j));
+            scratch.row[j] = c;
+            if (c > scratch.max_cost) scratch.max_cost = c;
+          }
+          nearest_sinks(i, k0, scratch, scratch.arcs);
+        }
+        for (Node j = first_node(n1_, k, num_threads), end = first_node(n1_, k + 1, num_threads); j < end; j++)
+          for (Node i = 0; i < n0_; i++)
+            push_neighbor(j, k1, i, cost(i, j));
+      }
+      for (int k = 0; k < num_threads; k++) {
+        max_cost = std::max(max_cost, scratch_[k].max_cost);
+        candidates_.insert(candidates_.end(), scratch_[k].arcs.begin(), scratch_[k].arcs.end());
+      }
+    }
+
+    for (Node j = 0; j < n1_; j++)
+      for (Node m = 0; m < k1; m++) {
+        const std::pair<Value, Node> & neighbor(neighbors_[std::size_t(j)*k1 + m]);
+        candidates_.emplace_back(Arc(neighbor.second)*n1_ + j, neighbor.first);
+      }
+
+    set_candidate_arcs();
+    return max_cost;
+  }
+
+  // puts source i, at cost c, in the heap of the nearest sources of sink j if it is
+  // among the k1 nearest of the sources up to i
+  void push_neighbor(Node j, Node k1, Node i, Value c) {
+    auto heap(neighbors_.begin() + std::size_t(j)*k1);
+    if (i < k1) {
+      heap[i] = std::make_pair(c, i);
+      std::push_heap(heap, heap + i + 1);
+    }
+    else if (c < heap->first) {
+      std::pop_heap(heap, heap + k1);
+      heap[k1 - 1] = std::make_pair(c, i);
+      std::push_heap(heap, heap + k1);
+    }
+  }
+
+  // appends the arcs from source i to its k0 nearest sinks, whose costs are in scratch.row
+  void nearest_sinks(Node i, Node k0, RowScratch & scratch, std::vector<std::pair<Arc, Value>> & arcs) const {
+    const std::vector<Value> & row(scratch.row);
+    std::iota(scratch.order.begin(), scratch.order.end(), 0);
+    std::nth_element(scratch.order.begin(), scratch.order.begin() + k0, scratch.order.end(),
+                     [&row](Node a, Node b) { return row[a] < row[b]; });
+    for (Node m = 0; m < k0; m++)
+      arcs.emplace_back(Arc(i)*n1_ + scratch.order[m], row[scratch.order[m]]);
+  }
+
+  // replaces the arcs of the complete graph by candidates_, returning their largest cost
+  Value set_candidate_arcs() {
+
+    // arcs are ordered by source and target without duplicates
+    std::sort(candidates_.begin(), candidates_.end(),
+              [](const std::pair<Arc, Value> & a, const std::pair<Arc, Value> & b) { return a.first < b.first; });
+    candidates_.erase(std::unique(candidates_.begin(), candidates_.end(),
+                                  [](const std::pair<Arc, Value> & a, const std::pair<Arc, Value> & b) {
+                                    return a.first == b.first;
+                                  }), candidates_.end());
+
+    // the artificial arcs come first
+    std::size_t num_arcs(node_num_ + candidates_.size());
+    costs_.resize(node_num_);
+    flows_.resize(node_num_);
+    sources_.resize(node_num_);
+    targets_.resize(node_num_);
+    states_.resize(node_num_);
+    for (std::vector<Value> * v : {&costs_, &flows_}) v->reserve(num_arcs);
+    for (std::vector<Node> * v : {&sources_, &targets_}) v->reserve(num_arcs);
+    states_.reserve(num_arcs);
+    Value max_cost(0);
+    for (const std::pair<Arc, Value> & candidate : candidates_) {
+      add_arc(candidate.first / n1_, candidate.first % n1_ + n0_, candidate.second);
+      if (candidate.second > max_cost) max_cost = candidate.second;
+    }
+
+    return max_cost;
+  }
+
+  // prices every arc of the complete graph that is not present yet, returning whether
+  // any may enter, and if add is true adds the most negative of each source
+  // (arcs already present were last priced by the block search, which decides
+  // whether they may enter by the same criterion as NetworkSimplex)
+  // - the source potentials raised to max(pi_s, max_t(pi_t - c_st)) are dual feasible, as are
+  //   the sink potentials lowered to min(pi_t, min_s(pi_s + c_st)), and the better of the
+  //   two lower bounds on the optimal cost is stored in lower_bound_
+  template<class Cost>
+  bool price_complete_graph(const Cost & cost, bool add) {
+
+    // arcs present, bucketed by source
+    Arc num_arcs(arcNum());
+    row_starts_.assign(n0_ + 1, 0);
+    for (Arc e = node_num_; e < num_arcs; e++)
+      row_starts_[sources_[e] + 1]++;
+    std::partial_sum(row_starts_.begin(), row_starts_.end(), row_starts_.begin());
+    row_arcs_.resize(n_arcs());
+    for (Arc e = node_num_; e < num_arcs; e++)
+      row_arcs_[row_starts_[sources_[e]]++] = e;
+    std::rotate(row_starts_.begin(), row_starts_.end() - 1, row_starts_.end());
+    row_starts_[0] = 0;
+    row_bounds_.resize(n0_);
+
+    // each thread prices the arcs of its sources against its own copy of the sink potentials
+    int num_threads(scratch_threads());
+    bool any_entering(false);
+    #pragma omp parallel for num_threads(num_threads) schedule(static, 1) reduction(||:any_entering)
+    for (int k = 0; k < num_threads; k++) {
+      RowScratch & scratch(scratch_[k]);
+      scratch.present.assign(n1_, false);
+      scratch.sink_pis.assign(pis_.begin() + n0_, pis_.begin() + node_num_);
+      scratch.arcs.clear();
+      for (Node i = first_node(n0_, k, num_threads), end = first_node(n0_, k + 1, num_threads); i < end; i++)
+        any_entering |= price_source(i, cost, add, scratch);
+    }
+
+    // the arcs are added in the order of their sources, as with a single thread
+    sink_pis_.swap(scratch_[0].sink_pis);
+    for (int k = 0; k < num_threads; k++) {
+      if (k > 0)
+        for (Node j = 0; j < n1_; j++)
+          sink_pis_[j] = std::min(sink_pis_[j], scratch_[k].sink_pis[j]);
+      for (const std::pair<Arc, Value> & arc : scratch_[k].arcs)
+        add_arc(arc.first / n1_, arc.first % n1_ + n0_, arc.second);
+    }
+
+    Value lower_bound(0), sink_lower_bound(0);
+    for (Node i = 0; i < n0_; i++) {
+      lower_bound -= row_bounds_[i];
+      sink_lower_bound -= supplies_[i] * pis_[i];
+    }
+    for (Node t = n0_; t < node_num_; t++) {
+      lower_bound -= supplies_[t] * pis_[t];
+      sink_lower_bound -= supplies_[t] * sink_pis_[t - n0_];
+    }
+    lower_bound_ = std::max(lower_bound, sink_lower_bound);
+
+    if (add) reset_block_search();
+    return any_entering;
+  }
+
+  // prices the arcs of source i that are not present, lowering the sink potentials of
+  // scratch, storing its term of the lower bound in row_bounds_, and if add is true
+  // appending its most negative arcs to those of scratch, returning whether any may enter
+  template<class Cost>
+  bool price_source(Node i, const Cost & cost, bool add, RowScratch & scratch) {
+
+    Value pi_s(pis_[i]);
+    for (Arc k = row_starts_[i]; k < row_starts_[i + 1]; k++) {
+      Arc e(row_arcs_[k]);
+      Node j(targets_[e] - n0_);
+      scratch.present[j] = true;
+      pi_s = std::max(pi_s, pis_[targets_[e]] - costs_[e]);
+      scratch.sink_pis[j] = std::min(scratch.sink_pis[j], pis_[i] + costs_[e]);
+    }
+
+    scratch.entering.clear();
+    for (Node j = 0; j < n1_; j++) {
+      if (scratch.present[j]) continue;
+      Value c(cost(i, j)), pi_t(pis_[n0_ + j]), reduced_cost(c + pis_[i] - pi_t);
+      pi_s = std::max(pi_s, pi_t - c);
+      scratch.sink_pis[j] = std::min(scratch.sink_pis[j], pis_[i] + c);
+      if (reduced_cost < 0 && isEnteringArc(pis_[i], pi_t, c, reduced_cost)) {
+        scratch.row[j] = c;
+        scratch.entering.emplace_back(reduced_cost, j);
+      }
+    }
+    row_bounds_[i] = supplies_[i] * pi_s;
+
+    if (add) {
+      std::vector<std::pair<Value, Node>> & entering(scratch.entering);
+      if (Node(entering.size()) > n_neighbors_)
+        std::nth_element(entering.begin(), entering.begin() + n_neighbors_, entering.end());
+      for (Node m = 0, end = std::min(n_neighbors_, Node(entering.size())); m < end; m++)
+        scratch.arcs.emplace_back(Arc(i)*n1_ + entering[m].second, scratch.row[entering[m].second]);
+    }
+
+    for (Arc k = row_starts_[i]; k < row_starts_[i + 1]; k++)
+      scratch.present[targets_[row_arcs_[k]] - n0_] = false;
+
+    return !scratch.entering.empty();
+  }
+
+  //---------------------------------------------------------------------------
+  // Network simplex
+  //---------------------------------------------------------------------------
+
+  // spanning tree of artificial arcs joining every node to the root
+  void init_tree(Value artcosts) {
+
+    Node all_node_num(node_num_ + 1);
+    pis_.resize(all_node_num);
+    parents_.resize(all_node_num);
+    threads_.resize(all_node_num);
+    rev_threads_.resize(all_node_num);
+    succ_nums_.resize(all_node_num);
+    last_succs_.resize(all_node_num);
+    preds_.resize(all_node_num);
+    forwards_.resize(all_node_num);
+
+    // set data for the artificial root node
+    Node root(node_num_);
+    parents_[root] = -1;
+    preds_[root] = -1;
+    threads_[root] = 0;
+    rev_threads_[0] = root;
+    succ_nums_[root] = node_num_ + 1;
+    last_succs_[root] = root - 1;
+    supplies_[root] = 0;
+    pis_[root] = 0;
+
+    // EQ supply constraints
+    for (Node u = 0; u < node_num_; u++) {
+      Arc e(u);
+      parents_[u] = root;
+      preds_[u] = e;
+      threads_[u] = u + 1;
+      rev_threads_[u + 1] = u;
+      succ_nums_[u] = 1;
+      last_succs_[u] = u;
+      states_[e] = STATE_TREE;
+      if (supplies_[u] >= 0) {
+        forwards_[u] = true;
+        pis_[u] = 0;
+        flows_[e] = supplies_[u];
+        costs_[e] = 0;
+      } else {
+        forwards_[u] = false;
+        pis_[u] = artcosts;
+        flows_[e] = -supplies_[u];
+        costs_[e] = artcosts;
+      }
+    }
+
+    reset_block_search();
+  }
+
+  // Heuristic initial pivots on the cheapest arc into each sink
+  bool initialPivots() {
+
+    // order_ is free to hold the cheapest arc of each sink here
+    order_.assign(n1_, INVALID_ARC);
+    for (Arc e = node_num_; e < arcNum(); e++) {
+      Node j(targets_[e] - n0_);
+      if (order_[j] == INVALID_ARC || costs_[e] < costs_[order_[j]])
+        order_[j] = e;
+    }
+
+    for (Arc a : order_) {
+      if (a == INVALID_ARC) continue;
+      in_arc_ = a;
+      if (states_[in_arc_] * (costs_[in_arc_] + pis_[sources_[in_arc_]] - pis_[targets_[in_arc_]]) >= 0) continue;
+      if (!pivot()) return false;
+    }
+    return true;
+  }
+
+  // main pivoting loop on the current arcs
+  EMDStatus start() {
+    while (findEnteringArc()) {
+      if (n_iter_++ >= n_iter_max_)
+        return EMDStatus::MaxIterReached;
+      if (!pivot()) return EMDStatus::Unbounded;
+    }
+    return EMDStatus::Success;
+  }
+
+  // moves flow around the cycle of in_arc_ and updates the tree, false if unbounded
+  bool pivot() {
+    findJoinNode();
+    bool change(findLeavingArc());
+    if (delta_ >= std::numeric_limits<Value>::max()) return false;
+    changeFlow(change);
+    if (change) {
+      updateTreeStructure();
+      updatePotential();
+    }
+    return true;
+  }
+
+  // checks that the reduced cost c of an arc is negative relative to the scale of the problem
+  bool isEnteringArc(Value pi_s, Value pi_t, Value cost, Value c) const {
+    Value a(std::max(std::max(std::fabs(pi_s), std::fabs(pi_t)), std::fabs(cost)));
+    return c < -epsilon_small_*a;
+  }
+
+  // LEMON's block search over the arcs of the complete graph that have been added
+  void reset_block_search() {
+    next_arc_ = node_num_;
+    block_size_ = std::max(Arc(std::sqrt(double(n_arcs()))), Arc(10));
+  }
+  bool findEnteringArc() {
+    Arc first(node_num_), num_arcs(arcNum());
+    if (num_arcs == first) return false;
+
+    Value min(0);
+    Arc e(next_arc_), cnt(block_size_), min_arc(INVALID_ARC);
+    for (Arc remaining = num_arcs - first; remaining > 0; remaining--) {
+      Value c(states_[e] * (costs_[e] + pis_[sources_[e]] - pis_[targets_[e]]));
+      if (c < min) {
+        min = c;
+        min_arc = e;
+      }
+      if (++e == num_arcs) e = first;
+
+      // check the block
+      if (--cnt == 0) {
+        if (min < 0 && isEnteringArc(pis_[sources_[min_arc]], pis_[targets_[min_arc]], costs_[min_arc], min))
+          break;
+        cnt = block_size_;
+      }
+    }
+    if (min < 0 && isEnteringArc(pis_[sources_[min_arc]], pis_[targets_[min_arc]], costs_[min_arc], min)) {
+      in_arc_ = min_arc;
+      next_arc_ = e;
+      return true;
+    }
+    return false;
+  }
+
+  //---------------------------------------------------------------------------
+  // Spanning tree updates (see NetworkSimplexTree)
+  //---------------------------------------------------------------------------
+
+  using Tree::findJoinNode;
+  using Tree::findLeavingArc;
+  using Tree::changeFlow;
+  using Tree::updateTreeStructure;
+  using Tree::updatePotential;
+
+  // endpoints and states of the arcs for the spanning tree updates
+  Node source(Arc e) const { return sources_[e]; }
+  Node target(Arc e) const { return targets_[e]; }
+  char arc_state(Arc e) const { return states_[e]; }
+  void set_arc_state(Arc e, char s) { states_[e] = s; }
+
+}; // SparseNetworkSimplex
+
+template<typename V> constexpr V SparseNetworkSimplex<V>::INVALID_COST;
+template<typename V> constexpr typename SparseNetworkSimplex<V>::Arc SparseNetworkSimplex<V>::INVALID_ARC;
+template<typename V> constexpr V SparseNetworkSimplex<V>::INF;
+
+END_WASSERSTEIN_NAMESPACE
+
+#endif // WASSERSTEIN_SPARSENETWORKSIMPLEX_HH
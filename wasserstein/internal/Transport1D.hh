@@ -0,0 +1,239 @@
+//------------------------------------------------------------------------
+// This file is part of Wasserstein, a C++ library with a Python wrapper
+// that computes the Wasserstein/EMD distance. If you use it for academic
+// research, please cite or acknowledge the following works:
+//
+//   - Komiske, Metodiev, Thaler (2019) arXiv:1902.02346
+//       https://doi.org/10.1103/PhysRevLett.123.041801
+//   - Komiske, Metodiev, Thaler (2020) arXiv:2004.04159
+//       https://doi.org/10.1007/JHEP07%282020%29006
+//   - Boneel, van de Panne, Paris, Heidrich (2011)
+//       https://doi.org/10.1145/2070781.2024192
+//   - LEMON graph library https://lemon.cs.elte.hu/trac/lemon
+//
+// Copyright (C) 2019-2022 Patrick T. Komiske III
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------
+
+/*  _______  _____             _   _   _____  _____    ____   _____   _______
+ * |__   __||  __ \     /\    | \ | | / ____||  __ \  / __ \ |  __ \ |__   __|
+ *    | |   | |__) |   /  \   |  \| || (___  | |__) || |  | || |__) |   | |
+ *    | |   |  _  /   / /\ \  | . ` | \___ \ |  ___/ | |  | ||  _  /    | |
+ *    | |   | | \ \  / ____ \ | |\  | ____) || |     | |__| || | \ \    | |
+ *    |_|   |_|  \_\/_/    \_\|_| \_||_____/ |_|      \____/ |_|  \_\   |_|
+ *  __  _____
+ * /_ ||  __ \
+ *  | || |  | |
+ *  | || |  | |
+ *  | || |__| |
+ *  |_||_____/
+ */
+
+#ifndef WASSERSTEIN_TRANSPORT1D_HH
+#define WASSERSTEIN_TRANSPORT1D_HH
+
+// C++ standard library
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "EMDUtils.hh"
+#include "PairwiseDistance.hh"
+
+BEGIN_WASSERSTEIN_NAMESPACE
+
+////////////////////////////////////////////////////////////////////////////////
+// Transport1D - exact transport between particles on a line, solved by sorting
+////////////////////////////////////////////////////////////////////////////////
+
+// When the ground distance is a convex function of |x0 - x1| (beta >= 1), the
+// monotone coupling that matches the sorted sources and sinks in order is
+// optimal. It is found by the north-west corner rule on the sorted particles,
+// whose n0 + n1 - 1 arcs form a spanning tree (ties leave an arc with zero
+// flow). The node potentials are computed along this tree with the same
+// conventions as NetworkSimplex, such that pi_sink - pi_source is the cost of
+// each tree arc. The dense flows and distances are only built if requested.
+
+template<class PairwiseDistance>
+class Transport1D {
+public:
+
+  typedef typename PairwiseDistance::value_type Value;
+
+  // arc of the spanning tree, indexed by the original particle order
+  struct Arc {
+    index_type source, sink;
+    Value flow, cost;
+  };
+
+  Transport1D() :
+    ground_distance_(1, 1),
+    n0_(0), n1_(0), total_cost_(0), have_flows_(false), have_dists_(false)
+  {}
+
+  // coordinates of the sources and sinks, to be filled before calling compute
+  std::vector<Value> & coords0() { return coords0_; }
+  std::vector<Value> & coords1() { return coords1_; }
+
+  // weights are those of the sources followed by the sinks, as in NetworkSimplex::weights()
+  EMDStatus compute(const PairwiseDistance & pairwise_distance,
+                    const std::vector<Value> & weights,
+                    Value epsilon) {
+
+    // only R and beta are needed, not the per-event state of the pairwise distance
+    if (ground_distance_.R() != pairwise_distance.R())
+      ground_distance_.set_R(pairwise_distance.R());
+    if (ground_distance_.beta() != pairwise_distance.beta())
+      ground_distance_.set_beta(pairwise_distance.beta());
+
+    n0_ = coords0_.size();
+    n1_ = coords1_.size();
+    have_flows_ = have_dists_ = false;
+    arcs_.clear();
+    pis_.assign(n0_ + n1_, 0);
+    total_cost_ = INVALID_COST;
+
+    // same checks as the network simplex
+    if (n0_ + n1_ == 0) return EMDStatus::Empty;
+    Value sum_supplies(0);
+    for (index_type i = 0; i < n0_; i++)
+      sum_supplies += weights[i];
+    for (index_type j = 0; j < n1_; j++)
+      sum_supplies -= weights[n0_ + j];
+    if (std::fabs(sum_supplies) > epsilon) return EMDStatus::SupplyMismatch;
+
+    total_cost_ = 0;
+    if (n0_ == 0 || n1_ == 0) return EMDStatus::Success;
+
+    sort_order(coords0_, order0_);
+    sort_order(coords1_, order1_);
+
+    // walk the staircase of the sorted particles, a and b are the sorted positions
+    index_type a(0), b(0), i(order0_[0]), j(order1_[0]);
+    Value r0(weights[i]), r1(weights[n0_ + j]), c(cost(i, j));
+    pis_[n0_ + j] = c;
+    arcs_.reserve(n0_ + n1_ - 1);
+    while (true) {
+      Value f(std::min(r0, r1));
+      arcs_.push_back({i, j, f, c});
+      total_cost_ += f * c;
+      if (a + 1 == n0_ && b + 1 == n1_) break;
+
+      // move to the next source if this one is used up, unless the sinks are exhausted first
+      if (b + 1 == n1_ || (a + 1 < n0_ && r0 <= r1)) {
+        r1 -= f;
+        i = order0_[++a];
+        r0 = weights[i];
+        c = cost(i, j);
+        pis_[i] = pis_[n0_ + j] - c;
+      }
+      else {
+        r0 -= f;
+        j = order1_[++b];
+        r1 = weights[n0_ + j];
+        c = cost(i, j);
+        pis_[n0_ + j] = pis_[i] + c;
+      }
+    }
+
+    return EMDStatus::Success;
+  }
+
+  // access results
+  Value total_cost() const { return total_cost_; }
+  const std::vector<Arc> & arcs() const { return arcs_; }
+  const std::vector<Value> & potentials() const { return pis_; }
+
+  // dense n0 x n1 flows, in the same layout as NetworkSimplex::flows()
+  const std::vector<Value> & flows() const {
+    if (!have_flows_) {
+      flows_.assign(n0_ * n1_, 0);
+      for (const Arc & arc : arcs_)
+        flows_[arc.source * n1_ + arc.sink] = arc.flow;
+      have_flows_ = true;
+    }
+    return flows_;
+  }
+
+  // appends the nonzero flows with their arcs i*n1 + j
+  void sparse_flows(std::vector<std::pair<std::size_t, Value>> & arc_flows) const {
+    for (const Arc & arc : arcs_)
+      if (arc.flow != 0)
+        arc_flows.emplace_back(std::size_t(arc.source) * n1_ + arc.sink, arc.flow);
+  }
+
+  // dense n0 x n1 ground distances, in the same layout as NetworkSimplex::dists()
+  const std::vector<Value> & dists() const {
+    if (!have_dists_) {
+      dists_.resize(n0_ * n1_);
+      std::size_t k(0);
+      for (index_type i = 0; i < n0_; i++)
+        for (index_type j = 0; j < n1_; j++)
+          dists_[k++] = cost(i, j);
+      have_dists_ = true;
+    }
+    return dists_;
+  }
+
+  // free all memory
+  void free() {
+    free_vector(coords0_);
+    free_vector(coords1_);
+    free_vector(order0_);
+    free_vector(order1_);
+    free_vector(arcs_);
+    free_vector(pis_);
+    free_vector(flows_);
+    free_vector(dists_);
+    have_flows_ = have_dists_ = false;
+  }
+
+private:
+
+  static constexpr Value INVALID_COST = -1;
+
+  // ground distance between source i and sink j, identical to what PairwiseDistance would fill
+  Value cost(index_type i, index_type j) const {
+    Value dx(coords0_[i] - coords1_[j]);
+    return ground_distance_.distance_from_plain(dx*dx);
+  }
+
+  // indices that sort the coordinates
+  static void sort_order(const std::vector<Value> & xs, std::vector<index_type> & order) {
+    order.resize(xs.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(),
+                     [&xs](index_type i, index_type j) { return xs[i] < xs[j]; });
+  }
+
+  DefaultPairwiseDistance<Value> ground_distance_;
+  std::vector<Value> coords0_, coords1_;
+  std::vector<index_type> order0_, order1_;
+  std::vector<Arc> arcs_;
+  std::vector<Value> pis_;
+  index_type n0_, n1_;
+  Value total_cost_;
+
+  // dense results, built on demand
+  mutable std::vector<Value> flows_, dists_;
+  mutable bool have_flows_, have_dists_;
+
+}; // Transport1D
+
+END_WASSERSTEIN_NAMESPACE
+
+#endif // WASSERSTEIN_TRANSPORT1D_HH
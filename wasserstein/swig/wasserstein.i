@@ -78,14 +78,60 @@ using namespace wasserstein;
       throw std::invalid_argument("Weights and distance matrix are incompatible");
 
     // copy distances into vector for network simplex
+    $self->set_external_dists(true);
     std::size_t ndists(std::size_t(d0) * std::size_t(d1));
     $self->ground_dists().resize(ndists);
     std::copy(external_dists, external_dists + ndists, $self->ground_dists().begin());
 
-    $self->set_external_dists(true);
-
     return (*$self)(std::make_tuple(weights0, nullptr, n0, -1), std::make_tuple(weights1, nullptr, n1, -1));
   }
+
+  // cheap bounds on the EMD that never run a solver, from the same numpy arrays
+  F lower_bound(F* weights0, std::ptrdiff_t n0,
+                F* coords0,  std::ptrdiff_t n00, std::ptrdiff_t n01,
+                F* weights1, std::ptrdiff_t n1,
+                F* coords1,  std::ptrdiff_t n10, std::ptrdiff_t n11) {
+
+    if (n0 != n00 || n1 != n10)
+      throw std::invalid_argument("Number of weights does not match number of coordinates");
+    if (n01 != n11)
+      throw std::invalid_argument("Coordinate dimensions do not match");
+
+    $self->set_external_dists(false);
+
+    return $self->lower_bound(std::make_tuple(weights0, coords0, n0, n01), std::make_tuple(weights1, coords1, n1, n11));
+  }
+  F upper_bound(F* weights0, std::ptrdiff_t n0,
+                F* coords0,  std::ptrdiff_t n00, std::ptrdiff_t n01,
+                F* weights1, std::ptrdiff_t n1,
+                F* coords1,  std::ptrdiff_t n10, std::ptrdiff_t n11) {
+
+    if (n0 != n00 || n1 != n10)
+      throw std::invalid_argument("Number of weights does not match number of coordinates");
+    if (n01 != n11)
+      throw std::invalid_argument("Coordinate dimensions do not match");
+
+    $self->set_external_dists(false);
+
+    return $self->upper_bound(std::make_tuple(weights0, coords0, n0, n01), std::make_tuple(weights1, coords1, n1, n11));
+  }
+
+  // decides whether the EMD is below threshold, stopping as soon as that is settled
+  bool within(F* weights0, std::ptrdiff_t n0,
+              F* coords0,  std::ptrdiff_t n00, std::ptrdiff_t n01,
+              F* weights1, std::ptrdiff_t n1,
+              F* coords1,  std::ptrdiff_t n10, std::ptrdiff_t n11,
+              F threshold) {
+
+    if (n0 != n00 || n1 != n10)
+      throw std::invalid_argument("Number of weights does not match number of coordinates");
+    if (n01 != n11)
+      throw std::invalid_argument("Coordinate dimensions do not match");
+
+    $self->set_external_dists(false);
+
+    return $self->within(std::make_tuple(weights0, coords0, n0, n01), std::make_tuple(weights1, coords1, n1, n11), threshold);
+  }
 %enddef
 
 %pythoncode %{
@@ -116,7 +162,7 @@ def _store_events(pairwise_emd, events, event_weights, gdim, mask, dtype):
         # sometimes, e.g. in the case of a single particle, they may not
         # weights are never modified due to internal copying
         # coords may be modified (e.g. by centering), so we always make a copy of them
-        weights = np.array(event[:,0], dtype=dtype, order='C', copy=False)
+        weights = np.asarray(event[:,0], dtype=dtype, order='C')
         coords = np.array(event[:,1:], dtype=dtype, order='C', copy=True)
         
         # ensure that the lifetime of these arrays lasts through the computation
@@ -135,6 +181,24 @@ def _store_events(pairwise_emd, events, event_weights, gdim, mask, dtype):
     $self->events().emplace_back(weights, coords, n1, d, event_weight);
     $self->preprocess_back_event();
   }
+
+  // sweep mode over the pairs (Rs[p], betas[p]), disabled by empty arrays
+  void npy_set_sweep(F* Rs, std::ptrdiff_t nR, F* betas, std::ptrdiff_t nbeta) {
+    if (nR != nbeta)
+      throw std::invalid_argument("Rs and betas must have the same length");
+
+    std::vector<std::pair<F, F>> params;
+    for (std::ptrdiff_t p = 0; p < nR; p++)
+      params.emplace_back(Rs[p], betas[p]);
+    $self->set_sweep(params);
+  }
+
+  // the EMDs at point p of the sweep as an array of shape (nevA, nevB)
+  void npy_sweep_emds(std::size_t p, F** arr_out, std::ptrdiff_t* n0, std::ptrdiff_t* n1) {
+    std::vector<F> emds($self->sweep_emds(p));
+    MALLOC_2D_VALUE_ARRAY($self->nevA(), $self->nevB(), F)
+    memcpy(*arr_out, emds.data(), nbytes);
+  }
 %enddef
 
 namespace WASSERSTEIN_NAMESPACE {
@@ -86,7 +86,9 @@ using WASSERSTEIN_NAMESPACE::DefaultNetworkSimplex;
                                               (F* emds, std::ptrdiff_t n0),
                                               (F* event_weights, std::ptrdiff_t n1),
                                               (F* event_weightsA, std::ptrdiff_t nwA),
-                                              (F* event_weightsB, std::ptrdiff_t nwB)}
+                                              (F* event_weightsB, std::ptrdiff_t nwB),
+                                              (F* Rs, std::ptrdiff_t nR),
+                                              (F* betas, std::ptrdiff_t nbeta)}
   %apply (F* IN_ARRAY2, std::ptrdiff_t DIM1, std::ptrdiff_t DIM2) {(F* coords0, std::ptrdiff_t n00, std::ptrdiff_t n01),
                                                                    (F* coords1, std::ptrdiff_t n10, std::ptrdiff_t n11),
                                                                    (F* external_dists, std::ptrdiff_t d0, std::ptrdiff_t d1),
@@ -96,7 +98,8 @@ using WASSERSTEIN_NAMESPACE::DefaultNetworkSimplex;
   %apply (F* INPLACE_ARRAY1, std::ptrdiff_t DIM1) {(F* weights, std::ptrdiff_t n)}
   %apply (F* INPLACE_ARRAY2, std::ptrdiff_t DIM1, std::ptrdiff_t DIM2) {(F* coords, std::ptrdiff_t n1, std::ptrdiff_t d)}
 
-  %apply (F** ARGOUTVIEWM_ARRAY1, std::ptrdiff_t* DIM1) {(F** arr_out0, std::ptrdiff_t* n0), (F** arr_out1, std::ptrdiff_t* n1)}
+  %apply (F** ARGOUTVIEWM_ARRAY1, std::ptrdiff_t* DIM1) {(F** arr_out0, std::ptrdiff_t* n0), (F** arr_out1, std::ptrdiff_t* n1),
+                                                         (F** arr_out2, std::ptrdiff_t* n2)}
   %apply (F** ARGOUTVIEWM_ARRAY2, std::ptrdiff_t* DIM1, std::ptrdiff_t* DIM2) {(F** arr_out, std::ptrdiff_t* n0, std::ptrdiff_t* n1)}
 %enddef
 
@@ -108,6 +111,10 @@ WASSERSTEIN_NUMPY_TYPEMAPS(double)
   WASSERSTEIN_NUMPY_TYPEMAPS(float)
 #endif
 
+// event or particle indices, such as the close pairs of PairwiseEMD or the sparse flows of EMD
+%numpy_typemaps(std::ptrdiff_t, NPY_INTP, std::ptrdiff_t)
+%apply (std::ptrdiff_t** ARGOUTVIEWM_ARRAY2, std::ptrdiff_t* DIM1, std::ptrdiff_t* DIM2) {(std::ptrdiff_t** inds_out, std::ptrdiff_t* n0, std::ptrdiff_t* n1)}
+
 // prepare to extend classes by renaming some methods
 namespace WASSERSTEIN_NAMESPACE {
   %rename(flows_vec) EMDBase::flows;
@@ -116,8 +123,12 @@ namespace WASSERSTEIN_NAMESPACE {
   %rename(flows) EMDBase::npy_flows;
   %rename(dists) EMDBase::npy_dists;
   %rename(node_potentials) EMD::npy_node_potentials;
+  %rename(sparse_flows) EMDBase::npy_sparse_flows;
   %rename(emds_vec) PairwiseEMDBase::emds;
   %rename(emds) PairwiseEMDBase::npy_emds;
+  %rename(close_pairs) PairwiseEMD::npy_close_pairs;
+  %rename(set_sweep) PairwiseEMD::npy_set_sweep;
+  %rename(sweep_emds) PairwiseEMD::npy_sweep_emds;
   %rename(evaluate1d) ExternalEMDHandler::npy_evaluate1d;
   %rename(evaluate2d) ExternalEMDHandler::npy_evaluate2d;
   %rename(evaluate1d_symmetric) ExternalEMDHandler::npy_evaluate1d_symmetric;
@@ -195,6 +206,25 @@ namespace WASSERSTEIN_NAMESPACE {
     for (size_t i = 0; i < num_elements; i++)
       values[i] *= $self->scale();
   }
+
+  // the nonzero flows as an array of (i, j) indices of shape (num_flows, 2) and their values
+  void npy_sparse_flows(std::ptrdiff_t** inds_out, std::ptrdiff_t* n0, std::ptrdiff_t* n1,
+                        F** arr_out2, std::ptrdiff_t* n2) {
+    auto coo($self->sparse_flows());
+    *n0 = coo.second.size();
+    *n1 = 2;
+    size_t nbytes = size_t(*n0)*2*sizeof(std::ptrdiff_t);
+    std::ptrdiff_t * inds = (std::ptrdiff_t *) malloc(nbytes);
+    if (inds == NULL)
+      throw std::runtime_error("Failed to allocate " + std::to_string(nbytes) + " bytes");
+    for (size_t k = 0; k < coo.first.size(); k++) {
+      inds[2*k] = coo.first[k].first;
+      inds[2*k + 1] = coo.first[k].second;
+    }
+    *inds_out = inds;
+    MALLOC_1D_VALUE_ARRAY(arr_out2, n2, coo.second.size(), nbytes2, F)
+    memcpy(*arr_out2, coo.second.data(), nbytes2);
+  }
   void npy_dists(F** arr_out, std::ptrdiff_t* n0, std::ptrdiff_t* n1) {
     MALLOC_2D_VALUE_ARRAY($self->n0(), $self->n1(), F)
     memcpy(*arr_out, $self->ground_dists().data(), nbytes);
@@ -297,13 +327,30 @@ namespace WASSERSTEIN_NAMESPACE {
   // ignore certain functions
   %ignore EMDBase::ground_dists;
   %ignore EMDBase::raw_flows;
+  %ignore EMDBase::sparse_flows;
   %ignore EMD::compute;
+  %ignore EMD::compute_lower_bound;
+  %ignore EMD::compute_upper_bound;
+  %ignore EMD::compute_within;
+  %ignore EMD::compute_sweep;
+  %ignore EMD::auction;
+  %ignore EMD::sparse_network_simplex;
+  %ignore EMD::multiscale;
   %ignore EMD::network_simplex;
   %ignore EMD::pairwise_distance;
   %ignore PairwiseEMD::compute(const std::vector<Event> & events);
   %ignore PairwiseEMD::compute(const std::vector<Event> & eventsA, const std::vector<Event> & eventsB);
   %ignore PairwiseEMD::events;
+  %ignore PairwiseEMD::close_pairs;
+  %ignore PairwiseEMD::sweep;
+  %ignore PairwiseEMD::set_sweep;
+  %ignore PairwiseEMD::sweep_emds;
   %ignore PairwiseEMD::preprocess_back_event;
+  %ignore PairwiseEMD::stats;
+  %ignore PairwiseEMD::reset_stats;
+  %ignore SolverStats;
+  %ignore problem_threads;
+  %ignore DEFAULT_MIN_PARALLEL_ARCS;
   %ignore ExternalEMDHandler::evaluate;
   %ignore ExternalEMDHandler::evaluate_symmetric;
   %ignore Histogram1DHandler::print_axis;
@@ -332,6 +379,21 @@ namespace WASSERSTEIN_NAMESPACE {
   %extend PairwiseEMD {
     ADD_REPR_FROM_DESCRIPTION_ARGS
     ADD_EXPLICIT_PREPROCESSORS
+
+    // the close pairs of threshold mode as an array of shape (num_close_pairs, 2)
+    void npy_close_pairs(std::ptrdiff_t** inds_out, std::ptrdiff_t* n0, std::ptrdiff_t* n1) {
+      *n0 = $self->close_pairs().size();
+      *n1 = 2;
+      size_t nbytes = size_t(*n0)*2*sizeof(std::ptrdiff_t);
+      std::ptrdiff_t * inds = (std::ptrdiff_t *) malloc(nbytes);
+      if (inds == NULL)
+        throw std::runtime_error("Failed to allocate " + std::to_string(nbytes) + " bytes");
+      for (size_t k = 0; k < $self->close_pairs().size(); k++) {
+        inds[2*k] = $self->close_pairs()[k].first;
+        inds[2*k + 1] = $self->close_pairs()[k].second;
+      }
+      *inds_out = inds;
+    }
   }
 
   %extend PairwiseEMDBase {
@@ -0,0 +1,120 @@
+//------------------------------------------------------------------------
+// This file is part of Wasserstein, a C++ library with a Python wrapper
+// that computes the Wasserstein/EMD distance. If you use it for academic
+// research, please cite or acknowledge the following works:
+//
+//   - Komiske, Metodiev, Thaler (2019) arXiv:1902.02346
+//       https://doi.org/10.1103/PhysRevLett.123.041801
+//   - Komiske, Metodiev, Thaler (2020) arXiv:2004.04159
+//       https://doi.org/10.1007/JHEP07%282020%29006
+//   - Boneel, van de Panne, Paris, Heidrich (2011)
+//       https://doi.org/10.1145/2070781.2024192
+//   - LEMON graph library https://lemon.cs.elte.hu/trac/lemon
+//
+// Copyright (C) 2019-2022 Patrick T. Komiske III
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------
+
+// the anytime mode stops the network simplex once the gap between its bounds is small enough, it
+// runs out of iterations or time is up, with bounds that bracket the exact EMD, and otherwise
+// finds the exact EMD; PairwiseEMD stores the upper bounds
+
+#include "test_utils.hh"
+
+// the bounds of an approximate solution bracket the exact EMD and emd() is the upper one
+void check_bounds(const EMD<> & emd_obj, double exact) {
+  std::pair<double, double> bounds(emd_obj.emd_bounds());
+  double tol(1e-12 * std::max(1.0, exact));
+  CHECK(bounds.first <= exact + tol);
+  CHECK(bounds.second >= exact - tol);
+  CHECK(bounds.second == emd_obj.emd());
+}
+
+int main() {
+
+  std::mt19937 rng(17);
+  std::vector<Event> events;
+  for (bool norm : {false, true}) {
+    EMD<> exact_obj(1, 1, norm), gap_obj(1, 1, norm), iter_obj(1, 1, norm, false, false, 20),
+          time_obj(1, 1, norm), limited_obj(1, 1, norm, false, false, 20);
+    exact_obj.set_solver(emd::EMDSolver::NetworkSimplex);
+    gap_obj.set_solver(emd::EMDSolver::NetworkSimplex);
+    iter_obj.set_solver(emd::EMDSolver::NetworkSimplex);
+    time_obj.set_solver(emd::EMDSolver::NetworkSimplex);
+    limited_obj.set_solver(emd::EMDSolver::NetworkSimplex);
+    gap_obj.set_anytime(0.05);
+    iter_obj.set_anytime(0, 1e9);
+    time_obj.set_anytime(0, 1e-12);
+
+    int approximate(0);
+    for (int mult : {5, 50, 200}) {
+      for (int k = 0; k < 4; k++) {
+        Event ev0(random_event(rng, mult)), ev1(random_event(rng, mult + 10*k));
+        if (!norm) events.push_back(ev0);
+        double exact(exact_obj(ev0, ev1));
+        CHECK(exact_obj.status() == emd::EMDStatus::Success);
+        CHECK(exact_obj.emd_bounds().first == exact && exact_obj.emd_bounds().second == exact);
+
+        // within the relative gap of the exact EMD, or exact if it finished first
+        gap_obj(ev0, ev1);
+        CHECK(gap_obj.status() == emd::EMDStatus::Success || gap_obj.status() == emd::EMDStatus::Approximate);
+        check_bounds(gap_obj, exact);
+        CHECK(gap_obj.emd() <= exact + 0.05 * gap_obj.emd() + 1e-12 * std::max(1.0, exact));
+        if (gap_obj.status() == emd::EMDStatus::Approximate) {
+          approximate++;
+          std::pair<double, double> bounds(gap_obj.emd_bounds());
+          CHECK(bounds.second - bounds.first <= 0.05 * bounds.second + 1e-12 * std::max(1.0, exact));
+        }
+        else CHECK_CLOSE(gap_obj.emd(), exact, 1e-12);
+
+        // running out of iterations gives bounds rather than MaxIterReached, which is still
+        // returned outside of the anytime mode
+        iter_obj(ev0, ev1);
+        if (iter_obj.status() == emd::EMDStatus::Approximate) {
+          check_bounds(iter_obj, exact);
+          bool threw(false);
+          try { limited_obj(ev0, ev1); }
+          catch (const std::runtime_error &) { threw = true; }
+          CHECK(threw && limited_obj.status() == emd::EMDStatus::MaxIterReached);
+        }
+        else CHECK_CLOSE(iter_obj.emd(), exact, 1e-12);
+
+        // a deadline that has always passed stops at the first check of the clock
+        time_obj(ev0, ev1);
+        if (time_obj.status() == emd::EMDStatus::Approximate) check_bounds(time_obj, exact);
+        else CHECK_CLOSE(time_obj.emd(), exact, 1e-12);
+      }
+    }
+
+    // the larger problems do stop early
+    CHECK(approximate > 0);
+  }
+
+  // PairwiseEMD stores the upper bounds of the approximate EMDs
+  EMD<> thread_obj, exact_obj;
+  thread_obj.set_solver(emd::EMDSolver::NetworkSimplex);
+  exact_obj.set_solver(emd::EMDSolver::NetworkSimplex);
+  emd::PairwiseEMD<EMD<>> pairwise_obj(thread_obj, 2, -10, 0);
+  pairwise_obj.set_anytime(0.05);
+  pairwise_obj.compute(events);
+  for (std::size_t i = 0; i < events.size(); i++)
+    for (std::size_t j = 0; j < i; j++) {
+      double exact(exact_obj(events[i], events[j])), approx(pairwise_obj.emd(i, j));
+      CHECK(approx >= exact - 1e-12 * std::max(1.0, exact));
+      CHECK(approx <= exact + 0.05 * approx + 1e-12 * std::max(1.0, exact));
+    }
+
+  return test_result("anytime");
+}
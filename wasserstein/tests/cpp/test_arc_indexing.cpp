@@ -0,0 +1,104 @@
+//------------------------------------------------------------------------
+// This file is part of Wasserstein, a C++ library with a Python wrapper
+// that computes the Wasserstein/EMD distance. If you use it for academic
+// research, please cite or acknowledge the following works:
+//
+//   - Komiske, Metodiev, Thaler (2019) arXiv:1902.02346
+//       https://doi.org/10.1103/PhysRevLett.123.041801
+//   - Komiske, Metodiev, Thaler (2020) arXiv:2004.04159
+//       https://doi.org/10.1007/JHEP07%282020%29006
+//   - Boneel, van de Panne, Paris, Heidrich (2011)
+//       https://doi.org/10.1145/2070781.2024192
+//   - LEMON graph library https://lemon.cs.elte.hu/trac/lemon
+//
+// Copyright (C) 2019-2022 Patrick T. Komiske III
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------
+
+// the arc endpoints derived from the arc index: the flows out of each particle and into
+// each particle add up to its weight, the flows times the ground distances add up to the
+// EMD, and for equally weighted particles the EMD is the cheapest of all the matchings
+
+#include <numeric>
+
+#include "test_utils.hh"
+
+// cost of the best one-to-one matching of the particles, by trying every permutation
+double brute_force_matching(const Event & ev0, const Event & ev1, const emd::EuclideanDistance2D<double> & distance) {
+  std::vector<int> perm(ev1.particles().size());
+  std::iota(perm.begin(), perm.end(), 0);
+  double best(std::numeric_limits<double>::max());
+  do {
+    double cost(0);
+    for (std::size_t i = 0; i < perm.size(); i++)
+      cost += distance.distance(ev0.particles().begin() + i, ev1.particles().begin() + perm[i]);
+    best = std::min(best, cost);
+  } while (std::next_permutation(perm.begin(), perm.end()));
+  return best;
+}
+
+// checks the flows of the last EMD computed by emd_obj against the weights of the events
+template<class EMDType>
+void check_flows(const EMDType & emd_obj, const Event & ev0, const Event & ev1) {
+  std::vector<double> ws0, ws1;
+  for (const EMDParticle & p : ev0.particles()) ws0.push_back(p.weight());
+  for (const EMDParticle & p : ev1.particles()) ws1.push_back(p.weight());
+
+  // the extra particle takes the difference of the total weights
+  double diff(std::accumulate(ws0.begin(), ws0.end(), 0.0) - std::accumulate(ws1.begin(), ws1.end(), 0.0));
+  if (emd_obj.extra() == emd::ExtraParticle::Zero) ws0.push_back(-diff);
+  if (emd_obj.extra() == emd::ExtraParticle::One) ws1.push_back(diff);
+  CHECK(std::size_t(emd_obj.n0()) == ws0.size() && std::size_t(emd_obj.n1()) == ws1.size());
+
+  std::vector<double> flows(emd_obj.flows()), dists(emd_obj.dists()), rows(ws0.size(), 0), cols(ws1.size(), 0);
+  double cost(0);
+  for (std::size_t i = 0; i < ws0.size(); i++)
+    for (std::size_t j = 0; j < ws1.size(); j++) {
+      double f(flows[i*ws1.size() + j]);
+      CHECK(f >= 0);
+      rows[i] += f;
+      cols[j] += f;
+      cost += f * dists[i*ws1.size() + j];
+    }
+  for (std::size_t i = 0; i < ws0.size(); i++) CHECK_CLOSE(rows[i], ws0[i], 1e-12);
+  for (std::size_t j = 0; j < ws1.size(); j++) CHECK_CLOSE(cols[j], ws1[j], 1e-12);
+  CHECK_CLOSE(cost, emd_obj.emd(), 1e-12);
+}
+
+int main() {
+
+  std::mt19937 rng(2);
+  emd::EuclideanDistance2D<double> distance(1, 1);
+
+  // equal weights, so that the optimal flows form a matching
+  EMD<> emd_obj;
+  for (int mult : {1, 2, 4, 6, 7})
+    for (int k = 0; k < 3; k++) {
+      Event ev0(random_event(rng, mult, true)), ev1(random_event(rng, mult, true));
+      CHECK_CLOSE(emd_obj(ev0, ev1), brute_force_matching(ev0, ev1, distance), 1e-12);
+      check_flows(emd_obj, ev0, ev1);
+    }
+
+  // different multiplicities and total weights, with the extra particle on either side
+  for (int mult0 : {1, 3, 17, 60})
+    for (int mult1 : {1, 8, 33}) {
+      Event ev0(random_event(rng, mult0)), ev1(random_event(rng, mult1));
+      emd_obj(ev0, ev1);
+      CHECK(emd_obj.status() == emd::EMDStatus::Success);
+      check_flows(emd_obj, ev0, ev1);
+    }
+
+  return test_result("arc_indexing");
+}
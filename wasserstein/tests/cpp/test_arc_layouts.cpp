@@ -0,0 +1,60 @@
+//------------------------------------------------------------------------
+// This file is part of Wasserstein, a C++ library with a Python wrapper
+// that computes the Wasserstein/EMD distance. If you use it for academic
+// research, please cite or acknowledge the following works:
+//
+//   - Komiske, Metodiev, Thaler (2019) arXiv:1902.02346
+//       https://doi.org/10.1103/PhysRevLett.123.041801
+//   - Komiske, Metodiev, Thaler (2020) arXiv:2004.04159
+//       https://doi.org/10.1007/JHEP07%282020%29006
+//   - Boneel, van de Panne, Paris, Heidrich (2011)
+//       https://doi.org/10.1145/2070781.2024192
+//   - LEMON graph library https://lemon.cs.elte.hu/trac/lemon
+//
+// Copyright (C) 2019-2022 Patrick T. Komiske III
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------
+
+// the arc storage layouts only change where the arcs live, so every layout follows the same
+// pivots as the separate arrays of the default network simplex and finds the same EMD and flows
+
+#include "test_utils.hh"
+
+int main() {
+
+  std::mt19937 rng(3);
+  EMD<> default_obj;
+  EMD<WithPolicies<emd::SeparateArcLayout>::NetworkSimplex> separate_obj;
+  EMD<emd::PackedNetworkSimplex> packed_obj;
+
+  for (int mult0 : {1, 10, 50, 150})
+    for (int mult1 : {3, 50, 120}) {
+      Event ev0(random_event(rng, mult0)), ev1(random_event(rng, mult1));
+      double exact(default_obj(ev0, ev1));
+      CHECK_CLOSE(separate_obj(ev0, ev1), exact, 1e-12);
+      CHECK_CLOSE(packed_obj(ev0, ev1), exact, 1e-12);
+      CHECK(packed_obj.status() == emd::EMDStatus::Success);
+
+      std::vector<double> flows(default_obj.flows()), separate_flows(separate_obj.flows()),
+                          packed_flows(packed_obj.flows());
+      CHECK(flows.size() == packed_flows.size() && flows.size() == separate_flows.size());
+      for (std::size_t k = 0; k < flows.size(); k++) {
+        CHECK_CLOSE(separate_flows[k], flows[k], 1e-12);
+        CHECK_CLOSE(packed_flows[k], flows[k], 1e-12);
+      }
+    }
+
+  return test_result("arc_layouts");
+}
@@ -0,0 +1,141 @@
+//------------------------------------------------------------------------
+// This file is part of Wasserstein, a C++ library with a Python wrapper
+// that computes the Wasserstein/EMD distance. If you use it for academic
+// research, please cite or acknowledge the following works:
+//
+//   - Komiske, Metodiev, Thaler (2019) arXiv:1902.02346
+//       https://doi.org/10.1103/PhysRevLett.123.041801
+//   - Komiske, Metodiev, Thaler (2020) arXiv:2004.04159
+//       https://doi.org/10.1007/JHEP07%282020%29006
+//   - Boneel, van de Panne, Paris, Heidrich (2011)
+//       https://doi.org/10.1145/2070781.2024192
+//   - LEMON graph library https://lemon.cs.elte.hu/trac/lemon
+//
+// Copyright (C) 2019-2022 Patrick T. Komiske III
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------
+
+// the auction solver finds the EMD of events with equally weighted particles within its final
+// epsilon (relative_epsilon times the range of the costs, or a few ulps of the prices if larger)
+// times the total weight, also in single precision, gives up after max_bids bids, and leaves any
+// other events to the network simplex
+
+#include "test_utils.hh"
+
+// float events with the particles of event
+emd::EuclideanEvent2D<float> float_event(const Event & event) {
+  std::vector<emd::EuclideanParticle2D<float>> particles;
+  for (const EMDParticle & p : event.particles())
+    particles.emplace_back(float(p.weight()), float(p[0]), float(p[1]));
+  return emd::EuclideanEvent2D<float>(particles);
+}
+
+int main() {
+
+  std::mt19937 rng(8);
+  EMD<> exact_obj, auction_obj;
+  exact_obj.set_solver(emd::EMDSolver::NetworkSimplex);
+  auction_obj.set_solver(emd::EMDSolver::Auction);
+
+  for (int mult : {1, 2, 10, 50, 150}) {
+    Event ev0(random_event(rng, mult, true)), ev1(random_event(rng, mult, true));
+    double exact(exact_obj(ev0, ev1)), approx(auction_obj(ev0, ev1));
+    CHECK(auction_obj.last_solver() == emd::EMDSolver::Auction);
+    CHECK(auction_obj.status() == emd::EMDStatus::Success);
+
+    std::vector<double> dists(exact_obj.dists());
+    auto minmax(std::minmax_element(dists.begin(), dists.end()));
+    double epsilon(auction_obj.auction().final_epsilon());
+    CHECK(epsilon >= auction_obj.auction().relative_epsilon() * (*minmax.second - *minmax.first));
+    CHECK(approx >= exact - 1e-12);
+    CHECK(approx <= exact + epsilon * ev0.total_weight() + 1e-12);
+
+    // the flows form an assignment, each carrying the weight of a particle
+    std::vector<double> flows(auction_obj.flows());
+    int nonzero(0);
+    for (double f : flows)
+      if (f != 0) {
+        nonzero++;
+        CHECK_CLOSE(f, 1, 1e-12);
+      }
+    CHECK(nonzero == mult);
+  }
+
+  // single precision, where the default relative_epsilon is below the resolution of the prices
+  emd::Auction<float> float_auction;
+  for (float scale : {0.01f, 1.f, 100.f})
+    for (int n = 2; n <= 5; n++)
+      for (int k = 0; k < 1000; k++) {
+        std::uniform_real_distribution<float> cost(0, scale);
+        std::vector<float> costs(n*n);
+        for (float & c : costs) c = cost(rng);
+        CHECK(float_auction.compute(costs, n, 1) == emd::EMDStatus::Success);
+        CHECK(float_auction.final_epsilon() < 1e-5f * scale);
+
+        // the optimal assignment by brute force
+        std::vector<int> perm(n);
+        for (int i = 0; i < n; i++) perm[i] = i;
+        double exact(std::numeric_limits<double>::max());
+        do {
+          double total(0);
+          for (int i = 0; i < n; i++) total += costs[i*n + perm[i]];
+          exact = std::min(exact, total);
+        } while (std::next_permutation(perm.begin(), perm.end()));
+        CHECK(float_auction.total_cost() >= exact - 1e-5 * scale);
+        CHECK(float_auction.total_cost() <= exact + n*float_auction.final_epsilon() + 1e-5 * scale);
+      }
+
+  emd::EMD<float, emd::EuclideanEvent2D, emd::EuclideanDistance2D> float_obj;
+  float_obj.set_solver(emd::EMDSolver::Auction);
+  for (int mult : {1, 2, 5, 10, 50, 150}) {
+    Event ev0(random_event(rng, mult, true)), ev1(random_event(rng, mult, true));
+    double exact(exact_obj(ev0, ev1));
+    float approx(float_obj(float_event(ev0), float_event(ev1)));
+    CHECK(float_obj.last_solver() == emd::EMDSolver::Auction);
+    CHECK(float_obj.status() == emd::EMDStatus::Success);
+    CHECK_CLOSE(approx, exact, 1e-5);
+    CHECK(approx <= exact + float_obj.auction().final_epsilon() * mult + 1e-5 * std::max(1.0, exact));
+  }
+
+  // too few bids to assign every source
+  emd::Auction<double> limited(1e-9, 10, 3);
+  std::vector<double> costs(exact_obj.dists());
+  CHECK(limited.compute(costs, 40, 1) == emd::EMDStatus::MaxIterReached);
+  CHECK(limited.n_bids() == 3);
+  CHECK(limited.flows().size() == 40*40 && limited.potentials().size() == 80);
+
+  // an EMD that hits the cap still reads flows and potentials of the full sizes, all zero
+  auction_obj.auction().set_params(1e-9, 10, 3);
+  Event capped0(random_event(rng, 40, true)), capped1(random_event(rng, 40, true));
+  CHECK(auction_obj.compute(capped0, capped1) == emd::EMDStatus::MaxIterReached);
+  CHECK(auction_obj.last_solver() == emd::EMDSolver::Auction);
+  std::vector<double> capped_flows(auction_obj.flows());
+  CHECK(capped_flows.size() == 40*40);
+  CHECK(std::count(capped_flows.begin(), capped_flows.end(), 0.0) == 40*40);
+  CHECK(auction_obj.sparse_flows().second.empty());
+  auto potentials(auction_obj.node_potentials());
+  CHECK(potentials.first.size() == 40 && potentials.second.size() == 40);
+  CHECK(std::count(potentials.first.begin(), potentials.first.end(), 0.0) == 40);
+  auction_obj.auction().set_params(1e-9, 10);
+
+  // unequal weights or multiplicities fall back to the network simplex
+  for (int mult : {10, 40}) {
+    Event ev0(random_event(rng, mult)), ev1(random_event(rng, mult + 1, true));
+    CHECK_CLOSE(auction_obj(ev0, ev1), exact_obj(ev0, ev1), 1e-12);
+    CHECK(auction_obj.last_solver() == emd::EMDSolver::NetworkSimplex);
+  }
+
+  return test_result("auction");
+}
@@ -0,0 +1,196 @@
+//------------------------------------------------------------------------
+// This file is part of Wasserstein, a C++ library with a Python wrapper
+// that computes the Wasserstein/EMD distance. If you use it for academic
+// research, please cite or acknowledge the following works:
+//
+//   - Komiske, Metodiev, Thaler (2019) arXiv:1902.02346
+//       https://doi.org/10.1103/PhysRevLett.123.041801
+//   - Komiske, Metodiev, Thaler (2020) arXiv:2004.04159
+//       https://doi.org/10.1007/JHEP07%282020%29006
+//   - Boneel, van de Panne, Paris, Heidrich (2011)
+//       https://doi.org/10.1145/2070781.2024192
+//   - LEMON graph library https://lemon.cs.elte.hu/trac/lemon
+//
+// Copyright (C) 2019-2022 Patrick T. Komiske III
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------
+
+// the row kernels filling the ground distances, unrolled for dimensions 1 to 8 and vectorized
+// where supported, agree with the scalar pairwise distance of each pair and with the distance
+// computed directly with std::pow, for every class of beta, with or without an extra particle
+
+#include "test_utils.hh"
+
+// relative tolerance of the distances for each floating point type
+template<typename Value> double tolerance();
+template<> double tolerance<double>() { return 1e-12; }
+template<> double tolerance<float>() { return 1e-5; }
+
+// random coordinates in [lo, hi), with a few particles repeated to give zero distances
+template<typename Value>
+std::vector<Value> random_coords(std::mt19937 & rng, emd::index_type n, emd::index_type dim, double lo, double hi) {
+  std::uniform_real_distribution<double> coord(lo, hi);
+  std::vector<Value> coords(std::size_t(n) * dim);
+  for (Value & x : coords) x = Value(coord(rng));
+  if (n > 2) std::copy(coords.begin(), coords.begin() + dim, coords.begin() + std::size_t(n/2) * dim);
+  return coords;
+}
+
+// distance between particles with the given plain distance, to the power beta, in long double
+long double reference_distance(long double plain, double R, double beta) {
+  return std::pow(std::sqrt(plain)/R, (long double)(beta));
+}
+
+// phi distance with fmod, as the scalar distance used to compute it
+const long double PI_LD(3.141592653589793238462643383279502884L);
+
+long double reference_dphi(long double phi0, long double phi1) {
+  long double dphi(std::fmod(std::fabs(phi0 - phi1), 2*PI_LD));
+  return dphi > PI_LD ? 2*PI_LD - dphi : dphi;
+}
+
+template<class PairwiseDistance, typename Value = typename PairwiseDistance::value_type>
+void check_fill(PairwiseDistance & pd, const std::vector<Value> & coords0, const std::vector<Value> & coords1,
+                emd::index_type n0, emd::index_type n1, emd::index_type dim, const std::vector<long double> & plains) {
+  typedef typename PairwiseDistance::ParticleCollection ParticleCollection;
+  typedef typename PairwiseDistance::ParticleIterator ParticleIterator;
+  const ParticleCollection ps0(const_cast<Value *>(coords0.data()), n0, dim),
+                           ps1(const_cast<Value *>(coords1.data()), n1, dim);
+
+  for (emd::ExtraParticle extra : {emd::ExtraParticle::Neither, emd::ExtraParticle::Zero, emd::ExtraParticle::One}) {
+    std::size_t row_len(n1 + (extra == emd::ExtraParticle::One));
+    std::vector<Value> dists, threaded_dists, plain_dists, derived_dists;
+    pd.fill_distances(ps0, ps1, dists, extra);
+    CHECK(dists.size() == (n0 + (extra == emd::ExtraParticle::Zero)) * row_len);
+
+    // each pair against the scalar distance and the reference
+    std::size_t i(0);
+    for (ParticleIterator p0 = ps0.begin(); i < std::size_t(n0); ++p0, i++) {
+      std::size_t j(0);
+      for (ParticleIterator p1 = ps1.begin(); j < std::size_t(n1); ++p1, j++) {
+        double dist(dists[i*row_len + j]), tol(tolerance<Value>());
+        CHECK_CLOSE(dist, pd.distance(p0, p1), tol);
+        CHECK_CLOSE(dist, double(reference_distance(plains[i*n1 + j], pd.R(), pd.beta())), tol);
+      }
+      if (extra == emd::ExtraParticle::One) CHECK(dists[i*row_len + n1] == 1);
+    }
+    if (extra == emd::ExtraParticle::Zero)
+      CHECK(std::all_of(dists.begin() + n0*row_len, dists.end(), [](Value d){ return d == 1; }));
+
+    // the threads fill the same rows, and the plain distances give the same distances
+    pd.fill_distances(ps0, ps1, threaded_dists, extra, 3);
+    CHECK(threaded_dists == dists);
+    pd.fill_plain_distances(ps0, ps1, plain_dists, extra);
+    for (std::size_t k = 0; k < std::size_t(n0*n1); k++)
+      CHECK_CLOSE(plain_dists[(k/n1)*row_len + k%n1], double(plains[k]), tolerance<Value>());
+    pd.distances_from_plain(plain_dists, derived_dists, n0, n1, extra);
+    CHECK(derived_dists.size() == dists.size());
+    for (std::size_t k = 0; k < dists.size() && k < derived_dists.size(); k++)
+      CHECK_CLOSE(derived_dists[k], dists[k], tolerance<Value>());
+  }
+}
+
+// betas of each class, with a large one beyond the products of the (half-)integer classes
+// where the error of the approximate power of floats, about 1e-7 |beta/2 log(x)|, allows
+template<typename Value>
+std::vector<double> betas() {
+  std::vector<double> betas{1, 2, 0.5, 1.5, 3, 4, 5.5, 0.25, 0.7, 2.3};
+  if (std::is_same<Value, double>::value) betas.push_back(70);
+  return betas;
+}
+const std::vector<emd::index_type> mults{1, 3, 4, 7, 8, 9, 17, 64, 101};
+
+template<typename Value>
+void check_euclidean(std::mt19937 & rng) {
+  for (emd::index_type dim = 1; dim <= 10; dim++)
+    for (emd::index_type n1 : mults) {
+      emd::index_type n0(1 + n1 % 5);
+      std::vector<Value> coords0(random_coords<Value>(rng, n0, dim, -1, 1)),
+                         coords1(random_coords<Value>(rng, n1, dim, -1, 1));
+      std::vector<long double> plains;
+      for (emd::index_type i = 0; i < n0; i++)
+        for (emd::index_type j = 0; j < n1; j++) {
+          long double d(0);
+          for (emd::index_type k = 0; k < dim; k++) {
+            long double dx((long double)(coords0[i*dim + k]) - coords1[j*dim + k]);
+            d += dx*dx;
+          }
+          plains.push_back(d);
+        }
+      for (double R : {0.4, 1.0})
+        for (double beta : betas<Value>()) {
+          emd::EuclideanArrayDistance<Value> pd((Value(R)), Value(beta));
+          check_fill(pd, coords0, coords1, n0, n1, dim, plains);
+        }
+    }
+}
+
+template<typename Value>
+void check_yphi(std::mt19937 & rng) {
+  for (emd::index_type n1 : mults) {
+    emd::index_type n0(1 + n1 % 5);
+
+    // phi well outside of [0, 2pi) so that it wraps
+    std::vector<Value> coords0(random_coords<Value>(rng, n0, 2, -10, 10)),
+                       coords1(random_coords<Value>(rng, n1, 2, -10, 10));
+    std::vector<long double> plains;
+    for (emd::index_type i = 0; i < n0; i++)
+      for (emd::index_type j = 0; j < n1; j++) {
+        long double dy((long double)(coords0[2*i]) - coords1[2*j]),
+                    dphi(reference_dphi(coords0[2*i + 1], coords1[2*j + 1]));
+        plains.push_back(dy*dy + dphi*dphi);
+      }
+    for (double R : {0.4, 1.0})
+      for (double beta : betas<Value>()) {
+        emd::YPhiArrayDistance<Value> pd((Value(R)), Value(beta));
+        check_fill(pd, coords0, coords1, n0, n1, 2, plains);
+      }
+  }
+}
+
+// the powers of each class of beta against std::pow, across many orders of magnitude
+template<typename Value>
+void check_beta_power(double max_log10) {
+  for (double beta : betas<Value>()) {
+    emd::BetaPower<Value> power{Value(beta)};
+    CHECK(emd::beta_power(Value(0), power) == 0 || beta == 0);
+    for (double e = -max_log10; e <= max_log10; e += 0.37) {
+      Value x(Value(std::pow(10.0, e)));
+      long double expected(std::pow((long double)(x), (long double)(beta)/2));
+      // beyond where the approximate power is clamped
+      if (std::fabs(std::log(expected)) > emd::PowerApproximation<Value>::max_exponent()) continue;
+      CHECK_CLOSE(emd::beta_power(x, power)/expected, 1.0, tolerance<Value>());
+
+      // a whole row, which is vectorized where supported
+      std::vector<Value> row(13, x * Value(3));
+      emd::beta_power_row(row.data(), emd::index_type(row.size()), Value(3), power);
+      for (Value y : row)
+        CHECK_CLOSE(y/expected, 1.0, tolerance<Value>());
+    }
+  }
+}
+
+int main() {
+
+  std::mt19937 rng(22);
+  check_euclidean<double>(rng);
+  check_euclidean<float>(rng);
+  check_yphi<double>(rng);
+  check_yphi<float>(rng);
+  check_beta_power<double>(12);
+  check_beta_power<float>(6);
+
+  return test_result("distance_kernels");
+}
@@ -0,0 +1,80 @@
+//------------------------------------------------------------------------
+// This file is part of Wasserstein, a C++ library with a Python wrapper
+// that computes the Wasserstein/EMD distance. If you use it for academic
+// research, please cite or acknowledge the following works:
+//
+//   - Komiske, Metodiev, Thaler (2019) arXiv:1902.02346
+//       https://doi.org/10.1103/PhysRevLett.123.041801
+//   - Komiske, Metodiev, Thaler (2020) arXiv:2004.04159
+//       https://doi.org/10.1007/JHEP07%282020%29006
+//   - Boneel, van de Panne, Paris, Heidrich (2011)
+//       https://doi.org/10.1145/2070781.2024192
+//   - LEMON graph library https://lemon.cs.elte.hu/trac/lemon
+//
+// Copyright (C) 2019-2022 Patrick T. Komiske III
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------
+
+// the default network simplex, which sends each problem to a solver with 32-bit or wide arc
+// indices by its size, gives the same EMD and flows as either solver alone, and counts the
+// artificial arcs towards the limit of the 32-bit solver
+
+#include "test_utils.hh"
+
+template<typename Value>
+using Narrow = emd::NetworkSimplex<Value, int, int, char>;
+template<typename Value>
+using Wide = emd::NetworkSimplex<Value, emd::index_type, int, char>;
+
+int main() {
+
+  // n0*n1 bipartite arcs plus n0 + n1 artificial ones, 46340^2 alone would fit
+  using Dispatch = emd::DefaultNetworkSimplex<double>;
+  const std::size_t max_arcs(std::numeric_limits<int>::max());
+  CHECK(Dispatch::max_small_arcs() == max_arcs);
+  CHECK(Dispatch::fits_small(46339, 46339));
+  CHECK(!Dispatch::fits_small(46340, 46340));
+  CHECK(Dispatch::fits_small(1, max_arcs/2 - 1));
+  CHECK(!Dispatch::fits_small(1, max_arcs/2 + 1));
+  CHECK(!Dispatch::fits_small(0, max_arcs + 1));
+
+  std::mt19937 rng(15);
+  for (bool warm : {false, true}) {
+    EMD<> default_obj;
+    EMD<Narrow> narrow_obj;
+    EMD<Wide> wide_obj;
+    default_obj.set_solver(emd::EMDSolver::NetworkSimplex);
+    narrow_obj.set_solver(emd::EMDSolver::NetworkSimplex);
+    wide_obj.set_solver(emd::EMDSolver::NetworkSimplex);
+    default_obj.set_warm_start(warm);
+    narrow_obj.set_warm_start(warm);
+    wide_obj.set_warm_start(warm);
+
+    for (int mult0 : {1, 20, 150, 300})
+      for (int mult1 : {3, 60, 250}) {
+        Event ev0(random_event(rng, mult0)), ev1(random_event(rng, mult1));
+        double emd(default_obj(ev0, ev1));
+        CHECK(default_obj.network_simplex().last_small());
+        CHECK(narrow_obj(ev0, ev1) == emd);
+        CHECK(wide_obj(ev0, ev1) == emd);
+        CHECK(narrow_obj.flows() == default_obj.flows());
+        CHECK(wide_obj.flows() == default_obj.flows());
+        CHECK(narrow_obj.n_iter() == default_obj.n_iter());
+        CHECK(wide_obj.n_iter() == default_obj.n_iter());
+      }
+  }
+
+  return test_result("index_dispatch");
+}
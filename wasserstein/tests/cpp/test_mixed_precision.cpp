@@ -0,0 +1,85 @@
+//------------------------------------------------------------------------
+// This file is part of Wasserstein, a C++ library with a Python wrapper
+// that computes the Wasserstein/EMD distance. If you use it for academic
+// research, please cite or acknowledge the following works:
+//
+//   - Komiske, Metodiev, Thaler (2019) arXiv:1902.02346
+//       https://doi.org/10.1103/PhysRevLett.123.041801
+//   - Komiske, Metodiev, Thaler (2020) arXiv:2004.04159
+//       https://doi.org/10.1007/JHEP07%282020%29006
+//   - Boneel, van de Panne, Paris, Heidrich (2011)
+//       https://doi.org/10.1145/2070781.2024192
+//   - LEMON graph library https://lemon.cs.elte.hu/trac/lemon
+//
+// Copyright (C) 2019-2022 Patrick T. Komiske III
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------
+
+// the mixed precision arc layout prices with costs rounded to float but enters arcs and
+// checks optimality with the exact costs, so it finds the EMD and flows of the default
+// network simplex, also when many costs differ by less than float resolution
+
+#include "test_utils.hh"
+
+// particles within spread of a few centers, so their distances only differ far below float resolution
+Event clustered_event(std::mt19937 & rng, int mult, double spread) {
+  std::uniform_real_distribution<double> weight(0, 1), jitter(-spread, spread);
+  const double centers[3][2] = {{-0.3, 0.1}, {0.2, -0.25}, {0.05, 0.35}};
+  std::vector<EMDParticle> particles;
+  for (int i = 0; i < mult; i++)
+    particles.emplace_back(1 - weight(rng), centers[i % 3][0] + jitter(rng), centers[i % 3][1] + jitter(rng));
+  return Event(particles);
+}
+
+void check(EMD<> & default_obj, EMD<emd::MixedPrecisionNetworkSimplex> & mixed_obj,
+           const Event & ev0, const Event & ev1) {
+  double exact(default_obj(ev0, ev1));
+  CHECK_CLOSE(mixed_obj(ev0, ev1), exact, 1e-12);
+  CHECK(mixed_obj.status() == emd::EMDStatus::Success);
+
+  // the final flows are optimal for the exact costs
+  std::vector<double> flows(mixed_obj.flows()), dists(mixed_obj.dists());
+  double cost(0);
+  for (std::size_t k = 0; k < flows.size(); k++)
+    cost += flows[k] * dists[k];
+  CHECK_CLOSE(cost, exact, 1e-12);
+}
+
+int main() {
+
+  std::mt19937 rng(13);
+  EMD<> default_obj;
+  EMD<emd::MixedPrecisionNetworkSimplex> mixed_obj;
+
+  for (int mult0 : {1, 10, 50, 150})
+    for (int mult1 : {3, 50, 120}) {
+      Event ev0(random_event(rng, mult0)), ev1(random_event(rng, mult1));
+      check(default_obj, mixed_obj, ev0, ev1);
+
+      std::vector<double> flows(default_obj.flows()), mixed_flows(mixed_obj.flows());
+      CHECK(flows.size() == mixed_flows.size());
+      for (std::size_t k = 0; k < flows.size(); k++)
+        CHECK_CLOSE(mixed_flows[k], flows[k], 1e-12);
+    }
+
+  // costs that round to the same float, where only the exact pricing at the end sees the difference
+  for (double spread : {1e-6, 1e-9, 1e-12})
+    for (int mult : {10, 60}) {
+      Event ev0(clustered_event(rng, mult, spread)), ev1(clustered_event(rng, mult + 7, spread));
+      check(default_obj, mixed_obj, ev0, ev1);
+    }
+
+  return test_result("mixed_precision");
+}
@@ -0,0 +1,81 @@
+//------------------------------------------------------------------------
+// This file is part of Wasserstein, a C++ library with a Python wrapper
+// that computes the Wasserstein/EMD distance. If you use it for academic
+// research, please cite or acknowledge the following works:
+//
+//   - Komiske, Metodiev, Thaler (2019) arXiv:1902.02346
+//       https://doi.org/10.1103/PhysRevLett.123.041801
+//   - Komiske, Metodiev, Thaler (2020) arXiv:2004.04159
+//       https://doi.org/10.1007/JHEP07%282020%29006
+//   - Boneel, van de Panne, Paris, Heidrich (2011)
+//       https://doi.org/10.1145/2070781.2024192
+//   - LEMON graph library https://lemon.cs.elte.hu/trac/lemon
+//
+// Copyright (C) 2019-2022 Patrick T. Komiske III
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------
+
+// the multiscale solver finds the exact EMD of the dense network simplex from nested
+// clusterings of the events, including with an extra particle, and when the rounds of the
+// finest level are limited its error bound covers its excess over the exact EMD
+
+#include "test_utils.hh"
+
+int main() {
+
+  std::mt19937 rng(10);
+  for (bool norm : {true, false}) {
+    EMD<> exact_obj(1, 1, norm), multiscale_obj(1, 1, norm), limited_obj(1, 1, norm);
+    exact_obj.set_solver(emd::EMDSolver::NetworkSimplex);
+    multiscale_obj.set_solver(emd::EMDSolver::Multiscale);
+    multiscale_obj.multiscale().set_params(2, 8);
+    limited_obj.set_solver(emd::EMDSolver::Multiscale);
+    limited_obj.multiscale().set_max_rounds(1);
+
+    for (int mult0 : {1, 20, 150, 400})
+      for (int mult1 : {3, 60, 300}) {
+        Event ev0(random_event(rng, mult0)), ev1(random_event(rng, mult1));
+        double exact(exact_obj(ev0, ev1));
+        CHECK_CLOSE(multiscale_obj(ev0, ev1), exact, 1e-12);
+        CHECK(multiscale_obj.last_solver() == emd::EMDSolver::Multiscale);
+        CHECK(multiscale_obj.status() == emd::EMDStatus::Success);
+        if (std::max(mult0, mult1) > 16)
+          CHECK(multiscale_obj.multiscale().n_levels() > 1);
+
+        // the flows of the solution still meet the weights
+        std::vector<double> flows(multiscale_obj.flows()), exact_flows(exact_obj.flows());
+        CHECK(flows.size() == exact_flows.size());
+        double total(0), exact_total(0);
+        for (std::size_t k = 0; k < flows.size(); k++) {
+          total += flows[k];
+          exact_total += exact_flows[k];
+        }
+        CHECK_CLOSE(total, exact_total, 1e-12);
+
+        // the error bound is in the units of the problem solved, those of the normalized weights
+        double approx(limited_obj(ev0, ev1)), scale(norm ? 1 : limited_obj.scale());
+        CHECK(approx >= exact - 1e-12 * std::max(1.0, exact));
+        CHECK(approx - scale * limited_obj.multiscale().error_bound() <= exact + 1e-12 * std::max(1.0, exact));
+
+        // a round limit that leaves the flow suboptimal reports it, with the error bound as the gap
+        double error_bound(scale * limited_obj.multiscale().error_bound());
+        if (limited_obj.status() == emd::EMDStatus::Success) CHECK(error_bound == 0);
+        else CHECK(limited_obj.status() == emd::EMDStatus::Approximate);
+        CHECK((limited_obj.emd_bounds() == std::make_pair(approx - error_bound, approx)));
+      }
+  }
+
+  return test_result("multiscale");
+}
@@ -0,0 +1,107 @@
+//------------------------------------------------------------------------
+// This file is part of Wasserstein, a C++ library with a Python wrapper
+// that computes the Wasserstein/EMD distance. If you use it for academic
+// research, please cite or acknowledge the following works:
+//
+//   - Komiske, Metodiev, Thaler (2019) arXiv:1902.02346
+//       https://doi.org/10.1103/PhysRevLett.123.041801
+//   - Komiske, Metodiev, Thaler (2020) arXiv:2004.04159
+//       https://doi.org/10.1007/JHEP07%282020%29006
+//   - Boneel, van de Panne, Paris, Heidrich (2011)
+//       https://doi.org/10.1145/2070781.2024192
+//   - LEMON graph library https://lemon.cs.elte.hu/trac/lemon
+//
+// Copyright (C) 2019-2022 Patrick T. Komiske III
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------
+
+// several threads within a single problem, filling the ground distances and pricing the arcs of
+// the network simplex, give the same cost and flows as one thread, with or without an extra
+// particle, while problems below min_parallel_arcs and those of PairwiseEMD use one thread
+
+#include "test_utils.hh"
+
+int main() {
+
+#ifdef _OPENMP
+  // run several threads even where fewer cores are available
+  omp_set_num_threads(4);
+#endif
+
+  std::mt19937 rng(19);
+  int other_pivots(0);
+  for (bool norm : {false, true}) {
+    EMD<> serial_obj(1, 1, norm);
+    serial_obj.set_solver(emd::EMDSolver::NetworkSimplex);
+    std::vector<EMD<>> threaded_objs;
+    for (int num_threads : {2, 3, -1}) {
+      threaded_objs.emplace_back(1, 1, norm);
+      threaded_objs.back().set_solver(emd::EMDSolver::NetworkSimplex);
+      threaded_objs.back().set_num_threads(num_threads, 1);
+      CHECK(threaded_objs.back().num_threads() == num_threads);
+      CHECK(threaded_objs.back().min_parallel_arcs() == 1);
+    }
+
+    for (int mult0 : {1, 30, 200, 600})
+      for (int mult1 : {20, 500}) {
+        Event ev0(random_event(rng, mult0)), ev1(random_event(rng, mult1));
+        double serial(serial_obj(ev0, ev1));
+        std::vector<double> serial_flows(serial_obj.flows()), serial_dists(serial_obj.dists());
+        for (EMD<> & threaded_obj : threaded_objs) {
+          CHECK_CLOSE(threaded_obj(ev0, ev1), serial, 1e-12);
+          CHECK(threaded_obj.status() == emd::EMDStatus::Success);
+          CHECK(threaded_obj.dists() == serial_dists);
+          other_pivots += threaded_obj.n_iter() != serial_obj.n_iter();
+          std::vector<double> flows(threaded_obj.flows());
+          CHECK(flows.size() == serial_flows.size());
+          for (std::size_t k = 0; k < flows.size() && k < serial_flows.size(); k++)
+            CHECK_CLOSE(flows[k], serial_flows[k], 1e-12);
+        }
+      }
+  }
+
+#ifdef _OPENMP
+  // the threads did price the arcs, which takes a different path to the same optimum
+  CHECK(other_pivots > 0);
+
+  // the number of threads for a problem
+  CHECK(emd::problem_threads(4, 100, 1000) == 1);
+  CHECK(emd::problem_threads(4, 1000, 1000) == 4);
+  CHECK(emd::problem_threads(-1, 1000, 1000) == omp_get_max_threads());
+  CHECK(emd::problem_threads(1, 1000, 1000) == 1);
+  int inside(0);
+  #pragma omp parallel num_threads(2)
+  {
+    #pragma omp single
+    inside = emd::problem_threads(4, 1000, 1000);
+  }
+  CHECK(inside == 1);
+#endif
+
+  // PairwiseEMD gives the same EMDs with threaded EMD objects
+  std::vector<Event> events;
+  for (int i = 0; i < 8; i++)
+    events.push_back(random_event(rng, 50 + 20*i));
+  EMD<> serial_obj, threaded_obj;
+  threaded_obj.set_num_threads(-1, 1);
+  emd::PairwiseEMD<EMD<>> serial_pairwise(serial_obj, 2, -10, 0), threaded_pairwise(threaded_obj, 2, -10, 0);
+  serial_pairwise.compute(events);
+  threaded_pairwise.compute(events);
+  for (std::size_t i = 0; i < events.size(); i++)
+    for (std::size_t j = 0; j < i; j++)
+      CHECK(threaded_pairwise.emd(i, j) == serial_pairwise.emd(i, j));
+
+  return test_result("num_threads");
+}
@@ -0,0 +1,77 @@
+//------------------------------------------------------------------------
+// This file is part of Wasserstein, a C++ library with a Python wrapper
+// that computes the Wasserstein/EMD distance. If you use it for academic
+// research, please cite or acknowledge the following works:
+//
+//   - Komiske, Metodiev, Thaler (2019) arXiv:1902.02346
+//       https://doi.org/10.1103/PhysRevLett.123.041801
+//   - Komiske, Metodiev, Thaler (2020) arXiv:2004.04159
+//       https://doi.org/10.1007/JHEP07%282020%29006
+//   - Boneel, van de Panne, Paris, Heidrich (2011)
+//       https://doi.org/10.1145/2070781.2024192
+//   - LEMON graph library https://lemon.cs.elte.hu/trac/lemon
+//
+// Copyright (C) 2019-2022 Patrick T. Komiske III
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------
+
+// every pivot rule finds the exact EMD of the default block search, and setting the network
+// simplex parameters without pivot rule parameters keeps those set before
+
+#include "test_utils.hh"
+
+bool contains(const std::string & s, const std::string & part) {
+  return s.find(part) != std::string::npos;
+}
+
+int main() {
+
+  std::mt19937 rng(5);
+  EMD<> emd_obj;
+  EMD<WithPolicies<emd::SeparateArcLayout, emd::BlockSearchPivotRule>::NetworkSimplex> block_obj;
+  EMD<WithPolicies<emd::SeparateArcLayout, emd::CandidateListPivotRule>::NetworkSimplex> candidate_obj;
+  EMD<WithPolicies<emd::SeparateArcLayout, emd::AlteringCandidateListPivotRule>::NetworkSimplex> altering_obj;
+  EMD<WithPolicies<emd::SeparateArcLayout, emd::FirstEligiblePivotRule>::NetworkSimplex> first_obj;
+
+  for (int mult0 : {1, 10, 60, 150})
+    for (int mult1 : {4, 60, 110}) {
+      Event ev0(random_event(rng, mult0)), ev1(random_event(rng, mult1));
+      double exact(emd_obj(ev0, ev1));
+      CHECK_CLOSE(block_obj(ev0, ev1), exact, 1e-12);
+      CHECK_CLOSE(candidate_obj(ev0, ev1), exact, 1e-12);
+      CHECK_CLOSE(altering_obj(ev0, ev1), exact, 1e-12);
+      CHECK_CLOSE(first_obj(ev0, ev1), exact, 1e-12);
+      CHECK(candidate_obj.status() == emd::EMDStatus::Success && first_obj.status() == emd::EMDStatus::Success);
+    }
+
+  // non-default parameters survive setting only the constructor parameters, and a negative
+  // value restores the default
+  candidate_obj.set_network_simplex_params(100000, 1000, 1, 0.5, 0.2);
+  CHECK(contains(candidate_obj.description(), "list_length_factor 0.5, minor_limit_factor 0.2"));
+  candidate_obj.set_network_simplex_params(50000);
+  CHECK(contains(candidate_obj.description(), "list_length_factor 0.5, minor_limit_factor 0.2"));
+  CHECK(contains(candidate_obj.description(), "n_iter_max - 50000"));
+  candidate_obj.set_network_simplex_params(100000, 1000, 1, 0, -1);
+  CHECK(contains(candidate_obj.description(), "list_length_factor 0.5, minor_limit_factor 0.1"));
+
+  // and the EMDs with other parameters are still exact
+  Event ev0(random_event(rng, 80)), ev1(random_event(rng, 90));
+  block_obj.set_network_simplex_params(100000, 1000, 1, 0.3, 3);
+  CHECK(contains(block_obj.description(), "block_size_factor 0.3, min_block_size 3"));
+  CHECK_CLOSE(block_obj(ev0, ev1), emd_obj(ev0, ev1), 1e-12);
+  CHECK_CLOSE(candidate_obj(ev0, ev1), emd_obj(ev0, ev1), 1e-12);
+
+  return test_result("pivot_rules");
+}
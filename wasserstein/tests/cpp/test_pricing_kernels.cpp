@@ -0,0 +1,92 @@
+//------------------------------------------------------------------------
+// This file is part of Wasserstein, a C++ library with a Python wrapper
+// that computes the Wasserstein/EMD distance. If you use it for academic
+// research, please cite or acknowledge the following works:
+//
+//   - Komiske, Metodiev, Thaler (2019) arXiv:1902.02346
+//       https://doi.org/10.1103/PhysRevLett.123.041801
+//   - Komiske, Metodiev, Thaler (2020) arXiv:2004.04159
+//       https://doi.org/10.1007/JHEP07%282020%29006
+//   - Boneel, van de Panne, Paris, Heidrich (2011)
+//       https://doi.org/10.1145/2070781.2024192
+//   - LEMON graph library https://lemon.cs.elte.hu/trac/lemon
+//
+// Copyright (C) 2019-2022 Patrick T. Komiske III
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------
+
+// every pricing kernel supported here makes the same pivot choices as the scalar one: on
+// runs of arcs with ties and all three arc states, with float costs and double potentials
+// as priced by the mixed precision layout, and on whole EMDs, each solver using its own kernel
+
+#include <cstdint>
+
+#include "test_utils.hh"
+
+// prices the same random run of arcs with kernel and with the scalar kernel
+template<typename Value, typename Cost = Value>
+void check_price_arcs(emd::PricingKernel kernel, std::mt19937 & rng, int n) {
+  std::uniform_int_distribution<int> small(-3, 3), state(-1, 1);
+  std::vector<Cost> costs(n);
+  std::vector<Value> pis_t(n);
+  std::vector<char> states(n);
+  for (int k = 0; k < n; k++) {
+    costs[k] = Cost(small(rng));
+    pis_t[k] = Value(small(rng));
+    states[k] = char(state(rng));
+  }
+
+  Value min(0), scalar_min(0);
+  long min_arc(-1), scalar_min_arc(-1);
+  emd::price_arcs(kernel, costs.data(), states.data(), Value(1), pis_t.data(), 10L, long(n), min, min_arc);
+  emd::price_arcs_scalar(costs.data(), states.data(), Value(1), pis_t.data(), 10L, long(n), scalar_min, scalar_min_arc);
+  CHECK(min == scalar_min);
+  CHECK(min_arc == scalar_min_arc);
+}
+
+int main() {
+
+  std::mt19937 rng(4);
+  CHECK(emd::supported_pricing_kernel(emd::PricingKernel::AVX512) == emd::best_pricing_kernel());
+  CHECK(emd::default_pricing_kernel() <= emd::PricingKernel::AVX2);
+
+  EMD<> scalar_obj;
+  CHECK(scalar_obj.network_simplex().pricing_kernel() == emd::default_pricing_kernel());
+  CHECK(scalar_obj.network_simplex().set_pricing_kernel(emd::PricingKernel::Scalar) == emd::PricingKernel::Scalar);
+
+  for (int k = 0; k <= int(emd::best_pricing_kernel()); k++) {
+    emd::PricingKernel kernel(static_cast<emd::PricingKernel>(k));
+
+    for (int n : {1, 31, 32, 33, 64, 100, 257}) {
+      check_price_arcs<double>(kernel, rng, n);
+      check_price_arcs<float>(kernel, rng, n);
+      check_price_arcs<std::int64_t>(kernel, rng, n);
+      check_price_arcs<double, float>(kernel, rng, n);
+    }
+
+    EMD<> emd_obj;
+    CHECK(emd_obj.network_simplex().set_pricing_kernel(kernel) == kernel);
+    for (int mult : {10, 50, 200}) {
+      Event ev0(random_event(rng, mult)), ev1(random_event(rng, mult + 7));
+      CHECK(emd_obj(ev0, ev1) == scalar_obj(ev0, ev1));
+      CHECK(emd_obj.flows() == scalar_obj.flows());
+    }
+
+    // setting one solver's kernel leaves the others alone
+    CHECK(scalar_obj.network_simplex().pricing_kernel() == emd::PricingKernel::Scalar);
+  }
+
+  return test_result("pricing_kernels");
+}
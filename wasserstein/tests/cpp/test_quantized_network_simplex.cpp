@@ -0,0 +1,97 @@
+//------------------------------------------------------------------------
+// This file is part of Wasserstein, a C++ library with a Python wrapper
+// that computes the Wasserstein/EMD distance. If you use it for academic
+// research, please cite or acknowledge the following works:
+//
+//   - Komiske, Metodiev, Thaler (2019) arXiv:1902.02346
+//       https://doi.org/10.1103/PhysRevLett.123.041801
+//   - Komiske, Metodiev, Thaler (2020) arXiv:2004.04159
+//       https://doi.org/10.1007/JHEP07%282020%29006
+//   - Boneel, van de Panne, Paris, Heidrich (2011)
+//       https://doi.org/10.1145/2070781.2024192
+//   - LEMON graph library https://lemon.cs.elte.hu/trac/lemon
+//
+// Copyright (C) 2019-2022 Patrick T. Komiske III
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------
+
+// the quantized network simplex solves the EMD of the rounded weights and ground distances,
+// which is within the rounding of the exact EMD, gives the same bits whatever the number of
+// threads or previous problems, and throws when the resolutions are too fine for 64 bits
+
+#include "test_utils.hh"
+
+int main() {
+
+  const double weight_resolution(1e-9), dist_resolution(1e-9), max_dist(2);
+
+  std::mt19937 rng(14);
+  for (bool norm : {true, false}) {
+    EMD<> exact_obj(1, 1, norm);
+    EMD<emd::QuantizedNetworkSimplex> quantized_obj(1, 1, norm), threaded_obj(1, 1, norm);
+    exact_obj.set_solver(emd::EMDSolver::NetworkSimplex);
+    quantized_obj.set_solver(emd::EMDSolver::NetworkSimplex);
+    threaded_obj.set_solver(emd::EMDSolver::NetworkSimplex);
+    quantized_obj.network_simplex().set_resolutions(weight_resolution, dist_resolution);
+    threaded_obj.network_simplex().set_resolutions(weight_resolution, dist_resolution);
+    threaded_obj.network_simplex().set_num_threads(4, 1);
+
+    for (int mult0 : {1, 20, 150})
+      for (int mult1 : {3, 60, 200}) {
+        Event ev0(random_event(rng, mult0)), ev1(random_event(rng, mult1));
+        double exact(exact_obj(ev0, ev1)), quantized(quantized_obj(ev0, ev1));
+        CHECK(quantized_obj.status() == emd::EMDStatus::Success);
+
+        // every weight (including an extra particle) moves by less than a unit, each unit
+        // of flow by at most max_dist, and the ground distances by half a unit
+        double scale(norm ? 1 : quantized_obj.scale());
+        double tol((mult0 + mult1 + 1) * weight_resolution * max_dist + dist_resolution);
+        CHECK(std::fabs(quantized - exact) <= scale * tol);
+
+        // the same bits with several threads, and again after another problem
+        std::vector<double> flows(quantized_obj.network_simplex().flows());
+        CHECK(threaded_obj(ev0, ev1) == quantized);
+        CHECK(threaded_obj.network_simplex().flows() == flows);
+        quantized_obj(ev1, ev0);
+        CHECK(quantized_obj(ev0, ev1) == quantized);
+        CHECK(quantized_obj.network_simplex().flows() == flows);
+      }
+  }
+
+  // resolutions too fine for 64-bit arithmetic
+  EMD<emd::QuantizedNetworkSimplex> fine_obj;
+  fine_obj.set_solver(emd::EMDSolver::NetworkSimplex);
+  fine_obj.network_simplex().set_resolutions(1e-12, 1e-12);
+  bool threw(false);
+  try { fine_obj(random_event(rng, 10), random_event(rng, 10)); }
+  catch (const std::overflow_error &) { threw = true; }
+  CHECK(threw);
+
+  // weights or distances beyond the range of 64-bit integers in units of the default resolutions,
+  // which must be detected before they are converted
+  for (double weight : {0.5, 1e12})
+    for (double dist : {1.0, 1e12, -1e12}) {
+      if (weight == 0.5 && dist == 1) continue;
+      emd::QuantizedNetworkSimplex<double> ns;
+      ns.weights() = {weight, weight, weight, weight};
+      ns.dists() = {dist, 2*dist, 3*dist, dist};
+      bool overflowed(false);
+      try { ns.compute(2, 2); }
+      catch (const std::overflow_error &) { overflowed = true; }
+      CHECK(overflowed);
+    }
+
+  return test_result("quantized_network_simplex");
+}
@@ -0,0 +1,115 @@
+//------------------------------------------------------------------------
+// This file is part of Wasserstein, a C++ library with a Python wrapper
+// that computes the Wasserstein/EMD distance. If you use it for academic
+// research, please cite or acknowledge the following works:
+//
+//   - Komiske, Metodiev, Thaler (2019) arXiv:1902.02346
+//       https://doi.org/10.1103/PhysRevLett.123.041801
+//   - Komiske, Metodiev, Thaler (2020) arXiv:2004.04159
+//       https://doi.org/10.1007/JHEP07%282020%29006
+//   - Boneel, van de Panne, Paris, Heidrich (2011)
+//       https://doi.org/10.1145/2070781.2024192
+//   - LEMON graph library https://lemon.cs.elte.hu/trac/lemon
+//
+// Copyright (C) 2019-2022 Patrick T. Komiske III
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------
+
+// reserving the buffers for the largest event, with or without huge pages, leaves nothing to
+// allocate while computing, on every thread of PairwiseEMD, and does not change the EMDs; the
+// allocations counter of the solver statistics only sees the buffers that grow, so computing the
+// EMDs of a single object (without the copies of operator()) is also checked to make no heap
+// allocation at all through operator new
+
+// count allocations in this test whatever the build flags
+#ifndef WASSERSTEIN_SOLVER_STATS
+# define WASSERSTEIN_SOLVER_STATS
+#endif
+
+// C++ standard library
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include "test_utils.hh"
+
+// every allocation through operator new (operator new[] goes through it as well)
+std::atomic<std::size_t> heap_allocations(0);
+
+void * operator new(std::size_t size) {
+  heap_allocations++;
+  if (void * p = std::malloc(size == 0 ? 1 : size)) return p;
+  throw std::bad_alloc();
+}
+
+// GCC sees free on the pointers of the replaced operator new once both are inlined
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+# pragma GCC diagnostic push
+# pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+void operator delete(void * p) noexcept { std::free(p); }
+void operator delete(void * p, std::size_t) noexcept { std::free(p); }
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+# pragma GCC diagnostic pop
+#endif
+
+int main() {
+
+  std::mt19937 rng(16);
+  std::vector<Event> events;
+  int max_mult(0);
+  for (int mult : {5, 80, 30, 150, 60, 150, 10}) {
+    events.push_back(random_event(rng, mult));
+    max_mult = std::max(max_mult, mult);
+  }
+
+  for (bool huge_pages : {false, true}) {
+    EMD<> exact_obj, emd_obj;
+    exact_obj.set_solver(emd::EMDSolver::NetworkSimplex);
+    emd_obj.set_solver(emd::EMDSolver::NetworkSimplex);
+    emd_obj.reserve(max_mult, max_mult, huge_pages);
+    std::vector<double> exact_emds, emds(events.size() * events.size());
+    for (const Event & ev0 : events)
+      for (const Event & ev1 : events) {
+        exact_obj.compute(ev0, ev1);
+        exact_emds.push_back(exact_obj.emd());
+      }
+    emd_obj.reset_stats();
+    std::size_t heap_allocations_before(heap_allocations), k(0);
+    for (const Event & ev0 : events)
+      for (const Event & ev1 : events) {
+        CHECK(emd_obj.compute(ev0, ev1) == emd::EMDStatus::Success);
+        emds[k++] = emd_obj.emd();
+      }
+    CHECK(heap_allocations == heap_allocations_before);
+    CHECK(emd_obj.stats().allocations == 0);
+    CHECK(emds == exact_emds);
+
+    // every thread's EMD object is reserved, including for the extra particle of unnormalized events
+    EMD<> thread_obj;
+    thread_obj.set_solver(emd::EMDSolver::NetworkSimplex);
+    emd::PairwiseEMD<EMD<>> pairwise_obj(thread_obj, 4, -10, 0), unreserved_obj(thread_obj, 4, -10, 0);
+    pairwise_obj.reserve(max_mult, huge_pages);
+    pairwise_obj.reset_stats();
+    pairwise_obj.compute(events);
+    unreserved_obj.compute(events);
+    for (int thread = 0; thread < pairwise_obj.num_threads(); thread++)
+      CHECK(pairwise_obj.stats(thread).allocations == 0);
+    CHECK(pairwise_obj.stats().n_solves == std::size_t(pairwise_obj.num_emds()));
+    CHECK(pairwise_obj.emds() == unreserved_obj.emds());
+  }
+
+  return test_result("reserve");
+}
@@ -0,0 +1,108 @@
+//------------------------------------------------------------------------
+// This file is part of Wasserstein, a C++ library with a Python wrapper
+// that computes the Wasserstein/EMD distance. If you use it for academic
+// research, please cite or acknowledge the following works:
+//
+//   - Komiske, Metodiev, Thaler (2019) arXiv:1902.02346
+//       https://doi.org/10.1103/PhysRevLett.123.041801
+//   - Komiske, Metodiev, Thaler (2020) arXiv:2004.04159
+//       https://doi.org/10.1007/JHEP07%282020%29006
+//   - Boneel, van de Panne, Paris, Heidrich (2011)
+//       https://doi.org/10.1145/2070781.2024192
+//   - LEMON graph library https://lemon.cs.elte.hu/trac/lemon
+//
+// Copyright (C) 2019-2022 Patrick T. Komiske III
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------
+
+// the Sinkhorn solver approaches the exact EMD from above as its regularization decreases,
+// within the regularization times the log of the number of arcs (in units of the largest
+// cost), and its flows meet the weights within its tolerance
+
+#include <cmath>
+
+#include "test_utils.hh"
+
+int main() {
+
+#ifdef _OPENMP
+  // run several threads even where fewer cores are available
+  omp_set_num_threads(4);
+#endif
+
+  std::mt19937 rng(7);
+  EMD<> exact_obj(1, 1, true);
+  EMD<emd::Sinkhorn> sinkhorn_obj(1, 1, true);
+
+  // setting the network simplex parameters leaves the regularization and tolerance alone
+  sinkhorn_obj.network_simplex().set_regularization(0.002);
+  sinkhorn_obj.network_simplex().set_tolerance(1e-9);
+  sinkhorn_obj.set_network_simplex_params(100000, 1000, 1, 0.5, 0.5);
+  CHECK(sinkhorn_obj.network_simplex().regularization() == 0.002);
+  CHECK(sinkhorn_obj.network_simplex().tolerance() == 1e-9);
+
+  for (double regularization : {0.01, 0.002})
+    for (int mult : {5, 20, 60}) {
+      sinkhorn_obj.network_simplex().set_regularization(regularization);
+      Event ev0(random_event(rng, mult)), ev1(random_event(rng, mult + 3));
+      double exact(exact_obj(ev0, ev1)), approx(sinkhorn_obj(ev0, ev1));
+      CHECK(sinkhorn_obj.status() == emd::EMDStatus::Success);
+
+      std::vector<double> dists(exact_obj.dists()), flows(sinkhorn_obj.flows());
+      double max_cost(*std::max_element(dists.begin(), dists.end()));
+      double n_arcs(double(sinkhorn_obj.n0()) * sinkhorn_obj.n1());
+      CHECK(approx >= exact - 1e-6 * max_cost);
+      CHECK(approx <= exact + regularization * max_cost * std::log(n_arcs) + 1e-6 * max_cost);
+
+      // marginals of the normalized events, summed over both sides
+      double violation(0);
+      for (int i = 0; i < sinkhorn_obj.n0(); i++) {
+        double row(0);
+        for (int j = 0; j < sinkhorn_obj.n1(); j++) row += flows[i*sinkhorn_obj.n1() + j];
+        violation += std::fabs(row - ev0.particles()[i].weight() / ev0.total_weight());
+      }
+      for (int j = 0; j < sinkhorn_obj.n1(); j++) {
+        double col(0);
+        for (int i = 0; i < sinkhorn_obj.n0(); i++) col += flows[i*sinkhorn_obj.n1() + j];
+        violation += std::fabs(col - ev1.particles()[j].weight() / ev1.total_weight());
+      }
+      CHECK(violation <= 1e-8);
+
+      // the dual bound is below the exact EMD, and the upper bound is the regularized cost
+      CHECK(sinkhorn_obj.network_simplex().cost_lower_bound() <= exact + 1e-12);
+      CHECK(sinkhorn_obj.network_simplex().cost_lower_bound() >= exact - regularization * max_cost * std::log(n_arcs));
+      CHECK(sinkhorn_obj.network_simplex().cost_upper_bound() == approx);
+      CHECK(sinkhorn_obj.emd_bounds() == std::make_pair(approx, approx));
+    }
+
+  // splitting the rows and columns among threads gives the same plan up to the order of the
+  // sums of the marginal violations, and the anytime mode, which Sinkhorn does not have,
+  // changes nothing
+  EMD<emd::Sinkhorn> threaded_obj(1, 1, true);
+  threaded_obj.network_simplex().set_tolerance(1e-9);
+  threaded_obj.set_num_threads(4, 0);
+  threaded_obj.set_anytime(0.1);
+  sinkhorn_obj.network_simplex().set_regularization(0.01);
+  for (int mult : {3, 40, 150}) {
+    Event ev0(random_event(rng, mult)), ev1(random_event(rng, mult + 7));
+    CHECK_CLOSE(threaded_obj(ev0, ev1), sinkhorn_obj(ev0, ev1), 1e-9);
+    CHECK(threaded_obj.status() == emd::EMDStatus::Success);
+    std::vector<double> flows(sinkhorn_obj.flows()), threaded_flows(threaded_obj.flows());
+    for (std::size_t k = 0; k < flows.size(); k++)
+      CHECK_CLOSE(threaded_flows[k], flows[k], 1e-9);
+  }
+
+  return test_result("sinkhorn");
+}
@@ -0,0 +1,105 @@
+//------------------------------------------------------------------------
+// This file is part of Wasserstein, a C++ library with a Python wrapper
+// that computes the Wasserstein/EMD distance. If you use it for academic
+// research, please cite or acknowledge the following works:
+//
+//   - Komiske, Metodiev, Thaler (2019) arXiv:1902.02346
+//       https://doi.org/10.1103/PhysRevLett.123.041801
+//   - Komiske, Metodiev, Thaler (2020) arXiv:2004.04159
+//       https://doi.org/10.1007/JHEP07%282020%29006
+//   - Boneel, van de Panne, Paris, Heidrich (2011)
+//       https://doi.org/10.1145/2070781.2024192
+//   - LEMON graph library https://lemon.cs.elte.hu/trac/lemon
+//
+// Copyright (C) 2019-2022 Patrick T. Komiske III
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------
+
+// solver statistics count the work of the network simplex and of the EMD around it without
+// changing its results, stop counting allocations once the buffers fit the largest problem,
+// and are summed over the threads of PairwiseEMD
+
+// collect the statistics in this test whatever the build flags
+#ifndef WASSERSTEIN_SOLVER_STATS
+# define WASSERSTEIN_SOLVER_STATS
+#endif
+
+#include "test_utils.hh"
+
+int main() {
+
+  CHECK(emd::COMPILED_WITH_SOLVER_STATS);
+
+  std::mt19937 rng(12);
+  EMD<> emd_obj, exact_obj;
+  exact_obj.set_solver(emd::EMDSolver::NetworkSimplex);
+  emd_obj.set_solver(emd::EMDSolver::NetworkSimplex);
+
+  std::vector<Event> events;
+  for (int mult : {10, 50, 120, 120, 80})
+    events.push_back(random_event(rng, mult));
+
+  std::size_t n_solves(0);
+  for (std::size_t i = 0; i < events.size(); i++)
+    for (std::size_t j = 0; j < events.size(); j++) {
+      double emd(emd_obj(events[i], events[j]));
+      n_solves++;
+      CHECK(emd == exact_obj(events[i], events[j]));
+
+      emd::SolverStats stats(emd_obj.stats());
+      CHECK(stats.n_solves == n_solves);
+      CHECK(stats.degenerate_pivots <= stats.pivots);
+      CHECK(stats.arcs_priced >= stats.pivots);
+      CHECK(stats.fill_time >= 0 && stats.solve_time >= 0);
+    }
+
+  // once the buffers fit the largest event no more allocations are made
+  std::size_t allocations(emd_obj.stats().allocations);
+  CHECK(allocations > 0);
+  for (const Event & ev0 : events)
+    for (const Event & ev1 : events)
+      emd_obj(ev0, ev1);
+  CHECK(emd_obj.stats().allocations == allocations);
+
+  // reserving up front leaves nothing to allocate
+  EMD<> reserved_obj;
+  reserved_obj.set_solver(emd::EMDSolver::NetworkSimplex);
+  reserved_obj.reserve(120, 120);
+  reserved_obj.reset_stats();
+  for (const Event & ev0 : events)
+    for (const Event & ev1 : events)
+      reserved_obj(ev0, ev1);
+  CHECK(reserved_obj.stats().allocations == 0);
+
+  emd_obj.reset_stats();
+  CHECK(emd_obj.stats().n_solves == 0 && emd_obj.stats().pivots == 0);
+
+  // PairwiseEMD sums the statistics of its threads
+  EMD<> thread_obj;
+  thread_obj.set_solver(emd::EMDSolver::NetworkSimplex);
+  emd::PairwiseEMD<EMD<>> pairwise_obj(thread_obj, 3, -10, 0);
+  pairwise_obj.compute(events);
+  emd::SolverStats total(pairwise_obj.stats()), summed;
+  for (int thread = 0; thread < pairwise_obj.num_threads(); thread++)
+    summed += pairwise_obj.stats(thread);
+  CHECK(total.n_solves == std::size_t(pairwise_obj.num_emds()));
+  CHECK(summed.n_solves == total.n_solves);
+  CHECK(summed.pivots == total.pivots);
+  CHECK(summed.arcs_priced == total.arcs_priced);
+  pairwise_obj.reset_stats();
+  CHECK(pairwise_obj.stats().n_solves == 0);
+
+  return test_result("solver_stats");
+}
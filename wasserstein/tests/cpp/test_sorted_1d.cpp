@@ -0,0 +1,133 @@
+//------------------------------------------------------------------------
+// This file is part of Wasserstein, a C++ library with a Python wrapper
+// that computes the Wasserstein/EMD distance. If you use it for academic
+// research, please cite or acknowledge the following works:
+//
+//   - Komiske, Metodiev, Thaler (2019) arXiv:1902.02346
+//       https://doi.org/10.1103/PhysRevLett.123.041801
+//   - Komiske, Metodiev, Thaler (2020) arXiv:2004.04159
+//       https://doi.org/10.1007/JHEP07%282020%29006
+//   - Boneel, van de Panne, Paris, Heidrich (2011)
+//       https://doi.org/10.1145/2070781.2024192
+//   - LEMON graph library https://lemon.cs.elte.hu/trac/lemon
+//
+// Copyright (C) 2019-2022 Patrick T. Komiske III
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------
+
+// events on a line are solved by sorting with the same EMD and ground distances as the
+// network simplex, while Auto leaves events whose total weights differ to the network simplex,
+// as it does all events when the network simplex is not an exact floating point one
+
+#include "test_utils.hh"
+
+using Event1D = emd::EuclideanEvent1D<double>;
+using EMD1D = emd::EMD<double, emd::EuclideanEvent1D, emd::EuclideanDistance1D>;
+using SinkhornEMD1D = emd::EMD<double, emd::EuclideanEvent1D, emd::EuclideanDistance1D, emd::Sinkhorn>;
+using QuantizedEMD1D = emd::EMD<double, emd::EuclideanEvent1D, emd::EuclideanDistance1D, emd::QuantizedNetworkSimplex>;
+
+static_assert(emd::is_exact_network_simplex<emd::DefaultNetworkSimplex<double>>::value, "");
+static_assert(emd::is_exact_network_simplex<emd::MixedPrecisionNetworkSimplex<double>>::value, "");
+static_assert(!emd::is_exact_network_simplex<emd::Sinkhorn<double>>::value, "");
+static_assert(!emd::is_exact_network_simplex<emd::QuantizedNetworkSimplex<double>>::value, "");
+
+// the particles of a random event on the x-axis as 1D particles
+Event1D random_event_1d(std::mt19937 & rng, int mult) {
+  Event event(random_event(rng, mult, false, true));
+  std::vector<emd::EuclideanParticleND<1, double>> particles;
+  for (const EMDParticle & p : event.particles())
+    particles.emplace_back(p.weight(), std::array<double, 1>{{p[0]}});
+  return Event1D(particles);
+}
+
+int main() {
+
+  std::mt19937 rng(6);
+  for (double beta : {1.0, 1.5, 2.0}) {
+    EMD1D exact_obj(1, beta, true), sorted_obj(1, beta, true);
+    exact_obj.set_solver(emd::EMDSolver::NetworkSimplex);
+    sorted_obj.set_solver(emd::EMDSolver::Sorted1D);
+
+    for (int mult0 : {1, 5, 40, 130})
+      for (int mult1 : {2, 40, 77}) {
+        Event1D ev0(random_event_1d(rng, mult0)), ev1(random_event_1d(rng, mult1));
+        double exact(exact_obj(ev0, ev1));
+        CHECK_CLOSE(sorted_obj(ev0, ev1), exact, 1e-12);
+        CHECK(sorted_obj.last_solver() == emd::EMDSolver::Sorted1D);
+        CHECK(sorted_obj.status() == emd::EMDStatus::Success);
+
+        // the dense ground distances are built on the first request and kept after that
+        std::vector<double> & dists(sorted_obj.ground_dists());
+        CHECK(&sorted_obj.ground_dists() == &dists);
+        std::vector<double> exact_dists(exact_obj.dists()), sorted_dists(sorted_obj.dists());
+        CHECK(sorted_dists.size() == exact_dists.size());
+        for (std::size_t k = 0; k < exact_dists.size(); k++)
+          CHECK_CLOSE(sorted_dists[k], exact_dists[k], 1e-12);
+      }
+  }
+
+  // the sorting solver follows changes of R and beta made on the same object
+  EMD1D exact_params_obj(1, 1, true), sorted_params_obj(1, 1, true);
+  exact_params_obj.set_solver(emd::EMDSolver::NetworkSimplex);
+  sorted_params_obj.set_solver(emd::EMDSolver::Sorted1D);
+  Event1D ev0(random_event_1d(rng, 25)), ev1(random_event_1d(rng, 31));
+  for (double R : {1.0, 0.4})
+    for (double beta : {1.0, 2.0, 1.5, 3.0}) {
+      exact_params_obj.set_R(R);
+      exact_params_obj.set_beta(beta);
+      sorted_params_obj.set_R(R);
+      sorted_params_obj.set_beta(beta);
+      CHECK_CLOSE(sorted_params_obj(ev0, ev1), exact_params_obj(ev0, ev1), 1e-12);
+      std::vector<double> exact_dists(exact_params_obj.dists()), sorted_dists(sorted_params_obj.dists());
+      for (std::size_t k = 0; k < exact_dists.size(); k++)
+        CHECK_CLOSE(sorted_dists[k], exact_dists[k], 1e-12);
+    }
+
+  // with unnormalized events of different total weight an extra particle is needed
+  EMD1D exact_obj, auto_obj;
+  exact_obj.set_solver(emd::EMDSolver::NetworkSimplex);
+  for (int mult : {3, 30, 90}) {
+    Event1D ev0(random_event_1d(rng, mult)), ev1(random_event_1d(rng, mult + 4));
+    CHECK_CLOSE(auto_obj(ev0, ev1), exact_obj(ev0, ev1), 1e-12);
+    CHECK(auto_obj.last_solver() == emd::EMDSolver::NetworkSimplex);
+  }
+
+  // Sinkhorn and QuantizedNetworkSimplex keep their own results under Auto, sorting only if chosen
+  SinkhornEMD1D sinkhorn_obj(1, 1, true);
+  QuantizedEMD1D quantized_obj(1, 1, true);
+  EMD1D sorted_obj(1, 1, true);
+  for (int mult : {5, 40}) {
+    Event1D ev0(random_event_1d(rng, mult)), ev1(random_event_1d(rng, mult + 3));
+    double exact(sorted_obj(ev0, ev1));
+    CHECK(sorted_obj.last_solver() == emd::EMDSolver::Sorted1D);
+
+    double regularized(sinkhorn_obj(ev0, ev1));
+    CHECK(sinkhorn_obj.last_solver() == emd::EMDSolver::NetworkSimplex);
+    CHECK(regularized > exact);
+    sinkhorn_obj.set_solver(emd::EMDSolver::Sorted1D);
+    CHECK(sinkhorn_obj(ev0, ev1) == exact);
+    CHECK(sinkhorn_obj.last_solver() == emd::EMDSolver::Sorted1D);
+    sinkhorn_obj.set_solver(emd::EMDSolver::Auto);
+
+    quantized_obj(ev0, ev1);
+    CHECK(quantized_obj.last_solver() == emd::EMDSolver::NetworkSimplex);
+    CHECK_CLOSE(quantized_obj.emd(), exact, 1e-6);
+    quantized_obj.set_solver(emd::EMDSolver::Sorted1D);
+    CHECK(quantized_obj(ev0, ev1) == exact);
+    quantized_obj.set_solver(emd::EMDSolver::Auto);
+  }
+
+  return test_result("sorted_1d");
+}
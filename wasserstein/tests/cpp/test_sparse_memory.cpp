@@ -0,0 +1,62 @@
+//------------------------------------------------------------------------
+// This file is part of Wasserstein, a C++ library with a Python wrapper
+// that computes the Wasserstein/EMD distance. If you use it for academic
+// research, please cite or acknowledge the following works:
+//
+//   - Komiske, Metodiev, Thaler (2019) arXiv:1902.02346
+//       https://doi.org/10.1103/PhysRevLett.123.041801
+//   - Komiske, Metodiev, Thaler (2020) arXiv:2004.04159
+//       https://doi.org/10.1007/JHEP07%282020%29006
+//   - Boneel, van de Panne, Paris, Heidrich (2011)
+//       https://doi.org/10.1145/2070781.2024192
+//   - LEMON graph library https://lemon.cs.elte.hu/trac/lemon
+//
+// Copyright (C) 2019-2022 Patrick T. Komiske III
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------
+
+// the sparse network simplex and the multiscale solver are the lazy ground distance mode:
+// they compute the costs from the particles as needed, never fill the dense ground distances
+// and keep no more arcs than their neighbors and pricing rounds add
+
+#include "test_utils.hh"
+
+int main() {
+
+  std::mt19937 rng(21);
+
+  // large events with an extra particle on several threads, the initial arcs join each of the
+  // n0 + n1 nodes to n_neighbors nodes and each round adds at most n_neighbors arcs per source
+  EMD<> exact_obj(1, 1, false), sparse_obj(1, 1, false), multiscale_obj(1, 1, false);
+  exact_obj.set_solver(emd::EMDSolver::NetworkSimplex);
+  sparse_obj.set_solver(emd::EMDSolver::SparseNetworkSimplex);
+  sparse_obj.set_num_threads(4, 1);
+  multiscale_obj.set_solver(emd::EMDSolver::Multiscale);
+  multiscale_obj.set_num_threads(4, 1);
+  Event ev0(random_event(rng, 3000)), ev1(random_event(rng, 2900));
+  double exact(exact_obj(ev0, ev1));
+  CHECK_CLOSE(sparse_obj(ev0, ev1), exact, 1e-12);
+  CHECK_CLOSE(multiscale_obj(ev0, ev1), exact, 1e-12);
+  CHECK(sparse_obj.network_simplex().dists().capacity() == 0);
+  CHECK(multiscale_obj.network_simplex().dists().capacity() == 0);
+
+  const emd::SparseNetworkSimplex<double> & sparse(sparse_obj.sparse_network_simplex());
+  std::size_t n0(sparse_obj.n0()), n1(sparse_obj.n1()), n_neighbors(sparse.n_neighbors());
+  CHECK(n0 + n1 == 5901);
+  CHECK(std::size_t(sparse.n_arcs()) <= n_neighbors * (n0 + n1 + sparse.n_rounds() * n0));
+  CHECK(std::size_t(sparse.n_arcs()) < n0 * n1 / 20);
+
+  return test_result("sparse_memory");
+}
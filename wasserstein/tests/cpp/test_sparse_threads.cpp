@@ -0,0 +1,82 @@
+//------------------------------------------------------------------------
+// This file is part of Wasserstein, a C++ library with a Python wrapper
+// that computes the Wasserstein/EMD distance. If you use it for academic
+// research, please cite or acknowledge the following works:
+//
+//   - Komiske, Metodiev, Thaler (2019) arXiv:1902.02346
+//       https://doi.org/10.1103/PhysRevLett.123.041801
+//   - Komiske, Metodiev, Thaler (2020) arXiv:2004.04159
+//       https://doi.org/10.1007/JHEP07%282020%29006
+//   - Boneel, van de Panne, Paris, Heidrich (2011)
+//       https://doi.org/10.1145/2070781.2024192
+//   - LEMON graph library https://lemon.cs.elte.hu/trac/lemon
+//
+// Copyright (C) 2019-2022 Patrick T. Komiske III
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------
+
+// the sparse network simplex and multiscale solvers go through the complete graph of a problem
+// above DEFAULT_MIN_PARALLEL_ARCS with several threads, finding the same arcs, pivots, flows and
+// error bound as with one thread
+
+#include "test_utils.hh"
+
+int main() {
+
+#ifdef _OPENMP
+  // run several threads even where fewer cores are available
+  omp_set_num_threads(4);
+#endif
+
+  // just above the default number of arcs for threads, with an extra particle
+  std::mt19937 rng(21);
+  Event ev0(random_event(rng, 2100)), ev1(random_event(rng, 2000));
+  CHECK(std::size_t(2100 + 1) * 2000 >= emd::DEFAULT_MIN_PARALLEL_ARCS);
+
+  for (emd::EMDSolver solver : {emd::EMDSolver::SparseNetworkSimplex, emd::EMDSolver::Multiscale}) {
+    for (std::size_t max_rounds : {0, 1}) {
+      EMD<> serial_obj, threaded_obj;
+      for (EMD<> * emd_obj : {&serial_obj, &threaded_obj}) {
+        emd_obj->set_solver(solver);
+        emd_obj->sparse_network_simplex().set_max_rounds(max_rounds);
+        emd_obj->multiscale().set_max_rounds(max_rounds);
+      }
+      threaded_obj.set_num_threads(-1);
+      CHECK(threaded_obj.min_parallel_arcs() == emd::DEFAULT_MIN_PARALLEL_ARCS);
+
+      double serial(serial_obj(ev0, ev1)), threaded(threaded_obj(ev0, ev1));
+      CHECK(threaded_obj.last_solver() == solver);
+      CHECK(threaded == serial);
+      CHECK(threaded_obj.n_iter() == serial_obj.n_iter());
+      CHECK(threaded_obj.flows() == serial_obj.flows());
+      CHECK(threaded_obj.sparse_flows() == serial_obj.sparse_flows());
+      if (solver == emd::EMDSolver::SparseNetworkSimplex) {
+        const emd::SparseNetworkSimplex<double> & s(serial_obj.sparse_network_simplex()),
+                                                & t(threaded_obj.sparse_network_simplex());
+        CHECK(t.n_arcs() == s.n_arcs());
+        CHECK(t.n_rounds() == s.n_rounds());
+        CHECK(t.error_bound() == s.error_bound());
+      }
+      else {
+        const emd::Multiscale<double> & s(serial_obj.multiscale()), & t(threaded_obj.multiscale());
+        CHECK(t.n_levels() == s.n_levels());
+        CHECK(t.n_rounds() == s.n_rounds());
+        CHECK(t.error_bound() == s.error_bound());
+      }
+    }
+  }
+
+  return test_result("sparse_threads");
+}
@@ -0,0 +1,133 @@
+//------------------------------------------------------------------------
+// This file is part of Wasserstein, a C++ library with a Python wrapper
+// that computes the Wasserstein/EMD distance. If you use it for academic
+// research, please cite or acknowledge the following works:
+//
+//   - Komiske, Metodiev, Thaler (2019) arXiv:1902.02346
+//       https://doi.org/10.1103/PhysRevLett.123.041801
+//   - Komiske, Metodiev, Thaler (2020) arXiv:2004.04159
+//       https://doi.org/10.1007/JHEP07%282020%29006
+//   - Boneel, van de Panne, Paris, Heidrich (2011)
+//       https://doi.org/10.1145/2070781.2024192
+//   - LEMON graph library https://lemon.cs.elte.hu/trac/lemon
+//
+// Copyright (C) 2019-2022 Patrick T. Komiske III
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------
+
+// the threshold decision mode stops the network simplex once its upper bound is below the
+// threshold or its lower bound is not, on the correct side of the exact EMD, and EMD::within
+// agrees with the exact EMD for thresholds just either side of it
+
+#include "test_utils.hh"
+
+int main() {
+
+  std::mt19937 rng(18);
+
+  // the early exit of the network simplex itself, in the normalized units it works in
+  EMD<> exact_obj(1, 1, true), threshold_obj(1, 1, true);
+  exact_obj.set_solver(emd::EMDSolver::NetworkSimplex);
+  threshold_obj.set_solver(emd::EMDSolver::NetworkSimplex);
+  int below(0), above(0);
+  for (int mult : {20, 100, 300}) {
+    for (int k = 0; k < 5; k++) {
+      Event ev0(random_event(rng, mult)), ev1(random_event(rng, mult + k));
+      double exact(exact_obj(ev0, ev1));
+      for (double factor : {0.5, 0.9, 1.1, 2.0}) {
+        double threshold(factor * exact);
+        threshold_obj.network_simplex().set_cost_threshold(threshold);
+        CHECK(threshold_obj.network_simplex().has_cost_threshold());
+        threshold_obj(ev0, ev1);
+        emd::EMDStatus status(threshold_obj.status());
+        std::pair<double, double> bounds(threshold_obj.emd_bounds());
+        CHECK(bounds.first <= exact + 1e-12 && bounds.second >= exact - 1e-12);
+        if (status == emd::EMDStatus::Approximate) {
+          CHECK(threshold_obj.n_iter() <= exact_obj.n_iter());
+          if (factor > 1) {
+            CHECK(bounds.second < threshold);
+            below++;
+          }
+          else {
+            CHECK(bounds.first >= threshold);
+            above++;
+          }
+        }
+        else {
+          CHECK(status == emd::EMDStatus::Success);
+          CHECK_CLOSE(threshold_obj.emd(), exact, 1e-12);
+        }
+      }
+    }
+  }
+  threshold_obj.network_simplex().set_cost_threshold(std::numeric_limits<double>::max());
+  CHECK(!threshold_obj.network_simplex().has_cost_threshold());
+
+  // both kinds of early exit happen
+  CHECK(below > 0 && above > 0);
+
+  // EMD::within, through the cheap bounds or the network simplex, with or without an extra particle
+  for (bool norm : {true, false}) {
+    EMD<> emd_obj(1, 1, norm), within_obj(1, 1, norm);
+    emd_obj.set_solver(emd::EMDSolver::NetworkSimplex);
+    within_obj.set_solver(emd::EMDSolver::NetworkSimplex);
+    for (int mult : {1, 10, 100, 300}) {
+      for (int k = 0; k < 5; k++) {
+        Event ev0(random_event(rng, mult)), ev1(random_event(rng, mult + 3*k));
+        double exact(emd_obj(ev0, ev1)), eps(1e-9 * std::max(1.0, exact));
+        for (double threshold : {exact - eps, exact + eps, 0.5 * exact, 2 * exact + eps, 0.0})
+          CHECK(within_obj.within(ev0, ev1, threshold) == (exact < threshold));
+
+        // the threshold does not outlive the decision
+        CHECK(!within_obj.network_simplex().has_cost_threshold());
+        CHECK_CLOSE(within_obj(ev0, ev1), exact, 1e-12);
+      }
+    }
+  }
+
+  // the cached signatures are refilled after the particles or weights of an event change
+  EMD<> bounds_obj(1, 1, true);
+  bounds_obj.set_solver(emd::EMDSolver::NetworkSimplex);
+  for (int mult : {5, 50}) {
+    Event ev0(random_event(rng, mult)), ev1(random_event(rng, mult + 7));
+    ev0.normalize_weights();
+    ev1.normalize_weights();
+    bounds_obj.compute_lower_bound(ev0, ev1);
+    bounds_obj.compute_upper_bound(ev0, ev1);
+    CHECK(ev0.signature().filled && ev1.signature().filled);
+
+    // shift and reweight the particles of the first event, then normalize it again
+    double total(0);
+    for (std::size_t i = 0; i < ev0.particles().size(); i++) {
+      ev0.particles()[i][0] += 0.3;
+      total += (ev0.weights()[i] *= 1 + double(i % 3));
+    }
+    ev0.total_weight() = total;
+    ev0.normalize_weights();
+    CHECK(!ev0.signature().filled);
+
+    Event fresh0(ev0);
+    fresh0.reset_signature();
+    double lower(bounds_obj.compute_lower_bound(ev0, ev1)), upper(bounds_obj.compute_upper_bound(ev0, ev1));
+    CHECK_CLOSE(lower, bounds_obj.compute_lower_bound(fresh0, ev1), 1e-14);
+    CHECK_CLOSE(upper, bounds_obj.compute_upper_bound(fresh0, ev1), 1e-14);
+    CHECK_CLOSE(ev0.signature().centroid[0], fresh0.signature().centroid[0], 1e-14);
+
+    double exact(bounds_obj.compute(ev0, ev1) == emd::EMDStatus::Success ? bounds_obj.emd() : -1);
+    CHECK(lower <= exact + 1e-12 && exact <= upper + 1e-12);
+  }
+
+  return test_result("threshold");
+}
@@ -0,0 +1,105 @@
+//------------------------------------------------------------------------
+// This file is part of Wasserstein, a C++ library with a Python wrapper
+// that computes the Wasserstein/EMD distance. If you use it for academic
+// research, please cite or acknowledge the following works:
+//
+//   - Komiske, Metodiev, Thaler (2019) arXiv:1902.02346
+//       https://doi.org/10.1103/PhysRevLett.123.041801
+//   - Komiske, Metodiev, Thaler (2020) arXiv:2004.04159
+//       https://doi.org/10.1007/JHEP07%282020%29006
+//   - Boneel, van de Panne, Paris, Heidrich (2011)
+//       https://doi.org/10.1145/2070781.2024192
+//   - LEMON graph library https://lemon.cs.elte.hu/trac/lemon
+//
+// Copyright (C) 2019-2022 Patrick T. Komiske III
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------
+
+// shared helpers of the C++ tests, each of which compares a solver or an option against
+// the exact dense network simplex on random events and returns nonzero on failure
+
+#ifndef WASSERSTEIN_TEST_UTILS_HH
+#define WASSERSTEIN_TEST_UTILS_HH
+
+// C++ standard library
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+// Wasserstein library
+#include "Wasserstein.hh"
+
+// events are random collections of 2D particles
+using EMDParticle = emd::EuclideanParticle2D<>;
+using Event = emd::EuclideanEvent2D<double>;
+
+// EMD with a configurable network simplex
+template<template<typename> class NetworkSimplex = emd::DefaultNetworkSimplex>
+using EMD = emd::EMD<double, emd::EuclideanEvent2D, emd::EuclideanDistance2D, NetworkSimplex>;
+
+// network simplex with a configurable arc layout and pivot rule
+template<class ArcLayout, class PivotRule = emd::BlockSearchPivotRule>
+struct WithPolicies {
+  template<typename Value>
+  using NetworkSimplex = emd::NetworkSimplex<Value, emd::index_type, int, char, ArcLayout, PivotRule>;
+};
+
+// particles with weights in (0, 1] (or all 1 if uniform) and coordinates in [-0.4, 0.4),
+// placed along the x-axis if one_dimensional
+inline Event random_event(std::mt19937 & rng, int mult, bool uniform = false, bool one_dimensional = false) {
+  std::uniform_real_distribution<double> weight(0, 1), coord(-0.4, 0.4);
+  std::vector<EMDParticle> particles;
+  for (int i = 0; i < mult; i++)
+    particles.emplace_back(uniform ? 1 : 1 - weight(rng), coord(rng), one_dimensional ? 0 : coord(rng));
+  return Event(particles);
+}
+
+// number of failed checks so far
+inline int & test_failures() {
+  static int failures(0);
+  return failures;
+}
+
+inline void report_failure(const std::string & what, const char * file, int line) {
+  std::cerr << file << ':' << line << ": check failed: " << what << '\n';
+  test_failures()++;
+}
+
+#define CHECK(cond) \
+  do { if (!(cond)) report_failure(#cond, __FILE__, __LINE__); } while (false)
+
+// a and b agree within tol, relative to the larger of them if that exceeds 1
+#define CHECK_CLOSE(a, b, tol) \
+  do { \
+    double check_a(a), check_b(b); \
+    if (!(std::fabs(check_a - check_b) <= (tol) * std::max(1.0, std::max(std::fabs(check_a), std::fabs(check_b))))) \
+      report_failure(std::string(#a " == " #b " within " #tol " (") + std::to_string(check_a) + \
+                     " vs " + std::to_string(check_b) + ")", __FILE__, __LINE__); \
+  } while (false)
+
+// prints the outcome of the test named name, returning the exit status of main
+inline int test_result(const std::string & name) {
+  if (test_failures() > 0) {
+    std::cerr << name << ": " << test_failures() << " checks failed\n";
+    return 1;
+  }
+  std::cout << name << ": passed\n";
+  return 0;
+}
+
+#endif // WASSERSTEIN_TEST_UTILS_HH
@@ -0,0 +1,61 @@
+//------------------------------------------------------------------------
+// This file is part of Wasserstein, a C++ library with a Python wrapper
+// that computes the Wasserstein/EMD distance. If you use it for academic
+// research, please cite or acknowledge the following works:
+//
+//   - Komiske, Metodiev, Thaler (2019) arXiv:1902.02346
+//       https://doi.org/10.1103/PhysRevLett.123.041801
+//   - Komiske, Metodiev, Thaler (2020) arXiv:2004.04159
+//       https://doi.org/10.1007/JHEP07%282020%29006
+//   - Boneel, van de Panne, Paris, Heidrich (2011)
+//       https://doi.org/10.1145/2070781.2024192
+//   - LEMON graph library https://lemon.cs.elte.hu/trac/lemon
+//
+// Copyright (C) 2019-2022 Patrick T. Komiske III
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------
+
+// warm starting the network simplex from the previous problem gives the same EMDs as
+// starting every problem from scratch, as the events change size and weight
+
+#include "test_utils.hh"
+
+int main() {
+
+  std::mt19937 rng(1);
+  for (bool norm : {false, true}) {
+    EMD<> cold_obj(1, 1, norm), warm_obj(1, 1, norm);
+    warm_obj.set_warm_start(true);
+    CHECK(warm_obj.warm_start() && !cold_obj.warm_start());
+
+    // several pairs of each shape in turn, so that some problems can reuse the previous tree
+    for (int mult : {10, 10, 25, 40, 40, 5, 100}) {
+      for (int k = 0; k < 5; k++) {
+        Event ev0(random_event(rng, mult)), ev1(random_event(rng, mult + k));
+        double cold(cold_obj(ev0, ev1)), warm(warm_obj(ev0, ev1));
+        CHECK(warm_obj.status() == emd::EMDStatus::Success);
+        CHECK_CLOSE(warm, cold, 1e-12);
+      }
+    }
+
+    // the same pair solved again from its own optimal tree
+    Event ev0(random_event(rng, 30)), ev1(random_event(rng, 30));
+    double cold(cold_obj(ev0, ev1));
+    CHECK_CLOSE(warm_obj(ev0, ev1), cold, 1e-12);
+    CHECK_CLOSE(warm_obj(ev0, ev1), cold, 1e-12);
+  }
+
+  return test_result("warm_start");
+}
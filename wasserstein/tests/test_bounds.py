@@ -0,0 +1,43 @@
+import numpy as np
+import pytest
+
+import wasserstein
+
+@pytest.mark.bounds
+@pytest.mark.parametrize('norm', [True, False])
+@pytest.mark.parametrize('beta', [0.5, 1.0, 2.0])
+@pytest.mark.parametrize('dim', [1, 2, 3])
+@pytest.mark.parametrize('num_particles', [1, 4, 16, 64])
+def test_bounds(num_particles, dim, beta, norm):
+
+    emd = wasserstein.EMD(beta=beta, norm=norm)
+    for i in range(10):
+        ws0, ws1 = np.random.rand(2, num_particles)
+        coords0, coords1 = 2*np.random.rand(2, num_particles, dim) - 1
+
+        # the bounds bracket the exact EMD, including with an extra particle
+        lower = emd.lower_bound(ws0, coords0, ws1, coords1)
+        upper = emd.upper_bound(ws0, coords0, ws1, coords1)
+        exact = emd(ws0, coords0, ws1, coords1)
+        tol = 1e-12*max(1, exact)
+        assert lower <= exact + tol
+        assert exact <= upper + tol
+
+@pytest.mark.bounds
+@pytest.mark.parametrize('norm', [True, False])
+@pytest.mark.parametrize('beta', [0.5, 1.0, 2.0])
+@pytest.mark.parametrize('num_particles', [1, 4, 16, 64, 256])
+def test_within(num_particles, beta, norm):
+
+    emd = wasserstein.EMD(beta=beta, norm=norm)
+    for i in range(10):
+        ws0, ws1 = np.random.rand(2, num_particles)
+        coords0, coords1 = 2*np.random.rand(2, num_particles, 2) - 1
+
+        # the decision agrees with the exact EMD for thresholds just either side of it
+        exact = emd(ws0, coords0, ws1, coords1)
+        eps = 1e-9*max(1, exact)
+        assert emd.within(ws0, coords0, ws1, coords1, exact + eps)
+        assert not emd.within(ws0, coords0, ws1, coords1, exact - eps)
+        assert emd.within(ws0, coords0, ws1, coords1, 2*exact + 1)
+        assert not emd.within(ws0, coords0, ws1, coords1, 0)
@@ -0,0 +1,18 @@
+import os
+import shutil
+import subprocess
+
+import pytest
+
+# the C++ tests, each built from wasserstein/tests/cpp/test_*.cpp by its Makefile
+CPP_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), 'cpp')
+CPP_TESTS = sorted(os.path.splitext(f)[0] for f in os.listdir(CPP_DIR) if f.startswith('test_') and f.endswith('.cpp'))
+
+@pytest.mark.cpp
+@pytest.mark.skipif(shutil.which('make') is None or shutil.which('g++') is None, reason='needs make and g++')
+@pytest.mark.parametrize('test', CPP_TESTS)
+def test_cpp(test):
+
+    subprocess.run(['make', '-s', 'bin/' + test], cwd=CPP_DIR, check=True)
+    result = subprocess.run([os.path.join(CPP_DIR, 'bin', test)], cwd=CPP_DIR, capture_output=True, text=True)
+    assert result.returncode == 0, result.stdout + result.stderr
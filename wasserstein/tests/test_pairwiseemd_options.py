@@ -0,0 +1,125 @@
+import numpy as np
+import pytest
+
+import wasserstein
+
+# random events of up to max_mult particles, with weights in the first column
+def random_events(num_events, max_mult, dim=2):
+    return [np.random.rand(np.random.randint(1, max_mult + 1), dim + 1) for i in range(num_events)]
+
+# the EMDs of all pairs of events, computed one at a time
+def pairwise_emds(events, **kwargs):
+    emd = wasserstein.EMD(**kwargs)
+    emds = np.zeros((len(events), len(events)))
+    for i in range(len(events)):
+        for j in range(i):
+            emds[i,j] = emds[j,i] = emd(events[i][:,0], events[i][:,1:], events[j][:,0], events[j][:,1:])
+    return emds
+
+@pytest.mark.pairwise_emd
+@pytest.mark.parametrize('store_sym_emds_raw', [True, False])
+def test_symmetric_diagonal(store_sym_emds_raw):
+
+    storage = (wasserstein.EMDPairsStorage_FlattenedSymmetric if store_sym_emds_raw else
+               wasserstein.EMDPairsStorage_FullSymmetric)
+
+    # the full matrix has zeros on its diagonal, also after events of other sizes
+    pairwise_emd = wasserstein.PairwiseEMD(store_sym_emds_raw=store_sym_emds_raw, verbose=False)
+    for num_events in [10, 8, 13, 10]:
+        events = random_events(num_events, 20)
+        pairwise_emd(events)
+        assert pairwise_emd.storage() == storage
+        emds = pairwise_emd.emds()
+        assert emds.shape == (num_events, num_events)
+        assert np.all(np.diag(emds) == 0)
+        assert np.all(np.abs(emds - pairwise_emds(events)) < 1e-14)
+
+@pytest.mark.pairwise_emd
+@pytest.mark.parametrize('huge_pages', [False, True])
+@pytest.mark.parametrize('num_threads', [1, 2, -1])
+def test_reserve(num_threads, huge_pages):
+
+    events = random_events(20, 40)
+    pairwise_emd = wasserstein.PairwiseEMD(num_threads=num_threads, verbose=False)
+    pairwise_emd.reserve(40, huge_pages=huge_pages)
+    pairwise_emd(events)
+    assert np.all(np.abs(pairwise_emd.emds() - pairwise_emds(events)) < 1e-14)
+
+    # events larger than reserved still work
+    events = random_events(10, 80)
+    pairwise_emd(events)
+    assert np.all(np.abs(pairwise_emd.emds() - pairwise_emds(events)) < 1e-14)
+
+@pytest.mark.pairwise_emd
+@pytest.mark.parametrize('num_threads', [1, 2, -1])
+def test_threshold(num_threads):
+
+    events = random_events(20, 40)
+    emds = pairwise_emds(events)
+    threshold = np.median(emds[np.triu_indices(len(events), 1)])
+
+    # the close pairs are those with EMDs below the threshold, sorted with i < j
+    pairwise_emd = wasserstein.PairwiseEMD(num_threads=num_threads, verbose=False)
+    assert not pairwise_emd.has_threshold()
+    pairwise_emd.set_threshold(threshold)
+    assert pairwise_emd.has_threshold() and pairwise_emd.threshold() == threshold
+    pairwise_emd(events)
+    close_pairs = pairwise_emd.close_pairs()
+    assert close_pairs.shape[1] == 2
+    expected = [(i, j) for i in range(len(events)) for j in range(i + 1, len(events)) if emds[i,j] < threshold]
+    assert [tuple(pair) for pair in close_pairs] == expected
+    assert pairwise_emd.storage() == wasserstein.EMDPairsStorage_Threshold
+    with pytest.raises(ValueError):
+        pairwise_emd.emds()
+
+    # two sets of events index the first with i
+    pairwise_emd(events[:8], events[8:])
+    expected = [(i, j) for i in range(8) for j in range(len(events) - 8) if emds[i,8+j] < threshold]
+    assert [tuple(pair) for pair in pairwise_emd.close_pairs()] == expected
+
+    # disabling the threshold stores the EMDs again
+    pairwise_emd.set_threshold()
+    assert not pairwise_emd.has_threshold()
+    pairwise_emd(events)
+    assert np.all(np.abs(pairwise_emd.emds() - emds) < 1e-14)
+
+@pytest.mark.pairwise_emd
+@pytest.mark.parametrize('store_sym_emds_raw', [True, False])
+@pytest.mark.parametrize('num_threads', [1, 2, -1])
+def test_sweep(num_threads, store_sym_emds_raw):
+
+    events = random_events(15, 30)
+    Rs, betas = np.meshgrid([0.8, 1., 1.5], [0.5, 1., 1.5, 2.])
+    Rs, betas = Rs.flatten(), betas.flatten()
+
+    pairwise_emd = wasserstein.PairwiseEMD(num_threads=num_threads, store_sym_emds_raw=store_sym_emds_raw,
+                                           verbose=False)
+    assert not pairwise_emd.has_sweep()
+    pairwise_emd.set_sweep(Rs, betas)
+    assert pairwise_emd.has_sweep()
+    pairwise_emd(events)
+    assert pairwise_emd.storage() == wasserstein.EMDPairsStorage_Sweep
+
+    # each point of the sweep matches EMDs computed independently at its (R, beta)
+    for p, (R, beta) in enumerate(zip(Rs, betas)):
+        emds = pairwise_emds(events, R=R, beta=beta)
+        assert np.all(np.abs(pairwise_emd.sweep_emds(p) - emds) < 1e-12)
+
+    # two sets of events
+    pairwise_emd(events[:6], events[6:])
+    for p, (R, beta) in enumerate(zip(Rs, betas)):
+        emds = pairwise_emds(events, R=R, beta=beta)
+        assert np.all(np.abs(pairwise_emd.sweep_emds(p) - emds[:6,6:]) < 1e-12)
+
+    with pytest.raises(IndexError):
+        pairwise_emd.sweep_emds(len(Rs))
+    with pytest.raises(ValueError):
+        pairwise_emd.set_sweep(Rs, betas[1:])
+
+    # disabling the sweep stores the EMDs at R and beta again
+    pairwise_emd.set_sweep(np.zeros(0), np.zeros(0))
+    assert not pairwise_emd.has_sweep()
+    pairwise_emd(events)
+    assert np.all(np.abs(pairwise_emd.emds() - pairwise_emds(events)) < 1e-14)
+    with pytest.raises(ValueError):
+        pairwise_emd.sweep_emds(0)
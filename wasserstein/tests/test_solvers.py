@@ -0,0 +1,134 @@
+import numpy as np
+import pytest
+
+import wasserstein
+
+# the exact EMD from the dense network simplex
+def exact_emd(ws0, coords0, ws1, coords1, **kwargs):
+    emd = wasserstein.EMD(**kwargs)
+    emd.set_solver(wasserstein.EMDSolver_NetworkSimplex)
+    return emd(ws0, coords0, ws1, coords1)
+
+@pytest.mark.solvers
+@pytest.mark.parametrize('solver', ['EMDSolver_Auto', 'EMDSolver_NetworkSimplex', 'EMDSolver_Sorted1D', 'EMDSolver_Auction',
+                                    'EMDSolver_SparseNetworkSimplex', 'EMDSolver_Multiscale'])
+def test_set_solver(solver):
+
+    emd = wasserstein.EMD()
+    assert emd.solver() == wasserstein.EMDSolver_Auto
+    emd.set_solver(getattr(wasserstein, solver))
+    assert emd.solver() == getattr(wasserstein, solver)
+
+    pairwise_emd = wasserstein.PairwiseEMD()
+    pairwise_emd.set_solver(getattr(wasserstein, solver))
+    assert pairwise_emd.solver() == getattr(wasserstein, solver)
+
+@pytest.mark.solvers
+@pytest.mark.parametrize('num_particles', [1, 5, 20, 60])
+def test_auction(num_particles):
+
+    emd = wasserstein.EMD()
+    emd.set_solver(wasserstein.EMDSolver_Auction)
+    for i in range(5):
+        ws = np.ones(num_particles)
+        coords0, coords1 = np.random.rand(2, num_particles, 2)
+
+        # within the final epsilon (1e-9 of the range of the distances) times the total weight
+        exact = exact_emd(ws, coords0, ws, coords1)
+        assert abs(emd(ws, coords0, ws, coords1) - exact) <= 1e-9*num_particles*np.sqrt(2) + 1e-12
+        assert emd.last_solver() == wasserstein.EMDSolver_Auction
+
+    # unequal weights are left to the network simplex
+    ws0 = np.random.rand(num_particles)
+    assert abs(emd(ws0, coords0, ws, coords1) - exact_emd(ws0, coords0, ws, coords1)) < 1e-12
+    assert emd.last_solver() == wasserstein.EMDSolver_NetworkSimplex
+
+@pytest.mark.solvers
+@pytest.mark.parametrize('num_particles', [1, 2, 5, 20, 60])
+def test_auction_float32(num_particles):
+
+    # the final epsilon is kept above the resolution of the float prices
+    np.random.seed(1)
+    emd = wasserstein.EMDFloat32()
+    emd.set_solver(wasserstein.EMDSolver_Auction)
+    for i in range(20):
+        ws = np.ones(num_particles, dtype=np.float32)
+        coords0, coords1 = np.random.rand(2, num_particles, 2).astype(np.float32)
+        exact = exact_emd(ws.astype(np.float64), coords0.astype(np.float64),
+                          ws.astype(np.float64), coords1.astype(np.float64))
+        assert abs(emd(ws, coords0, ws, coords1) - exact) <= 1e-5*max(1, exact)
+        assert emd.last_solver() == wasserstein.EMDSolver_Auction
+
+@pytest.mark.solvers
+@pytest.mark.parametrize('norm', [True, False])
+@pytest.mark.parametrize('num_particles', [1, 10, 100, 300])
+def test_sparse_network_simplex(num_particles, norm):
+
+    emd = wasserstein.EMD(norm=norm)
+    emd.set_solver(wasserstein.EMDSolver_SparseNetworkSimplex)
+    for i in range(3):
+        ws0, ws1 = np.random.rand(2, num_particles)
+        coords0, coords1 = np.random.rand(2, num_particles, 2)
+
+        # exact, including with an extra particle
+        exact = exact_emd(ws0, coords0, ws1, coords1, norm=norm)
+        assert abs(emd(ws0, coords0, ws1, coords1) - exact) <= 1e-12*max(1, exact)
+        assert emd.last_solver() == wasserstein.EMDSolver_SparseNetworkSimplex
+        assert emd.status() == wasserstein.EMDStatus_Success
+
+        # external distances go through the same solver, which needs equal total weights
+        ws1 *= np.sum(ws0)/np.sum(ws1)
+        dists = np.linalg.norm(coords0[:,None] - coords1[None], axis=-1)
+        exact = exact_emd(ws0, coords0, ws1, coords1, norm=norm)
+        assert abs(emd(ws0, ws1, dists) - exact) <= 1e-12*max(1, exact)
+
+@pytest.mark.solvers
+@pytest.mark.parametrize('norm', [True, False])
+@pytest.mark.parametrize('num_particles', [1, 10, 100, 300])
+def test_multiscale(num_particles, norm):
+
+    emd = wasserstein.EMD(norm=norm)
+    emd.set_solver(wasserstein.EMDSolver_Multiscale)
+    for i in range(3):
+        ws0, ws1 = np.random.rand(2, num_particles)
+        coords0, coords1 = np.random.rand(2, num_particles, 2)
+
+        # exact, including with an extra particle
+        exact = exact_emd(ws0, coords0, ws1, coords1, norm=norm)
+        assert abs(emd(ws0, coords0, ws1, coords1) - exact) <= 1e-12*max(1, exact)
+        assert emd.last_solver() == wasserstein.EMDSolver_Multiscale
+        assert emd.status() == wasserstein.EMDStatus_Success
+
+@pytest.mark.solvers
+@pytest.mark.flows
+@pytest.mark.parametrize('norm', [True, False])
+@pytest.mark.parametrize('uniform', [True, False])
+@pytest.mark.parametrize('solver', ['EMDSolver_NetworkSimplex', 'EMDSolver_Sorted1D', 'EMDSolver_Auction',
+                                    'EMDSolver_SparseNetworkSimplex', 'EMDSolver_Multiscale'])
+def test_sparse_flows(solver, uniform, norm):
+
+    emd = wasserstein.EMD(norm=norm)
+    emd.set_solver(getattr(wasserstein, solver))
+    for n0, n1 in [(1, 1), (5, 5), (20, 12), (9, 40), (150, 150)]:
+        ws0, ws1 = (np.ones(n0), np.ones(n1)) if uniform else (np.random.rand(n0), np.random.rand(n1))
+        coords0, coords1 = np.random.rand(n0, 1), np.random.rand(n1, 1)
+        if solver != 'EMDSolver_Sorted1D':
+            coords0, coords1 = np.random.rand(n0, 2), np.random.rand(n1, 2)
+        emd(ws0, coords0, ws1, coords1)
+
+        # scattering the triplets back gives the dense flows exactly, with any extra particle
+        inds, vals = emd.sparse_flows()
+        assert inds.shape == (len(vals), 2) and np.all(vals != 0)
+        flows = np.zeros((emd.n0(), emd.n1()))
+        flows[inds[:,0], inds[:,1]] = vals
+        assert np.array_equal(flows, emd.flows())
+        assert np.count_nonzero(emd.flows()) == len(vals)
+
+        # in row-major order
+        assert np.all(np.diff(inds[:,0]*emd.n1() + inds[:,1]) > 0)
+
+        # the extra particle takes the difference in total weight
+        if not norm and np.sum(ws0) != np.sum(ws1):
+            assert emd.n0() + emd.n1() == n0 + n1 + 1
+            extra = flows[-1] if emd.n0() > n0 else flows[:,-1]
+            assert abs(np.sum(extra) - abs(np.sum(ws0) - np.sum(ws1))) <= 1e-12*max(1, np.sum(ws0))
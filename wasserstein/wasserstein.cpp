@@ -5583,7 +5583,7 @@ SWIG_AsVal_bool (PyObject *obj, bool *val)
 
 
 SWIGINTERN void wasserstein_EMDBase_Sl_double_Sg__npy_flows(wasserstein::EMDBase< double > *self,double **arr_out,std::ptrdiff_t *n0,std::ptrdiff_t *n1){
-    /*@SWIG:wasserstein/swig/wasserstein_common.i,178,MALLOC_2D_VALUE_ARRAY@*/
+    /*@SWIG:wasserstein/swig/wasserstein_common.i,189,MALLOC_2D_VALUE_ARRAY@*/
   *n0 = self->n0();
   *n1 = self->n1();
   size_t num_elements = size_t(*n0)*size_t(*n1);
@@ -5598,8 +5598,32 @@ SWIGINTERN void wasserstein_EMDBase_Sl_double_Sg__npy_flows(wasserstein::EMDBase
     for (size_t i = 0; i < num_elements; i++)
       values[i] *= self->scale();
   }
+SWIGINTERN void wasserstein_EMDBase_Sl_double_Sg__npy_sparse_flows(wasserstein::EMDBase< double > *self,std::ptrdiff_t **inds_out,std::ptrdiff_t *n0,std::ptrdiff_t *n1,double **arr_out2,std::ptrdiff_t *n2){
+    auto coo(self->sparse_flows());
+    *n0 = coo.second.size();
+    *n1 = 2;
+    size_t nbytes = size_t(*n0)*2*sizeof(std::ptrdiff_t);
+    std::ptrdiff_t * inds = (std::ptrdiff_t *) malloc(nbytes);
+    if (inds == NULL)
+      throw std::runtime_error("Failed to allocate " + std::to_string(nbytes) + " bytes");
+    for (size_t k = 0; k < coo.first.size(); k++) {
+      inds[2*k] = coo.first[k].first;
+      inds[2*k + 1] = coo.first[k].second;
+    }
+    *inds_out = inds;
+    /*@SWIG:wasserstein/swig/wasserstein_common.i,157,MALLOC_1D_VALUE_ARRAY@*/
+  *n2 = coo.second.size();
+  size_t nbytes2 = size_t(*n2)*sizeof(double);
+  *arr_out2 = (double *) malloc(nbytes2);
+  if (*arr_out2 == NULL) {
+    throw std::runtime_error("Failed to allocate " + std::to_string(nbytes2) + " bytes");
+    return;
+  }
+/*@SWIG@*/
+    memcpy(*arr_out2, coo.second.data(), nbytes2);
+  }
 SWIGINTERN void wasserstein_EMDBase_Sl_double_Sg__npy_dists(wasserstein::EMDBase< double > *self,double **arr_out,std::ptrdiff_t *n0,std::ptrdiff_t *n1){
-    /*@SWIG:wasserstein/swig/wasserstein_common.i,178,MALLOC_2D_VALUE_ARRAY@*/
+    /*@SWIG:wasserstein/swig/wasserstein_common.i,189,MALLOC_2D_VALUE_ARRAY@*/
   *n0 = self->n0();
   *n1 = self->n1();
   size_t num_elements = size_t(*n0)*size_t(*n1);
@@ -5612,8 +5636,8 @@ SWIGINTERN void wasserstein_EMDBase_Sl_double_Sg__npy_dists(wasserstein::EMDBase
     memcpy(*arr_out, self->ground_dists().data(), nbytes);
   }
 SWIGINTERN void wasserstein_EMDBase_Sl_double_Sg__npy_node_potentials(wasserstein::EMDBase< double > *self,double **arr_out0,std::ptrdiff_t *n0,double **arr_out1,std::ptrdiff_t *n1){
-    /*@SWIG:wasserstein/swig/wasserstein_common.i,163,PAIRED_1DNUMPY_FROM_VECPAIR@*/
-  /*@SWIG:wasserstein/swig/wasserstein_common.i,146,MALLOC_1D_VALUE_ARRAY@*/
+    /*@SWIG:wasserstein/swig/wasserstein_common.i,174,PAIRED_1DNUMPY_FROM_VECPAIR@*/
+  /*@SWIG:wasserstein/swig/wasserstein_common.i,157,MALLOC_1D_VALUE_ARRAY@*/
   *n0 = self->n0();
   size_t nbytes0 = size_t(*n0)*sizeof(double);
   *arr_out0 = (double *) malloc(nbytes0);
@@ -5622,7 +5646,7 @@ SWIGINTERN void wasserstein_EMDBase_Sl_double_Sg__npy_node_potentials(wasserstei
     return;
   }
 /*@SWIG@*/
-  /*@SWIG:wasserstein/swig/wasserstein_common.i,146,MALLOC_1D_VALUE_ARRAY@*/
+  /*@SWIG:wasserstein/swig/wasserstein_common.i,157,MALLOC_1D_VALUE_ARRAY@*/
   *n1 = self->n1();
   size_t nbytes1 = size_t(*n1)*sizeof(double);
   *arr_out1 = (double *) malloc(nbytes1);
@@ -5637,7 +5661,7 @@ SWIGINTERN void wasserstein_EMDBase_Sl_double_Sg__npy_node_potentials(wasserstei
 /*@SWIG@*/
   }
 SWIGINTERN void wasserstein_PairwiseEMDBase_Sl_double_Sg__npy_emds(wasserstein::PairwiseEMDBase< double > *self,double **arr_out,std::ptrdiff_t *n0,std::ptrdiff_t *n1){
-    /*@SWIG:wasserstein/swig/wasserstein_common.i,178,MALLOC_2D_VALUE_ARRAY@*/
+    /*@SWIG:wasserstein/swig/wasserstein_common.i,189,MALLOC_2D_VALUE_ARRAY@*/
   *n0 = self->nevA();
   *n1 = self->nevB();
   size_t num_elements = size_t(*n0)*size_t(*n1);
@@ -5653,7 +5677,7 @@ SWIGINTERN void wasserstein_PairwiseEMDBase_Sl_double_Sg__raw_emds(wasserstein::
     if (self->storage() != wasserstein::EMDPairsStorage::FlattenedSymmetric)
       throw std::runtime_error("raw emds only available with raw symmetric storage");
 
-    /*@SWIG:wasserstein/swig/wasserstein_common.i,146,MALLOC_1D_VALUE_ARRAY@*/
+    /*@SWIG:wasserstein/swig/wasserstein_common.i,157,MALLOC_1D_VALUE_ARRAY@*/
   *n0 = self->num_emds();
   size_t nbytes = size_t(*n0)*sizeof(double);
   *arr_out0 = (double *) malloc(nbytes);
@@ -6121,7 +6145,7 @@ SWIGINTERN std::string wasserstein_Histogram1DHandler_Sl_boost_histogram_axis_tr
     return self->description();
   }
 SWIGINTERN void wasserstein_Histogram1DHandler_Sl_boost_histogram_axis_transform_log_Sc_double_Sg__npy_bin_centers(wasserstein::Histogram1DHandler< boost::histogram::axis::transform::log,double > *self,double **arr_out0,std::ptrdiff_t *n0){
-    /*@SWIG:wasserstein/swig/wasserstein_common.i,146,MALLOC_1D_VALUE_ARRAY@*/
+    /*@SWIG:wasserstein/swig/wasserstein_common.i,157,MALLOC_1D_VALUE_ARRAY@*/
   *n0 = self->nbins();
   size_t nbytes = size_t(*n0)*sizeof(double);
   *arr_out0 = (double *) malloc(nbytes);
@@ -6133,7 +6157,7 @@ SWIGINTERN void wasserstein_Histogram1DHandler_Sl_boost_histogram_axis_transform
     memcpy(*arr_out0, self->bin_centers().data(), nbytes);
   }
 SWIGINTERN void wasserstein_Histogram1DHandler_Sl_boost_histogram_axis_transform_log_Sc_double_Sg__npy_bin_edges(wasserstein::Histogram1DHandler< boost::histogram::axis::transform::log,double > *self,double **arr_out0,std::ptrdiff_t *n0){
-    /*@SWIG:wasserstein/swig/wasserstein_common.i,146,MALLOC_1D_VALUE_ARRAY@*/
+    /*@SWIG:wasserstein/swig/wasserstein_common.i,157,MALLOC_1D_VALUE_ARRAY@*/
   *n0 = self->nbins() + 1;
   size_t nbytes = size_t(*n0)*sizeof(double);
   *arr_out0 = (double *) malloc(nbytes);
@@ -6146,8 +6170,8 @@ SWIGINTERN void wasserstein_Histogram1DHandler_Sl_boost_histogram_axis_transform
   }
 SWIGINTERN void wasserstein_Histogram1DHandler_Sl_boost_histogram_axis_transform_log_Sc_double_Sg__npy_hist_vals_vars(wasserstein::Histogram1DHandler< boost::histogram::axis::transform::log,double > *self,double **arr_out0,std::ptrdiff_t *n0,double **arr_out1,std::ptrdiff_t *n1,bool overflows=true){
     unsigned nbins = self->nbins() + (overflows ? 2 : 0);
-    /*@SWIG:wasserstein/swig/wasserstein_common.i,163,PAIRED_1DNUMPY_FROM_VECPAIR@*/
-  /*@SWIG:wasserstein/swig/wasserstein_common.i,146,MALLOC_1D_VALUE_ARRAY@*/
+    /*@SWIG:wasserstein/swig/wasserstein_common.i,174,PAIRED_1DNUMPY_FROM_VECPAIR@*/
+  /*@SWIG:wasserstein/swig/wasserstein_common.i,157,MALLOC_1D_VALUE_ARRAY@*/
   *n0 = nbins;
   size_t nbytes0 = size_t(*n0)*sizeof(double);
   *arr_out0 = (double *) malloc(nbytes0);
@@ -6156,7 +6180,7 @@ SWIGINTERN void wasserstein_Histogram1DHandler_Sl_boost_histogram_axis_transform
     return;
   }
 /*@SWIG@*/
-  /*@SWIG:wasserstein/swig/wasserstein_common.i,146,MALLOC_1D_VALUE_ARRAY@*/
+  /*@SWIG:wasserstein/swig/wasserstein_common.i,157,MALLOC_1D_VALUE_ARRAY@*/
   *n1 = nbins;
   size_t nbytes1 = size_t(*n1)*sizeof(double);
   *arr_out1 = (double *) malloc(nbytes1);
@@ -6174,7 +6198,7 @@ SWIGINTERN std::string wasserstein_Histogram1DHandler_Sl_boost_histogram_axis_tr
     return self->description();
   }
 SWIGINTERN void wasserstein_Histogram1DHandler_Sl_boost_histogram_axis_transform_id_Sc_double_Sg__npy_bin_centers(wasserstein::Histogram1DHandler< boost::histogram::axis::transform::id,double > *self,double **arr_out0,std::ptrdiff_t *n0){
-    /*@SWIG:wasserstein/swig/wasserstein_common.i,146,MALLOC_1D_VALUE_ARRAY@*/
+    /*@SWIG:wasserstein/swig/wasserstein_common.i,157,MALLOC_1D_VALUE_ARRAY@*/
   *n0 = self->nbins();
   size_t nbytes = size_t(*n0)*sizeof(double);
   *arr_out0 = (double *) malloc(nbytes);
@@ -6186,7 +6210,7 @@ SWIGINTERN void wasserstein_Histogram1DHandler_Sl_boost_histogram_axis_transform
     memcpy(*arr_out0, self->bin_centers().data(), nbytes);
   }
 SWIGINTERN void wasserstein_Histogram1DHandler_Sl_boost_histogram_axis_transform_id_Sc_double_Sg__npy_bin_edges(wasserstein::Histogram1DHandler< boost::histogram::axis::transform::id,double > *self,double **arr_out0,std::ptrdiff_t *n0){
-    /*@SWIG:wasserstein/swig/wasserstein_common.i,146,MALLOC_1D_VALUE_ARRAY@*/
+    /*@SWIG:wasserstein/swig/wasserstein_common.i,157,MALLOC_1D_VALUE_ARRAY@*/
   *n0 = self->nbins() + 1;
   size_t nbytes = size_t(*n0)*sizeof(double);
   *arr_out0 = (double *) malloc(nbytes);
@@ -6199,8 +6223,8 @@ SWIGINTERN void wasserstein_Histogram1DHandler_Sl_boost_histogram_axis_transform
   }
 SWIGINTERN void wasserstein_Histogram1DHandler_Sl_boost_histogram_axis_transform_id_Sc_double_Sg__npy_hist_vals_vars(wasserstein::Histogram1DHandler< boost::histogram::axis::transform::id,double > *self,double **arr_out0,std::ptrdiff_t *n0,double **arr_out1,std::ptrdiff_t *n1,bool overflows=true){
     unsigned nbins = self->nbins() + (overflows ? 2 : 0);
-    /*@SWIG:wasserstein/swig/wasserstein_common.i,163,PAIRED_1DNUMPY_FROM_VECPAIR@*/
-  /*@SWIG:wasserstein/swig/wasserstein_common.i,146,MALLOC_1D_VALUE_ARRAY@*/
+    /*@SWIG:wasserstein/swig/wasserstein_common.i,174,PAIRED_1DNUMPY_FROM_VECPAIR@*/
+  /*@SWIG:wasserstein/swig/wasserstein_common.i,157,MALLOC_1D_VALUE_ARRAY@*/
   *n0 = nbins;
   size_t nbytes0 = size_t(*n0)*sizeof(double);
   *arr_out0 = (double *) malloc(nbytes0);
@@ -6209,7 +6233,7 @@ SWIGINTERN void wasserstein_Histogram1DHandler_Sl_boost_histogram_axis_transform
     return;
   }
 /*@SWIG@*/
-  /*@SWIG:wasserstein/swig/wasserstein_common.i,146,MALLOC_1D_VALUE_ARRAY@*/
+  /*@SWIG:wasserstein/swig/wasserstein_common.i,157,MALLOC_1D_VALUE_ARRAY@*/
   *n1 = nbins;
   size_t nbytes1 = size_t(*n1)*sizeof(double);
   *arr_out1 = (double *) malloc(nbytes1);
@@ -6224,7 +6248,7 @@ SWIGINTERN void wasserstein_Histogram1DHandler_Sl_boost_histogram_axis_transform
 /*@SWIG@*/
   }
 SWIGINTERN void wasserstein_EMDBase_Sl_float_Sg__npy_flows(wasserstein::EMDBase< float > *self,float **arr_out,std::ptrdiff_t *n0,std::ptrdiff_t *n1){
-    /*@SWIG:wasserstein/swig/wasserstein_common.i,178,MALLOC_2D_VALUE_ARRAY@*/
+    /*@SWIG:wasserstein/swig/wasserstein_common.i,189,MALLOC_2D_VALUE_ARRAY@*/
   *n0 = self->n0();
   *n1 = self->n1();
   size_t num_elements = size_t(*n0)*size_t(*n1);
@@ -6239,8 +6263,32 @@ SWIGINTERN void wasserstein_EMDBase_Sl_float_Sg__npy_flows(wasserstein::EMDBase<
     for (size_t i = 0; i < num_elements; i++)
       values[i] *= self->scale();
   }
+SWIGINTERN void wasserstein_EMDBase_Sl_float_Sg__npy_sparse_flows(wasserstein::EMDBase< float > *self,std::ptrdiff_t **inds_out,std::ptrdiff_t *n0,std::ptrdiff_t *n1,float **arr_out2,std::ptrdiff_t *n2){
+    auto coo(self->sparse_flows());
+    *n0 = coo.second.size();
+    *n1 = 2;
+    size_t nbytes = size_t(*n0)*2*sizeof(std::ptrdiff_t);
+    std::ptrdiff_t * inds = (std::ptrdiff_t *) malloc(nbytes);
+    if (inds == NULL)
+      throw std::runtime_error("Failed to allocate " + std::to_string(nbytes) + " bytes");
+    for (size_t k = 0; k < coo.first.size(); k++) {
+      inds[2*k] = coo.first[k].first;
+      inds[2*k + 1] = coo.first[k].second;
+    }
+    *inds_out = inds;
+    /*@SWIG:wasserstein/swig/wasserstein_common.i,157,MALLOC_1D_VALUE_ARRAY@*/
+  *n2 = coo.second.size();
+  size_t nbytes2 = size_t(*n2)*sizeof(float);
+  *arr_out2 = (float *) malloc(nbytes2);
+  if (*arr_out2 == NULL) {
+    throw std::runtime_error("Failed to allocate " + std::to_string(nbytes2) + " bytes");
+    return;
+  }
+/*@SWIG@*/
+    memcpy(*arr_out2, coo.second.data(), nbytes2);
+  }
 SWIGINTERN void wasserstein_EMDBase_Sl_float_Sg__npy_dists(wasserstein::EMDBase< float > *self,float **arr_out,std::ptrdiff_t *n0,std::ptrdiff_t *n1){
-    /*@SWIG:wasserstein/swig/wasserstein_common.i,178,MALLOC_2D_VALUE_ARRAY@*/
+    /*@SWIG:wasserstein/swig/wasserstein_common.i,189,MALLOC_2D_VALUE_ARRAY@*/
   *n0 = self->n0();
   *n1 = self->n1();
   size_t num_elements = size_t(*n0)*size_t(*n1);
@@ -6253,8 +6301,8 @@ SWIGINTERN void wasserstein_EMDBase_Sl_float_Sg__npy_dists(wasserstein::EMDBase<
     memcpy(*arr_out, self->ground_dists().data(), nbytes);
   }
 SWIGINTERN void wasserstein_EMDBase_Sl_float_Sg__npy_node_potentials(wasserstein::EMDBase< float > *self,float **arr_out0,std::ptrdiff_t *n0,float **arr_out1,std::ptrdiff_t *n1){
-    /*@SWIG:wasserstein/swig/wasserstein_common.i,163,PAIRED_1DNUMPY_FROM_VECPAIR@*/
-  /*@SWIG:wasserstein/swig/wasserstein_common.i,146,MALLOC_1D_VALUE_ARRAY@*/
+    /*@SWIG:wasserstein/swig/wasserstein_common.i,174,PAIRED_1DNUMPY_FROM_VECPAIR@*/
+  /*@SWIG:wasserstein/swig/wasserstein_common.i,157,MALLOC_1D_VALUE_ARRAY@*/
   *n0 = self->n0();
   size_t nbytes0 = size_t(*n0)*sizeof(float);
   *arr_out0 = (float *) malloc(nbytes0);
@@ -6263,7 +6311,7 @@ SWIGINTERN void wasserstein_EMDBase_Sl_float_Sg__npy_node_potentials(wasserstein
     return;
   }
 /*@SWIG@*/
-  /*@SWIG:wasserstein/swig/wasserstein_common.i,146,MALLOC_1D_VALUE_ARRAY@*/
+  /*@SWIG:wasserstein/swig/wasserstein_common.i,157,MALLOC_1D_VALUE_ARRAY@*/
   *n1 = self->n1();
   size_t nbytes1 = size_t(*n1)*sizeof(float);
   *arr_out1 = (float *) malloc(nbytes1);
@@ -6278,7 +6326,7 @@ SWIGINTERN void wasserstein_EMDBase_Sl_float_Sg__npy_node_potentials(wasserstein
 /*@SWIG@*/
   }
 SWIGINTERN void wasserstein_PairwiseEMDBase_Sl_float_Sg__npy_emds(wasserstein::PairwiseEMDBase< float > *self,float **arr_out,std::ptrdiff_t *n0,std::ptrdiff_t *n1){
-    /*@SWIG:wasserstein/swig/wasserstein_common.i,178,MALLOC_2D_VALUE_ARRAY@*/
+    /*@SWIG:wasserstein/swig/wasserstein_common.i,189,MALLOC_2D_VALUE_ARRAY@*/
   *n0 = self->nevA();
   *n1 = self->nevB();
   size_t num_elements = size_t(*n0)*size_t(*n1);
@@ -6294,7 +6342,7 @@ SWIGINTERN void wasserstein_PairwiseEMDBase_Sl_float_Sg__raw_emds(wasserstein::P
     if (self->storage() != wasserstein::EMDPairsStorage::FlattenedSymmetric)
       throw std::runtime_error("raw emds only available with raw symmetric storage");
 
-    /*@SWIG:wasserstein/swig/wasserstein_common.i,146,MALLOC_1D_VALUE_ARRAY@*/
+    /*@SWIG:wasserstein/swig/wasserstein_common.i,157,MALLOC_1D_VALUE_ARRAY@*/
   *n0 = self->num_emds();
   size_t nbytes = size_t(*n0)*sizeof(float);
   *arr_out0 = (float *) malloc(nbytes);
@@ -6342,7 +6390,7 @@ SWIGINTERN std::string wasserstein_Histogram1DHandler_Sl_boost_histogram_axis_tr
     return self->description();
   }
 SWIGINTERN void wasserstein_Histogram1DHandler_Sl_boost_histogram_axis_transform_log_Sc_float_Sg__npy_bin_centers(wasserstein::Histogram1DHandler< boost::histogram::axis::transform::log,float > *self,float **arr_out0,std::ptrdiff_t *n0){
-    /*@SWIG:wasserstein/swig/wasserstein_common.i,146,MALLOC_1D_VALUE_ARRAY@*/
+    /*@SWIG:wasserstein/swig/wasserstein_common.i,157,MALLOC_1D_VALUE_ARRAY@*/
   *n0 = self->nbins();
   size_t nbytes = size_t(*n0)*sizeof(float);
   *arr_out0 = (float *) malloc(nbytes);
@@ -6354,7 +6402,7 @@ SWIGINTERN void wasserstein_Histogram1DHandler_Sl_boost_histogram_axis_transform
     memcpy(*arr_out0, self->bin_centers().data(), nbytes);
   }
 SWIGINTERN void wasserstein_Histogram1DHandler_Sl_boost_histogram_axis_transform_log_Sc_float_Sg__npy_bin_edges(wasserstein::Histogram1DHandler< boost::histogram::axis::transform::log,float > *self,float **arr_out0,std::ptrdiff_t *n0){
-    /*@SWIG:wasserstein/swig/wasserstein_common.i,146,MALLOC_1D_VALUE_ARRAY@*/
+    /*@SWIG:wasserstein/swig/wasserstein_common.i,157,MALLOC_1D_VALUE_ARRAY@*/
   *n0 = self->nbins() + 1;
   size_t nbytes = size_t(*n0)*sizeof(float);
   *arr_out0 = (float *) malloc(nbytes);
@@ -6367,8 +6415,8 @@ SWIGINTERN void wasserstein_Histogram1DHandler_Sl_boost_histogram_axis_transform
   }
 SWIGINTERN void wasserstein_Histogram1DHandler_Sl_boost_histogram_axis_transform_log_Sc_float_Sg__npy_hist_vals_vars(wasserstein::Histogram1DHandler< boost::histogram::axis::transform::log,float > *self,float **arr_out0,std::ptrdiff_t *n0,float **arr_out1,std::ptrdiff_t *n1,bool overflows=true){
     unsigned nbins = self->nbins() + (overflows ? 2 : 0);
-    /*@SWIG:wasserstein/swig/wasserstein_common.i,163,PAIRED_1DNUMPY_FROM_VECPAIR@*/
-  /*@SWIG:wasserstein/swig/wasserstein_common.i,146,MALLOC_1D_VALUE_ARRAY@*/
+    /*@SWIG:wasserstein/swig/wasserstein_common.i,174,PAIRED_1DNUMPY_FROM_VECPAIR@*/
+  /*@SWIG:wasserstein/swig/wasserstein_common.i,157,MALLOC_1D_VALUE_ARRAY@*/
   *n0 = nbins;
   size_t nbytes0 = size_t(*n0)*sizeof(float);
   *arr_out0 = (float *) malloc(nbytes0);
@@ -6377,7 +6425,7 @@ SWIGINTERN void wasserstein_Histogram1DHandler_Sl_boost_histogram_axis_transform
     return;
   }
 /*@SWIG@*/
-  /*@SWIG:wasserstein/swig/wasserstein_common.i,146,MALLOC_1D_VALUE_ARRAY@*/
+  /*@SWIG:wasserstein/swig/wasserstein_common.i,157,MALLOC_1D_VALUE_ARRAY@*/
   *n1 = nbins;
   size_t nbytes1 = size_t(*n1)*sizeof(float);
   *arr_out1 = (float *) malloc(nbytes1);
@@ -6395,7 +6443,7 @@ SWIGINTERN std::string wasserstein_Histogram1DHandler_Sl_boost_histogram_axis_tr
     return self->description();
   }
 SWIGINTERN void wasserstein_Histogram1DHandler_Sl_boost_histogram_axis_transform_id_Sc_float_Sg__npy_bin_centers(wasserstein::Histogram1DHandler< boost::histogram::axis::transform::id,float > *self,float **arr_out0,std::ptrdiff_t *n0){
-    /*@SWIG:wasserstein/swig/wasserstein_common.i,146,MALLOC_1D_VALUE_ARRAY@*/
+    /*@SWIG:wasserstein/swig/wasserstein_common.i,157,MALLOC_1D_VALUE_ARRAY@*/
   *n0 = self->nbins();
   size_t nbytes = size_t(*n0)*sizeof(float);
   *arr_out0 = (float *) malloc(nbytes);
@@ -6407,7 +6455,7 @@ SWIGINTERN void wasserstein_Histogram1DHandler_Sl_boost_histogram_axis_transform
     memcpy(*arr_out0, self->bin_centers().data(), nbytes);
   }
 SWIGINTERN void wasserstein_Histogram1DHandler_Sl_boost_histogram_axis_transform_id_Sc_float_Sg__npy_bin_edges(wasserstein::Histogram1DHandler< boost::histogram::axis::transform::id,float > *self,float **arr_out0,std::ptrdiff_t *n0){
-    /*@SWIG:wasserstein/swig/wasserstein_common.i,146,MALLOC_1D_VALUE_ARRAY@*/
+    /*@SWIG:wasserstein/swig/wasserstein_common.i,157,MALLOC_1D_VALUE_ARRAY@*/
   *n0 = self->nbins() + 1;
   size_t nbytes = size_t(*n0)*sizeof(float);
   *arr_out0 = (float *) malloc(nbytes);
@@ -6420,8 +6468,8 @@ SWIGINTERN void wasserstein_Histogram1DHandler_Sl_boost_histogram_axis_transform
   }
 SWIGINTERN void wasserstein_Histogram1DHandler_Sl_boost_histogram_axis_transform_id_Sc_float_Sg__npy_hist_vals_vars(wasserstein::Histogram1DHandler< boost::histogram::axis::transform::id,float > *self,float **arr_out0,std::ptrdiff_t *n0,float **arr_out1,std::ptrdiff_t *n1,bool overflows=true){
     unsigned nbins = self->nbins() + (overflows ? 2 : 0);
-    /*@SWIG:wasserstein/swig/wasserstein_common.i,163,PAIRED_1DNUMPY_FROM_VECPAIR@*/
-  /*@SWIG:wasserstein/swig/wasserstein_common.i,146,MALLOC_1D_VALUE_ARRAY@*/
+    /*@SWIG:wasserstein/swig/wasserstein_common.i,174,PAIRED_1DNUMPY_FROM_VECPAIR@*/
+  /*@SWIG:wasserstein/swig/wasserstein_common.i,157,MALLOC_1D_VALUE_ARRAY@*/
   *n0 = nbins;
   size_t nbytes0 = size_t(*n0)*sizeof(float);
   *arr_out0 = (float *) malloc(nbytes0);
@@ -6430,7 +6478,7 @@ SWIGINTERN void wasserstein_Histogram1DHandler_Sl_boost_histogram_axis_transform
     return;
   }
 /*@SWIG@*/
-  /*@SWIG:wasserstein/swig/wasserstein_common.i,146,MALLOC_1D_VALUE_ARRAY@*/
+  /*@SWIG:wasserstein/swig/wasserstein_common.i,157,MALLOC_1D_VALUE_ARRAY@*/
   *n1 = nbins;
   size_t nbytes1 = size_t(*n1)*sizeof(float);
   *arr_out1 = (float *) malloc(nbytes1);
@@ -6448,7 +6496,7 @@ SWIGINTERN std::string wasserstein_CorrelationDimension_Sl_float_Sg____repr__(wa
     return self->description();
   }
 SWIGINTERN void wasserstein_CorrelationDimension_Sl_float_Sg__npy_corrdim_bins(wasserstein::CorrelationDimension< float > *self,float **arr_out0,std::ptrdiff_t *n0){
-    /*@SWIG:wasserstein/swig/wasserstein_common.i,146,MALLOC_1D_VALUE_ARRAY@*/
+    /*@SWIG:wasserstein/swig/wasserstein_common.i,157,MALLOC_1D_VALUE_ARRAY@*/
   *n0 = self->nbins() - 1;
   size_t nbytes = size_t(*n0)*sizeof(float);
   *arr_out0 = (float *) malloc(nbytes);
@@ -6460,8 +6508,8 @@ SWIGINTERN void wasserstein_CorrelationDimension_Sl_float_Sg__npy_corrdim_bins(w
     memcpy(*arr_out0, self->corrdim_bins().data(), nbytes);
   }
 SWIGINTERN void wasserstein_CorrelationDimension_Sl_float_Sg__npy_corrdims(wasserstein::CorrelationDimension< float > *self,float **arr_out0,std::ptrdiff_t *n0,float **arr_out1,std::ptrdiff_t *n1){
-    /*@SWIG:wasserstein/swig/wasserstein_common.i,163,PAIRED_1DNUMPY_FROM_VECPAIR@*/
-  /*@SWIG:wasserstein/swig/wasserstein_common.i,146,MALLOC_1D_VALUE_ARRAY@*/
+    /*@SWIG:wasserstein/swig/wasserstein_common.i,174,PAIRED_1DNUMPY_FROM_VECPAIR@*/
+  /*@SWIG:wasserstein/swig/wasserstein_common.i,157,MALLOC_1D_VALUE_ARRAY@*/
   *n0 = self->nbins() - 1;
   size_t nbytes0 = size_t(*n0)*sizeof(float);
   *arr_out0 = (float *) malloc(nbytes0);
@@ -6470,7 +6518,7 @@ SWIGINTERN void wasserstein_CorrelationDimension_Sl_float_Sg__npy_corrdims(wasse
     return;
   }
 /*@SWIG@*/
-  /*@SWIG:wasserstein/swig/wasserstein_common.i,146,MALLOC_1D_VALUE_ARRAY@*/
+  /*@SWIG:wasserstein/swig/wasserstein_common.i,157,MALLOC_1D_VALUE_ARRAY@*/
   *n1 = self->nbins() - 1;
   size_t nbytes1 = size_t(*n1)*sizeof(float);
   *arr_out1 = (float *) malloc(nbytes1);
@@ -6485,8 +6533,8 @@ SWIGINTERN void wasserstein_CorrelationDimension_Sl_float_Sg__npy_corrdims(wasse
 /*@SWIG@*/
   }
 SWIGINTERN void wasserstein_CorrelationDimension_Sl_float_Sg__npy_cumulative_vals_vars(wasserstein::CorrelationDimension< float > *self,float **arr_out0,std::ptrdiff_t *n0,float **arr_out1,std::ptrdiff_t *n1){
-    /*@SWIG:wasserstein/swig/wasserstein_common.i,163,PAIRED_1DNUMPY_FROM_VECPAIR@*/
-  /*@SWIG:wasserstein/swig/wasserstein_common.i,146,MALLOC_1D_VALUE_ARRAY@*/
+    /*@SWIG:wasserstein/swig/wasserstein_common.i,174,PAIRED_1DNUMPY_FROM_VECPAIR@*/
+  /*@SWIG:wasserstein/swig/wasserstein_common.i,157,MALLOC_1D_VALUE_ARRAY@*/
   *n0 = self->nbins();
   size_t nbytes0 = size_t(*n0)*sizeof(float);
   *arr_out0 = (float *) malloc(nbytes0);
@@ -6495,7 +6543,7 @@ SWIGINTERN void wasserstein_CorrelationDimension_Sl_float_Sg__npy_cumulative_val
     return;
   }
 /*@SWIG@*/
-  /*@SWIG:wasserstein/swig/wasserstein_common.i,146,MALLOC_1D_VALUE_ARRAY@*/
+  /*@SWIG:wasserstein/swig/wasserstein_common.i,157,MALLOC_1D_VALUE_ARRAY@*/
   *n1 = self->nbins();
   size_t nbytes1 = size_t(*n1)*sizeof(float);
   *arr_out1 = (float *) malloc(nbytes1);
@@ -6513,7 +6561,7 @@ SWIGINTERN std::string wasserstein_CorrelationDimension_Sl_double_Sg____repr__(w
     return self->description();
   }
 SWIGINTERN void wasserstein_CorrelationDimension_Sl_double_Sg__npy_corrdim_bins(wasserstein::CorrelationDimension< double > *self,double **arr_out0,std::ptrdiff_t *n0){
-    /*@SWIG:wasserstein/swig/wasserstein_common.i,146,MALLOC_1D_VALUE_ARRAY@*/
+    /*@SWIG:wasserstein/swig/wasserstein_common.i,157,MALLOC_1D_VALUE_ARRAY@*/
   *n0 = self->nbins() - 1;
   size_t nbytes = size_t(*n0)*sizeof(double);
   *arr_out0 = (double *) malloc(nbytes);
@@ -6525,8 +6573,8 @@ SWIGINTERN void wasserstein_CorrelationDimension_Sl_double_Sg__npy_corrdim_bins(
     memcpy(*arr_out0, self->corrdim_bins().data(), nbytes);
   }
 SWIGINTERN void wasserstein_CorrelationDimension_Sl_double_Sg__npy_corrdims(wasserstein::CorrelationDimension< double > *self,double **arr_out0,std::ptrdiff_t *n0,double **arr_out1,std::ptrdiff_t *n1){
-    /*@SWIG:wasserstein/swig/wasserstein_common.i,163,PAIRED_1DNUMPY_FROM_VECPAIR@*/
-  /*@SWIG:wasserstein/swig/wasserstein_common.i,146,MALLOC_1D_VALUE_ARRAY@*/
+    /*@SWIG:wasserstein/swig/wasserstein_common.i,174,PAIRED_1DNUMPY_FROM_VECPAIR@*/
+  /*@SWIG:wasserstein/swig/wasserstein_common.i,157,MALLOC_1D_VALUE_ARRAY@*/
   *n0 = self->nbins() - 1;
   size_t nbytes0 = size_t(*n0)*sizeof(double);
   *arr_out0 = (double *) malloc(nbytes0);
@@ -6535,7 +6583,7 @@ SWIGINTERN void wasserstein_CorrelationDimension_Sl_double_Sg__npy_corrdims(wass
     return;
   }
 /*@SWIG@*/
-  /*@SWIG:wasserstein/swig/wasserstein_common.i,146,MALLOC_1D_VALUE_ARRAY@*/
+  /*@SWIG:wasserstein/swig/wasserstein_common.i,157,MALLOC_1D_VALUE_ARRAY@*/
   *n1 = self->nbins() - 1;
   size_t nbytes1 = size_t(*n1)*sizeof(double);
   *arr_out1 = (double *) malloc(nbytes1);
@@ -6550,8 +6598,8 @@ SWIGINTERN void wasserstein_CorrelationDimension_Sl_double_Sg__npy_corrdims(wass
 /*@SWIG@*/
   }
 SWIGINTERN void wasserstein_CorrelationDimension_Sl_double_Sg__npy_cumulative_vals_vars(wasserstein::CorrelationDimension< double > *self,double **arr_out0,std::ptrdiff_t *n0,double **arr_out1,std::ptrdiff_t *n1){
-    /*@SWIG:wasserstein/swig/wasserstein_common.i,163,PAIRED_1DNUMPY_FROM_VECPAIR@*/
-  /*@SWIG:wasserstein/swig/wasserstein_common.i,146,MALLOC_1D_VALUE_ARRAY@*/
+    /*@SWIG:wasserstein/swig/wasserstein_common.i,174,PAIRED_1DNUMPY_FROM_VECPAIR@*/
+  /*@SWIG:wasserstein/swig/wasserstein_common.i,157,MALLOC_1D_VALUE_ARRAY@*/
   *n0 = self->nbins();
   size_t nbytes0 = size_t(*n0)*sizeof(double);
   *arr_out0 = (double *) malloc(nbytes0);
@@ -6560,7 +6608,7 @@ SWIGINTERN void wasserstein_CorrelationDimension_Sl_double_Sg__npy_cumulative_va
     return;
   }
 /*@SWIG@*/
-  /*@SWIG:wasserstein/swig/wasserstein_common.i,146,MALLOC_1D_VALUE_ARRAY@*/
+  /*@SWIG:wasserstein/swig/wasserstein_common.i,157,MALLOC_1D_VALUE_ARRAY@*/
   *n1 = self->nbins();
   size_t nbytes1 = size_t(*n1)*sizeof(double);
   *arr_out1 = (double *) malloc(nbytes1);
@@ -6595,14 +6643,46 @@ SWIGINTERN double wasserstein_EMD_Sl_double_Sc_wasserstein_DefaultArrayEvent_Sc_
       throw std::invalid_argument("Weights and distance matrix are incompatible");
 
     // copy distances into vector for network simplex
+    self->set_external_dists(true);
     std::size_t ndists(std::size_t(d0) * std::size_t(d1));
     self->ground_dists().resize(ndists);
     std::copy(external_dists, external_dists + ndists, self->ground_dists().begin());
 
-    self->set_external_dists(true);
-
     return (*self)(std::make_tuple(weights0, nullptr, n0, -1), std::make_tuple(weights1, nullptr, n1, -1));
   }
+SWIGINTERN double wasserstein_EMD_Sl_double_Sc_wasserstein_DefaultArrayEvent_Sc_wasserstein_EuclideanArrayDistance_Sg__lower_bound(wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *self,double *weights0,std::ptrdiff_t n0,double *coords0,std::ptrdiff_t n00,std::ptrdiff_t n01,double *weights1,std::ptrdiff_t n1,double *coords1,std::ptrdiff_t n10,std::ptrdiff_t n11){
+
+    if (n0 != n00 || n1 != n10)
+      throw std::invalid_argument("Number of weights does not match number of coordinates");
+    if (n01 != n11)
+      throw std::invalid_argument("Coordinate dimensions do not match");
+
+    self->set_external_dists(false);
+
+    return self->lower_bound(std::make_tuple(weights0, coords0, n0, n01), std::make_tuple(weights1, coords1, n1, n11));
+  }
+SWIGINTERN double wasserstein_EMD_Sl_double_Sc_wasserstein_DefaultArrayEvent_Sc_wasserstein_EuclideanArrayDistance_Sg__upper_bound(wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *self,double *weights0,std::ptrdiff_t n0,double *coords0,std::ptrdiff_t n00,std::ptrdiff_t n01,double *weights1,std::ptrdiff_t n1,double *coords1,std::ptrdiff_t n10,std::ptrdiff_t n11){
+
+    if (n0 != n00 || n1 != n10)
+      throw std::invalid_argument("Number of weights does not match number of coordinates");
+    if (n01 != n11)
+      throw std::invalid_argument("Coordinate dimensions do not match");
+
+    self->set_external_dists(false);
+
+    return self->upper_bound(std::make_tuple(weights0, coords0, n0, n01), std::make_tuple(weights1, coords1, n1, n11));
+  }
+SWIGINTERN bool wasserstein_EMD_Sl_double_Sc_wasserstein_DefaultArrayEvent_Sc_wasserstein_EuclideanArrayDistance_Sg__within(wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *self,double *weights0,std::ptrdiff_t n0,double *coords0,std::ptrdiff_t n00,std::ptrdiff_t n01,double *weights1,std::ptrdiff_t n1,double *coords1,std::ptrdiff_t n10,std::ptrdiff_t n11,double threshold){
+
+    if (n0 != n00 || n1 != n10)
+      throw std::invalid_argument("Number of weights does not match number of coordinates");
+    if (n01 != n11)
+      throw std::invalid_argument("Coordinate dimensions do not match");
+
+    self->set_external_dists(false);
+
+    return self->within(std::make_tuple(weights0, coords0, n0, n01), std::make_tuple(weights1, coords1, n1, n11), threshold);
+  }
 SWIGINTERN std::string wasserstein_EMD_Sl_float_Sc_wasserstein_DefaultArrayEvent_Sc_wasserstein_EuclideanArrayDistance_Sg____repr__(wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > const *self){
     return self->description();
   }
@@ -6624,14 +6704,46 @@ SWIGINTERN float wasserstein_EMD_Sl_float_Sc_wasserstein_DefaultArrayEvent_Sc_wa
       throw std::invalid_argument("Weights and distance matrix are incompatible");
 
     // copy distances into vector for network simplex
+    self->set_external_dists(true);
     std::size_t ndists(std::size_t(d0) * std::size_t(d1));
     self->ground_dists().resize(ndists);
     std::copy(external_dists, external_dists + ndists, self->ground_dists().begin());
 
-    self->set_external_dists(true);
-
     return (*self)(std::make_tuple(weights0, nullptr, n0, -1), std::make_tuple(weights1, nullptr, n1, -1));
   }
+SWIGINTERN float wasserstein_EMD_Sl_float_Sc_wasserstein_DefaultArrayEvent_Sc_wasserstein_EuclideanArrayDistance_Sg__lower_bound(wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *self,float *weights0,std::ptrdiff_t n0,float *coords0,std::ptrdiff_t n00,std::ptrdiff_t n01,float *weights1,std::ptrdiff_t n1,float *coords1,std::ptrdiff_t n10,std::ptrdiff_t n11){
+
+    if (n0 != n00 || n1 != n10)
+      throw std::invalid_argument("Number of weights does not match number of coordinates");
+    if (n01 != n11)
+      throw std::invalid_argument("Coordinate dimensions do not match");
+
+    self->set_external_dists(false);
+
+    return self->lower_bound(std::make_tuple(weights0, coords0, n0, n01), std::make_tuple(weights1, coords1, n1, n11));
+  }
+SWIGINTERN float wasserstein_EMD_Sl_float_Sc_wasserstein_DefaultArrayEvent_Sc_wasserstein_EuclideanArrayDistance_Sg__upper_bound(wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *self,float *weights0,std::ptrdiff_t n0,float *coords0,std::ptrdiff_t n00,std::ptrdiff_t n01,float *weights1,std::ptrdiff_t n1,float *coords1,std::ptrdiff_t n10,std::ptrdiff_t n11){
+
+    if (n0 != n00 || n1 != n10)
+      throw std::invalid_argument("Number of weights does not match number of coordinates");
+    if (n01 != n11)
+      throw std::invalid_argument("Coordinate dimensions do not match");
+
+    self->set_external_dists(false);
+
+    return self->upper_bound(std::make_tuple(weights0, coords0, n0, n01), std::make_tuple(weights1, coords1, n1, n11));
+  }
+SWIGINTERN bool wasserstein_EMD_Sl_float_Sc_wasserstein_DefaultArrayEvent_Sc_wasserstein_EuclideanArrayDistance_Sg__within(wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *self,float *weights0,std::ptrdiff_t n0,float *coords0,std::ptrdiff_t n00,std::ptrdiff_t n01,float *weights1,std::ptrdiff_t n1,float *coords1,std::ptrdiff_t n10,std::ptrdiff_t n11,float threshold){
+
+    if (n0 != n00 || n1 != n10)
+      throw std::invalid_argument("Number of weights does not match number of coordinates");
+    if (n01 != n11)
+      throw std::invalid_argument("Coordinate dimensions do not match");
+
+    self->set_external_dists(false);
+
+    return self->within(std::make_tuple(weights0, coords0, n0, n01), std::make_tuple(weights1, coords1, n1, n11), threshold);
+  }
 SWIGINTERN std::string wasserstein_EMD_Sl_double_Sc_wasserstein_DefaultArray2Event_Sc_wasserstein_YPhiArrayDistance_Sg____repr__(wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > const *self){
     return self->description();
   }
@@ -6653,14 +6765,46 @@ SWIGINTERN double wasserstein_EMD_Sl_double_Sc_wasserstein_DefaultArray2Event_Sc
       throw std::invalid_argument("Weights and distance matrix are incompatible");
 
     // copy distances into vector for network simplex
+    self->set_external_dists(true);
     std::size_t ndists(std::size_t(d0) * std::size_t(d1));
     self->ground_dists().resize(ndists);
     std::copy(external_dists, external_dists + ndists, self->ground_dists().begin());
 
-    self->set_external_dists(true);
-
     return (*self)(std::make_tuple(weights0, nullptr, n0, -1), std::make_tuple(weights1, nullptr, n1, -1));
   }
+SWIGINTERN double wasserstein_EMD_Sl_double_Sc_wasserstein_DefaultArray2Event_Sc_wasserstein_YPhiArrayDistance_Sg__lower_bound(wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *self,double *weights0,std::ptrdiff_t n0,double *coords0,std::ptrdiff_t n00,std::ptrdiff_t n01,double *weights1,std::ptrdiff_t n1,double *coords1,std::ptrdiff_t n10,std::ptrdiff_t n11){
+
+    if (n0 != n00 || n1 != n10)
+      throw std::invalid_argument("Number of weights does not match number of coordinates");
+    if (n01 != n11)
+      throw std::invalid_argument("Coordinate dimensions do not match");
+
+    self->set_external_dists(false);
+
+    return self->lower_bound(std::make_tuple(weights0, coords0, n0, n01), std::make_tuple(weights1, coords1, n1, n11));
+  }
+SWIGINTERN double wasserstein_EMD_Sl_double_Sc_wasserstein_DefaultArray2Event_Sc_wasserstein_YPhiArrayDistance_Sg__upper_bound(wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *self,double *weights0,std::ptrdiff_t n0,double *coords0,std::ptrdiff_t n00,std::ptrdiff_t n01,double *weights1,std::ptrdiff_t n1,double *coords1,std::ptrdiff_t n10,std::ptrdiff_t n11){
+
+    if (n0 != n00 || n1 != n10)
+      throw std::invalid_argument("Number of weights does not match number of coordinates");
+    if (n01 != n11)
+      throw std::invalid_argument("Coordinate dimensions do not match");
+
+    self->set_external_dists(false);
+
+    return self->upper_bound(std::make_tuple(weights0, coords0, n0, n01), std::make_tuple(weights1, coords1, n1, n11));
+  }
+SWIGINTERN bool wasserstein_EMD_Sl_double_Sc_wasserstein_DefaultArray2Event_Sc_wasserstein_YPhiArrayDistance_Sg__within(wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *self,double *weights0,std::ptrdiff_t n0,double *coords0,std::ptrdiff_t n00,std::ptrdiff_t n01,double *weights1,std::ptrdiff_t n1,double *coords1,std::ptrdiff_t n10,std::ptrdiff_t n11,double threshold){
+
+    if (n0 != n00 || n1 != n10)
+      throw std::invalid_argument("Number of weights does not match number of coordinates");
+    if (n01 != n11)
+      throw std::invalid_argument("Coordinate dimensions do not match");
+
+    self->set_external_dists(false);
+
+    return self->within(std::make_tuple(weights0, coords0, n0, n01), std::make_tuple(weights1, coords1, n1, n11), threshold);
+  }
 SWIGINTERN std::string wasserstein_EMD_Sl_float_Sc_wasserstein_DefaultArray2Event_Sc_wasserstein_YPhiArrayDistance_Sg____repr__(wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > const *self){
     return self->description();
   }
@@ -6682,18 +6826,63 @@ SWIGINTERN float wasserstein_EMD_Sl_float_Sc_wasserstein_DefaultArray2Event_Sc_w
       throw std::invalid_argument("Weights and distance matrix are incompatible");
 
     // copy distances into vector for network simplex
+    self->set_external_dists(true);
     std::size_t ndists(std::size_t(d0) * std::size_t(d1));
     self->ground_dists().resize(ndists);
     std::copy(external_dists, external_dists + ndists, self->ground_dists().begin());
 
-    self->set_external_dists(true);
-
     return (*self)(std::make_tuple(weights0, nullptr, n0, -1), std::make_tuple(weights1, nullptr, n1, -1));
   }
+SWIGINTERN float wasserstein_EMD_Sl_float_Sc_wasserstein_DefaultArray2Event_Sc_wasserstein_YPhiArrayDistance_Sg__lower_bound(wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *self,float *weights0,std::ptrdiff_t n0,float *coords0,std::ptrdiff_t n00,std::ptrdiff_t n01,float *weights1,std::ptrdiff_t n1,float *coords1,std::ptrdiff_t n10,std::ptrdiff_t n11){
+
+    if (n0 != n00 || n1 != n10)
+      throw std::invalid_argument("Number of weights does not match number of coordinates");
+    if (n01 != n11)
+      throw std::invalid_argument("Coordinate dimensions do not match");
+
+    self->set_external_dists(false);
+
+    return self->lower_bound(std::make_tuple(weights0, coords0, n0, n01), std::make_tuple(weights1, coords1, n1, n11));
+  }
+SWIGINTERN float wasserstein_EMD_Sl_float_Sc_wasserstein_DefaultArray2Event_Sc_wasserstein_YPhiArrayDistance_Sg__upper_bound(wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *self,float *weights0,std::ptrdiff_t n0,float *coords0,std::ptrdiff_t n00,std::ptrdiff_t n01,float *weights1,std::ptrdiff_t n1,float *coords1,std::ptrdiff_t n10,std::ptrdiff_t n11){
+
+    if (n0 != n00 || n1 != n10)
+      throw std::invalid_argument("Number of weights does not match number of coordinates");
+    if (n01 != n11)
+      throw std::invalid_argument("Coordinate dimensions do not match");
+
+    self->set_external_dists(false);
+
+    return self->upper_bound(std::make_tuple(weights0, coords0, n0, n01), std::make_tuple(weights1, coords1, n1, n11));
+  }
+SWIGINTERN bool wasserstein_EMD_Sl_float_Sc_wasserstein_DefaultArray2Event_Sc_wasserstein_YPhiArrayDistance_Sg__within(wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *self,float *weights0,std::ptrdiff_t n0,float *coords0,std::ptrdiff_t n00,std::ptrdiff_t n01,float *weights1,std::ptrdiff_t n1,float *coords1,std::ptrdiff_t n10,std::ptrdiff_t n11,float threshold){
+
+    if (n0 != n00 || n1 != n10)
+      throw std::invalid_argument("Number of weights does not match number of coordinates");
+    if (n01 != n11)
+      throw std::invalid_argument("Coordinate dimensions do not match");
+
+    self->set_external_dists(false);
+
+    return self->within(std::make_tuple(weights0, coords0, n0, n01), std::make_tuple(weights1, coords1, n1, n11), threshold);
+  }
 SWIGINTERN std::string wasserstein_PairwiseEMD_Sl_wasserstein_EMD_Sl_double_Sc_wasserstein_DefaultArrayEvent_Sc_wasserstein_EuclideanArrayDistance_Sg__Sc_double_Sg____repr__(wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,double > const *self){
     return self->description();
   }
 SWIGINTERN void wasserstein_PairwiseEMD_Sl_wasserstein_EMD_Sl_double_Sc_wasserstein_DefaultArrayEvent_Sc_wasserstein_EuclideanArrayDistance_Sg__Sc_double_Sg__preprocess_CenterWeightedCentroid(wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,double > *self){ self->preprocess<wasserstein::CenterWeightedCentroid>(); }
+SWIGINTERN void wasserstein_PairwiseEMD_Sl_wasserstein_EMD_Sl_double_Sc_wasserstein_DefaultArrayEvent_Sc_wasserstein_EuclideanArrayDistance_Sg__Sc_double_Sg__npy_close_pairs(wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,double > *self,std::ptrdiff_t **inds_out,std::ptrdiff_t *n0,std::ptrdiff_t *n1){
+      *n0 = self->close_pairs().size();
+      *n1 = 2;
+      size_t nbytes = size_t(*n0)*2*sizeof(std::ptrdiff_t);
+      std::ptrdiff_t * inds = (std::ptrdiff_t *) malloc(nbytes);
+      if (inds == NULL)
+        throw std::runtime_error("Failed to allocate " + std::to_string(nbytes) + " bytes");
+      for (size_t k = 0; k < self->close_pairs().size(); k++) {
+        inds[2*k] = self->close_pairs()[k].first;
+        inds[2*k + 1] = self->close_pairs()[k].second;
+      }
+      *inds_out = inds;
+    }
 SWIGINTERN void wasserstein_PairwiseEMD_Sl_wasserstein_EMD_Sl_double_Sc_wasserstein_DefaultArrayEvent_Sc_wasserstein_EuclideanArrayDistance_Sg__Sc_double_Sg___reset_B_events(wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,double > *self){
       self->events().resize(self->nevA());
     }
@@ -6702,10 +6891,46 @@ SWIGINTERN void wasserstein_PairwiseEMD_Sl_wasserstein_EMD_Sl_double_Sc_wasserst
     self->events().emplace_back(weights, coords, n1, d, event_weight);
     self->preprocess_back_event();
   }
+SWIGINTERN void wasserstein_PairwiseEMD_Sl_wasserstein_EMD_Sl_double_Sc_wasserstein_DefaultArrayEvent_Sc_wasserstein_EuclideanArrayDistance_Sg__Sc_double_Sg__npy_set_sweep(wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,double > *self,double *Rs,std::ptrdiff_t nR,double *betas,std::ptrdiff_t nbeta){
+    if (nR != nbeta)
+      throw std::invalid_argument("Rs and betas must have the same length");
+
+    std::vector<std::pair<double, double>> params;
+    for (std::ptrdiff_t p = 0; p < nR; p++)
+      params.emplace_back(Rs[p], betas[p]);
+    self->set_sweep(params);
+  }
+SWIGINTERN void wasserstein_PairwiseEMD_Sl_wasserstein_EMD_Sl_double_Sc_wasserstein_DefaultArrayEvent_Sc_wasserstein_EuclideanArrayDistance_Sg__Sc_double_Sg__npy_sweep_emds(wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,double > *self,std::size_t p,double **arr_out,std::ptrdiff_t *n0,std::ptrdiff_t *n1){
+    std::vector<double> emds(self->sweep_emds(p));
+    /*@SWIG:wasserstein/swig/wasserstein_common.i,189,MALLOC_2D_VALUE_ARRAY@*/
+  *n0 = self->nevA();
+  *n1 = self->nevB();
+  size_t num_elements = size_t(*n0)*size_t(*n1);
+  size_t nbytes = num_elements*sizeof(double);
+  double * values = (double *) malloc(nbytes);
+  if (values == NULL)
+    throw std::runtime_error("Failed to allocate " + std::to_string(nbytes) + " bytes");
+  *arr_out = values;
+/*@SWIG@*/
+    memcpy(*arr_out, emds.data(), nbytes);
+  }
 SWIGINTERN std::string wasserstein_PairwiseEMD_Sl_wasserstein_EMD_Sl_float_Sc_wasserstein_DefaultArrayEvent_Sc_wasserstein_EuclideanArrayDistance_Sg__Sc_float_Sg____repr__(wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,float > const *self){
     return self->description();
   }
 SWIGINTERN void wasserstein_PairwiseEMD_Sl_wasserstein_EMD_Sl_float_Sc_wasserstein_DefaultArrayEvent_Sc_wasserstein_EuclideanArrayDistance_Sg__Sc_float_Sg__preprocess_CenterWeightedCentroid(wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,float > *self){ self->preprocess<wasserstein::CenterWeightedCentroid>(); }
+SWIGINTERN void wasserstein_PairwiseEMD_Sl_wasserstein_EMD_Sl_float_Sc_wasserstein_DefaultArrayEvent_Sc_wasserstein_EuclideanArrayDistance_Sg__Sc_float_Sg__npy_close_pairs(wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,float > *self,std::ptrdiff_t **inds_out,std::ptrdiff_t *n0,std::ptrdiff_t *n1){
+      *n0 = self->close_pairs().size();
+      *n1 = 2;
+      size_t nbytes = size_t(*n0)*2*sizeof(std::ptrdiff_t);
+      std::ptrdiff_t * inds = (std::ptrdiff_t *) malloc(nbytes);
+      if (inds == NULL)
+        throw std::runtime_error("Failed to allocate " + std::to_string(nbytes) + " bytes");
+      for (size_t k = 0; k < self->close_pairs().size(); k++) {
+        inds[2*k] = self->close_pairs()[k].first;
+        inds[2*k + 1] = self->close_pairs()[k].second;
+      }
+      *inds_out = inds;
+    }
 SWIGINTERN void wasserstein_PairwiseEMD_Sl_wasserstein_EMD_Sl_float_Sc_wasserstein_DefaultArrayEvent_Sc_wasserstein_EuclideanArrayDistance_Sg__Sc_float_Sg___reset_B_events(wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,float > *self){
       self->events().resize(self->nevA());
     }
@@ -6714,10 +6939,46 @@ SWIGINTERN void wasserstein_PairwiseEMD_Sl_wasserstein_EMD_Sl_float_Sc_wasserste
     self->events().emplace_back(weights, coords, n1, d, event_weight);
     self->preprocess_back_event();
   }
+SWIGINTERN void wasserstein_PairwiseEMD_Sl_wasserstein_EMD_Sl_float_Sc_wasserstein_DefaultArrayEvent_Sc_wasserstein_EuclideanArrayDistance_Sg__Sc_float_Sg__npy_set_sweep(wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,float > *self,float *Rs,std::ptrdiff_t nR,float *betas,std::ptrdiff_t nbeta){
+    if (nR != nbeta)
+      throw std::invalid_argument("Rs and betas must have the same length");
+
+    std::vector<std::pair<float, float>> params;
+    for (std::ptrdiff_t p = 0; p < nR; p++)
+      params.emplace_back(Rs[p], betas[p]);
+    self->set_sweep(params);
+  }
+SWIGINTERN void wasserstein_PairwiseEMD_Sl_wasserstein_EMD_Sl_float_Sc_wasserstein_DefaultArrayEvent_Sc_wasserstein_EuclideanArrayDistance_Sg__Sc_float_Sg__npy_sweep_emds(wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,float > *self,std::size_t p,float **arr_out,std::ptrdiff_t *n0,std::ptrdiff_t *n1){
+    std::vector<float> emds(self->sweep_emds(p));
+    /*@SWIG:wasserstein/swig/wasserstein_common.i,189,MALLOC_2D_VALUE_ARRAY@*/
+  *n0 = self->nevA();
+  *n1 = self->nevB();
+  size_t num_elements = size_t(*n0)*size_t(*n1);
+  size_t nbytes = num_elements*sizeof(float);
+  float * values = (float *) malloc(nbytes);
+  if (values == NULL)
+    throw std::runtime_error("Failed to allocate " + std::to_string(nbytes) + " bytes");
+  *arr_out = values;
+/*@SWIG@*/
+    memcpy(*arr_out, emds.data(), nbytes);
+  }
 SWIGINTERN std::string wasserstein_PairwiseEMD_Sl_wasserstein_EMD_Sl_double_Sc_wasserstein_DefaultArray2Event_Sc_wasserstein_YPhiArrayDistance_Sg__Sc_double_Sg____repr__(wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,double > const *self){
     return self->description();
   }
 SWIGINTERN void wasserstein_PairwiseEMD_Sl_wasserstein_EMD_Sl_double_Sc_wasserstein_DefaultArray2Event_Sc_wasserstein_YPhiArrayDistance_Sg__Sc_double_Sg__preprocess_CenterWeightedCentroid(wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,double > *self){ self->preprocess<wasserstein::CenterWeightedCentroid>(); }
+SWIGINTERN void wasserstein_PairwiseEMD_Sl_wasserstein_EMD_Sl_double_Sc_wasserstein_DefaultArray2Event_Sc_wasserstein_YPhiArrayDistance_Sg__Sc_double_Sg__npy_close_pairs(wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,double > *self,std::ptrdiff_t **inds_out,std::ptrdiff_t *n0,std::ptrdiff_t *n1){
+      *n0 = self->close_pairs().size();
+      *n1 = 2;
+      size_t nbytes = size_t(*n0)*2*sizeof(std::ptrdiff_t);
+      std::ptrdiff_t * inds = (std::ptrdiff_t *) malloc(nbytes);
+      if (inds == NULL)
+        throw std::runtime_error("Failed to allocate " + std::to_string(nbytes) + " bytes");
+      for (size_t k = 0; k < self->close_pairs().size(); k++) {
+        inds[2*k] = self->close_pairs()[k].first;
+        inds[2*k + 1] = self->close_pairs()[k].second;
+      }
+      *inds_out = inds;
+    }
 SWIGINTERN void wasserstein_PairwiseEMD_Sl_wasserstein_EMD_Sl_double_Sc_wasserstein_DefaultArray2Event_Sc_wasserstein_YPhiArrayDistance_Sg__Sc_double_Sg___reset_B_events(wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,double > *self){
       self->events().resize(self->nevA());
     }
@@ -6726,10 +6987,46 @@ SWIGINTERN void wasserstein_PairwiseEMD_Sl_wasserstein_EMD_Sl_double_Sc_wasserst
     self->events().emplace_back(weights, coords, n1, d, event_weight);
     self->preprocess_back_event();
   }
+SWIGINTERN void wasserstein_PairwiseEMD_Sl_wasserstein_EMD_Sl_double_Sc_wasserstein_DefaultArray2Event_Sc_wasserstein_YPhiArrayDistance_Sg__Sc_double_Sg__npy_set_sweep(wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,double > *self,double *Rs,std::ptrdiff_t nR,double *betas,std::ptrdiff_t nbeta){
+    if (nR != nbeta)
+      throw std::invalid_argument("Rs and betas must have the same length");
+
+    std::vector<std::pair<double, double>> params;
+    for (std::ptrdiff_t p = 0; p < nR; p++)
+      params.emplace_back(Rs[p], betas[p]);
+    self->set_sweep(params);
+  }
+SWIGINTERN void wasserstein_PairwiseEMD_Sl_wasserstein_EMD_Sl_double_Sc_wasserstein_DefaultArray2Event_Sc_wasserstein_YPhiArrayDistance_Sg__Sc_double_Sg__npy_sweep_emds(wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,double > *self,std::size_t p,double **arr_out,std::ptrdiff_t *n0,std::ptrdiff_t *n1){
+    std::vector<double> emds(self->sweep_emds(p));
+    /*@SWIG:wasserstein/swig/wasserstein_common.i,189,MALLOC_2D_VALUE_ARRAY@*/
+  *n0 = self->nevA();
+  *n1 = self->nevB();
+  size_t num_elements = size_t(*n0)*size_t(*n1);
+  size_t nbytes = num_elements*sizeof(double);
+  double * values = (double *) malloc(nbytes);
+  if (values == NULL)
+    throw std::runtime_error("Failed to allocate " + std::to_string(nbytes) + " bytes");
+  *arr_out = values;
+/*@SWIG@*/
+    memcpy(*arr_out, emds.data(), nbytes);
+  }
 SWIGINTERN std::string wasserstein_PairwiseEMD_Sl_wasserstein_EMD_Sl_float_Sc_wasserstein_DefaultArray2Event_Sc_wasserstein_YPhiArrayDistance_Sg__Sc_float_Sg____repr__(wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,float > const *self){
     return self->description();
   }
 SWIGINTERN void wasserstein_PairwiseEMD_Sl_wasserstein_EMD_Sl_float_Sc_wasserstein_DefaultArray2Event_Sc_wasserstein_YPhiArrayDistance_Sg__Sc_float_Sg__preprocess_CenterWeightedCentroid(wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,float > *self){ self->preprocess<wasserstein::CenterWeightedCentroid>(); }
+SWIGINTERN void wasserstein_PairwiseEMD_Sl_wasserstein_EMD_Sl_float_Sc_wasserstein_DefaultArray2Event_Sc_wasserstein_YPhiArrayDistance_Sg__Sc_float_Sg__npy_close_pairs(wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,float > *self,std::ptrdiff_t **inds_out,std::ptrdiff_t *n0,std::ptrdiff_t *n1){
+      *n0 = self->close_pairs().size();
+      *n1 = 2;
+      size_t nbytes = size_t(*n0)*2*sizeof(std::ptrdiff_t);
+      std::ptrdiff_t * inds = (std::ptrdiff_t *) malloc(nbytes);
+      if (inds == NULL)
+        throw std::runtime_error("Failed to allocate " + std::to_string(nbytes) + " bytes");
+      for (size_t k = 0; k < self->close_pairs().size(); k++) {
+        inds[2*k] = self->close_pairs()[k].first;
+        inds[2*k + 1] = self->close_pairs()[k].second;
+      }
+      *inds_out = inds;
+    }
 SWIGINTERN void wasserstein_PairwiseEMD_Sl_wasserstein_EMD_Sl_float_Sc_wasserstein_DefaultArray2Event_Sc_wasserstein_YPhiArrayDistance_Sg__Sc_float_Sg___reset_B_events(wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,float > *self){
       self->events().resize(self->nevA());
     }
@@ -6738,6 +7035,29 @@ SWIGINTERN void wasserstein_PairwiseEMD_Sl_wasserstein_EMD_Sl_float_Sc_wasserste
     self->events().emplace_back(weights, coords, n1, d, event_weight);
     self->preprocess_back_event();
   }
+SWIGINTERN void wasserstein_PairwiseEMD_Sl_wasserstein_EMD_Sl_float_Sc_wasserstein_DefaultArray2Event_Sc_wasserstein_YPhiArrayDistance_Sg__Sc_float_Sg__npy_set_sweep(wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,float > *self,float *Rs,std::ptrdiff_t nR,float *betas,std::ptrdiff_t nbeta){
+    if (nR != nbeta)
+      throw std::invalid_argument("Rs and betas must have the same length");
+
+    std::vector<std::pair<float, float>> params;
+    for (std::ptrdiff_t p = 0; p < nR; p++)
+      params.emplace_back(Rs[p], betas[p]);
+    self->set_sweep(params);
+  }
+SWIGINTERN void wasserstein_PairwiseEMD_Sl_wasserstein_EMD_Sl_float_Sc_wasserstein_DefaultArray2Event_Sc_wasserstein_YPhiArrayDistance_Sg__Sc_float_Sg__npy_sweep_emds(wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,float > *self,std::size_t p,float **arr_out,std::ptrdiff_t *n0,std::ptrdiff_t *n1){
+    std::vector<float> emds(self->sweep_emds(p));
+    /*@SWIG:wasserstein/swig/wasserstein_common.i,189,MALLOC_2D_VALUE_ARRAY@*/
+  *n0 = self->nevA();
+  *n1 = self->nevB();
+  size_t num_elements = size_t(*n0)*size_t(*n1);
+  size_t nbytes = num_elements*sizeof(float);
+  float * values = (float *) malloc(nbytes);
+  if (values == NULL)
+    throw std::runtime_error("Failed to allocate " + std::to_string(nbytes) + " bytes");
+  *arr_out = values;
+/*@SWIG@*/
+    memcpy(*arr_out, emds.data(), nbytes);
+  }
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -13714,6 +14034,20 @@ SWIGINTERN PyObject *Swig_var_COMPILED_WITH_OPENMP_get(void) {
 }
 
 
+SWIGINTERN int Swig_var_COMPILED_WITH_SOLVER_STATS_set(PyObject *) {
+  SWIG_Error(SWIG_AttributeError,"Variable COMPILED_WITH_SOLVER_STATS is read-only.");
+  return 1;
+}
+
+
+SWIGINTERN PyObject *Swig_var_COMPILED_WITH_SOLVER_STATS_get(void) {
+  PyObject *pyobj = 0;
+  
+  pyobj = SWIG_From_bool(static_cast< bool >(wasserstein::COMPILED_WITH_SOLVER_STATS));
+  return pyobj;
+}
+
+
 SWIGINTERN PyObject *_wrap_check_emd_status(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
   PyObject *resultobj = 0;
   wasserstein::EMDStatus arg1 ;
@@ -14022,6 +14356,8 @@ SWIGINTERN PyObject *_wrap_EMDBaseFloat64_set_network_simplex_params(PyObject *S
   std::size_t arg2 = (std::size_t) 100000 ;
   double arg3 = (double) 1000 ;
   double arg4 = (double) 1 ;
+  double arg5 = (double) 0 ;
+  double arg6 = (double) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   size_t val2 ;
@@ -14030,15 +14366,21 @@ SWIGINTERN PyObject *_wrap_EMDBaseFloat64_set_network_simplex_params(PyObject *S
   int ecode3 = 0 ;
   double val4 ;
   int ecode4 = 0 ;
+  double val5 ;
+  int ecode5 = 0 ;
+  double val6 ;
+  int ecode6 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   PyObject * obj2 = 0 ;
   PyObject * obj3 = 0 ;
+  PyObject * obj4 = 0 ;
+  PyObject * obj5 = 0 ;
   char * kwnames[] = {
-    (char *)"self",  (char *)"n_iter_max",  (char *)"epsilon_large_factor",  (char *)"epsilon_small_factor",  NULL 
+    (char *)"self",  (char *)"n_iter_max",  (char *)"epsilon_large_factor",  (char *)"epsilon_small_factor",  (char *)"pivot_param0",  (char *)"pivot_param1",  NULL 
   };
   
-  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|OOO:EMDBaseFloat64_set_network_simplex_params", kwnames, &obj0, &obj1, &obj2, &obj3)) SWIG_fail;
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|OOOOO:EMDBaseFloat64_set_network_simplex_params", kwnames, &obj0, &obj1, &obj2, &obj3, &obj4, &obj5)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__EMDBaseT_double_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDBaseFloat64_set_network_simplex_params" "', argument " "1"" of type '" "wasserstein::EMDBase< double > *""'"); 
@@ -14065,9 +14407,23 @@ SWIGINTERN PyObject *_wrap_EMDBaseFloat64_set_network_simplex_params(PyObject *S
     } 
     arg4 = static_cast< double >(val4);
   }
+  if (obj4) {
+    ecode5 = SWIG_AsVal_double(obj4, &val5);
+    if (!SWIG_IsOK(ecode5)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode5), "in method '" "EMDBaseFloat64_set_network_simplex_params" "', argument " "5"" of type '" "double""'");
+    } 
+    arg5 = static_cast< double >(val5);
+  }
+  if (obj5) {
+    ecode6 = SWIG_AsVal_double(obj5, &val6);
+    if (!SWIG_IsOK(ecode6)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode6), "in method '" "EMDBaseFloat64_set_network_simplex_params" "', argument " "6"" of type '" "double""'");
+    } 
+    arg6 = static_cast< double >(val6);
+  }
   {
     try {
-      (arg1)->set_network_simplex_params(arg2,arg3,arg4); 
+      (arg1)->set_network_simplex_params(arg2,arg3,arg4,arg5,arg6); 
     }
     /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
     catch (std::invalid_argument& e) {
@@ -14097,7 +14453,7 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_EMDBaseFloat64_norm(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_EMDBaseFloat64_warm_start(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   wasserstein::EMDBase< double > *arg1 = (wasserstein::EMDBase< double > *) 0 ;
   void *argp1 = 0 ;
@@ -14109,12 +14465,12 @@ SWIGINTERN PyObject *_wrap_EMDBaseFloat64_norm(PyObject *SWIGUNUSEDPARM(self), P
   swig_obj[0] = args;
   res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__EMDBaseT_double_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDBaseFloat64_norm" "', argument " "1"" of type '" "wasserstein::EMDBase< double > const *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDBaseFloat64_warm_start" "', argument " "1"" of type '" "wasserstein::EMDBase< double > const *""'"); 
   }
   arg1 = reinterpret_cast< wasserstein::EMDBase< double > * >(argp1);
   {
     try {
-      result = (bool)((wasserstein::EMDBase< double > const *)arg1)->norm(); 
+      result = (bool)((wasserstein::EMDBase< double > const *)arg1)->warm_start(); 
     }
     /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
     catch (std::invalid_argument& e) {
@@ -14144,7 +14500,7 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_EMDBaseFloat64_set_norm(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+SWIGINTERN PyObject *_wrap_EMDBaseFloat64_set_warm_start(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
   PyObject *resultobj = 0;
   wasserstein::EMDBase< double > *arg1 = (wasserstein::EMDBase< double > *) 0 ;
   bool arg2 ;
@@ -14155,23 +14511,23 @@ SWIGINTERN PyObject *_wrap_EMDBaseFloat64_set_norm(PyObject *SWIGUNUSEDPARM(self
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   char * kwnames[] = {
-    (char *)"self",  (char *)"norm",  NULL 
+    (char *)"self",  (char *)"warm",  NULL 
   };
   
-  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:EMDBaseFloat64_set_norm", kwnames, &obj0, &obj1)) SWIG_fail;
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:EMDBaseFloat64_set_warm_start", kwnames, &obj0, &obj1)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__EMDBaseT_double_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDBaseFloat64_set_norm" "', argument " "1"" of type '" "wasserstein::EMDBase< double > *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDBaseFloat64_set_warm_start" "', argument " "1"" of type '" "wasserstein::EMDBase< double > *""'"); 
   }
   arg1 = reinterpret_cast< wasserstein::EMDBase< double > * >(argp1);
   ecode2 = SWIG_AsVal_bool(obj1, &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "EMDBaseFloat64_set_norm" "', argument " "2"" of type '" "bool""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "EMDBaseFloat64_set_warm_start" "', argument " "2"" of type '" "bool""'");
   } 
   arg2 = static_cast< bool >(val2);
   {
     try {
-      (arg1)->set_norm(arg2); 
+      (arg1)->set_warm_start(arg2); 
     }
     /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
     catch (std::invalid_argument& e) {
@@ -14201,24 +14557,24 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_EMDBaseFloat64_do_timing(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_EMDBaseFloat64_solver(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   wasserstein::EMDBase< double > *arg1 = (wasserstein::EMDBase< double > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject *swig_obj[1] ;
-  bool result;
+  wasserstein::EMDSolver result;
   
   if (!args) SWIG_fail;
   swig_obj[0] = args;
   res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__EMDBaseT_double_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDBaseFloat64_do_timing" "', argument " "1"" of type '" "wasserstein::EMDBase< double > const *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDBaseFloat64_solver" "', argument " "1"" of type '" "wasserstein::EMDBase< double > const *""'"); 
   }
   arg1 = reinterpret_cast< wasserstein::EMDBase< double > * >(argp1);
   {
     try {
-      result = (bool)((wasserstein::EMDBase< double > const *)arg1)->do_timing(); 
+      result = (wasserstein::EMDSolver)((wasserstein::EMDBase< double > const *)arg1)->solver(); 
     }
     /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
     catch (std::invalid_argument& e) {
@@ -14241,41 +14597,41 @@ SWIGINTERN PyObject *_wrap_EMDBaseFloat64_do_timing(PyObject *SWIGUNUSEDPARM(sel
       SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
     }
   }
-  resultobj = SWIG_From_bool(static_cast< bool >(result));
+  resultobj = SWIG_From_int(static_cast< int >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_EMDBaseFloat64_set_do_timing(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+SWIGINTERN PyObject *_wrap_EMDBaseFloat64_set_solver(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
   PyObject *resultobj = 0;
   wasserstein::EMDBase< double > *arg1 = (wasserstein::EMDBase< double > *) 0 ;
-  bool arg2 ;
+  wasserstein::EMDSolver arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  bool val2 ;
+  int val2 ;
   int ecode2 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   char * kwnames[] = {
-    (char *)"self",  (char *)"timing",  NULL 
+    (char *)"self",  (char *)"solver",  NULL 
   };
   
-  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:EMDBaseFloat64_set_do_timing", kwnames, &obj0, &obj1)) SWIG_fail;
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:EMDBaseFloat64_set_solver", kwnames, &obj0, &obj1)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__EMDBaseT_double_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDBaseFloat64_set_do_timing" "', argument " "1"" of type '" "wasserstein::EMDBase< double > *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDBaseFloat64_set_solver" "', argument " "1"" of type '" "wasserstein::EMDBase< double > *""'"); 
   }
   arg1 = reinterpret_cast< wasserstein::EMDBase< double > * >(argp1);
-  ecode2 = SWIG_AsVal_bool(obj1, &val2);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "EMDBaseFloat64_set_do_timing" "', argument " "2"" of type '" "bool""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "EMDBaseFloat64_set_solver" "', argument " "2"" of type '" "wasserstein::EMDSolver""'");
   } 
-  arg2 = static_cast< bool >(val2);
+  arg2 = static_cast< wasserstein::EMDSolver >(val2);
   {
     try {
-      (arg1)->set_do_timing(arg2); 
+      (arg1)->set_solver(arg2); 
     }
     /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
     catch (std::invalid_argument& e) {
@@ -14305,7 +14661,7 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_EMDBaseFloat64_external_dists(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_EMDBaseFloat64_norm(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   wasserstein::EMDBase< double > *arg1 = (wasserstein::EMDBase< double > *) 0 ;
   void *argp1 = 0 ;
@@ -14317,12 +14673,12 @@ SWIGINTERN PyObject *_wrap_EMDBaseFloat64_external_dists(PyObject *SWIGUNUSEDPAR
   swig_obj[0] = args;
   res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__EMDBaseT_double_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDBaseFloat64_external_dists" "', argument " "1"" of type '" "wasserstein::EMDBase< double > const *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDBaseFloat64_norm" "', argument " "1"" of type '" "wasserstein::EMDBase< double > const *""'"); 
   }
   arg1 = reinterpret_cast< wasserstein::EMDBase< double > * >(argp1);
   {
     try {
-      result = (bool)((wasserstein::EMDBase< double > const *)arg1)->external_dists(); 
+      result = (bool)((wasserstein::EMDBase< double > const *)arg1)->norm(); 
     }
     /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
     catch (std::invalid_argument& e) {
@@ -14352,7 +14708,7 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_EMDBaseFloat64_set_external_dists(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+SWIGINTERN PyObject *_wrap_EMDBaseFloat64_set_norm(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
   PyObject *resultobj = 0;
   wasserstein::EMDBase< double > *arg1 = (wasserstein::EMDBase< double > *) 0 ;
   bool arg2 ;
@@ -14363,23 +14719,23 @@ SWIGINTERN PyObject *_wrap_EMDBaseFloat64_set_external_dists(PyObject *SWIGUNUSE
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   char * kwnames[] = {
-    (char *)"self",  (char *)"exdists",  NULL 
+    (char *)"self",  (char *)"norm",  NULL 
   };
   
-  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:EMDBaseFloat64_set_external_dists", kwnames, &obj0, &obj1)) SWIG_fail;
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:EMDBaseFloat64_set_norm", kwnames, &obj0, &obj1)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__EMDBaseT_double_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDBaseFloat64_set_external_dists" "', argument " "1"" of type '" "wasserstein::EMDBase< double > *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDBaseFloat64_set_norm" "', argument " "1"" of type '" "wasserstein::EMDBase< double > *""'"); 
   }
   arg1 = reinterpret_cast< wasserstein::EMDBase< double > * >(argp1);
   ecode2 = SWIG_AsVal_bool(obj1, &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "EMDBaseFloat64_set_external_dists" "', argument " "2"" of type '" "bool""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "EMDBaseFloat64_set_norm" "', argument " "2"" of type '" "bool""'");
   } 
   arg2 = static_cast< bool >(val2);
   {
     try {
-      (arg1)->set_external_dists(arg2); 
+      (arg1)->set_norm(arg2); 
     }
     /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
     catch (std::invalid_argument& e) {
@@ -14409,24 +14765,24 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_EMDBaseFloat64_n0(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_EMDBaseFloat64_do_timing(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   wasserstein::EMDBase< double > *arg1 = (wasserstein::EMDBase< double > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject *swig_obj[1] ;
-  wasserstein::index_type result;
+  bool result;
   
   if (!args) SWIG_fail;
   swig_obj[0] = args;
   res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__EMDBaseT_double_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDBaseFloat64_n0" "', argument " "1"" of type '" "wasserstein::EMDBase< double > const *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDBaseFloat64_do_timing" "', argument " "1"" of type '" "wasserstein::EMDBase< double > const *""'"); 
   }
   arg1 = reinterpret_cast< wasserstein::EMDBase< double > * >(argp1);
   {
     try {
-      result = ((wasserstein::EMDBase< double > const *)arg1)->n0(); 
+      result = (bool)((wasserstein::EMDBase< double > const *)arg1)->do_timing(); 
     }
     /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
     catch (std::invalid_argument& e) {
@@ -14449,7 +14805,215 @@ SWIGINTERN PyObject *_wrap_EMDBaseFloat64_n0(PyObject *SWIGUNUSEDPARM(self), PyO
       SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
     }
   }
-  resultobj = SWIG_From_ptrdiff_t(static_cast< ptrdiff_t >(result));
+  resultobj = SWIG_From_bool(static_cast< bool >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_EMDBaseFloat64_set_do_timing(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  wasserstein::EMDBase< double > *arg1 = (wasserstein::EMDBase< double > *) 0 ;
+  bool arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  bool val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"timing",  NULL 
+  };
+  
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:EMDBaseFloat64_set_do_timing", kwnames, &obj0, &obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__EMDBaseT_double_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDBaseFloat64_set_do_timing" "', argument " "1"" of type '" "wasserstein::EMDBase< double > *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::EMDBase< double > * >(argp1);
+  ecode2 = SWIG_AsVal_bool(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "EMDBaseFloat64_set_do_timing" "', argument " "2"" of type '" "bool""'");
+  } 
+  arg2 = static_cast< bool >(val2);
+  {
+    try {
+      (arg1)->set_do_timing(arg2); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_EMDBaseFloat64_external_dists(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  wasserstein::EMDBase< double > *arg1 = (wasserstein::EMDBase< double > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  bool result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__EMDBaseT_double_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDBaseFloat64_external_dists" "', argument " "1"" of type '" "wasserstein::EMDBase< double > const *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::EMDBase< double > * >(argp1);
+  {
+    try {
+      result = (bool)((wasserstein::EMDBase< double > const *)arg1)->external_dists(); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_From_bool(static_cast< bool >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_EMDBaseFloat64_set_external_dists(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  wasserstein::EMDBase< double > *arg1 = (wasserstein::EMDBase< double > *) 0 ;
+  bool arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  bool val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"exdists",  NULL 
+  };
+  
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:EMDBaseFloat64_set_external_dists", kwnames, &obj0, &obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__EMDBaseT_double_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDBaseFloat64_set_external_dists" "', argument " "1"" of type '" "wasserstein::EMDBase< double > *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::EMDBase< double > * >(argp1);
+  ecode2 = SWIG_AsVal_bool(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "EMDBaseFloat64_set_external_dists" "', argument " "2"" of type '" "bool""'");
+  } 
+  arg2 = static_cast< bool >(val2);
+  {
+    try {
+      (arg1)->set_external_dists(arg2); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_EMDBaseFloat64_n0(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  wasserstein::EMDBase< double > *arg1 = (wasserstein::EMDBase< double > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  wasserstein::index_type result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__EMDBaseT_double_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDBaseFloat64_n0" "', argument " "1"" of type '" "wasserstein::EMDBase< double > const *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::EMDBase< double > * >(argp1);
+  {
+    try {
+      result = ((wasserstein::EMDBase< double > const *)arg1)->n0(); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_From_ptrdiff_t(static_cast< ptrdiff_t >(result));
   return resultobj;
 fail:
   return NULL;
@@ -15267,17 +15831,21 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_EMDBaseFloat64_dists(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_EMDBaseFloat64_sparse_flows(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   wasserstein::EMDBase< double > *arg1 = (wasserstein::EMDBase< double > *) 0 ;
-  double **arg2 = (double **) 0 ;
+  std::ptrdiff_t **arg2 = (std::ptrdiff_t **) 0 ;
   std::ptrdiff_t *arg3 = (std::ptrdiff_t *) 0 ;
   std::ptrdiff_t *arg4 = (std::ptrdiff_t *) 0 ;
+  double **arg5 = (double **) 0 ;
+  std::ptrdiff_t *arg6 = (std::ptrdiff_t *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  double *data_temp2 = NULL ;
+  std::ptrdiff_t *data_temp2 = NULL ;
   std::ptrdiff_t dim1_temp2 ;
   std::ptrdiff_t dim2_temp2 ;
+  double *data_temp5 = NULL ;
+  std::ptrdiff_t dim_temp5 ;
   PyObject *swig_obj[1] ;
   
   {
@@ -15285,16 +15853,20 @@ SWIGINTERN PyObject *_wrap_EMDBaseFloat64_dists(PyObject *SWIGUNUSEDPARM(self),
     arg3 = &dim1_temp2;
     arg4 = &dim2_temp2;
   }
+  {
+    arg5 = &data_temp5;
+    arg6 = &dim_temp5;
+  }
   if (!args) SWIG_fail;
   swig_obj[0] = args;
   res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__EMDBaseT_double_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDBaseFloat64_dists" "', argument " "1"" of type '" "wasserstein::EMDBase< double > *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDBaseFloat64_sparse_flows" "', argument " "1"" of type '" "wasserstein::EMDBase< double > *""'"); 
   }
   arg1 = reinterpret_cast< wasserstein::EMDBase< double > * >(argp1);
   {
     try {
-      wasserstein_EMDBase_Sl_double_Sg__npy_dists(arg1,arg2,arg3,arg4); 
+      wasserstein_EMDBase_Sl_double_Sg__npy_sparse_flows(arg1,arg2,arg3,arg4,arg5,arg6); 
     }
     /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
     catch (std::invalid_argument& e) {
@@ -15322,7 +15894,7 @@ SWIGINTERN PyObject *_wrap_EMDBaseFloat64_dists(PyObject *SWIGUNUSEDPARM(self),
     npy_intp dims[2] = {
       *arg3, *arg4 
     };
-    PyObject* obj = PyArray_SimpleNewFromData(2, dims, NPY_DOUBLE, (void*)(*arg2));
+    PyObject* obj = PyArray_SimpleNewFromData(2, dims, NPY_INTP, (void*)(*arg2));
     PyArrayObject* array = (PyArrayObject*) obj;
     
     if (!array) SWIG_fail;
@@ -15333,6 +15905,29 @@ SWIGINTERN PyObject *_wrap_EMDBaseFloat64_dists(PyObject *SWIGUNUSEDPARM(self),
     PyObject* cap = PyCObject_FromVoidPtr((void*)(*arg2), free);
 #endif
     
+#if NPY_API_VERSION < 0x00000007
+    PyArray_BASE(array) = cap;
+#else
+    PyArray_SetBaseObject(array,cap);
+#endif
+    
+    resultobj = SWIG_Python_AppendOutput(resultobj,obj);
+  }
+  {
+    npy_intp dims[1] = {
+      *arg6 
+    };
+    PyObject* obj = PyArray_SimpleNewFromData(1, dims, NPY_DOUBLE, (void*)(*arg5));
+    PyArrayObject* array = (PyArrayObject*) obj;
+    
+    if (!array) SWIG_fail;
+    
+#ifdef SWIGPY_USE_CAPSULE
+    PyObject* cap = PyCapsule_New((void*)(*arg5), SWIGPY_CAPSULE_NAME, free_cap);
+#else
+    PyObject* cap = PyCObject_FromVoidPtr((void*)(*arg5), free);
+#endif
+    
 #if NPY_API_VERSION < 0x00000007
     PyArray_BASE(array) = cap;
 #else
@@ -15347,39 +15942,119 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_EMDBaseFloat64_npy_node_potentials(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_EMDBaseFloat64_dists(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   wasserstein::EMDBase< double > *arg1 = (wasserstein::EMDBase< double > *) 0 ;
   double **arg2 = (double **) 0 ;
   std::ptrdiff_t *arg3 = (std::ptrdiff_t *) 0 ;
-  double **arg4 = (double **) 0 ;
-  std::ptrdiff_t *arg5 = (std::ptrdiff_t *) 0 ;
+  std::ptrdiff_t *arg4 = (std::ptrdiff_t *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   double *data_temp2 = NULL ;
-  std::ptrdiff_t dim_temp2 ;
-  double *data_temp4 = NULL ;
-  std::ptrdiff_t dim_temp4 ;
+  std::ptrdiff_t dim1_temp2 ;
+  std::ptrdiff_t dim2_temp2 ;
   PyObject *swig_obj[1] ;
   
   {
     arg2 = &data_temp2;
-    arg3 = &dim_temp2;
-  }
-  {
-    arg4 = &data_temp4;
-    arg5 = &dim_temp4;
+    arg3 = &dim1_temp2;
+    arg4 = &dim2_temp2;
   }
   if (!args) SWIG_fail;
   swig_obj[0] = args;
   res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__EMDBaseT_double_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDBaseFloat64_npy_node_potentials" "', argument " "1"" of type '" "wasserstein::EMDBase< double > *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDBaseFloat64_dists" "', argument " "1"" of type '" "wasserstein::EMDBase< double > *""'"); 
   }
   arg1 = reinterpret_cast< wasserstein::EMDBase< double > * >(argp1);
   {
     try {
-      wasserstein_EMDBase_Sl_double_Sg__npy_node_potentials(arg1,arg2,arg3,arg4,arg5); 
+      wasserstein_EMDBase_Sl_double_Sg__npy_dists(arg1,arg2,arg3,arg4); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    npy_intp dims[2] = {
+      *arg3, *arg4 
+    };
+    PyObject* obj = PyArray_SimpleNewFromData(2, dims, NPY_DOUBLE, (void*)(*arg2));
+    PyArrayObject* array = (PyArrayObject*) obj;
+    
+    if (!array) SWIG_fail;
+    
+#ifdef SWIGPY_USE_CAPSULE
+    PyObject* cap = PyCapsule_New((void*)(*arg2), SWIGPY_CAPSULE_NAME, free_cap);
+#else
+    PyObject* cap = PyCObject_FromVoidPtr((void*)(*arg2), free);
+#endif
+    
+#if NPY_API_VERSION < 0x00000007
+    PyArray_BASE(array) = cap;
+#else
+    PyArray_SetBaseObject(array,cap);
+#endif
+    
+    resultobj = SWIG_Python_AppendOutput(resultobj,obj);
+  }
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_EMDBaseFloat64_npy_node_potentials(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  wasserstein::EMDBase< double > *arg1 = (wasserstein::EMDBase< double > *) 0 ;
+  double **arg2 = (double **) 0 ;
+  std::ptrdiff_t *arg3 = (std::ptrdiff_t *) 0 ;
+  double **arg4 = (double **) 0 ;
+  std::ptrdiff_t *arg5 = (std::ptrdiff_t *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  double *data_temp2 = NULL ;
+  std::ptrdiff_t dim_temp2 ;
+  double *data_temp4 = NULL ;
+  std::ptrdiff_t dim_temp4 ;
+  PyObject *swig_obj[1] ;
+  
+  {
+    arg2 = &data_temp2;
+    arg3 = &dim_temp2;
+  }
+  {
+    arg4 = &data_temp4;
+    arg5 = &dim_temp4;
+  }
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__EMDBaseT_double_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDBaseFloat64_npy_node_potentials" "', argument " "1"" of type '" "wasserstein::EMDBase< double > *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::EMDBase< double > * >(argp1);
+  {
+    try {
+      wasserstein_EMDBase_Sl_double_Sg__npy_node_potentials(arg1,arg2,arg3,arg4,arg5); 
     }
     /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
     catch (std::invalid_argument& e) {
@@ -15826,6 +16501,8 @@ SWIGINTERN PyObject *_wrap_PairwiseEMDBaseFloat64_set_network_simplex_params(PyO
   std::size_t arg2 = (std::size_t) 100000 ;
   double arg3 = (double) 1000 ;
   double arg4 = (double) 1 ;
+  double arg5 = (double) 0 ;
+  double arg6 = (double) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   size_t val2 ;
@@ -15834,15 +16511,21 @@ SWIGINTERN PyObject *_wrap_PairwiseEMDBaseFloat64_set_network_simplex_params(PyO
   int ecode3 = 0 ;
   double val4 ;
   int ecode4 = 0 ;
+  double val5 ;
+  int ecode5 = 0 ;
+  double val6 ;
+  int ecode6 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   PyObject * obj2 = 0 ;
   PyObject * obj3 = 0 ;
+  PyObject * obj4 = 0 ;
+  PyObject * obj5 = 0 ;
   char * kwnames[] = {
-    (char *)"self",  (char *)"n_iter_max",  (char *)"epsilon_large_factor",  (char *)"epsilon_small_factor",  NULL 
+    (char *)"self",  (char *)"n_iter_max",  (char *)"epsilon_large_factor",  (char *)"epsilon_small_factor",  (char *)"pivot_param0",  (char *)"pivot_param1",  NULL 
   };
   
-  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|OOO:PairwiseEMDBaseFloat64_set_network_simplex_params", kwnames, &obj0, &obj1, &obj2, &obj3)) SWIG_fail;
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|OOOOO:PairwiseEMDBaseFloat64_set_network_simplex_params", kwnames, &obj0, &obj1, &obj2, &obj3, &obj4, &obj5)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDBaseT_double_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDBaseFloat64_set_network_simplex_params" "', argument " "1"" of type '" "wasserstein::PairwiseEMDBase< double > *""'"); 
@@ -15869,9 +16552,23 @@ SWIGINTERN PyObject *_wrap_PairwiseEMDBaseFloat64_set_network_simplex_params(PyO
     } 
     arg4 = static_cast< double >(val4);
   }
+  if (obj4) {
+    ecode5 = SWIG_AsVal_double(obj4, &val5);
+    if (!SWIG_IsOK(ecode5)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode5), "in method '" "PairwiseEMDBaseFloat64_set_network_simplex_params" "', argument " "5"" of type '" "double""'");
+    } 
+    arg5 = static_cast< double >(val5);
+  }
+  if (obj5) {
+    ecode6 = SWIG_AsVal_double(obj5, &val6);
+    if (!SWIG_IsOK(ecode6)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode6), "in method '" "PairwiseEMDBaseFloat64_set_network_simplex_params" "', argument " "6"" of type '" "double""'");
+    } 
+    arg6 = static_cast< double >(val6);
+  }
   {
     try {
-      (arg1)->set_network_simplex_params(arg2,arg3,arg4); 
+      (arg1)->set_network_simplex_params(arg2,arg3,arg4,arg5,arg6); 
     }
     /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
     catch (std::invalid_argument& e) {
@@ -15901,37 +16598,24 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_PairwiseEMDBaseFloat64_set_external_emd_handler(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+SWIGINTERN PyObject *_wrap_PairwiseEMDBaseFloat64_warm_start(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   wasserstein::PairwiseEMDBase< double > *arg1 = (wasserstein::PairwiseEMDBase< double > *) 0 ;
-  wasserstein::ExternalEMDHandler< double > *arg2 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  void *argp2 = 0 ;
-  int res2 = 0 ;
-  PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
-  char * kwnames[] = {
-    (char *)"self",  (char *)"handler",  NULL 
-  };
+  PyObject *swig_obj[1] ;
+  bool result;
   
-  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:PairwiseEMDBaseFloat64_set_external_emd_handler", kwnames, &obj0, &obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDBaseT_double_t, 0 |  0 );
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDBaseT_double_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDBaseFloat64_set_external_emd_handler" "', argument " "1"" of type '" "wasserstein::PairwiseEMDBase< double > *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDBaseFloat64_warm_start" "', argument " "1"" of type '" "wasserstein::PairwiseEMDBase< double > const *""'"); 
   }
   arg1 = reinterpret_cast< wasserstein::PairwiseEMDBase< double > * >(argp1);
-  res2 = SWIG_ConvertPtr(obj1, &argp2, SWIGTYPE_p_wasserstein__ExternalEMDHandlerT_double_t,  0 );
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "PairwiseEMDBaseFloat64_set_external_emd_handler" "', argument " "2"" of type '" "wasserstein::ExternalEMDHandler< double > &""'"); 
-  }
-  if (!argp2) {
-    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "PairwiseEMDBaseFloat64_set_external_emd_handler" "', argument " "2"" of type '" "wasserstein::ExternalEMDHandler< double > &""'"); 
-  }
-  arg2 = reinterpret_cast< wasserstein::ExternalEMDHandler< double > * >(argp2);
   {
     try {
-      (arg1)->set_external_emd_handler(*arg2); 
+      result = (bool)((wasserstein::PairwiseEMDBase< double > const *)arg1)->warm_start(); 
     }
     /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
     catch (std::invalid_argument& e) {
@@ -15954,31 +16638,41 @@ SWIGINTERN PyObject *_wrap_PairwiseEMDBaseFloat64_set_external_emd_handler(PyObj
       SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
     }
   }
-  resultobj = SWIG_Py_Void();
+  resultobj = SWIG_From_bool(static_cast< bool >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_PairwiseEMDBaseFloat64_have_external_emd_handler(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_PairwiseEMDBaseFloat64_set_warm_start(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
   PyObject *resultobj = 0;
   wasserstein::PairwiseEMDBase< double > *arg1 = (wasserstein::PairwiseEMDBase< double > *) 0 ;
+  bool arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  PyObject *swig_obj[1] ;
-  bool result;
+  bool val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"warm",  NULL 
+  };
   
-  if (!args) SWIG_fail;
-  swig_obj[0] = args;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDBaseT_double_t, 0 |  0 );
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:PairwiseEMDBaseFloat64_set_warm_start", kwnames, &obj0, &obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDBaseT_double_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDBaseFloat64_have_external_emd_handler" "', argument " "1"" of type '" "wasserstein::PairwiseEMDBase< double > const *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDBaseFloat64_set_warm_start" "', argument " "1"" of type '" "wasserstein::PairwiseEMDBase< double > *""'"); 
   }
   arg1 = reinterpret_cast< wasserstein::PairwiseEMDBase< double > * >(argp1);
+  ecode2 = SWIG_AsVal_bool(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PairwiseEMDBaseFloat64_set_warm_start" "', argument " "2"" of type '" "bool""'");
+  } 
+  arg2 = static_cast< bool >(val2);
   {
     try {
-      result = (bool)((wasserstein::PairwiseEMDBase< double > const *)arg1)->have_external_emd_handler(); 
+      (arg1)->set_warm_start(arg2); 
     }
     /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
     catch (std::invalid_argument& e) {
@@ -16001,31 +16695,31 @@ SWIGINTERN PyObject *_wrap_PairwiseEMDBaseFloat64_have_external_emd_handler(PyOb
       SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
     }
   }
-  resultobj = SWIG_From_bool(static_cast< bool >(result));
+  resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_PairwiseEMDBaseFloat64_num_threads(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_PairwiseEMDBaseFloat64_solver(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   wasserstein::PairwiseEMDBase< double > *arg1 = (wasserstein::PairwiseEMDBase< double > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject *swig_obj[1] ;
-  int result;
+  wasserstein::EMDSolver result;
   
   if (!args) SWIG_fail;
   swig_obj[0] = args;
   res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDBaseT_double_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDBaseFloat64_num_threads" "', argument " "1"" of type '" "wasserstein::PairwiseEMDBase< double > const *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDBaseFloat64_solver" "', argument " "1"" of type '" "wasserstein::PairwiseEMDBase< double > const *""'"); 
   }
   arg1 = reinterpret_cast< wasserstein::PairwiseEMDBase< double > * >(argp1);
   {
     try {
-      result = (int)((wasserstein::PairwiseEMDBase< double > const *)arg1)->num_threads(); 
+      result = (wasserstein::EMDSolver)((wasserstein::PairwiseEMDBase< double > const *)arg1)->solver(); 
     }
     /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
     catch (std::invalid_argument& e) {
@@ -16055,10 +16749,10 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_PairwiseEMDBaseFloat64_set_omp_dynamic_chunksize(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+SWIGINTERN PyObject *_wrap_PairwiseEMDBaseFloat64_set_solver(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
   PyObject *resultobj = 0;
   wasserstein::PairwiseEMDBase< double > *arg1 = (wasserstein::PairwiseEMDBase< double > *) 0 ;
-  int arg2 ;
+  wasserstein::EMDSolver arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   int val2 ;
@@ -16066,23 +16760,23 @@ SWIGINTERN PyObject *_wrap_PairwiseEMDBaseFloat64_set_omp_dynamic_chunksize(PyOb
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   char * kwnames[] = {
-    (char *)"self",  (char *)"chunksize",  NULL 
+    (char *)"self",  (char *)"solver",  NULL 
   };
   
-  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:PairwiseEMDBaseFloat64_set_omp_dynamic_chunksize", kwnames, &obj0, &obj1)) SWIG_fail;
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:PairwiseEMDBaseFloat64_set_solver", kwnames, &obj0, &obj1)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDBaseT_double_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDBaseFloat64_set_omp_dynamic_chunksize" "', argument " "1"" of type '" "wasserstein::PairwiseEMDBase< double > *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDBaseFloat64_set_solver" "', argument " "1"" of type '" "wasserstein::PairwiseEMDBase< double > *""'"); 
   }
   arg1 = reinterpret_cast< wasserstein::PairwiseEMDBase< double > * >(argp1);
   ecode2 = SWIG_AsVal_int(obj1, &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PairwiseEMDBaseFloat64_set_omp_dynamic_chunksize" "', argument " "2"" of type '" "int""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PairwiseEMDBaseFloat64_set_solver" "', argument " "2"" of type '" "wasserstein::EMDSolver""'");
   } 
-  arg2 = static_cast< int >(val2);
+  arg2 = static_cast< wasserstein::EMDSolver >(val2);
   {
     try {
-      (arg1)->set_omp_dynamic_chunksize(arg2); 
+      (arg1)->set_solver(arg2); 
     }
     /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
     catch (std::invalid_argument& e) {
@@ -16112,24 +16806,37 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_PairwiseEMDBaseFloat64_omp_dynamic_chunksize(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_PairwiseEMDBaseFloat64_set_external_emd_handler(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
   PyObject *resultobj = 0;
   wasserstein::PairwiseEMDBase< double > *arg1 = (wasserstein::PairwiseEMDBase< double > *) 0 ;
+  wasserstein::ExternalEMDHandler< double > *arg2 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  PyObject *swig_obj[1] ;
-  int result;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"handler",  NULL 
+  };
   
-  if (!args) SWIG_fail;
-  swig_obj[0] = args;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDBaseT_double_t, 0 |  0 );
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:PairwiseEMDBaseFloat64_set_external_emd_handler", kwnames, &obj0, &obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDBaseT_double_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDBaseFloat64_omp_dynamic_chunksize" "', argument " "1"" of type '" "wasserstein::PairwiseEMDBase< double > const *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDBaseFloat64_set_external_emd_handler" "', argument " "1"" of type '" "wasserstein::PairwiseEMDBase< double > *""'"); 
   }
   arg1 = reinterpret_cast< wasserstein::PairwiseEMDBase< double > * >(argp1);
+  res2 = SWIG_ConvertPtr(obj1, &argp2, SWIGTYPE_p_wasserstein__ExternalEMDHandlerT_double_t,  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "PairwiseEMDBaseFloat64_set_external_emd_handler" "', argument " "2"" of type '" "wasserstein::ExternalEMDHandler< double > &""'"); 
+  }
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "PairwiseEMDBaseFloat64_set_external_emd_handler" "', argument " "2"" of type '" "wasserstein::ExternalEMDHandler< double > &""'"); 
+  }
+  arg2 = reinterpret_cast< wasserstein::ExternalEMDHandler< double > * >(argp2);
   {
     try {
-      result = (int)((wasserstein::PairwiseEMDBase< double > const *)arg1)->omp_dynamic_chunksize(); 
+      (arg1)->set_external_emd_handler(*arg2); 
     }
     /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
     catch (std::invalid_argument& e) {
@@ -16152,41 +16859,31 @@ SWIGINTERN PyObject *_wrap_PairwiseEMDBaseFloat64_omp_dynamic_chunksize(PyObject
       SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
     }
   }
-  resultobj = SWIG_From_int(static_cast< int >(result));
+  resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_PairwiseEMDBaseFloat64_set_request_mode(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+SWIGINTERN PyObject *_wrap_PairwiseEMDBaseFloat64_have_external_emd_handler(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   wasserstein::PairwiseEMDBase< double > *arg1 = (wasserstein::PairwiseEMDBase< double > *) 0 ;
-  bool arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  bool val2 ;
-  int ecode2 = 0 ;
-  PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
-  char * kwnames[] = {
-    (char *)"self",  (char *)"mode",  NULL 
-  };
+  PyObject *swig_obj[1] ;
+  bool result;
   
-  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:PairwiseEMDBaseFloat64_set_request_mode", kwnames, &obj0, &obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDBaseT_double_t, 0 |  0 );
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDBaseT_double_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDBaseFloat64_set_request_mode" "', argument " "1"" of type '" "wasserstein::PairwiseEMDBase< double > *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDBaseFloat64_have_external_emd_handler" "', argument " "1"" of type '" "wasserstein::PairwiseEMDBase< double > const *""'"); 
   }
   arg1 = reinterpret_cast< wasserstein::PairwiseEMDBase< double > * >(argp1);
-  ecode2 = SWIG_AsVal_bool(obj1, &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PairwiseEMDBaseFloat64_set_request_mode" "', argument " "2"" of type '" "bool""'");
-  } 
-  arg2 = static_cast< bool >(val2);
   {
     try {
-      (arg1)->set_request_mode(arg2); 
+      result = (bool)((wasserstein::PairwiseEMDBase< double > const *)arg1)->have_external_emd_handler(); 
     }
     /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
     catch (std::invalid_argument& e) {
@@ -16209,31 +16906,31 @@ SWIGINTERN PyObject *_wrap_PairwiseEMDBaseFloat64_set_request_mode(PyObject *SWI
       SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
     }
   }
-  resultobj = SWIG_Py_Void();
+  resultobj = SWIG_From_bool(static_cast< bool >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_PairwiseEMDBaseFloat64_request_mode(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_PairwiseEMDBaseFloat64_num_threads(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   wasserstein::PairwiseEMDBase< double > *arg1 = (wasserstein::PairwiseEMDBase< double > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject *swig_obj[1] ;
-  bool result;
+  int result;
   
   if (!args) SWIG_fail;
   swig_obj[0] = args;
   res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDBaseT_double_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDBaseFloat64_request_mode" "', argument " "1"" of type '" "wasserstein::PairwiseEMDBase< double > const *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDBaseFloat64_num_threads" "', argument " "1"" of type '" "wasserstein::PairwiseEMDBase< double > const *""'"); 
   }
   arg1 = reinterpret_cast< wasserstein::PairwiseEMDBase< double > * >(argp1);
   {
     try {
-      result = (bool)((wasserstein::PairwiseEMDBase< double > const *)arg1)->request_mode(); 
+      result = (int)((wasserstein::PairwiseEMDBase< double > const *)arg1)->num_threads(); 
     }
     /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
     catch (std::invalid_argument& e) {
@@ -16256,31 +16953,41 @@ SWIGINTERN PyObject *_wrap_PairwiseEMDBaseFloat64_request_mode(PyObject *SWIGUNU
       SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
     }
   }
-  resultobj = SWIG_From_bool(static_cast< bool >(result));
+  resultobj = SWIG_From_int(static_cast< int >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_PairwiseEMDBaseFloat64_duration(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_PairwiseEMDBaseFloat64_set_omp_dynamic_chunksize(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
   PyObject *resultobj = 0;
   wasserstein::PairwiseEMDBase< double > *arg1 = (wasserstein::PairwiseEMDBase< double > *) 0 ;
+  int arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  PyObject *swig_obj[1] ;
-  double result;
+  int val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"chunksize",  NULL 
+  };
   
-  if (!args) SWIG_fail;
-  swig_obj[0] = args;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDBaseT_double_t, 0 |  0 );
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:PairwiseEMDBaseFloat64_set_omp_dynamic_chunksize", kwnames, &obj0, &obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDBaseT_double_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDBaseFloat64_duration" "', argument " "1"" of type '" "wasserstein::PairwiseEMDBase< double > const *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDBaseFloat64_set_omp_dynamic_chunksize" "', argument " "1"" of type '" "wasserstein::PairwiseEMDBase< double > *""'"); 
   }
   arg1 = reinterpret_cast< wasserstein::PairwiseEMDBase< double > * >(argp1);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PairwiseEMDBaseFloat64_set_omp_dynamic_chunksize" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
   {
     try {
-      result = (double)((wasserstein::PairwiseEMDBase< double > const *)arg1)->duration(); 
+      (arg1)->set_omp_dynamic_chunksize(arg2); 
     }
     /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
     catch (std::invalid_argument& e) {
@@ -16303,7 +17010,205 @@ SWIGINTERN PyObject *_wrap_PairwiseEMDBaseFloat64_duration(PyObject *SWIGUNUSEDP
       SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
     }
   }
-  resultobj = SWIG_From_double(static_cast< double >(result));
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_PairwiseEMDBaseFloat64_omp_dynamic_chunksize(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  wasserstein::PairwiseEMDBase< double > *arg1 = (wasserstein::PairwiseEMDBase< double > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  int result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDBaseT_double_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDBaseFloat64_omp_dynamic_chunksize" "', argument " "1"" of type '" "wasserstein::PairwiseEMDBase< double > const *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::PairwiseEMDBase< double > * >(argp1);
+  {
+    try {
+      result = (int)((wasserstein::PairwiseEMDBase< double > const *)arg1)->omp_dynamic_chunksize(); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_From_int(static_cast< int >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_PairwiseEMDBaseFloat64_set_request_mode(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  wasserstein::PairwiseEMDBase< double > *arg1 = (wasserstein::PairwiseEMDBase< double > *) 0 ;
+  bool arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  bool val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"mode",  NULL 
+  };
+  
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:PairwiseEMDBaseFloat64_set_request_mode", kwnames, &obj0, &obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDBaseT_double_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDBaseFloat64_set_request_mode" "', argument " "1"" of type '" "wasserstein::PairwiseEMDBase< double > *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::PairwiseEMDBase< double > * >(argp1);
+  ecode2 = SWIG_AsVal_bool(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PairwiseEMDBaseFloat64_set_request_mode" "', argument " "2"" of type '" "bool""'");
+  } 
+  arg2 = static_cast< bool >(val2);
+  {
+    try {
+      (arg1)->set_request_mode(arg2); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_PairwiseEMDBaseFloat64_request_mode(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  wasserstein::PairwiseEMDBase< double > *arg1 = (wasserstein::PairwiseEMDBase< double > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  bool result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDBaseT_double_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDBaseFloat64_request_mode" "', argument " "1"" of type '" "wasserstein::PairwiseEMDBase< double > const *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::PairwiseEMDBase< double > * >(argp1);
+  {
+    try {
+      result = (bool)((wasserstein::PairwiseEMDBase< double > const *)arg1)->request_mode(); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_From_bool(static_cast< bool >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_PairwiseEMDBaseFloat64_duration(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  wasserstein::PairwiseEMDBase< double > *arg1 = (wasserstein::PairwiseEMDBase< double > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  double result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDBaseT_double_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDBaseFloat64_duration" "', argument " "1"" of type '" "wasserstein::PairwiseEMDBase< double > const *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::PairwiseEMDBase< double > * >(argp1);
+  {
+    try {
+      result = (double)((wasserstein::PairwiseEMDBase< double > const *)arg1)->duration(); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_From_double(static_cast< double >(result));
   return resultobj;
 fail:
   return NULL;
@@ -19808,6 +20713,8 @@ SWIGINTERN PyObject *_wrap_EMDBaseFloat32_set_network_simplex_params(PyObject *S
   std::size_t arg2 = (std::size_t) 100000 ;
   float arg3 = (float) 1000 ;
   float arg4 = (float) 1 ;
+  float arg5 = (float) 0 ;
+  float arg6 = (float) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   size_t val2 ;
@@ -19816,15 +20723,21 @@ SWIGINTERN PyObject *_wrap_EMDBaseFloat32_set_network_simplex_params(PyObject *S
   int ecode3 = 0 ;
   float val4 ;
   int ecode4 = 0 ;
+  float val5 ;
+  int ecode5 = 0 ;
+  float val6 ;
+  int ecode6 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   PyObject * obj2 = 0 ;
   PyObject * obj3 = 0 ;
+  PyObject * obj4 = 0 ;
+  PyObject * obj5 = 0 ;
   char * kwnames[] = {
-    (char *)"self",  (char *)"n_iter_max",  (char *)"epsilon_large_factor",  (char *)"epsilon_small_factor",  NULL 
+    (char *)"self",  (char *)"n_iter_max",  (char *)"epsilon_large_factor",  (char *)"epsilon_small_factor",  (char *)"pivot_param0",  (char *)"pivot_param1",  NULL 
   };
   
-  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|OOO:EMDBaseFloat32_set_network_simplex_params", kwnames, &obj0, &obj1, &obj2, &obj3)) SWIG_fail;
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|OOOOO:EMDBaseFloat32_set_network_simplex_params", kwnames, &obj0, &obj1, &obj2, &obj3, &obj4, &obj5)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__EMDBaseT_float_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDBaseFloat32_set_network_simplex_params" "', argument " "1"" of type '" "wasserstein::EMDBase< float > *""'"); 
@@ -19851,9 +20764,23 @@ SWIGINTERN PyObject *_wrap_EMDBaseFloat32_set_network_simplex_params(PyObject *S
     } 
     arg4 = static_cast< float >(val4);
   }
+  if (obj4) {
+    ecode5 = SWIG_AsVal_float(obj4, &val5);
+    if (!SWIG_IsOK(ecode5)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode5), "in method '" "EMDBaseFloat32_set_network_simplex_params" "', argument " "5"" of type '" "float""'");
+    } 
+    arg5 = static_cast< float >(val5);
+  }
+  if (obj5) {
+    ecode6 = SWIG_AsVal_float(obj5, &val6);
+    if (!SWIG_IsOK(ecode6)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode6), "in method '" "EMDBaseFloat32_set_network_simplex_params" "', argument " "6"" of type '" "float""'");
+    } 
+    arg6 = static_cast< float >(val6);
+  }
   {
     try {
-      (arg1)->set_network_simplex_params(arg2,arg3,arg4); 
+      (arg1)->set_network_simplex_params(arg2,arg3,arg4,arg5,arg6); 
     }
     /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
     catch (std::invalid_argument& e) {
@@ -19883,7 +20810,7 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_EMDBaseFloat32_norm(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_EMDBaseFloat32_warm_start(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   wasserstein::EMDBase< float > *arg1 = (wasserstein::EMDBase< float > *) 0 ;
   void *argp1 = 0 ;
@@ -19895,12 +20822,12 @@ SWIGINTERN PyObject *_wrap_EMDBaseFloat32_norm(PyObject *SWIGUNUSEDPARM(self), P
   swig_obj[0] = args;
   res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__EMDBaseT_float_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDBaseFloat32_norm" "', argument " "1"" of type '" "wasserstein::EMDBase< float > const *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDBaseFloat32_warm_start" "', argument " "1"" of type '" "wasserstein::EMDBase< float > const *""'"); 
   }
   arg1 = reinterpret_cast< wasserstein::EMDBase< float > * >(argp1);
   {
     try {
-      result = (bool)((wasserstein::EMDBase< float > const *)arg1)->norm(); 
+      result = (bool)((wasserstein::EMDBase< float > const *)arg1)->warm_start(); 
     }
     /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
     catch (std::invalid_argument& e) {
@@ -19930,7 +20857,7 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_EMDBaseFloat32_set_norm(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+SWIGINTERN PyObject *_wrap_EMDBaseFloat32_set_warm_start(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
   PyObject *resultobj = 0;
   wasserstein::EMDBase< float > *arg1 = (wasserstein::EMDBase< float > *) 0 ;
   bool arg2 ;
@@ -19941,23 +20868,23 @@ SWIGINTERN PyObject *_wrap_EMDBaseFloat32_set_norm(PyObject *SWIGUNUSEDPARM(self
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   char * kwnames[] = {
-    (char *)"self",  (char *)"norm",  NULL 
+    (char *)"self",  (char *)"warm",  NULL 
   };
   
-  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:EMDBaseFloat32_set_norm", kwnames, &obj0, &obj1)) SWIG_fail;
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:EMDBaseFloat32_set_warm_start", kwnames, &obj0, &obj1)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__EMDBaseT_float_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDBaseFloat32_set_norm" "', argument " "1"" of type '" "wasserstein::EMDBase< float > *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDBaseFloat32_set_warm_start" "', argument " "1"" of type '" "wasserstein::EMDBase< float > *""'"); 
   }
   arg1 = reinterpret_cast< wasserstein::EMDBase< float > * >(argp1);
   ecode2 = SWIG_AsVal_bool(obj1, &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "EMDBaseFloat32_set_norm" "', argument " "2"" of type '" "bool""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "EMDBaseFloat32_set_warm_start" "', argument " "2"" of type '" "bool""'");
   } 
   arg2 = static_cast< bool >(val2);
   {
     try {
-      (arg1)->set_norm(arg2); 
+      (arg1)->set_warm_start(arg2); 
     }
     /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
     catch (std::invalid_argument& e) {
@@ -19987,24 +20914,24 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_EMDBaseFloat32_do_timing(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_EMDBaseFloat32_solver(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   wasserstein::EMDBase< float > *arg1 = (wasserstein::EMDBase< float > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject *swig_obj[1] ;
-  bool result;
+  wasserstein::EMDSolver result;
   
   if (!args) SWIG_fail;
   swig_obj[0] = args;
   res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__EMDBaseT_float_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDBaseFloat32_do_timing" "', argument " "1"" of type '" "wasserstein::EMDBase< float > const *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDBaseFloat32_solver" "', argument " "1"" of type '" "wasserstein::EMDBase< float > const *""'"); 
   }
   arg1 = reinterpret_cast< wasserstein::EMDBase< float > * >(argp1);
   {
     try {
-      result = (bool)((wasserstein::EMDBase< float > const *)arg1)->do_timing(); 
+      result = (wasserstein::EMDSolver)((wasserstein::EMDBase< float > const *)arg1)->solver(); 
     }
     /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
     catch (std::invalid_argument& e) {
@@ -20027,41 +20954,41 @@ SWIGINTERN PyObject *_wrap_EMDBaseFloat32_do_timing(PyObject *SWIGUNUSEDPARM(sel
       SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
     }
   }
-  resultobj = SWIG_From_bool(static_cast< bool >(result));
+  resultobj = SWIG_From_int(static_cast< int >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_EMDBaseFloat32_set_do_timing(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+SWIGINTERN PyObject *_wrap_EMDBaseFloat32_set_solver(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
   PyObject *resultobj = 0;
   wasserstein::EMDBase< float > *arg1 = (wasserstein::EMDBase< float > *) 0 ;
-  bool arg2 ;
+  wasserstein::EMDSolver arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  bool val2 ;
+  int val2 ;
   int ecode2 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   char * kwnames[] = {
-    (char *)"self",  (char *)"timing",  NULL 
+    (char *)"self",  (char *)"solver",  NULL 
   };
   
-  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:EMDBaseFloat32_set_do_timing", kwnames, &obj0, &obj1)) SWIG_fail;
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:EMDBaseFloat32_set_solver", kwnames, &obj0, &obj1)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__EMDBaseT_float_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDBaseFloat32_set_do_timing" "', argument " "1"" of type '" "wasserstein::EMDBase< float > *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDBaseFloat32_set_solver" "', argument " "1"" of type '" "wasserstein::EMDBase< float > *""'"); 
   }
   arg1 = reinterpret_cast< wasserstein::EMDBase< float > * >(argp1);
-  ecode2 = SWIG_AsVal_bool(obj1, &val2);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "EMDBaseFloat32_set_do_timing" "', argument " "2"" of type '" "bool""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "EMDBaseFloat32_set_solver" "', argument " "2"" of type '" "wasserstein::EMDSolver""'");
   } 
-  arg2 = static_cast< bool >(val2);
+  arg2 = static_cast< wasserstein::EMDSolver >(val2);
   {
     try {
-      (arg1)->set_do_timing(arg2); 
+      (arg1)->set_solver(arg2); 
     }
     /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
     catch (std::invalid_argument& e) {
@@ -20091,7 +21018,7 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_EMDBaseFloat32_external_dists(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_EMDBaseFloat32_norm(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   wasserstein::EMDBase< float > *arg1 = (wasserstein::EMDBase< float > *) 0 ;
   void *argp1 = 0 ;
@@ -20103,12 +21030,12 @@ SWIGINTERN PyObject *_wrap_EMDBaseFloat32_external_dists(PyObject *SWIGUNUSEDPAR
   swig_obj[0] = args;
   res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__EMDBaseT_float_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDBaseFloat32_external_dists" "', argument " "1"" of type '" "wasserstein::EMDBase< float > const *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDBaseFloat32_norm" "', argument " "1"" of type '" "wasserstein::EMDBase< float > const *""'"); 
   }
   arg1 = reinterpret_cast< wasserstein::EMDBase< float > * >(argp1);
   {
     try {
-      result = (bool)((wasserstein::EMDBase< float > const *)arg1)->external_dists(); 
+      result = (bool)((wasserstein::EMDBase< float > const *)arg1)->norm(); 
     }
     /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
     catch (std::invalid_argument& e) {
@@ -20138,7 +21065,7 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_EMDBaseFloat32_set_external_dists(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+SWIGINTERN PyObject *_wrap_EMDBaseFloat32_set_norm(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
   PyObject *resultobj = 0;
   wasserstein::EMDBase< float > *arg1 = (wasserstein::EMDBase< float > *) 0 ;
   bool arg2 ;
@@ -20149,23 +21076,231 @@ SWIGINTERN PyObject *_wrap_EMDBaseFloat32_set_external_dists(PyObject *SWIGUNUSE
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   char * kwnames[] = {
-    (char *)"self",  (char *)"exdists",  NULL 
+    (char *)"self",  (char *)"norm",  NULL 
   };
   
-  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:EMDBaseFloat32_set_external_dists", kwnames, &obj0, &obj1)) SWIG_fail;
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:EMDBaseFloat32_set_norm", kwnames, &obj0, &obj1)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__EMDBaseT_float_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDBaseFloat32_set_external_dists" "', argument " "1"" of type '" "wasserstein::EMDBase< float > *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDBaseFloat32_set_norm" "', argument " "1"" of type '" "wasserstein::EMDBase< float > *""'"); 
   }
   arg1 = reinterpret_cast< wasserstein::EMDBase< float > * >(argp1);
   ecode2 = SWIG_AsVal_bool(obj1, &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "EMDBaseFloat32_set_external_dists" "', argument " "2"" of type '" "bool""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "EMDBaseFloat32_set_norm" "', argument " "2"" of type '" "bool""'");
   } 
   arg2 = static_cast< bool >(val2);
   {
     try {
-      (arg1)->set_external_dists(arg2); 
+      (arg1)->set_norm(arg2); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_EMDBaseFloat32_do_timing(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  wasserstein::EMDBase< float > *arg1 = (wasserstein::EMDBase< float > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  bool result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__EMDBaseT_float_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDBaseFloat32_do_timing" "', argument " "1"" of type '" "wasserstein::EMDBase< float > const *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::EMDBase< float > * >(argp1);
+  {
+    try {
+      result = (bool)((wasserstein::EMDBase< float > const *)arg1)->do_timing(); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_From_bool(static_cast< bool >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_EMDBaseFloat32_set_do_timing(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  wasserstein::EMDBase< float > *arg1 = (wasserstein::EMDBase< float > *) 0 ;
+  bool arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  bool val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"timing",  NULL 
+  };
+  
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:EMDBaseFloat32_set_do_timing", kwnames, &obj0, &obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__EMDBaseT_float_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDBaseFloat32_set_do_timing" "', argument " "1"" of type '" "wasserstein::EMDBase< float > *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::EMDBase< float > * >(argp1);
+  ecode2 = SWIG_AsVal_bool(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "EMDBaseFloat32_set_do_timing" "', argument " "2"" of type '" "bool""'");
+  } 
+  arg2 = static_cast< bool >(val2);
+  {
+    try {
+      (arg1)->set_do_timing(arg2); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_EMDBaseFloat32_external_dists(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  wasserstein::EMDBase< float > *arg1 = (wasserstein::EMDBase< float > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  bool result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__EMDBaseT_float_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDBaseFloat32_external_dists" "', argument " "1"" of type '" "wasserstein::EMDBase< float > const *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::EMDBase< float > * >(argp1);
+  {
+    try {
+      result = (bool)((wasserstein::EMDBase< float > const *)arg1)->external_dists(); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_From_bool(static_cast< bool >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_EMDBaseFloat32_set_external_dists(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  wasserstein::EMDBase< float > *arg1 = (wasserstein::EMDBase< float > *) 0 ;
+  bool arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  bool val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"exdists",  NULL 
+  };
+  
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:EMDBaseFloat32_set_external_dists", kwnames, &obj0, &obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__EMDBaseT_float_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDBaseFloat32_set_external_dists" "', argument " "1"" of type '" "wasserstein::EMDBase< float > *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::EMDBase< float > * >(argp1);
+  ecode2 = SWIG_AsVal_bool(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "EMDBaseFloat32_set_external_dists" "', argument " "2"" of type '" "bool""'");
+  } 
+  arg2 = static_cast< bool >(val2);
+  {
+    try {
+      (arg1)->set_external_dists(arg2); 
     }
     /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
     catch (std::invalid_argument& e) {
@@ -21053,17 +22188,21 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_EMDBaseFloat32_dists(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_EMDBaseFloat32_sparse_flows(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   wasserstein::EMDBase< float > *arg1 = (wasserstein::EMDBase< float > *) 0 ;
-  float **arg2 = (float **) 0 ;
+  std::ptrdiff_t **arg2 = (std::ptrdiff_t **) 0 ;
   std::ptrdiff_t *arg3 = (std::ptrdiff_t *) 0 ;
   std::ptrdiff_t *arg4 = (std::ptrdiff_t *) 0 ;
+  float **arg5 = (float **) 0 ;
+  std::ptrdiff_t *arg6 = (std::ptrdiff_t *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  float *data_temp2 = NULL ;
+  std::ptrdiff_t *data_temp2 = NULL ;
   std::ptrdiff_t dim1_temp2 ;
   std::ptrdiff_t dim2_temp2 ;
+  float *data_temp5 = NULL ;
+  std::ptrdiff_t dim_temp5 ;
   PyObject *swig_obj[1] ;
   
   {
@@ -21071,16 +22210,20 @@ SWIGINTERN PyObject *_wrap_EMDBaseFloat32_dists(PyObject *SWIGUNUSEDPARM(self),
     arg3 = &dim1_temp2;
     arg4 = &dim2_temp2;
   }
+  {
+    arg5 = &data_temp5;
+    arg6 = &dim_temp5;
+  }
   if (!args) SWIG_fail;
   swig_obj[0] = args;
   res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__EMDBaseT_float_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDBaseFloat32_dists" "', argument " "1"" of type '" "wasserstein::EMDBase< float > *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDBaseFloat32_sparse_flows" "', argument " "1"" of type '" "wasserstein::EMDBase< float > *""'"); 
   }
   arg1 = reinterpret_cast< wasserstein::EMDBase< float > * >(argp1);
   {
     try {
-      wasserstein_EMDBase_Sl_float_Sg__npy_dists(arg1,arg2,arg3,arg4); 
+      wasserstein_EMDBase_Sl_float_Sg__npy_sparse_flows(arg1,arg2,arg3,arg4,arg5,arg6); 
     }
     /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
     catch (std::invalid_argument& e) {
@@ -21108,7 +22251,7 @@ SWIGINTERN PyObject *_wrap_EMDBaseFloat32_dists(PyObject *SWIGUNUSEDPARM(self),
     npy_intp dims[2] = {
       *arg3, *arg4 
     };
-    PyObject* obj = PyArray_SimpleNewFromData(2, dims, NPY_FLOAT, (void*)(*arg2));
+    PyObject* obj = PyArray_SimpleNewFromData(2, dims, NPY_INTP, (void*)(*arg2));
     PyArrayObject* array = (PyArrayObject*) obj;
     
     if (!array) SWIG_fail;
@@ -21119,6 +22262,29 @@ SWIGINTERN PyObject *_wrap_EMDBaseFloat32_dists(PyObject *SWIGUNUSEDPARM(self),
     PyObject* cap = PyCObject_FromVoidPtr((void*)(*arg2), free);
 #endif
     
+#if NPY_API_VERSION < 0x00000007
+    PyArray_BASE(array) = cap;
+#else
+    PyArray_SetBaseObject(array,cap);
+#endif
+    
+    resultobj = SWIG_Python_AppendOutput(resultobj,obj);
+  }
+  {
+    npy_intp dims[1] = {
+      *arg6 
+    };
+    PyObject* obj = PyArray_SimpleNewFromData(1, dims, NPY_FLOAT, (void*)(*arg5));
+    PyArrayObject* array = (PyArrayObject*) obj;
+    
+    if (!array) SWIG_fail;
+    
+#ifdef SWIGPY_USE_CAPSULE
+    PyObject* cap = PyCapsule_New((void*)(*arg5), SWIGPY_CAPSULE_NAME, free_cap);
+#else
+    PyObject* cap = PyCObject_FromVoidPtr((void*)(*arg5), free);
+#endif
+    
 #if NPY_API_VERSION < 0x00000007
     PyArray_BASE(array) = cap;
 #else
@@ -21133,39 +22299,119 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_EMDBaseFloat32_npy_node_potentials(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_EMDBaseFloat32_dists(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   wasserstein::EMDBase< float > *arg1 = (wasserstein::EMDBase< float > *) 0 ;
   float **arg2 = (float **) 0 ;
   std::ptrdiff_t *arg3 = (std::ptrdiff_t *) 0 ;
-  float **arg4 = (float **) 0 ;
-  std::ptrdiff_t *arg5 = (std::ptrdiff_t *) 0 ;
+  std::ptrdiff_t *arg4 = (std::ptrdiff_t *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   float *data_temp2 = NULL ;
-  std::ptrdiff_t dim_temp2 ;
-  float *data_temp4 = NULL ;
-  std::ptrdiff_t dim_temp4 ;
+  std::ptrdiff_t dim1_temp2 ;
+  std::ptrdiff_t dim2_temp2 ;
   PyObject *swig_obj[1] ;
   
   {
     arg2 = &data_temp2;
-    arg3 = &dim_temp2;
-  }
-  {
-    arg4 = &data_temp4;
-    arg5 = &dim_temp4;
+    arg3 = &dim1_temp2;
+    arg4 = &dim2_temp2;
   }
   if (!args) SWIG_fail;
   swig_obj[0] = args;
   res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__EMDBaseT_float_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDBaseFloat32_npy_node_potentials" "', argument " "1"" of type '" "wasserstein::EMDBase< float > *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDBaseFloat32_dists" "', argument " "1"" of type '" "wasserstein::EMDBase< float > *""'"); 
   }
   arg1 = reinterpret_cast< wasserstein::EMDBase< float > * >(argp1);
   {
     try {
-      wasserstein_EMDBase_Sl_float_Sg__npy_node_potentials(arg1,arg2,arg3,arg4,arg5); 
+      wasserstein_EMDBase_Sl_float_Sg__npy_dists(arg1,arg2,arg3,arg4); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    npy_intp dims[2] = {
+      *arg3, *arg4 
+    };
+    PyObject* obj = PyArray_SimpleNewFromData(2, dims, NPY_FLOAT, (void*)(*arg2));
+    PyArrayObject* array = (PyArrayObject*) obj;
+    
+    if (!array) SWIG_fail;
+    
+#ifdef SWIGPY_USE_CAPSULE
+    PyObject* cap = PyCapsule_New((void*)(*arg2), SWIGPY_CAPSULE_NAME, free_cap);
+#else
+    PyObject* cap = PyCObject_FromVoidPtr((void*)(*arg2), free);
+#endif
+    
+#if NPY_API_VERSION < 0x00000007
+    PyArray_BASE(array) = cap;
+#else
+    PyArray_SetBaseObject(array,cap);
+#endif
+    
+    resultobj = SWIG_Python_AppendOutput(resultobj,obj);
+  }
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_EMDBaseFloat32_npy_node_potentials(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  wasserstein::EMDBase< float > *arg1 = (wasserstein::EMDBase< float > *) 0 ;
+  float **arg2 = (float **) 0 ;
+  std::ptrdiff_t *arg3 = (std::ptrdiff_t *) 0 ;
+  float **arg4 = (float **) 0 ;
+  std::ptrdiff_t *arg5 = (std::ptrdiff_t *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  float *data_temp2 = NULL ;
+  std::ptrdiff_t dim_temp2 ;
+  float *data_temp4 = NULL ;
+  std::ptrdiff_t dim_temp4 ;
+  PyObject *swig_obj[1] ;
+  
+  {
+    arg2 = &data_temp2;
+    arg3 = &dim_temp2;
+  }
+  {
+    arg4 = &data_temp4;
+    arg5 = &dim_temp4;
+  }
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__EMDBaseT_float_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDBaseFloat32_npy_node_potentials" "', argument " "1"" of type '" "wasserstein::EMDBase< float > *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::EMDBase< float > * >(argp1);
+  {
+    try {
+      wasserstein_EMDBase_Sl_float_Sg__npy_node_potentials(arg1,arg2,arg3,arg4,arg5); 
     }
     /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
     catch (std::invalid_argument& e) {
@@ -21612,6 +22858,8 @@ SWIGINTERN PyObject *_wrap_PairwiseEMDBaseFloat32_set_network_simplex_params(PyO
   std::size_t arg2 = (std::size_t) 100000 ;
   float arg3 = (float) 1000 ;
   float arg4 = (float) 1 ;
+  float arg5 = (float) 0 ;
+  float arg6 = (float) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   size_t val2 ;
@@ -21620,15 +22868,21 @@ SWIGINTERN PyObject *_wrap_PairwiseEMDBaseFloat32_set_network_simplex_params(PyO
   int ecode3 = 0 ;
   float val4 ;
   int ecode4 = 0 ;
+  float val5 ;
+  int ecode5 = 0 ;
+  float val6 ;
+  int ecode6 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   PyObject * obj2 = 0 ;
   PyObject * obj3 = 0 ;
+  PyObject * obj4 = 0 ;
+  PyObject * obj5 = 0 ;
   char * kwnames[] = {
-    (char *)"self",  (char *)"n_iter_max",  (char *)"epsilon_large_factor",  (char *)"epsilon_small_factor",  NULL 
+    (char *)"self",  (char *)"n_iter_max",  (char *)"epsilon_large_factor",  (char *)"epsilon_small_factor",  (char *)"pivot_param0",  (char *)"pivot_param1",  NULL 
   };
   
-  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|OOO:PairwiseEMDBaseFloat32_set_network_simplex_params", kwnames, &obj0, &obj1, &obj2, &obj3)) SWIG_fail;
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|OOOOO:PairwiseEMDBaseFloat32_set_network_simplex_params", kwnames, &obj0, &obj1, &obj2, &obj3, &obj4, &obj5)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDBaseT_float_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDBaseFloat32_set_network_simplex_params" "', argument " "1"" of type '" "wasserstein::PairwiseEMDBase< float > *""'"); 
@@ -21655,9 +22909,23 @@ SWIGINTERN PyObject *_wrap_PairwiseEMDBaseFloat32_set_network_simplex_params(PyO
     } 
     arg4 = static_cast< float >(val4);
   }
+  if (obj4) {
+    ecode5 = SWIG_AsVal_float(obj4, &val5);
+    if (!SWIG_IsOK(ecode5)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode5), "in method '" "PairwiseEMDBaseFloat32_set_network_simplex_params" "', argument " "5"" of type '" "float""'");
+    } 
+    arg5 = static_cast< float >(val5);
+  }
+  if (obj5) {
+    ecode6 = SWIG_AsVal_float(obj5, &val6);
+    if (!SWIG_IsOK(ecode6)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode6), "in method '" "PairwiseEMDBaseFloat32_set_network_simplex_params" "', argument " "6"" of type '" "float""'");
+    } 
+    arg6 = static_cast< float >(val6);
+  }
   {
     try {
-      (arg1)->set_network_simplex_params(arg2,arg3,arg4); 
+      (arg1)->set_network_simplex_params(arg2,arg3,arg4,arg5,arg6); 
     }
     /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
     catch (std::invalid_argument& e) {
@@ -21687,37 +22955,24 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_PairwiseEMDBaseFloat32_set_external_emd_handler(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+SWIGINTERN PyObject *_wrap_PairwiseEMDBaseFloat32_warm_start(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   wasserstein::PairwiseEMDBase< float > *arg1 = (wasserstein::PairwiseEMDBase< float > *) 0 ;
-  wasserstein::ExternalEMDHandler< float > *arg2 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  void *argp2 = 0 ;
-  int res2 = 0 ;
-  PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
-  char * kwnames[] = {
-    (char *)"self",  (char *)"handler",  NULL 
-  };
+  PyObject *swig_obj[1] ;
+  bool result;
   
-  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:PairwiseEMDBaseFloat32_set_external_emd_handler", kwnames, &obj0, &obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDBaseT_float_t, 0 |  0 );
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDBaseT_float_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDBaseFloat32_set_external_emd_handler" "', argument " "1"" of type '" "wasserstein::PairwiseEMDBase< float > *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDBaseFloat32_warm_start" "', argument " "1"" of type '" "wasserstein::PairwiseEMDBase< float > const *""'"); 
   }
   arg1 = reinterpret_cast< wasserstein::PairwiseEMDBase< float > * >(argp1);
-  res2 = SWIG_ConvertPtr(obj1, &argp2, SWIGTYPE_p_wasserstein__ExternalEMDHandlerT_float_t,  0 );
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "PairwiseEMDBaseFloat32_set_external_emd_handler" "', argument " "2"" of type '" "wasserstein::ExternalEMDHandler< float > &""'"); 
-  }
-  if (!argp2) {
-    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "PairwiseEMDBaseFloat32_set_external_emd_handler" "', argument " "2"" of type '" "wasserstein::ExternalEMDHandler< float > &""'"); 
-  }
-  arg2 = reinterpret_cast< wasserstein::ExternalEMDHandler< float > * >(argp2);
   {
     try {
-      (arg1)->set_external_emd_handler(*arg2); 
+      result = (bool)((wasserstein::PairwiseEMDBase< float > const *)arg1)->warm_start(); 
     }
     /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
     catch (std::invalid_argument& e) {
@@ -21740,31 +22995,41 @@ SWIGINTERN PyObject *_wrap_PairwiseEMDBaseFloat32_set_external_emd_handler(PyObj
       SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
     }
   }
-  resultobj = SWIG_Py_Void();
+  resultobj = SWIG_From_bool(static_cast< bool >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_PairwiseEMDBaseFloat32_have_external_emd_handler(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_PairwiseEMDBaseFloat32_set_warm_start(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
   PyObject *resultobj = 0;
   wasserstein::PairwiseEMDBase< float > *arg1 = (wasserstein::PairwiseEMDBase< float > *) 0 ;
+  bool arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  PyObject *swig_obj[1] ;
-  bool result;
+  bool val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"warm",  NULL 
+  };
   
-  if (!args) SWIG_fail;
-  swig_obj[0] = args;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDBaseT_float_t, 0 |  0 );
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:PairwiseEMDBaseFloat32_set_warm_start", kwnames, &obj0, &obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDBaseT_float_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDBaseFloat32_have_external_emd_handler" "', argument " "1"" of type '" "wasserstein::PairwiseEMDBase< float > const *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDBaseFloat32_set_warm_start" "', argument " "1"" of type '" "wasserstein::PairwiseEMDBase< float > *""'"); 
   }
   arg1 = reinterpret_cast< wasserstein::PairwiseEMDBase< float > * >(argp1);
+  ecode2 = SWIG_AsVal_bool(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PairwiseEMDBaseFloat32_set_warm_start" "', argument " "2"" of type '" "bool""'");
+  } 
+  arg2 = static_cast< bool >(val2);
   {
     try {
-      result = (bool)((wasserstein::PairwiseEMDBase< float > const *)arg1)->have_external_emd_handler(); 
+      (arg1)->set_warm_start(arg2); 
     }
     /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
     catch (std::invalid_argument& e) {
@@ -21787,31 +23052,31 @@ SWIGINTERN PyObject *_wrap_PairwiseEMDBaseFloat32_have_external_emd_handler(PyOb
       SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
     }
   }
-  resultobj = SWIG_From_bool(static_cast< bool >(result));
+  resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_PairwiseEMDBaseFloat32_num_threads(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_PairwiseEMDBaseFloat32_solver(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   wasserstein::PairwiseEMDBase< float > *arg1 = (wasserstein::PairwiseEMDBase< float > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject *swig_obj[1] ;
-  int result;
+  wasserstein::EMDSolver result;
   
   if (!args) SWIG_fail;
   swig_obj[0] = args;
   res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDBaseT_float_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDBaseFloat32_num_threads" "', argument " "1"" of type '" "wasserstein::PairwiseEMDBase< float > const *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDBaseFloat32_solver" "', argument " "1"" of type '" "wasserstein::PairwiseEMDBase< float > const *""'"); 
   }
   arg1 = reinterpret_cast< wasserstein::PairwiseEMDBase< float > * >(argp1);
   {
     try {
-      result = (int)((wasserstein::PairwiseEMDBase< float > const *)arg1)->num_threads(); 
+      result = (wasserstein::EMDSolver)((wasserstein::PairwiseEMDBase< float > const *)arg1)->solver(); 
     }
     /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
     catch (std::invalid_argument& e) {
@@ -21841,10 +23106,10 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_PairwiseEMDBaseFloat32_set_omp_dynamic_chunksize(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+SWIGINTERN PyObject *_wrap_PairwiseEMDBaseFloat32_set_solver(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
   PyObject *resultobj = 0;
   wasserstein::PairwiseEMDBase< float > *arg1 = (wasserstein::PairwiseEMDBase< float > *) 0 ;
-  int arg2 ;
+  wasserstein::EMDSolver arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   int val2 ;
@@ -21852,23 +23117,23 @@ SWIGINTERN PyObject *_wrap_PairwiseEMDBaseFloat32_set_omp_dynamic_chunksize(PyOb
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   char * kwnames[] = {
-    (char *)"self",  (char *)"chunksize",  NULL 
+    (char *)"self",  (char *)"solver",  NULL 
   };
   
-  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:PairwiseEMDBaseFloat32_set_omp_dynamic_chunksize", kwnames, &obj0, &obj1)) SWIG_fail;
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:PairwiseEMDBaseFloat32_set_solver", kwnames, &obj0, &obj1)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDBaseT_float_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDBaseFloat32_set_omp_dynamic_chunksize" "', argument " "1"" of type '" "wasserstein::PairwiseEMDBase< float > *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDBaseFloat32_set_solver" "', argument " "1"" of type '" "wasserstein::PairwiseEMDBase< float > *""'"); 
   }
   arg1 = reinterpret_cast< wasserstein::PairwiseEMDBase< float > * >(argp1);
   ecode2 = SWIG_AsVal_int(obj1, &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PairwiseEMDBaseFloat32_set_omp_dynamic_chunksize" "', argument " "2"" of type '" "int""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PairwiseEMDBaseFloat32_set_solver" "', argument " "2"" of type '" "wasserstein::EMDSolver""'");
   } 
-  arg2 = static_cast< int >(val2);
+  arg2 = static_cast< wasserstein::EMDSolver >(val2);
   {
     try {
-      (arg1)->set_omp_dynamic_chunksize(arg2); 
+      (arg1)->set_solver(arg2); 
     }
     /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
     catch (std::invalid_argument& e) {
@@ -21898,24 +23163,37 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_PairwiseEMDBaseFloat32_omp_dynamic_chunksize(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_PairwiseEMDBaseFloat32_set_external_emd_handler(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
   PyObject *resultobj = 0;
   wasserstein::PairwiseEMDBase< float > *arg1 = (wasserstein::PairwiseEMDBase< float > *) 0 ;
+  wasserstein::ExternalEMDHandler< float > *arg2 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  PyObject *swig_obj[1] ;
-  int result;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"handler",  NULL 
+  };
   
-  if (!args) SWIG_fail;
-  swig_obj[0] = args;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDBaseT_float_t, 0 |  0 );
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:PairwiseEMDBaseFloat32_set_external_emd_handler", kwnames, &obj0, &obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDBaseT_float_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDBaseFloat32_omp_dynamic_chunksize" "', argument " "1"" of type '" "wasserstein::PairwiseEMDBase< float > const *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDBaseFloat32_set_external_emd_handler" "', argument " "1"" of type '" "wasserstein::PairwiseEMDBase< float > *""'"); 
   }
   arg1 = reinterpret_cast< wasserstein::PairwiseEMDBase< float > * >(argp1);
+  res2 = SWIG_ConvertPtr(obj1, &argp2, SWIGTYPE_p_wasserstein__ExternalEMDHandlerT_float_t,  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "PairwiseEMDBaseFloat32_set_external_emd_handler" "', argument " "2"" of type '" "wasserstein::ExternalEMDHandler< float > &""'"); 
+  }
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "PairwiseEMDBaseFloat32_set_external_emd_handler" "', argument " "2"" of type '" "wasserstein::ExternalEMDHandler< float > &""'"); 
+  }
+  arg2 = reinterpret_cast< wasserstein::ExternalEMDHandler< float > * >(argp2);
   {
     try {
-      result = (int)((wasserstein::PairwiseEMDBase< float > const *)arg1)->omp_dynamic_chunksize(); 
+      (arg1)->set_external_emd_handler(*arg2); 
     }
     /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
     catch (std::invalid_argument& e) {
@@ -21938,41 +23216,31 @@ SWIGINTERN PyObject *_wrap_PairwiseEMDBaseFloat32_omp_dynamic_chunksize(PyObject
       SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
     }
   }
-  resultobj = SWIG_From_int(static_cast< int >(result));
+  resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_PairwiseEMDBaseFloat32_set_request_mode(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+SWIGINTERN PyObject *_wrap_PairwiseEMDBaseFloat32_have_external_emd_handler(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   wasserstein::PairwiseEMDBase< float > *arg1 = (wasserstein::PairwiseEMDBase< float > *) 0 ;
-  bool arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  bool val2 ;
-  int ecode2 = 0 ;
-  PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
-  char * kwnames[] = {
-    (char *)"self",  (char *)"mode",  NULL 
-  };
+  PyObject *swig_obj[1] ;
+  bool result;
   
-  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:PairwiseEMDBaseFloat32_set_request_mode", kwnames, &obj0, &obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDBaseT_float_t, 0 |  0 );
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDBaseT_float_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDBaseFloat32_set_request_mode" "', argument " "1"" of type '" "wasserstein::PairwiseEMDBase< float > *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDBaseFloat32_have_external_emd_handler" "', argument " "1"" of type '" "wasserstein::PairwiseEMDBase< float > const *""'"); 
   }
   arg1 = reinterpret_cast< wasserstein::PairwiseEMDBase< float > * >(argp1);
-  ecode2 = SWIG_AsVal_bool(obj1, &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PairwiseEMDBaseFloat32_set_request_mode" "', argument " "2"" of type '" "bool""'");
-  } 
-  arg2 = static_cast< bool >(val2);
   {
     try {
-      (arg1)->set_request_mode(arg2); 
+      result = (bool)((wasserstein::PairwiseEMDBase< float > const *)arg1)->have_external_emd_handler(); 
     }
     /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
     catch (std::invalid_argument& e) {
@@ -21995,31 +23263,31 @@ SWIGINTERN PyObject *_wrap_PairwiseEMDBaseFloat32_set_request_mode(PyObject *SWI
       SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
     }
   }
-  resultobj = SWIG_Py_Void();
+  resultobj = SWIG_From_bool(static_cast< bool >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_PairwiseEMDBaseFloat32_request_mode(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_PairwiseEMDBaseFloat32_num_threads(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   wasserstein::PairwiseEMDBase< float > *arg1 = (wasserstein::PairwiseEMDBase< float > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject *swig_obj[1] ;
-  bool result;
+  int result;
   
   if (!args) SWIG_fail;
   swig_obj[0] = args;
   res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDBaseT_float_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDBaseFloat32_request_mode" "', argument " "1"" of type '" "wasserstein::PairwiseEMDBase< float > const *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDBaseFloat32_num_threads" "', argument " "1"" of type '" "wasserstein::PairwiseEMDBase< float > const *""'"); 
   }
   arg1 = reinterpret_cast< wasserstein::PairwiseEMDBase< float > * >(argp1);
   {
     try {
-      result = (bool)((wasserstein::PairwiseEMDBase< float > const *)arg1)->request_mode(); 
+      result = (int)((wasserstein::PairwiseEMDBase< float > const *)arg1)->num_threads(); 
     }
     /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
     catch (std::invalid_argument& e) {
@@ -22042,31 +23310,41 @@ SWIGINTERN PyObject *_wrap_PairwiseEMDBaseFloat32_request_mode(PyObject *SWIGUNU
       SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
     }
   }
-  resultobj = SWIG_From_bool(static_cast< bool >(result));
+  resultobj = SWIG_From_int(static_cast< int >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_PairwiseEMDBaseFloat32_duration(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_PairwiseEMDBaseFloat32_set_omp_dynamic_chunksize(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
   PyObject *resultobj = 0;
   wasserstein::PairwiseEMDBase< float > *arg1 = (wasserstein::PairwiseEMDBase< float > *) 0 ;
+  int arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  PyObject *swig_obj[1] ;
-  double result;
+  int val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"chunksize",  NULL 
+  };
   
-  if (!args) SWIG_fail;
-  swig_obj[0] = args;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDBaseT_float_t, 0 |  0 );
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:PairwiseEMDBaseFloat32_set_omp_dynamic_chunksize", kwnames, &obj0, &obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDBaseT_float_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDBaseFloat32_duration" "', argument " "1"" of type '" "wasserstein::PairwiseEMDBase< float > const *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDBaseFloat32_set_omp_dynamic_chunksize" "', argument " "1"" of type '" "wasserstein::PairwiseEMDBase< float > *""'"); 
   }
   arg1 = reinterpret_cast< wasserstein::PairwiseEMDBase< float > * >(argp1);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PairwiseEMDBaseFloat32_set_omp_dynamic_chunksize" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
   {
     try {
-      result = (double)((wasserstein::PairwiseEMDBase< float > const *)arg1)->duration(); 
+      (arg1)->set_omp_dynamic_chunksize(arg2); 
     }
     /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
     catch (std::invalid_argument& e) {
@@ -22089,7 +23367,205 @@ SWIGINTERN PyObject *_wrap_PairwiseEMDBaseFloat32_duration(PyObject *SWIGUNUSEDP
       SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
     }
   }
-  resultobj = SWIG_From_double(static_cast< double >(result));
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_PairwiseEMDBaseFloat32_omp_dynamic_chunksize(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  wasserstein::PairwiseEMDBase< float > *arg1 = (wasserstein::PairwiseEMDBase< float > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  int result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDBaseT_float_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDBaseFloat32_omp_dynamic_chunksize" "', argument " "1"" of type '" "wasserstein::PairwiseEMDBase< float > const *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::PairwiseEMDBase< float > * >(argp1);
+  {
+    try {
+      result = (int)((wasserstein::PairwiseEMDBase< float > const *)arg1)->omp_dynamic_chunksize(); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_From_int(static_cast< int >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_PairwiseEMDBaseFloat32_set_request_mode(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  wasserstein::PairwiseEMDBase< float > *arg1 = (wasserstein::PairwiseEMDBase< float > *) 0 ;
+  bool arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  bool val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"mode",  NULL 
+  };
+  
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:PairwiseEMDBaseFloat32_set_request_mode", kwnames, &obj0, &obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDBaseT_float_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDBaseFloat32_set_request_mode" "', argument " "1"" of type '" "wasserstein::PairwiseEMDBase< float > *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::PairwiseEMDBase< float > * >(argp1);
+  ecode2 = SWIG_AsVal_bool(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PairwiseEMDBaseFloat32_set_request_mode" "', argument " "2"" of type '" "bool""'");
+  } 
+  arg2 = static_cast< bool >(val2);
+  {
+    try {
+      (arg1)->set_request_mode(arg2); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_PairwiseEMDBaseFloat32_request_mode(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  wasserstein::PairwiseEMDBase< float > *arg1 = (wasserstein::PairwiseEMDBase< float > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  bool result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDBaseT_float_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDBaseFloat32_request_mode" "', argument " "1"" of type '" "wasserstein::PairwiseEMDBase< float > const *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::PairwiseEMDBase< float > * >(argp1);
+  {
+    try {
+      result = (bool)((wasserstein::PairwiseEMDBase< float > const *)arg1)->request_mode(); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_From_bool(static_cast< bool >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_PairwiseEMDBaseFloat32_duration(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  wasserstein::PairwiseEMDBase< float > *arg1 = (wasserstein::PairwiseEMDBase< float > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  double result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDBaseT_float_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDBaseFloat32_duration" "', argument " "1"" of type '" "wasserstein::PairwiseEMDBase< float > const *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::PairwiseEMDBase< float > * >(argp1);
+  {
+    try {
+      result = (double)((wasserstein::PairwiseEMDBase< float > const *)arg1)->duration(); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_From_double(static_cast< double >(result));
   return resultobj;
 fail:
   return NULL;
@@ -26804,6 +28280,53 @@ fail:
 }
 
 
+SWIGINTERN PyObject *_wrap_EMDFloat64_last_solver(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *arg1 = (wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  wasserstein::EMDSolver result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__EMDT_double_wasserstein__DefaultArrayEvent_wasserstein__EuclideanArrayDistance_wasserstein__DefaultNetworkSimplex_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDFloat64_last_solver" "', argument " "1"" of type '" "wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > const *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > * >(argp1);
+  {
+    try {
+      result = (wasserstein::EMDSolver)((wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > const *)arg1)->last_solver(); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_From_int(static_cast< int >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
 SWIGINTERN PyObject *_wrap_EMDFloat64___repr__(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *arg1 = (wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *) 0 ;
@@ -27269,116 +28792,96 @@ fail:
 }
 
 
-SWIGINTERN PyObject *EMDFloat64_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *obj;
-  if (!SWIG_Python_UnpackTuple(args, "swigregister", 1, 1, &obj)) return NULL;
-  SWIG_TypeNewClientData(SWIGTYPE_p_wasserstein__EMDT_double_wasserstein__DefaultArrayEvent_wasserstein__EuclideanArrayDistance_wasserstein__DefaultNetworkSimplex_t, SWIG_NewClientData(obj));
-  return SWIG_Py_Void();
-}
-
-SWIGINTERN PyObject *EMDFloat64_swiginit(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  return SWIG_Python_InitShadowInstance(args);
-}
-
-SWIGINTERN PyObject *_wrap_new_EMDFloat32(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+SWIGINTERN PyObject *_wrap_EMDFloat64_lower_bound(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
   PyObject *resultobj = 0;
-  float arg1 = (float) 1 ;
-  float arg2 = (float) 1 ;
-  bool arg3 = (bool) false ;
-  bool arg4 = (bool) false ;
-  bool arg5 = (bool) false ;
-  std::size_t arg6 = (std::size_t) 100000 ;
-  float arg7 = (float) 1000 ;
-  float arg8 = (float) 1 ;
-  float val1 ;
-  int ecode1 = 0 ;
-  float val2 ;
-  int ecode2 = 0 ;
-  bool val3 ;
-  int ecode3 = 0 ;
-  bool val4 ;
-  int ecode4 = 0 ;
-  bool val5 ;
-  int ecode5 = 0 ;
-  size_t val6 ;
-  int ecode6 = 0 ;
-  float val7 ;
-  int ecode7 = 0 ;
-  float val8 ;
-  int ecode8 = 0 ;
+  wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *arg1 = (wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *) 0 ;
+  double *arg2 = (double *) 0 ;
+  std::ptrdiff_t arg3 ;
+  double *arg4 = (double *) 0 ;
+  std::ptrdiff_t arg5 ;
+  std::ptrdiff_t arg6 ;
+  double *arg7 = (double *) 0 ;
+  std::ptrdiff_t arg8 ;
+  double *arg9 = (double *) 0 ;
+  std::ptrdiff_t arg10 ;
+  std::ptrdiff_t arg11 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyArrayObject *array2 = NULL ;
+  int is_new_object2 = 0 ;
+  PyArrayObject *array4 = NULL ;
+  int is_new_object4 = 0 ;
+  PyArrayObject *array7 = NULL ;
+  int is_new_object7 = 0 ;
+  PyArrayObject *array9 = NULL ;
+  int is_new_object9 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   PyObject * obj2 = 0 ;
   PyObject * obj3 = 0 ;
   PyObject * obj4 = 0 ;
-  PyObject * obj5 = 0 ;
-  PyObject * obj6 = 0 ;
-  PyObject * obj7 = 0 ;
   char * kwnames[] = {
-    (char *)"R",  (char *)"beta",  (char *)"norm",  (char *)"do_timing",  (char *)"external_dists",  (char *)"n_iter_max",  (char *)"epsilon_large_factor",  (char *)"epsilon_small_factor",  NULL 
+    (char *)"self",  (char *)"weights0",  (char *)"coords0",  (char *)"weights1",  (char *)"coords1",  NULL 
   };
-  wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *result = 0 ;
+  double result;
   
-  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|OOOOOOOO:new_EMDFloat32", kwnames, &obj0, &obj1, &obj2, &obj3, &obj4, &obj5, &obj6, &obj7)) SWIG_fail;
-  if (obj0) {
-    ecode1 = SWIG_AsVal_float(obj0, &val1);
-    if (!SWIG_IsOK(ecode1)) {
-      SWIG_exception_fail(SWIG_ArgError(ecode1), "in method '" "new_EMDFloat32" "', argument " "1"" of type '" "float""'");
-    } 
-    arg1 = static_cast< float >(val1);
-  }
-  if (obj1) {
-    ecode2 = SWIG_AsVal_float(obj1, &val2);
-    if (!SWIG_IsOK(ecode2)) {
-      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "new_EMDFloat32" "', argument " "2"" of type '" "float""'");
-    } 
-    arg2 = static_cast< float >(val2);
-  }
-  if (obj2) {
-    ecode3 = SWIG_AsVal_bool(obj2, &val3);
-    if (!SWIG_IsOK(ecode3)) {
-      SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "new_EMDFloat32" "', argument " "3"" of type '" "bool""'");
-    } 
-    arg3 = static_cast< bool >(val3);
-  }
-  if (obj3) {
-    ecode4 = SWIG_AsVal_bool(obj3, &val4);
-    if (!SWIG_IsOK(ecode4)) {
-      SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "new_EMDFloat32" "', argument " "4"" of type '" "bool""'");
-    } 
-    arg4 = static_cast< bool >(val4);
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOOOO:EMDFloat64_lower_bound", kwnames, &obj0, &obj1, &obj2, &obj3, &obj4)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__EMDT_double_wasserstein__DefaultArrayEvent_wasserstein__EuclideanArrayDistance_wasserstein__DefaultNetworkSimplex_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDFloat64_lower_bound" "', argument " "1"" of type '" "wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *""'"); 
   }
-  if (obj4) {
-    ecode5 = SWIG_AsVal_bool(obj4, &val5);
-    if (!SWIG_IsOK(ecode5)) {
-      SWIG_exception_fail(SWIG_ArgError(ecode5), "in method '" "new_EMDFloat32" "', argument " "5"" of type '" "bool""'");
-    } 
-    arg5 = static_cast< bool >(val5);
+  arg1 = reinterpret_cast< wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > * >(argp1);
+  {
+    npy_intp size[1] = {
+      -1 
+    };
+    array2 = obj_to_array_contiguous_allow_conversion(obj1,
+      NPY_DOUBLE,
+      &is_new_object2);
+    if (!array2 || !require_dimensions(array2, 1) ||
+      !require_size(array2, size, 1)) SWIG_fail;
+    arg2 = (double*) array_data(array2);
+    arg3 = (std::ptrdiff_t) array_size(array2,0);
   }
-  if (obj5) {
-    ecode6 = SWIG_AsVal_size_t(obj5, &val6);
-    if (!SWIG_IsOK(ecode6)) {
-      SWIG_exception_fail(SWIG_ArgError(ecode6), "in method '" "new_EMDFloat32" "', argument " "6"" of type '" "std::size_t""'");
-    } 
-    arg6 = static_cast< std::size_t >(val6);
+  {
+    npy_intp size[2] = {
+      -1, -1 
+    };
+    array4 = obj_to_array_contiguous_allow_conversion(obj2, NPY_DOUBLE,
+      &is_new_object4);
+    if (!array4 || !require_dimensions(array4, 2) ||
+      !require_size(array4, size, 2)) SWIG_fail;
+    arg4 = (double*) array_data(array4);
+    arg5 = (std::ptrdiff_t) array_size(array4,0);
+    arg6 = (std::ptrdiff_t) array_size(array4,1);
   }
-  if (obj6) {
-    ecode7 = SWIG_AsVal_float(obj6, &val7);
-    if (!SWIG_IsOK(ecode7)) {
-      SWIG_exception_fail(SWIG_ArgError(ecode7), "in method '" "new_EMDFloat32" "', argument " "7"" of type '" "float""'");
-    } 
-    arg7 = static_cast< float >(val7);
+  {
+    npy_intp size[1] = {
+      -1 
+    };
+    array7 = obj_to_array_contiguous_allow_conversion(obj3,
+      NPY_DOUBLE,
+      &is_new_object7);
+    if (!array7 || !require_dimensions(array7, 1) ||
+      !require_size(array7, size, 1)) SWIG_fail;
+    arg7 = (double*) array_data(array7);
+    arg8 = (std::ptrdiff_t) array_size(array7,0);
   }
-  if (obj7) {
-    ecode8 = SWIG_AsVal_float(obj7, &val8);
-    if (!SWIG_IsOK(ecode8)) {
-      SWIG_exception_fail(SWIG_ArgError(ecode8), "in method '" "new_EMDFloat32" "', argument " "8"" of type '" "float""'");
-    } 
-    arg8 = static_cast< float >(val8);
+  {
+    npy_intp size[2] = {
+      -1, -1 
+    };
+    array9 = obj_to_array_contiguous_allow_conversion(obj4, NPY_DOUBLE,
+      &is_new_object9);
+    if (!array9 || !require_dimensions(array9, 2) ||
+      !require_size(array9, size, 2)) SWIG_fail;
+    arg9 = (double*) array_data(array9);
+    arg10 = (std::ptrdiff_t) array_size(array9,0);
+    arg11 = (std::ptrdiff_t) array_size(array9,1);
   }
   {
     try {
-      result = (wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *)new wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >(arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8); 
+      result = (double)wasserstein_EMD_Sl_double_Sc_wasserstein_DefaultArrayEvent_Sc_wasserstein_EuclideanArrayDistance_Sg__lower_bound(arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11); 
     }
     /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
     catch (std::invalid_argument& e) {
@@ -27401,90 +28904,151 @@ SWIGINTERN PyObject *_wrap_new_EMDFloat32(PyObject *SWIGUNUSEDPARM(self), PyObje
       SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
     }
   }
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_wasserstein__EMDT_float_wasserstein__DefaultArrayEvent_wasserstein__EuclideanArrayDistance_wasserstein__DefaultNetworkSimplex_t, SWIG_POINTER_NEW |  0 );
-  return resultobj;
-fail:
-  return NULL;
-}
-
-
-SWIGINTERN PyObject *_wrap_delete_EMDFloat32(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *resultobj = 0;
-  wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *arg1 = (wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *) 0 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  PyObject *swig_obj[1] ;
-  
-  if (!args) SWIG_fail;
-  swig_obj[0] = args;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__EMDT_float_wasserstein__DefaultArrayEvent_wasserstein__EuclideanArrayDistance_wasserstein__DefaultNetworkSimplex_t, SWIG_POINTER_DISOWN |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_EMDFloat32" "', argument " "1"" of type '" "wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *""'"); 
+  resultobj = SWIG_From_double(static_cast< double >(result));
+  {
+    if (is_new_object2 && array2)
+    {
+      Py_DECREF(array2); 
+    }
   }
-  arg1 = reinterpret_cast< wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > * >(argp1);
   {
-    try {
-      delete arg1; 
+    if (is_new_object4 && array4)
+    {
+      Py_DECREF(array4); 
     }
-    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
-    catch (std::invalid_argument& e) {
-      SWIG_exception_fail(SWIG_ValueError, e.what() );
-    } catch (std::domain_error& e) {
-      SWIG_exception_fail(SWIG_ValueError, e.what() );
-    } catch (std::overflow_error& e) {
-      SWIG_exception_fail(SWIG_OverflowError, e.what() );
-    } catch (std::out_of_range& e) {
-      SWIG_exception_fail(SWIG_IndexError, e.what() );
-    } catch (std::length_error& e) {
-      SWIG_exception_fail(SWIG_IndexError, e.what() );
-    } catch (std::runtime_error& e) {
-      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
-    } catch (std::exception& e) {
-      SWIG_exception_fail(SWIG_SystemError, e.what() );
+  }
+  {
+    if (is_new_object7 && array7)
+    {
+      Py_DECREF(array7); 
     }
-    /*@SWIG@*/
-    catch (...) {
-      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+  }
+  {
+    if (is_new_object9 && array9)
+    {
+      Py_DECREF(array9); 
     }
   }
-  resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
+  {
+    if (is_new_object2 && array2)
+    {
+      Py_DECREF(array2); 
+    }
+  }
+  {
+    if (is_new_object4 && array4)
+    {
+      Py_DECREF(array4); 
+    }
+  }
+  {
+    if (is_new_object7 && array7)
+    {
+      Py_DECREF(array7); 
+    }
+  }
+  {
+    if (is_new_object9 && array9)
+    {
+      Py_DECREF(array9); 
+    }
+  }
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_EMDFloat32_description(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+SWIGINTERN PyObject *_wrap_EMDFloat64_upper_bound(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
   PyObject *resultobj = 0;
-  wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *arg1 = (wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *) 0 ;
-  bool arg2 = (bool) true ;
+  wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *arg1 = (wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *) 0 ;
+  double *arg2 = (double *) 0 ;
+  std::ptrdiff_t arg3 ;
+  double *arg4 = (double *) 0 ;
+  std::ptrdiff_t arg5 ;
+  std::ptrdiff_t arg6 ;
+  double *arg7 = (double *) 0 ;
+  std::ptrdiff_t arg8 ;
+  double *arg9 = (double *) 0 ;
+  std::ptrdiff_t arg10 ;
+  std::ptrdiff_t arg11 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  bool val2 ;
-  int ecode2 = 0 ;
+  PyArrayObject *array2 = NULL ;
+  int is_new_object2 = 0 ;
+  PyArrayObject *array4 = NULL ;
+  int is_new_object4 = 0 ;
+  PyArrayObject *array7 = NULL ;
+  int is_new_object7 = 0 ;
+  PyArrayObject *array9 = NULL ;
+  int is_new_object9 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  PyObject * obj4 = 0 ;
   char * kwnames[] = {
-    (char *)"self",  (char *)"write_preprocessors",  NULL 
+    (char *)"self",  (char *)"weights0",  (char *)"coords0",  (char *)"weights1",  (char *)"coords1",  NULL 
   };
-  std::string result;
+  double result;
   
-  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|O:EMDFloat32_description", kwnames, &obj0, &obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__EMDT_float_wasserstein__DefaultArrayEvent_wasserstein__EuclideanArrayDistance_wasserstein__DefaultNetworkSimplex_t, 0 |  0 );
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOOOO:EMDFloat64_upper_bound", kwnames, &obj0, &obj1, &obj2, &obj3, &obj4)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__EMDT_double_wasserstein__DefaultArrayEvent_wasserstein__EuclideanArrayDistance_wasserstein__DefaultNetworkSimplex_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDFloat32_description" "', argument " "1"" of type '" "wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > const *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDFloat64_upper_bound" "', argument " "1"" of type '" "wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *""'"); 
   }
-  arg1 = reinterpret_cast< wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > * >(argp1);
-  if (obj1) {
-    ecode2 = SWIG_AsVal_bool(obj1, &val2);
-    if (!SWIG_IsOK(ecode2)) {
-      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "EMDFloat32_description" "', argument " "2"" of type '" "bool""'");
-    } 
-    arg2 = static_cast< bool >(val2);
+  arg1 = reinterpret_cast< wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > * >(argp1);
+  {
+    npy_intp size[1] = {
+      -1 
+    };
+    array2 = obj_to_array_contiguous_allow_conversion(obj1,
+      NPY_DOUBLE,
+      &is_new_object2);
+    if (!array2 || !require_dimensions(array2, 1) ||
+      !require_size(array2, size, 1)) SWIG_fail;
+    arg2 = (double*) array_data(array2);
+    arg3 = (std::ptrdiff_t) array_size(array2,0);
+  }
+  {
+    npy_intp size[2] = {
+      -1, -1 
+    };
+    array4 = obj_to_array_contiguous_allow_conversion(obj2, NPY_DOUBLE,
+      &is_new_object4);
+    if (!array4 || !require_dimensions(array4, 2) ||
+      !require_size(array4, size, 2)) SWIG_fail;
+    arg4 = (double*) array_data(array4);
+    arg5 = (std::ptrdiff_t) array_size(array4,0);
+    arg6 = (std::ptrdiff_t) array_size(array4,1);
+  }
+  {
+    npy_intp size[1] = {
+      -1 
+    };
+    array7 = obj_to_array_contiguous_allow_conversion(obj3,
+      NPY_DOUBLE,
+      &is_new_object7);
+    if (!array7 || !require_dimensions(array7, 1) ||
+      !require_size(array7, size, 1)) SWIG_fail;
+    arg7 = (double*) array_data(array7);
+    arg8 = (std::ptrdiff_t) array_size(array7,0);
+  }
+  {
+    npy_intp size[2] = {
+      -1, -1 
+    };
+    array9 = obj_to_array_contiguous_allow_conversion(obj4, NPY_DOUBLE,
+      &is_new_object9);
+    if (!array9 || !require_dimensions(array9, 2) ||
+      !require_size(array9, size, 2)) SWIG_fail;
+    arg9 = (double*) array_data(array9);
+    arg10 = (std::ptrdiff_t) array_size(array9,0);
+    arg11 = (std::ptrdiff_t) array_size(array9,1);
   }
   {
     try {
-      result = ((wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > const *)arg1)->description(arg2); 
+      result = (double)wasserstein_EMD_Sl_double_Sc_wasserstein_DefaultArrayEvent_Sc_wasserstein_EuclideanArrayDistance_Sg__upper_bound(arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11); 
     }
     /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
     catch (std::invalid_argument& e) {
@@ -27507,119 +29071,75 @@ SWIGINTERN PyObject *_wrap_EMDFloat32_description(PyObject *SWIGUNUSEDPARM(self)
       SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
     }
   }
-  resultobj = SWIG_From_std_string(static_cast< std::string >(result));
-  return resultobj;
-fail:
-  return NULL;
-}
-
-
-SWIGINTERN PyObject *_wrap_EMDFloat32___repr__(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *resultobj = 0;
-  wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *arg1 = (wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *) 0 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  PyObject *swig_obj[1] ;
-  std::string result;
-  
-  if (!args) SWIG_fail;
-  swig_obj[0] = args;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__EMDT_float_wasserstein__DefaultArrayEvent_wasserstein__EuclideanArrayDistance_wasserstein__DefaultNetworkSimplex_t, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDFloat32___repr__" "', argument " "1"" of type '" "wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > const *""'"); 
+  resultobj = SWIG_From_double(static_cast< double >(result));
+  {
+    if (is_new_object2 && array2)
+    {
+      Py_DECREF(array2); 
+    }
   }
-  arg1 = reinterpret_cast< wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > * >(argp1);
   {
-    try {
-      result = wasserstein_EMD_Sl_float_Sc_wasserstein_DefaultArrayEvent_Sc_wasserstein_EuclideanArrayDistance_Sg____repr__((wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > const *)arg1); 
+    if (is_new_object4 && array4)
+    {
+      Py_DECREF(array4); 
     }
-    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
-    catch (std::invalid_argument& e) {
-      SWIG_exception_fail(SWIG_ValueError, e.what() );
-    } catch (std::domain_error& e) {
-      SWIG_exception_fail(SWIG_ValueError, e.what() );
-    } catch (std::overflow_error& e) {
-      SWIG_exception_fail(SWIG_OverflowError, e.what() );
-    } catch (std::out_of_range& e) {
-      SWIG_exception_fail(SWIG_IndexError, e.what() );
-    } catch (std::length_error& e) {
-      SWIG_exception_fail(SWIG_IndexError, e.what() );
-    } catch (std::runtime_error& e) {
-      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
-    } catch (std::exception& e) {
-      SWIG_exception_fail(SWIG_SystemError, e.what() );
+  }
+  {
+    if (is_new_object7 && array7)
+    {
+      Py_DECREF(array7); 
     }
-    /*@SWIG@*/
-    catch (...) {
-      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+  }
+  {
+    if (is_new_object9 && array9)
+    {
+      Py_DECREF(array9); 
     }
   }
-  resultobj = SWIG_From_std_string(static_cast< std::string >(result));
   return resultobj;
 fail:
-  return NULL;
-}
-
-
-SWIGINTERN PyObject *_wrap_EMDFloat32_preprocess_CenterWeightedCentroid(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *resultobj = 0;
-  wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *arg1 = (wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *) 0 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  PyObject *swig_obj[1] ;
-  
-  if (!args) SWIG_fail;
-  swig_obj[0] = args;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__EMDT_float_wasserstein__DefaultArrayEvent_wasserstein__EuclideanArrayDistance_wasserstein__DefaultNetworkSimplex_t, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDFloat32_preprocess_CenterWeightedCentroid" "', argument " "1"" of type '" "wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *""'"); 
+  {
+    if (is_new_object2 && array2)
+    {
+      Py_DECREF(array2); 
+    }
   }
-  arg1 = reinterpret_cast< wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > * >(argp1);
   {
-    try {
-      wasserstein_EMD_Sl_float_Sc_wasserstein_DefaultArrayEvent_Sc_wasserstein_EuclideanArrayDistance_Sg__preprocess_CenterWeightedCentroid(arg1); 
+    if (is_new_object4 && array4)
+    {
+      Py_DECREF(array4); 
     }
-    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
-    catch (std::invalid_argument& e) {
-      SWIG_exception_fail(SWIG_ValueError, e.what() );
-    } catch (std::domain_error& e) {
-      SWIG_exception_fail(SWIG_ValueError, e.what() );
-    } catch (std::overflow_error& e) {
-      SWIG_exception_fail(SWIG_OverflowError, e.what() );
-    } catch (std::out_of_range& e) {
-      SWIG_exception_fail(SWIG_IndexError, e.what() );
-    } catch (std::length_error& e) {
-      SWIG_exception_fail(SWIG_IndexError, e.what() );
-    } catch (std::runtime_error& e) {
-      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
-    } catch (std::exception& e) {
-      SWIG_exception_fail(SWIG_SystemError, e.what() );
+  }
+  {
+    if (is_new_object7 && array7)
+    {
+      Py_DECREF(array7); 
     }
-    /*@SWIG@*/
-    catch (...) {
-      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+  }
+  {
+    if (is_new_object9 && array9)
+    {
+      Py_DECREF(array9); 
     }
   }
-  resultobj = SWIG_Py_Void();
-  return resultobj;
-fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_EMDFloat32___call____SWIG_1(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
+SWIGINTERN PyObject *_wrap_EMDFloat64_within(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
   PyObject *resultobj = 0;
-  wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *arg1 = (wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *) 0 ;
-  float *arg2 = (float *) 0 ;
+  wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *arg1 = (wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *) 0 ;
+  double *arg2 = (double *) 0 ;
   std::ptrdiff_t arg3 ;
-  float *arg4 = (float *) 0 ;
+  double *arg4 = (double *) 0 ;
   std::ptrdiff_t arg5 ;
   std::ptrdiff_t arg6 ;
-  float *arg7 = (float *) 0 ;
+  double *arg7 = (double *) 0 ;
   std::ptrdiff_t arg8 ;
-  float *arg9 = (float *) 0 ;
+  double *arg9 = (double *) 0 ;
   std::ptrdiff_t arg10 ;
   std::ptrdiff_t arg11 ;
+  double arg12 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyArrayObject *array2 = NULL ;
@@ -27630,35 +29150,46 @@ SWIGINTERN PyObject *_wrap_EMDFloat32___call____SWIG_1(PyObject *SWIGUNUSEDPARM(
   int is_new_object7 = 0 ;
   PyArrayObject *array9 = NULL ;
   int is_new_object9 = 0 ;
-  float result;
+  double val12 ;
+  int ecode12 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  PyObject * obj4 = 0 ;
+  PyObject * obj5 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"weights0",  (char *)"coords0",  (char *)"weights1",  (char *)"coords1",  (char *)"threshold",  NULL 
+  };
+  bool result;
   
-  if ((nobjs < 5) || (nobjs > 5)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__EMDT_float_wasserstein__DefaultArrayEvent_wasserstein__EuclideanArrayDistance_wasserstein__DefaultNetworkSimplex_t, 0 |  0 );
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOOOOO:EMDFloat64_within", kwnames, &obj0, &obj1, &obj2, &obj3, &obj4, &obj5)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__EMDT_double_wasserstein__DefaultArrayEvent_wasserstein__EuclideanArrayDistance_wasserstein__DefaultNetworkSimplex_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDFloat32___call__" "', argument " "1"" of type '" "wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDFloat64_within" "', argument " "1"" of type '" "wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *""'"); 
   }
-  arg1 = reinterpret_cast< wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > * >(argp1);
+  arg1 = reinterpret_cast< wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > * >(argp1);
   {
     npy_intp size[1] = {
       -1 
     };
-    array2 = obj_to_array_contiguous_allow_conversion(swig_obj[1],
-      NPY_FLOAT,
+    array2 = obj_to_array_contiguous_allow_conversion(obj1,
+      NPY_DOUBLE,
       &is_new_object2);
     if (!array2 || !require_dimensions(array2, 1) ||
       !require_size(array2, size, 1)) SWIG_fail;
-    arg2 = (float*) array_data(array2);
+    arg2 = (double*) array_data(array2);
     arg3 = (std::ptrdiff_t) array_size(array2,0);
   }
   {
     npy_intp size[2] = {
       -1, -1 
     };
-    array4 = obj_to_array_contiguous_allow_conversion(swig_obj[2], NPY_FLOAT,
+    array4 = obj_to_array_contiguous_allow_conversion(obj2, NPY_DOUBLE,
       &is_new_object4);
     if (!array4 || !require_dimensions(array4, 2) ||
       !require_size(array4, size, 2)) SWIG_fail;
-    arg4 = (float*) array_data(array4);
+    arg4 = (double*) array_data(array4);
     arg5 = (std::ptrdiff_t) array_size(array4,0);
     arg6 = (std::ptrdiff_t) array_size(array4,1);
   }
@@ -27666,29 +29197,34 @@ SWIGINTERN PyObject *_wrap_EMDFloat32___call____SWIG_1(PyObject *SWIGUNUSEDPARM(
     npy_intp size[1] = {
       -1 
     };
-    array7 = obj_to_array_contiguous_allow_conversion(swig_obj[3],
-      NPY_FLOAT,
+    array7 = obj_to_array_contiguous_allow_conversion(obj3,
+      NPY_DOUBLE,
       &is_new_object7);
     if (!array7 || !require_dimensions(array7, 1) ||
       !require_size(array7, size, 1)) SWIG_fail;
-    arg7 = (float*) array_data(array7);
+    arg7 = (double*) array_data(array7);
     arg8 = (std::ptrdiff_t) array_size(array7,0);
   }
   {
     npy_intp size[2] = {
       -1, -1 
     };
-    array9 = obj_to_array_contiguous_allow_conversion(swig_obj[4], NPY_FLOAT,
+    array9 = obj_to_array_contiguous_allow_conversion(obj4, NPY_DOUBLE,
       &is_new_object9);
     if (!array9 || !require_dimensions(array9, 2) ||
       !require_size(array9, size, 2)) SWIG_fail;
-    arg9 = (float*) array_data(array9);
+    arg9 = (double*) array_data(array9);
     arg10 = (std::ptrdiff_t) array_size(array9,0);
     arg11 = (std::ptrdiff_t) array_size(array9,1);
   }
+  ecode12 = SWIG_AsVal_double(obj5, &val12);
+  if (!SWIG_IsOK(ecode12)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode12), "in method '" "EMDFloat64_within" "', argument " "12"" of type '" "double""'");
+  } 
+  arg12 = static_cast< double >(val12);
   {
     try {
-      result = (float)wasserstein_EMD_Sl_float_Sc_wasserstein_DefaultArrayEvent_Sc_wasserstein_EuclideanArrayDistance_Sg__operator_Sp__SP___SWIG_1(arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11); 
+      result = (bool)wasserstein_EMD_Sl_double_Sc_wasserstein_DefaultArrayEvent_Sc_wasserstein_EuclideanArrayDistance_Sg__within(arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11,arg12); 
     }
     /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
     catch (std::invalid_argument& e) {
@@ -27711,7 +29247,7 @@ SWIGINTERN PyObject *_wrap_EMDFloat32___call____SWIG_1(PyObject *SWIGUNUSEDPARM(
       SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
     }
   }
-  resultobj = SWIG_From_float(static_cast< float >(result));
+  resultobj = SWIG_From_bool(static_cast< bool >(result));
   {
     if (is_new_object2 && array2)
     {
@@ -27766,243 +29302,30 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_EMDFloat32___call____SWIG_2(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
+SWIGINTERN PyObject *EMDFloat64_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *obj;
+  if (!SWIG_Python_UnpackTuple(args, "swigregister", 1, 1, &obj)) return NULL;
+  SWIG_TypeNewClientData(SWIGTYPE_p_wasserstein__EMDT_double_wasserstein__DefaultArrayEvent_wasserstein__EuclideanArrayDistance_wasserstein__DefaultNetworkSimplex_t, SWIG_NewClientData(obj));
+  return SWIG_Py_Void();
+}
+
+SWIGINTERN PyObject *EMDFloat64_swiginit(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  return SWIG_Python_InitShadowInstance(args);
+}
+
+SWIGINTERN PyObject *_wrap_new_EMDFloat32(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
   PyObject *resultobj = 0;
-  wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *arg1 = (wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *) 0 ;
-  float *arg2 = (float *) 0 ;
-  std::ptrdiff_t arg3 ;
-  float *arg4 = (float *) 0 ;
-  std::ptrdiff_t arg5 ;
-  float *arg6 = (float *) 0 ;
-  std::ptrdiff_t arg7 ;
-  std::ptrdiff_t arg8 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  PyArrayObject *array2 = NULL ;
-  int is_new_object2 = 0 ;
-  PyArrayObject *array4 = NULL ;
-  int is_new_object4 = 0 ;
-  PyArrayObject *array6 = NULL ;
-  int is_new_object6 = 0 ;
-  float result;
-  
-  if ((nobjs < 4) || (nobjs > 4)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__EMDT_float_wasserstein__DefaultArrayEvent_wasserstein__EuclideanArrayDistance_wasserstein__DefaultNetworkSimplex_t, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDFloat32___call__" "', argument " "1"" of type '" "wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *""'"); 
-  }
-  arg1 = reinterpret_cast< wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > * >(argp1);
-  {
-    npy_intp size[1] = {
-      -1 
-    };
-    array2 = obj_to_array_contiguous_allow_conversion(swig_obj[1],
-      NPY_FLOAT,
-      &is_new_object2);
-    if (!array2 || !require_dimensions(array2, 1) ||
-      !require_size(array2, size, 1)) SWIG_fail;
-    arg2 = (float*) array_data(array2);
-    arg3 = (std::ptrdiff_t) array_size(array2,0);
-  }
-  {
-    npy_intp size[1] = {
-      -1 
-    };
-    array4 = obj_to_array_contiguous_allow_conversion(swig_obj[2],
-      NPY_FLOAT,
-      &is_new_object4);
-    if (!array4 || !require_dimensions(array4, 1) ||
-      !require_size(array4, size, 1)) SWIG_fail;
-    arg4 = (float*) array_data(array4);
-    arg5 = (std::ptrdiff_t) array_size(array4,0);
-  }
-  {
-    npy_intp size[2] = {
-      -1, -1 
-    };
-    array6 = obj_to_array_contiguous_allow_conversion(swig_obj[3], NPY_FLOAT,
-      &is_new_object6);
-    if (!array6 || !require_dimensions(array6, 2) ||
-      !require_size(array6, size, 2)) SWIG_fail;
-    arg6 = (float*) array_data(array6);
-    arg7 = (std::ptrdiff_t) array_size(array6,0);
-    arg8 = (std::ptrdiff_t) array_size(array6,1);
-  }
-  {
-    try {
-      result = (float)wasserstein_EMD_Sl_float_Sc_wasserstein_DefaultArrayEvent_Sc_wasserstein_EuclideanArrayDistance_Sg__operator_Sp__SP___SWIG_2(arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8); 
-    }
-    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
-    catch (std::invalid_argument& e) {
-      SWIG_exception_fail(SWIG_ValueError, e.what() );
-    } catch (std::domain_error& e) {
-      SWIG_exception_fail(SWIG_ValueError, e.what() );
-    } catch (std::overflow_error& e) {
-      SWIG_exception_fail(SWIG_OverflowError, e.what() );
-    } catch (std::out_of_range& e) {
-      SWIG_exception_fail(SWIG_IndexError, e.what() );
-    } catch (std::length_error& e) {
-      SWIG_exception_fail(SWIG_IndexError, e.what() );
-    } catch (std::runtime_error& e) {
-      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
-    } catch (std::exception& e) {
-      SWIG_exception_fail(SWIG_SystemError, e.what() );
-    }
-    /*@SWIG@*/
-    catch (...) {
-      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
-    }
-  }
-  resultobj = SWIG_From_float(static_cast< float >(result));
-  {
-    if (is_new_object2 && array2)
-    {
-      Py_DECREF(array2); 
-    }
-  }
-  {
-    if (is_new_object4 && array4)
-    {
-      Py_DECREF(array4); 
-    }
-  }
-  {
-    if (is_new_object6 && array6)
-    {
-      Py_DECREF(array6); 
-    }
-  }
-  return resultobj;
-fail:
-  {
-    if (is_new_object2 && array2)
-    {
-      Py_DECREF(array2); 
-    }
-  }
-  {
-    if (is_new_object4 && array4)
-    {
-      Py_DECREF(array4); 
-    }
-  }
-  {
-    if (is_new_object6 && array6)
-    {
-      Py_DECREF(array6); 
-    }
-  }
-  return NULL;
-}
-
-
-SWIGINTERN PyObject *_wrap_EMDFloat32___call__(PyObject *self, PyObject *args) {
-  Py_ssize_t argc;
-  PyObject *argv[6] = {
-    0
-  };
-  
-  if (!(argc = SWIG_Python_UnpackTuple(args, "EMDFloat32___call__", 0, 5, argv))) SWIG_fail;
-  --argc;
-  if (argc == 4) {
-    int _v;
-    void *vptr = 0;
-    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_wasserstein__EMDT_float_wasserstein__DefaultArrayEvent_wasserstein__EuclideanArrayDistance_wasserstein__DefaultNetworkSimplex_t, 0);
-    _v = SWIG_CheckState(res);
-    if (_v) {
-      {
-        _v = is_array(argv[1]) || PySequence_Check(argv[1]);
-      }
-      if (_v) {
-        {
-          _v = is_array(argv[2]) || PySequence_Check(argv[2]);
-        }
-        if (_v) {
-          {
-            _v = is_array(argv[3]) || PySequence_Check(argv[3]);
-          }
-          if (_v) {
-            if (argc <= 4) {
-              return _wrap_EMDFloat32___call____SWIG_2(self, argc, argv);
-            }
-            if (argc <= 5) {
-              return _wrap_EMDFloat32___call____SWIG_2(self, argc, argv);
-            }
-            return _wrap_EMDFloat32___call____SWIG_2(self, argc, argv);
-          }
-        }
-      }
-    }
-  }
-  if (argc == 5) {
-    int _v;
-    void *vptr = 0;
-    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_wasserstein__EMDT_float_wasserstein__DefaultArrayEvent_wasserstein__EuclideanArrayDistance_wasserstein__DefaultNetworkSimplex_t, 0);
-    _v = SWIG_CheckState(res);
-    if (_v) {
-      {
-        _v = is_array(argv[1]) || PySequence_Check(argv[1]);
-      }
-      if (_v) {
-        {
-          _v = is_array(argv[2]) || PySequence_Check(argv[2]);
-        }
-        if (_v) {
-          {
-            _v = is_array(argv[3]) || PySequence_Check(argv[3]);
-          }
-          if (_v) {
-            {
-              _v = is_array(argv[4]) || PySequence_Check(argv[4]);
-            }
-            if (_v) {
-              if (argc <= 5) {
-                return _wrap_EMDFloat32___call____SWIG_1(self, argc, argv);
-              }
-              if (argc <= 6) {
-                return _wrap_EMDFloat32___call____SWIG_1(self, argc, argv);
-              }
-              return _wrap_EMDFloat32___call____SWIG_1(self, argc, argv);
-            }
-          }
-        }
-      }
-    }
-  }
-  
-fail:
-  SWIG_Python_RaiseOrModifyTypeError("Wrong number or type of arguments for overloaded function 'EMDFloat32___call__'.\n"
-    "  Possible C/C++ prototypes are:\n"
-    "    wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >::operator ()(float *,std::ptrdiff_t,float *,std::ptrdiff_t,std::ptrdiff_t,float *,std::ptrdiff_t,float *,std::ptrdiff_t,std::ptrdiff_t)\n"
-    "    wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >::operator ()(float *,std::ptrdiff_t,float *,std::ptrdiff_t,float *,std::ptrdiff_t,std::ptrdiff_t)\n");
-  return 0;
-}
-
-
-SWIGINTERN PyObject *EMDFloat32_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *obj;
-  if (!SWIG_Python_UnpackTuple(args, "swigregister", 1, 1, &obj)) return NULL;
-  SWIG_TypeNewClientData(SWIGTYPE_p_wasserstein__EMDT_float_wasserstein__DefaultArrayEvent_wasserstein__EuclideanArrayDistance_wasserstein__DefaultNetworkSimplex_t, SWIG_NewClientData(obj));
-  return SWIG_Py_Void();
-}
-
-SWIGINTERN PyObject *EMDFloat32_swiginit(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  return SWIG_Python_InitShadowInstance(args);
-}
-
-SWIGINTERN PyObject *_wrap_new_EMDYPhiFloat64(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
-  PyObject *resultobj = 0;
-  double arg1 = (double) 1 ;
-  double arg2 = (double) 1 ;
+  float arg1 = (float) 1 ;
+  float arg2 = (float) 1 ;
   bool arg3 = (bool) false ;
   bool arg4 = (bool) false ;
   bool arg5 = (bool) false ;
   std::size_t arg6 = (std::size_t) 100000 ;
-  double arg7 = (double) 1000 ;
-  double arg8 = (double) 1 ;
-  double val1 ;
+  float arg7 = (float) 1000 ;
+  float arg8 = (float) 1 ;
+  float val1 ;
   int ecode1 = 0 ;
-  double val2 ;
+  float val2 ;
   int ecode2 = 0 ;
   bool val3 ;
   int ecode3 = 0 ;
@@ -28012,9 +29335,9 @@ SWIGINTERN PyObject *_wrap_new_EMDYPhiFloat64(PyObject *SWIGUNUSEDPARM(self), Py
   int ecode5 = 0 ;
   size_t val6 ;
   int ecode6 = 0 ;
-  double val7 ;
+  float val7 ;
   int ecode7 = 0 ;
-  double val8 ;
+  float val8 ;
   int ecode8 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
@@ -28027,68 +29350,68 @@ SWIGINTERN PyObject *_wrap_new_EMDYPhiFloat64(PyObject *SWIGUNUSEDPARM(self), Py
   char * kwnames[] = {
     (char *)"R",  (char *)"beta",  (char *)"norm",  (char *)"do_timing",  (char *)"external_dists",  (char *)"n_iter_max",  (char *)"epsilon_large_factor",  (char *)"epsilon_small_factor",  NULL 
   };
-  wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *result = 0 ;
+  wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *result = 0 ;
   
-  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|OOOOOOOO:new_EMDYPhiFloat64", kwnames, &obj0, &obj1, &obj2, &obj3, &obj4, &obj5, &obj6, &obj7)) SWIG_fail;
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|OOOOOOOO:new_EMDFloat32", kwnames, &obj0, &obj1, &obj2, &obj3, &obj4, &obj5, &obj6, &obj7)) SWIG_fail;
   if (obj0) {
-    ecode1 = SWIG_AsVal_double(obj0, &val1);
+    ecode1 = SWIG_AsVal_float(obj0, &val1);
     if (!SWIG_IsOK(ecode1)) {
-      SWIG_exception_fail(SWIG_ArgError(ecode1), "in method '" "new_EMDYPhiFloat64" "', argument " "1"" of type '" "double""'");
+      SWIG_exception_fail(SWIG_ArgError(ecode1), "in method '" "new_EMDFloat32" "', argument " "1"" of type '" "float""'");
     } 
-    arg1 = static_cast< double >(val1);
+    arg1 = static_cast< float >(val1);
   }
   if (obj1) {
-    ecode2 = SWIG_AsVal_double(obj1, &val2);
+    ecode2 = SWIG_AsVal_float(obj1, &val2);
     if (!SWIG_IsOK(ecode2)) {
-      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "new_EMDYPhiFloat64" "', argument " "2"" of type '" "double""'");
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "new_EMDFloat32" "', argument " "2"" of type '" "float""'");
     } 
-    arg2 = static_cast< double >(val2);
+    arg2 = static_cast< float >(val2);
   }
   if (obj2) {
     ecode3 = SWIG_AsVal_bool(obj2, &val3);
     if (!SWIG_IsOK(ecode3)) {
-      SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "new_EMDYPhiFloat64" "', argument " "3"" of type '" "bool""'");
+      SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "new_EMDFloat32" "', argument " "3"" of type '" "bool""'");
     } 
     arg3 = static_cast< bool >(val3);
   }
   if (obj3) {
     ecode4 = SWIG_AsVal_bool(obj3, &val4);
     if (!SWIG_IsOK(ecode4)) {
-      SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "new_EMDYPhiFloat64" "', argument " "4"" of type '" "bool""'");
+      SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "new_EMDFloat32" "', argument " "4"" of type '" "bool""'");
     } 
     arg4 = static_cast< bool >(val4);
   }
   if (obj4) {
     ecode5 = SWIG_AsVal_bool(obj4, &val5);
     if (!SWIG_IsOK(ecode5)) {
-      SWIG_exception_fail(SWIG_ArgError(ecode5), "in method '" "new_EMDYPhiFloat64" "', argument " "5"" of type '" "bool""'");
+      SWIG_exception_fail(SWIG_ArgError(ecode5), "in method '" "new_EMDFloat32" "', argument " "5"" of type '" "bool""'");
     } 
     arg5 = static_cast< bool >(val5);
   }
   if (obj5) {
     ecode6 = SWIG_AsVal_size_t(obj5, &val6);
     if (!SWIG_IsOK(ecode6)) {
-      SWIG_exception_fail(SWIG_ArgError(ecode6), "in method '" "new_EMDYPhiFloat64" "', argument " "6"" of type '" "std::size_t""'");
+      SWIG_exception_fail(SWIG_ArgError(ecode6), "in method '" "new_EMDFloat32" "', argument " "6"" of type '" "std::size_t""'");
     } 
     arg6 = static_cast< std::size_t >(val6);
   }
   if (obj6) {
-    ecode7 = SWIG_AsVal_double(obj6, &val7);
+    ecode7 = SWIG_AsVal_float(obj6, &val7);
     if (!SWIG_IsOK(ecode7)) {
-      SWIG_exception_fail(SWIG_ArgError(ecode7), "in method '" "new_EMDYPhiFloat64" "', argument " "7"" of type '" "double""'");
+      SWIG_exception_fail(SWIG_ArgError(ecode7), "in method '" "new_EMDFloat32" "', argument " "7"" of type '" "float""'");
     } 
-    arg7 = static_cast< double >(val7);
+    arg7 = static_cast< float >(val7);
   }
   if (obj7) {
-    ecode8 = SWIG_AsVal_double(obj7, &val8);
+    ecode8 = SWIG_AsVal_float(obj7, &val8);
     if (!SWIG_IsOK(ecode8)) {
-      SWIG_exception_fail(SWIG_ArgError(ecode8), "in method '" "new_EMDYPhiFloat64" "', argument " "8"" of type '" "double""'");
+      SWIG_exception_fail(SWIG_ArgError(ecode8), "in method '" "new_EMDFloat32" "', argument " "8"" of type '" "float""'");
     } 
-    arg8 = static_cast< double >(val8);
+    arg8 = static_cast< float >(val8);
   }
   {
     try {
-      result = (wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *)new wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >(arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8); 
+      result = (wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *)new wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >(arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8); 
     }
     /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
     catch (std::invalid_argument& e) {
@@ -28111,27 +29434,27 @@ SWIGINTERN PyObject *_wrap_new_EMDYPhiFloat64(PyObject *SWIGUNUSEDPARM(self), Py
       SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
     }
   }
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_wasserstein__EMDT_double_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t, SWIG_POINTER_NEW |  0 );
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_wasserstein__EMDT_float_wasserstein__DefaultArrayEvent_wasserstein__EuclideanArrayDistance_wasserstein__DefaultNetworkSimplex_t, SWIG_POINTER_NEW |  0 );
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_delete_EMDYPhiFloat64(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_delete_EMDFloat32(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *arg1 = (wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *) 0 ;
+  wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *arg1 = (wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject *swig_obj[1] ;
   
   if (!args) SWIG_fail;
   swig_obj[0] = args;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__EMDT_double_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t, SWIG_POINTER_DISOWN |  0 );
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__EMDT_float_wasserstein__DefaultArrayEvent_wasserstein__EuclideanArrayDistance_wasserstein__DefaultNetworkSimplex_t, SWIG_POINTER_DISOWN |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_EMDYPhiFloat64" "', argument " "1"" of type '" "wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_EMDFloat32" "', argument " "1"" of type '" "wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *""'"); 
   }
-  arg1 = reinterpret_cast< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > * >(argp1);
+  arg1 = reinterpret_cast< wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > * >(argp1);
   {
     try {
       delete arg1; 
@@ -28164,9 +29487,9 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_EMDYPhiFloat64_description(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+SWIGINTERN PyObject *_wrap_EMDFloat32_description(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
   PyObject *resultobj = 0;
-  wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *arg1 = (wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *) 0 ;
+  wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *arg1 = (wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *) 0 ;
   bool arg2 = (bool) true ;
   void *argp1 = 0 ;
   int res1 = 0 ;
@@ -28179,22 +29502,22 @@ SWIGINTERN PyObject *_wrap_EMDYPhiFloat64_description(PyObject *SWIGUNUSEDPARM(s
   };
   std::string result;
   
-  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|O:EMDYPhiFloat64_description", kwnames, &obj0, &obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__EMDT_double_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t, 0 |  0 );
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|O:EMDFloat32_description", kwnames, &obj0, &obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__EMDT_float_wasserstein__DefaultArrayEvent_wasserstein__EuclideanArrayDistance_wasserstein__DefaultNetworkSimplex_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDYPhiFloat64_description" "', argument " "1"" of type '" "wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > const *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDFloat32_description" "', argument " "1"" of type '" "wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > const *""'"); 
   }
-  arg1 = reinterpret_cast< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > * >(argp1);
+  arg1 = reinterpret_cast< wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > * >(argp1);
   if (obj1) {
     ecode2 = SWIG_AsVal_bool(obj1, &val2);
     if (!SWIG_IsOK(ecode2)) {
-      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "EMDYPhiFloat64_description" "', argument " "2"" of type '" "bool""'");
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "EMDFloat32_description" "', argument " "2"" of type '" "bool""'");
     } 
     arg2 = static_cast< bool >(val2);
   }
   {
     try {
-      result = ((wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > const *)arg1)->description(arg2); 
+      result = ((wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > const *)arg1)->description(arg2); 
     }
     /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
     catch (std::invalid_argument& e) {
@@ -28224,9 +29547,56 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_EMDYPhiFloat64___repr__(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_EMDFloat32_last_solver(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *arg1 = (wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *) 0 ;
+  wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *arg1 = (wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  wasserstein::EMDSolver result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__EMDT_float_wasserstein__DefaultArrayEvent_wasserstein__EuclideanArrayDistance_wasserstein__DefaultNetworkSimplex_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDFloat32_last_solver" "', argument " "1"" of type '" "wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > const *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > * >(argp1);
+  {
+    try {
+      result = (wasserstein::EMDSolver)((wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > const *)arg1)->last_solver(); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_From_int(static_cast< int >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_EMDFloat32___repr__(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *arg1 = (wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject *swig_obj[1] ;
@@ -28234,14 +29604,14 @@ SWIGINTERN PyObject *_wrap_EMDYPhiFloat64___repr__(PyObject *SWIGUNUSEDPARM(self
   
   if (!args) SWIG_fail;
   swig_obj[0] = args;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__EMDT_double_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__EMDT_float_wasserstein__DefaultArrayEvent_wasserstein__EuclideanArrayDistance_wasserstein__DefaultNetworkSimplex_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDYPhiFloat64___repr__" "', argument " "1"" of type '" "wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > const *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDFloat32___repr__" "', argument " "1"" of type '" "wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > const *""'"); 
   }
-  arg1 = reinterpret_cast< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > * >(argp1);
+  arg1 = reinterpret_cast< wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > * >(argp1);
   {
     try {
-      result = wasserstein_EMD_Sl_double_Sc_wasserstein_DefaultArray2Event_Sc_wasserstein_YPhiArrayDistance_Sg____repr__((wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > const *)arg1); 
+      result = wasserstein_EMD_Sl_float_Sc_wasserstein_DefaultArrayEvent_Sc_wasserstein_EuclideanArrayDistance_Sg____repr__((wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > const *)arg1); 
     }
     /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
     catch (std::invalid_argument& e) {
@@ -28271,23 +29641,23 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_EMDYPhiFloat64_preprocess_CenterWeightedCentroid(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_EMDFloat32_preprocess_CenterWeightedCentroid(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *arg1 = (wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *) 0 ;
+  wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *arg1 = (wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject *swig_obj[1] ;
   
   if (!args) SWIG_fail;
   swig_obj[0] = args;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__EMDT_double_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__EMDT_float_wasserstein__DefaultArrayEvent_wasserstein__EuclideanArrayDistance_wasserstein__DefaultNetworkSimplex_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDYPhiFloat64_preprocess_CenterWeightedCentroid" "', argument " "1"" of type '" "wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDFloat32_preprocess_CenterWeightedCentroid" "', argument " "1"" of type '" "wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *""'"); 
   }
-  arg1 = reinterpret_cast< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > * >(argp1);
+  arg1 = reinterpret_cast< wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > * >(argp1);
   {
     try {
-      wasserstein_EMD_Sl_double_Sc_wasserstein_DefaultArray2Event_Sc_wasserstein_YPhiArrayDistance_Sg__preprocess_CenterWeightedCentroid(arg1); 
+      wasserstein_EMD_Sl_float_Sc_wasserstein_DefaultArrayEvent_Sc_wasserstein_EuclideanArrayDistance_Sg__preprocess_CenterWeightedCentroid(arg1); 
     }
     /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
     catch (std::invalid_argument& e) {
@@ -28317,17 +29687,17 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_EMDYPhiFloat64___call____SWIG_1(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
+SWIGINTERN PyObject *_wrap_EMDFloat32___call____SWIG_1(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
   PyObject *resultobj = 0;
-  wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *arg1 = (wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *) 0 ;
-  double *arg2 = (double *) 0 ;
+  wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *arg1 = (wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *) 0 ;
+  float *arg2 = (float *) 0 ;
   std::ptrdiff_t arg3 ;
-  double *arg4 = (double *) 0 ;
+  float *arg4 = (float *) 0 ;
   std::ptrdiff_t arg5 ;
   std::ptrdiff_t arg6 ;
-  double *arg7 = (double *) 0 ;
+  float *arg7 = (float *) 0 ;
   std::ptrdiff_t arg8 ;
-  double *arg9 = (double *) 0 ;
+  float *arg9 = (float *) 0 ;
   std::ptrdiff_t arg10 ;
   std::ptrdiff_t arg11 ;
   void *argp1 = 0 ;
@@ -28340,35 +29710,35 @@ SWIGINTERN PyObject *_wrap_EMDYPhiFloat64___call____SWIG_1(PyObject *SWIGUNUSEDP
   int is_new_object7 = 0 ;
   PyArrayObject *array9 = NULL ;
   int is_new_object9 = 0 ;
-  double result;
+  float result;
   
   if ((nobjs < 5) || (nobjs > 5)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__EMDT_double_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__EMDT_float_wasserstein__DefaultArrayEvent_wasserstein__EuclideanArrayDistance_wasserstein__DefaultNetworkSimplex_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDYPhiFloat64___call__" "', argument " "1"" of type '" "wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDFloat32___call__" "', argument " "1"" of type '" "wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *""'"); 
   }
-  arg1 = reinterpret_cast< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > * >(argp1);
+  arg1 = reinterpret_cast< wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > * >(argp1);
   {
     npy_intp size[1] = {
       -1 
     };
     array2 = obj_to_array_contiguous_allow_conversion(swig_obj[1],
-      NPY_DOUBLE,
+      NPY_FLOAT,
       &is_new_object2);
     if (!array2 || !require_dimensions(array2, 1) ||
       !require_size(array2, size, 1)) SWIG_fail;
-    arg2 = (double*) array_data(array2);
+    arg2 = (float*) array_data(array2);
     arg3 = (std::ptrdiff_t) array_size(array2,0);
   }
   {
     npy_intp size[2] = {
       -1, -1 
     };
-    array4 = obj_to_array_contiguous_allow_conversion(swig_obj[2], NPY_DOUBLE,
+    array4 = obj_to_array_contiguous_allow_conversion(swig_obj[2], NPY_FLOAT,
       &is_new_object4);
     if (!array4 || !require_dimensions(array4, 2) ||
       !require_size(array4, size, 2)) SWIG_fail;
-    arg4 = (double*) array_data(array4);
+    arg4 = (float*) array_data(array4);
     arg5 = (std::ptrdiff_t) array_size(array4,0);
     arg6 = (std::ptrdiff_t) array_size(array4,1);
   }
@@ -28377,28 +29747,28 @@ SWIGINTERN PyObject *_wrap_EMDYPhiFloat64___call____SWIG_1(PyObject *SWIGUNUSEDP
       -1 
     };
     array7 = obj_to_array_contiguous_allow_conversion(swig_obj[3],
-      NPY_DOUBLE,
+      NPY_FLOAT,
       &is_new_object7);
     if (!array7 || !require_dimensions(array7, 1) ||
       !require_size(array7, size, 1)) SWIG_fail;
-    arg7 = (double*) array_data(array7);
+    arg7 = (float*) array_data(array7);
     arg8 = (std::ptrdiff_t) array_size(array7,0);
   }
   {
     npy_intp size[2] = {
       -1, -1 
     };
-    array9 = obj_to_array_contiguous_allow_conversion(swig_obj[4], NPY_DOUBLE,
+    array9 = obj_to_array_contiguous_allow_conversion(swig_obj[4], NPY_FLOAT,
       &is_new_object9);
     if (!array9 || !require_dimensions(array9, 2) ||
       !require_size(array9, size, 2)) SWIG_fail;
-    arg9 = (double*) array_data(array9);
+    arg9 = (float*) array_data(array9);
     arg10 = (std::ptrdiff_t) array_size(array9,0);
     arg11 = (std::ptrdiff_t) array_size(array9,1);
   }
   {
     try {
-      result = (double)wasserstein_EMD_Sl_double_Sc_wasserstein_DefaultArray2Event_Sc_wasserstein_YPhiArrayDistance_Sg__operator_Sp__SP___SWIG_1(arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11); 
+      result = (float)wasserstein_EMD_Sl_float_Sc_wasserstein_DefaultArrayEvent_Sc_wasserstein_EuclideanArrayDistance_Sg__operator_Sp__SP___SWIG_1(arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11); 
     }
     /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
     catch (std::invalid_argument& e) {
@@ -28421,7 +29791,7 @@ SWIGINTERN PyObject *_wrap_EMDYPhiFloat64___call____SWIG_1(PyObject *SWIGUNUSEDP
       SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
     }
   }
-  resultobj = SWIG_From_double(static_cast< double >(result));
+  resultobj = SWIG_From_float(static_cast< float >(result));
   {
     if (is_new_object2 && array2)
     {
@@ -28476,14 +29846,14 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_EMDYPhiFloat64___call____SWIG_2(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
+SWIGINTERN PyObject *_wrap_EMDFloat32___call____SWIG_2(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
   PyObject *resultobj = 0;
-  wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *arg1 = (wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *) 0 ;
-  double *arg2 = (double *) 0 ;
+  wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *arg1 = (wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *) 0 ;
+  float *arg2 = (float *) 0 ;
   std::ptrdiff_t arg3 ;
-  double *arg4 = (double *) 0 ;
+  float *arg4 = (float *) 0 ;
   std::ptrdiff_t arg5 ;
-  double *arg6 = (double *) 0 ;
+  float *arg6 = (float *) 0 ;
   std::ptrdiff_t arg7 ;
   std::ptrdiff_t arg8 ;
   void *argp1 = 0 ;
@@ -28494,24 +29864,24 @@ SWIGINTERN PyObject *_wrap_EMDYPhiFloat64___call____SWIG_2(PyObject *SWIGUNUSEDP
   int is_new_object4 = 0 ;
   PyArrayObject *array6 = NULL ;
   int is_new_object6 = 0 ;
-  double result;
+  float result;
   
   if ((nobjs < 4) || (nobjs > 4)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__EMDT_double_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__EMDT_float_wasserstein__DefaultArrayEvent_wasserstein__EuclideanArrayDistance_wasserstein__DefaultNetworkSimplex_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDYPhiFloat64___call__" "', argument " "1"" of type '" "wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDFloat32___call__" "', argument " "1"" of type '" "wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *""'"); 
   }
-  arg1 = reinterpret_cast< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > * >(argp1);
+  arg1 = reinterpret_cast< wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > * >(argp1);
   {
     npy_intp size[1] = {
       -1 
     };
     array2 = obj_to_array_contiguous_allow_conversion(swig_obj[1],
-      NPY_DOUBLE,
+      NPY_FLOAT,
       &is_new_object2);
     if (!array2 || !require_dimensions(array2, 1) ||
       !require_size(array2, size, 1)) SWIG_fail;
-    arg2 = (double*) array_data(array2);
+    arg2 = (float*) array_data(array2);
     arg3 = (std::ptrdiff_t) array_size(array2,0);
   }
   {
@@ -28519,28 +29889,28 @@ SWIGINTERN PyObject *_wrap_EMDYPhiFloat64___call____SWIG_2(PyObject *SWIGUNUSEDP
       -1 
     };
     array4 = obj_to_array_contiguous_allow_conversion(swig_obj[2],
-      NPY_DOUBLE,
+      NPY_FLOAT,
       &is_new_object4);
     if (!array4 || !require_dimensions(array4, 1) ||
       !require_size(array4, size, 1)) SWIG_fail;
-    arg4 = (double*) array_data(array4);
+    arg4 = (float*) array_data(array4);
     arg5 = (std::ptrdiff_t) array_size(array4,0);
   }
   {
     npy_intp size[2] = {
       -1, -1 
     };
-    array6 = obj_to_array_contiguous_allow_conversion(swig_obj[3], NPY_DOUBLE,
+    array6 = obj_to_array_contiguous_allow_conversion(swig_obj[3], NPY_FLOAT,
       &is_new_object6);
     if (!array6 || !require_dimensions(array6, 2) ||
       !require_size(array6, size, 2)) SWIG_fail;
-    arg6 = (double*) array_data(array6);
+    arg6 = (float*) array_data(array6);
     arg7 = (std::ptrdiff_t) array_size(array6,0);
     arg8 = (std::ptrdiff_t) array_size(array6,1);
   }
   {
     try {
-      result = (double)wasserstein_EMD_Sl_double_Sc_wasserstein_DefaultArray2Event_Sc_wasserstein_YPhiArrayDistance_Sg__operator_Sp__SP___SWIG_2(arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8); 
+      result = (float)wasserstein_EMD_Sl_float_Sc_wasserstein_DefaultArrayEvent_Sc_wasserstein_EuclideanArrayDistance_Sg__operator_Sp__SP___SWIG_2(arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8); 
     }
     /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
     catch (std::invalid_argument& e) {
@@ -28563,7 +29933,7 @@ SWIGINTERN PyObject *_wrap_EMDYPhiFloat64___call____SWIG_2(PyObject *SWIGUNUSEDP
       SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
     }
   }
-  resultobj = SWIG_From_double(static_cast< double >(result));
+  resultobj = SWIG_From_float(static_cast< float >(result));
   {
     if (is_new_object2 && array2)
     {
@@ -28606,18 +29976,18 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_EMDYPhiFloat64___call__(PyObject *self, PyObject *args) {
+SWIGINTERN PyObject *_wrap_EMDFloat32___call__(PyObject *self, PyObject *args) {
   Py_ssize_t argc;
   PyObject *argv[6] = {
     0
   };
   
-  if (!(argc = SWIG_Python_UnpackTuple(args, "EMDYPhiFloat64___call__", 0, 5, argv))) SWIG_fail;
+  if (!(argc = SWIG_Python_UnpackTuple(args, "EMDFloat32___call__", 0, 5, argv))) SWIG_fail;
   --argc;
   if (argc == 4) {
     int _v;
     void *vptr = 0;
-    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_wasserstein__EMDT_double_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t, 0);
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_wasserstein__EMDT_float_wasserstein__DefaultArrayEvent_wasserstein__EuclideanArrayDistance_wasserstein__DefaultNetworkSimplex_t, 0);
     _v = SWIG_CheckState(res);
     if (_v) {
       {
@@ -28633,12 +30003,12 @@ SWIGINTERN PyObject *_wrap_EMDYPhiFloat64___call__(PyObject *self, PyObject *arg
           }
           if (_v) {
             if (argc <= 4) {
-              return _wrap_EMDYPhiFloat64___call____SWIG_2(self, argc, argv);
+              return _wrap_EMDFloat32___call____SWIG_2(self, argc, argv);
             }
             if (argc <= 5) {
-              return _wrap_EMDYPhiFloat64___call____SWIG_2(self, argc, argv);
+              return _wrap_EMDFloat32___call____SWIG_2(self, argc, argv);
             }
-            return _wrap_EMDYPhiFloat64___call____SWIG_2(self, argc, argv);
+            return _wrap_EMDFloat32___call____SWIG_2(self, argc, argv);
           }
         }
       }
@@ -28647,7 +30017,7 @@ SWIGINTERN PyObject *_wrap_EMDYPhiFloat64___call__(PyObject *self, PyObject *arg
   if (argc == 5) {
     int _v;
     void *vptr = 0;
-    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_wasserstein__EMDT_double_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t, 0);
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_wasserstein__EMDT_float_wasserstein__DefaultArrayEvent_wasserstein__EuclideanArrayDistance_wasserstein__DefaultNetworkSimplex_t, 0);
     _v = SWIG_CheckState(res);
     if (_v) {
       {
@@ -28667,12 +30037,12 @@ SWIGINTERN PyObject *_wrap_EMDYPhiFloat64___call__(PyObject *self, PyObject *arg
             }
             if (_v) {
               if (argc <= 5) {
-                return _wrap_EMDYPhiFloat64___call____SWIG_1(self, argc, argv);
+                return _wrap_EMDFloat32___call____SWIG_1(self, argc, argv);
               }
               if (argc <= 6) {
-                return _wrap_EMDYPhiFloat64___call____SWIG_1(self, argc, argv);
+                return _wrap_EMDFloat32___call____SWIG_1(self, argc, argv);
               }
-              return _wrap_EMDYPhiFloat64___call____SWIG_1(self, argc, argv);
+              return _wrap_EMDFloat32___call____SWIG_1(self, argc, argv);
             }
           }
         }
@@ -28681,124 +30051,104 @@ SWIGINTERN PyObject *_wrap_EMDYPhiFloat64___call__(PyObject *self, PyObject *arg
   }
   
 fail:
-  SWIG_Python_RaiseOrModifyTypeError("Wrong number or type of arguments for overloaded function 'EMDYPhiFloat64___call__'.\n"
+  SWIG_Python_RaiseOrModifyTypeError("Wrong number or type of arguments for overloaded function 'EMDFloat32___call__'.\n"
     "  Possible C/C++ prototypes are:\n"
-    "    wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >::operator ()(double *,std::ptrdiff_t,double *,std::ptrdiff_t,std::ptrdiff_t,double *,std::ptrdiff_t,double *,std::ptrdiff_t,std::ptrdiff_t)\n"
-    "    wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >::operator ()(double *,std::ptrdiff_t,double *,std::ptrdiff_t,double *,std::ptrdiff_t,std::ptrdiff_t)\n");
+    "    wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >::operator ()(float *,std::ptrdiff_t,float *,std::ptrdiff_t,std::ptrdiff_t,float *,std::ptrdiff_t,float *,std::ptrdiff_t,std::ptrdiff_t)\n"
+    "    wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >::operator ()(float *,std::ptrdiff_t,float *,std::ptrdiff_t,float *,std::ptrdiff_t,std::ptrdiff_t)\n");
   return 0;
 }
 
 
-SWIGINTERN PyObject *EMDYPhiFloat64_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *obj;
-  if (!SWIG_Python_UnpackTuple(args, "swigregister", 1, 1, &obj)) return NULL;
-  SWIG_TypeNewClientData(SWIGTYPE_p_wasserstein__EMDT_double_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t, SWIG_NewClientData(obj));
-  return SWIG_Py_Void();
-}
-
-SWIGINTERN PyObject *EMDYPhiFloat64_swiginit(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  return SWIG_Python_InitShadowInstance(args);
-}
-
-SWIGINTERN PyObject *_wrap_new_EMDYPhiFloat32(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+SWIGINTERN PyObject *_wrap_EMDFloat32_lower_bound(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
   PyObject *resultobj = 0;
-  float arg1 = (float) 1 ;
-  float arg2 = (float) 1 ;
-  bool arg3 = (bool) false ;
-  bool arg4 = (bool) false ;
-  bool arg5 = (bool) false ;
-  std::size_t arg6 = (std::size_t) 100000 ;
-  float arg7 = (float) 1000 ;
-  float arg8 = (float) 1 ;
-  float val1 ;
-  int ecode1 = 0 ;
-  float val2 ;
-  int ecode2 = 0 ;
-  bool val3 ;
-  int ecode3 = 0 ;
-  bool val4 ;
-  int ecode4 = 0 ;
-  bool val5 ;
-  int ecode5 = 0 ;
-  size_t val6 ;
-  int ecode6 = 0 ;
-  float val7 ;
-  int ecode7 = 0 ;
-  float val8 ;
-  int ecode8 = 0 ;
-  PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
-  PyObject * obj2 = 0 ;
-  PyObject * obj3 = 0 ;
-  PyObject * obj4 = 0 ;
-  PyObject * obj5 = 0 ;
-  PyObject * obj6 = 0 ;
-  PyObject * obj7 = 0 ;
-  char * kwnames[] = {
-    (char *)"R",  (char *)"beta",  (char *)"norm",  (char *)"do_timing",  (char *)"external_dists",  (char *)"n_iter_max",  (char *)"epsilon_large_factor",  (char *)"epsilon_small_factor",  NULL 
-  };
-  wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *result = 0 ;
-  
-  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|OOOOOOOO:new_EMDYPhiFloat32", kwnames, &obj0, &obj1, &obj2, &obj3, &obj4, &obj5, &obj6, &obj7)) SWIG_fail;
-  if (obj0) {
-    ecode1 = SWIG_AsVal_float(obj0, &val1);
-    if (!SWIG_IsOK(ecode1)) {
-      SWIG_exception_fail(SWIG_ArgError(ecode1), "in method '" "new_EMDYPhiFloat32" "', argument " "1"" of type '" "float""'");
-    } 
-    arg1 = static_cast< float >(val1);
-  }
-  if (obj1) {
-    ecode2 = SWIG_AsVal_float(obj1, &val2);
-    if (!SWIG_IsOK(ecode2)) {
-      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "new_EMDYPhiFloat32" "', argument " "2"" of type '" "float""'");
-    } 
-    arg2 = static_cast< float >(val2);
-  }
-  if (obj2) {
-    ecode3 = SWIG_AsVal_bool(obj2, &val3);
-    if (!SWIG_IsOK(ecode3)) {
-      SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "new_EMDYPhiFloat32" "', argument " "3"" of type '" "bool""'");
-    } 
-    arg3 = static_cast< bool >(val3);
-  }
-  if (obj3) {
-    ecode4 = SWIG_AsVal_bool(obj3, &val4);
-    if (!SWIG_IsOK(ecode4)) {
-      SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "new_EMDYPhiFloat32" "', argument " "4"" of type '" "bool""'");
-    } 
-    arg4 = static_cast< bool >(val4);
+  wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *arg1 = (wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *) 0 ;
+  float *arg2 = (float *) 0 ;
+  std::ptrdiff_t arg3 ;
+  float *arg4 = (float *) 0 ;
+  std::ptrdiff_t arg5 ;
+  std::ptrdiff_t arg6 ;
+  float *arg7 = (float *) 0 ;
+  std::ptrdiff_t arg8 ;
+  float *arg9 = (float *) 0 ;
+  std::ptrdiff_t arg10 ;
+  std::ptrdiff_t arg11 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyArrayObject *array2 = NULL ;
+  int is_new_object2 = 0 ;
+  PyArrayObject *array4 = NULL ;
+  int is_new_object4 = 0 ;
+  PyArrayObject *array7 = NULL ;
+  int is_new_object7 = 0 ;
+  PyArrayObject *array9 = NULL ;
+  int is_new_object9 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  PyObject * obj4 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"weights0",  (char *)"coords0",  (char *)"weights1",  (char *)"coords1",  NULL 
+  };
+  float result;
+  
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOOOO:EMDFloat32_lower_bound", kwnames, &obj0, &obj1, &obj2, &obj3, &obj4)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__EMDT_float_wasserstein__DefaultArrayEvent_wasserstein__EuclideanArrayDistance_wasserstein__DefaultNetworkSimplex_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDFloat32_lower_bound" "', argument " "1"" of type '" "wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *""'"); 
   }
-  if (obj4) {
-    ecode5 = SWIG_AsVal_bool(obj4, &val5);
-    if (!SWIG_IsOK(ecode5)) {
-      SWIG_exception_fail(SWIG_ArgError(ecode5), "in method '" "new_EMDYPhiFloat32" "', argument " "5"" of type '" "bool""'");
-    } 
-    arg5 = static_cast< bool >(val5);
+  arg1 = reinterpret_cast< wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > * >(argp1);
+  {
+    npy_intp size[1] = {
+      -1 
+    };
+    array2 = obj_to_array_contiguous_allow_conversion(obj1,
+      NPY_FLOAT,
+      &is_new_object2);
+    if (!array2 || !require_dimensions(array2, 1) ||
+      !require_size(array2, size, 1)) SWIG_fail;
+    arg2 = (float*) array_data(array2);
+    arg3 = (std::ptrdiff_t) array_size(array2,0);
   }
-  if (obj5) {
-    ecode6 = SWIG_AsVal_size_t(obj5, &val6);
-    if (!SWIG_IsOK(ecode6)) {
-      SWIG_exception_fail(SWIG_ArgError(ecode6), "in method '" "new_EMDYPhiFloat32" "', argument " "6"" of type '" "std::size_t""'");
-    } 
-    arg6 = static_cast< std::size_t >(val6);
+  {
+    npy_intp size[2] = {
+      -1, -1 
+    };
+    array4 = obj_to_array_contiguous_allow_conversion(obj2, NPY_FLOAT,
+      &is_new_object4);
+    if (!array4 || !require_dimensions(array4, 2) ||
+      !require_size(array4, size, 2)) SWIG_fail;
+    arg4 = (float*) array_data(array4);
+    arg5 = (std::ptrdiff_t) array_size(array4,0);
+    arg6 = (std::ptrdiff_t) array_size(array4,1);
   }
-  if (obj6) {
-    ecode7 = SWIG_AsVal_float(obj6, &val7);
-    if (!SWIG_IsOK(ecode7)) {
-      SWIG_exception_fail(SWIG_ArgError(ecode7), "in method '" "new_EMDYPhiFloat32" "', argument " "7"" of type '" "float""'");
-    } 
-    arg7 = static_cast< float >(val7);
+  {
+    npy_intp size[1] = {
+      -1 
+    };
+    array7 = obj_to_array_contiguous_allow_conversion(obj3,
+      NPY_FLOAT,
+      &is_new_object7);
+    if (!array7 || !require_dimensions(array7, 1) ||
+      !require_size(array7, size, 1)) SWIG_fail;
+    arg7 = (float*) array_data(array7);
+    arg8 = (std::ptrdiff_t) array_size(array7,0);
   }
-  if (obj7) {
-    ecode8 = SWIG_AsVal_float(obj7, &val8);
-    if (!SWIG_IsOK(ecode8)) {
-      SWIG_exception_fail(SWIG_ArgError(ecode8), "in method '" "new_EMDYPhiFloat32" "', argument " "8"" of type '" "float""'");
-    } 
-    arg8 = static_cast< float >(val8);
+  {
+    npy_intp size[2] = {
+      -1, -1 
+    };
+    array9 = obj_to_array_contiguous_allow_conversion(obj4, NPY_FLOAT,
+      &is_new_object9);
+    if (!array9 || !require_dimensions(array9, 2) ||
+      !require_size(array9, size, 2)) SWIG_fail;
+    arg9 = (float*) array_data(array9);
+    arg10 = (std::ptrdiff_t) array_size(array9,0);
+    arg11 = (std::ptrdiff_t) array_size(array9,1);
   }
   {
     try {
-      result = (wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *)new wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >(arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8); 
+      result = (float)wasserstein_EMD_Sl_float_Sc_wasserstein_DefaultArrayEvent_Sc_wasserstein_EuclideanArrayDistance_Sg__lower_bound(arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11); 
     }
     /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
     catch (std::invalid_argument& e) {
@@ -28821,30 +30171,151 @@ SWIGINTERN PyObject *_wrap_new_EMDYPhiFloat32(PyObject *SWIGUNUSEDPARM(self), Py
       SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
     }
   }
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_wasserstein__EMDT_float_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t, SWIG_POINTER_NEW |  0 );
+  resultobj = SWIG_From_float(static_cast< float >(result));
+  {
+    if (is_new_object2 && array2)
+    {
+      Py_DECREF(array2); 
+    }
+  }
+  {
+    if (is_new_object4 && array4)
+    {
+      Py_DECREF(array4); 
+    }
+  }
+  {
+    if (is_new_object7 && array7)
+    {
+      Py_DECREF(array7); 
+    }
+  }
+  {
+    if (is_new_object9 && array9)
+    {
+      Py_DECREF(array9); 
+    }
+  }
   return resultobj;
 fail:
+  {
+    if (is_new_object2 && array2)
+    {
+      Py_DECREF(array2); 
+    }
+  }
+  {
+    if (is_new_object4 && array4)
+    {
+      Py_DECREF(array4); 
+    }
+  }
+  {
+    if (is_new_object7 && array7)
+    {
+      Py_DECREF(array7); 
+    }
+  }
+  {
+    if (is_new_object9 && array9)
+    {
+      Py_DECREF(array9); 
+    }
+  }
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_delete_EMDYPhiFloat32(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_EMDFloat32_upper_bound(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
   PyObject *resultobj = 0;
-  wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *arg1 = (wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *) 0 ;
+  wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *arg1 = (wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *) 0 ;
+  float *arg2 = (float *) 0 ;
+  std::ptrdiff_t arg3 ;
+  float *arg4 = (float *) 0 ;
+  std::ptrdiff_t arg5 ;
+  std::ptrdiff_t arg6 ;
+  float *arg7 = (float *) 0 ;
+  std::ptrdiff_t arg8 ;
+  float *arg9 = (float *) 0 ;
+  std::ptrdiff_t arg10 ;
+  std::ptrdiff_t arg11 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  PyObject *swig_obj[1] ;
+  PyArrayObject *array2 = NULL ;
+  int is_new_object2 = 0 ;
+  PyArrayObject *array4 = NULL ;
+  int is_new_object4 = 0 ;
+  PyArrayObject *array7 = NULL ;
+  int is_new_object7 = 0 ;
+  PyArrayObject *array9 = NULL ;
+  int is_new_object9 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  PyObject * obj4 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"weights0",  (char *)"coords0",  (char *)"weights1",  (char *)"coords1",  NULL 
+  };
+  float result;
   
-  if (!args) SWIG_fail;
-  swig_obj[0] = args;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__EMDT_float_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t, SWIG_POINTER_DISOWN |  0 );
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOOOO:EMDFloat32_upper_bound", kwnames, &obj0, &obj1, &obj2, &obj3, &obj4)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__EMDT_float_wasserstein__DefaultArrayEvent_wasserstein__EuclideanArrayDistance_wasserstein__DefaultNetworkSimplex_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_EMDYPhiFloat32" "', argument " "1"" of type '" "wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDFloat32_upper_bound" "', argument " "1"" of type '" "wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > * >(argp1);
+  {
+    npy_intp size[1] = {
+      -1 
+    };
+    array2 = obj_to_array_contiguous_allow_conversion(obj1,
+      NPY_FLOAT,
+      &is_new_object2);
+    if (!array2 || !require_dimensions(array2, 1) ||
+      !require_size(array2, size, 1)) SWIG_fail;
+    arg2 = (float*) array_data(array2);
+    arg3 = (std::ptrdiff_t) array_size(array2,0);
+  }
+  {
+    npy_intp size[2] = {
+      -1, -1 
+    };
+    array4 = obj_to_array_contiguous_allow_conversion(obj2, NPY_FLOAT,
+      &is_new_object4);
+    if (!array4 || !require_dimensions(array4, 2) ||
+      !require_size(array4, size, 2)) SWIG_fail;
+    arg4 = (float*) array_data(array4);
+    arg5 = (std::ptrdiff_t) array_size(array4,0);
+    arg6 = (std::ptrdiff_t) array_size(array4,1);
+  }
+  {
+    npy_intp size[1] = {
+      -1 
+    };
+    array7 = obj_to_array_contiguous_allow_conversion(obj3,
+      NPY_FLOAT,
+      &is_new_object7);
+    if (!array7 || !require_dimensions(array7, 1) ||
+      !require_size(array7, size, 1)) SWIG_fail;
+    arg7 = (float*) array_data(array7);
+    arg8 = (std::ptrdiff_t) array_size(array7,0);
+  }
+  {
+    npy_intp size[2] = {
+      -1, -1 
+    };
+    array9 = obj_to_array_contiguous_allow_conversion(obj4, NPY_FLOAT,
+      &is_new_object9);
+    if (!array9 || !require_dimensions(array9, 2) ||
+      !require_size(array9, size, 2)) SWIG_fail;
+    arg9 = (float*) array_data(array9);
+    arg10 = (std::ptrdiff_t) array_size(array9,0);
+    arg11 = (std::ptrdiff_t) array_size(array9,1);
   }
-  arg1 = reinterpret_cast< wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > * >(argp1);
   {
     try {
-      delete arg1; 
+      result = (float)wasserstein_EMD_Sl_float_Sc_wasserstein_DefaultArrayEvent_Sc_wasserstein_EuclideanArrayDistance_Sg__upper_bound(arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11); 
     }
     /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
     catch (std::invalid_argument& e) {
@@ -28867,44 +30338,160 @@ SWIGINTERN PyObject *_wrap_delete_EMDYPhiFloat32(PyObject *SWIGUNUSEDPARM(self),
       SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
     }
   }
-  resultobj = SWIG_Py_Void();
+  resultobj = SWIG_From_float(static_cast< float >(result));
+  {
+    if (is_new_object2 && array2)
+    {
+      Py_DECREF(array2); 
+    }
+  }
+  {
+    if (is_new_object4 && array4)
+    {
+      Py_DECREF(array4); 
+    }
+  }
+  {
+    if (is_new_object7 && array7)
+    {
+      Py_DECREF(array7); 
+    }
+  }
+  {
+    if (is_new_object9 && array9)
+    {
+      Py_DECREF(array9); 
+    }
+  }
   return resultobj;
 fail:
+  {
+    if (is_new_object2 && array2)
+    {
+      Py_DECREF(array2); 
+    }
+  }
+  {
+    if (is_new_object4 && array4)
+    {
+      Py_DECREF(array4); 
+    }
+  }
+  {
+    if (is_new_object7 && array7)
+    {
+      Py_DECREF(array7); 
+    }
+  }
+  {
+    if (is_new_object9 && array9)
+    {
+      Py_DECREF(array9); 
+    }
+  }
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_EMDYPhiFloat32_description(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+SWIGINTERN PyObject *_wrap_EMDFloat32_within(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
   PyObject *resultobj = 0;
-  wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *arg1 = (wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *) 0 ;
-  bool arg2 = (bool) true ;
+  wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *arg1 = (wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *) 0 ;
+  float *arg2 = (float *) 0 ;
+  std::ptrdiff_t arg3 ;
+  float *arg4 = (float *) 0 ;
+  std::ptrdiff_t arg5 ;
+  std::ptrdiff_t arg6 ;
+  float *arg7 = (float *) 0 ;
+  std::ptrdiff_t arg8 ;
+  float *arg9 = (float *) 0 ;
+  std::ptrdiff_t arg10 ;
+  std::ptrdiff_t arg11 ;
+  float arg12 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  bool val2 ;
-  int ecode2 = 0 ;
+  PyArrayObject *array2 = NULL ;
+  int is_new_object2 = 0 ;
+  PyArrayObject *array4 = NULL ;
+  int is_new_object4 = 0 ;
+  PyArrayObject *array7 = NULL ;
+  int is_new_object7 = 0 ;
+  PyArrayObject *array9 = NULL ;
+  int is_new_object9 = 0 ;
+  float val12 ;
+  int ecode12 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  PyObject * obj4 = 0 ;
+  PyObject * obj5 = 0 ;
   char * kwnames[] = {
-    (char *)"self",  (char *)"write_preprocessors",  NULL 
+    (char *)"self",  (char *)"weights0",  (char *)"coords0",  (char *)"weights1",  (char *)"coords1",  (char *)"threshold",  NULL 
   };
-  std::string result;
+  bool result;
   
-  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|O:EMDYPhiFloat32_description", kwnames, &obj0, &obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__EMDT_float_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t, 0 |  0 );
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOOOOO:EMDFloat32_within", kwnames, &obj0, &obj1, &obj2, &obj3, &obj4, &obj5)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__EMDT_float_wasserstein__DefaultArrayEvent_wasserstein__EuclideanArrayDistance_wasserstein__DefaultNetworkSimplex_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDYPhiFloat32_description" "', argument " "1"" of type '" "wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > const *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDFloat32_within" "', argument " "1"" of type '" "wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > *""'"); 
   }
-  arg1 = reinterpret_cast< wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > * >(argp1);
-  if (obj1) {
-    ecode2 = SWIG_AsVal_bool(obj1, &val2);
-    if (!SWIG_IsOK(ecode2)) {
-      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "EMDYPhiFloat32_description" "', argument " "2"" of type '" "bool""'");
-    } 
-    arg2 = static_cast< bool >(val2);
+  arg1 = reinterpret_cast< wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance > * >(argp1);
+  {
+    npy_intp size[1] = {
+      -1 
+    };
+    array2 = obj_to_array_contiguous_allow_conversion(obj1,
+      NPY_FLOAT,
+      &is_new_object2);
+    if (!array2 || !require_dimensions(array2, 1) ||
+      !require_size(array2, size, 1)) SWIG_fail;
+    arg2 = (float*) array_data(array2);
+    arg3 = (std::ptrdiff_t) array_size(array2,0);
+  }
+  {
+    npy_intp size[2] = {
+      -1, -1 
+    };
+    array4 = obj_to_array_contiguous_allow_conversion(obj2, NPY_FLOAT,
+      &is_new_object4);
+    if (!array4 || !require_dimensions(array4, 2) ||
+      !require_size(array4, size, 2)) SWIG_fail;
+    arg4 = (float*) array_data(array4);
+    arg5 = (std::ptrdiff_t) array_size(array4,0);
+    arg6 = (std::ptrdiff_t) array_size(array4,1);
+  }
+  {
+    npy_intp size[1] = {
+      -1 
+    };
+    array7 = obj_to_array_contiguous_allow_conversion(obj3,
+      NPY_FLOAT,
+      &is_new_object7);
+    if (!array7 || !require_dimensions(array7, 1) ||
+      !require_size(array7, size, 1)) SWIG_fail;
+    arg7 = (float*) array_data(array7);
+    arg8 = (std::ptrdiff_t) array_size(array7,0);
   }
+  {
+    npy_intp size[2] = {
+      -1, -1 
+    };
+    array9 = obj_to_array_contiguous_allow_conversion(obj4, NPY_FLOAT,
+      &is_new_object9);
+    if (!array9 || !require_dimensions(array9, 2) ||
+      !require_size(array9, size, 2)) SWIG_fail;
+    arg9 = (float*) array_data(array9);
+    arg10 = (std::ptrdiff_t) array_size(array9,0);
+    arg11 = (std::ptrdiff_t) array_size(array9,1);
+  }
+  ecode12 = SWIG_AsVal_float(obj5, &val12);
+  if (!SWIG_IsOK(ecode12)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode12), "in method '" "EMDFloat32_within" "', argument " "12"" of type '" "float""'");
+  } 
+  arg12 = static_cast< float >(val12);
   {
     try {
-      result = ((wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > const *)arg1)->description(arg2); 
+      result = (bool)wasserstein_EMD_Sl_float_Sc_wasserstein_DefaultArrayEvent_Sc_wasserstein_EuclideanArrayDistance_Sg__within(arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11,arg12); 
     }
     /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
     catch (std::invalid_argument& e) {
@@ -28927,77 +30514,2175 @@ SWIGINTERN PyObject *_wrap_EMDYPhiFloat32_description(PyObject *SWIGUNUSEDPARM(s
       SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
     }
   }
-  resultobj = SWIG_From_std_string(static_cast< std::string >(result));
-  return resultobj;
-fail:
-  return NULL;
-}
-
-
-SWIGINTERN PyObject *_wrap_EMDYPhiFloat32___repr__(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *resultobj = 0;
-  wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *arg1 = (wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *) 0 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  PyObject *swig_obj[1] ;
-  std::string result;
-  
-  if (!args) SWIG_fail;
-  swig_obj[0] = args;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__EMDT_float_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDYPhiFloat32___repr__" "', argument " "1"" of type '" "wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > const *""'"); 
+  resultobj = SWIG_From_bool(static_cast< bool >(result));
+  {
+    if (is_new_object2 && array2)
+    {
+      Py_DECREF(array2); 
+    }
   }
-  arg1 = reinterpret_cast< wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > * >(argp1);
   {
-    try {
-      result = wasserstein_EMD_Sl_float_Sc_wasserstein_DefaultArray2Event_Sc_wasserstein_YPhiArrayDistance_Sg____repr__((wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > const *)arg1); 
+    if (is_new_object4 && array4)
+    {
+      Py_DECREF(array4); 
     }
-    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
-    catch (std::invalid_argument& e) {
-      SWIG_exception_fail(SWIG_ValueError, e.what() );
-    } catch (std::domain_error& e) {
-      SWIG_exception_fail(SWIG_ValueError, e.what() );
-    } catch (std::overflow_error& e) {
-      SWIG_exception_fail(SWIG_OverflowError, e.what() );
-    } catch (std::out_of_range& e) {
-      SWIG_exception_fail(SWIG_IndexError, e.what() );
-    } catch (std::length_error& e) {
-      SWIG_exception_fail(SWIG_IndexError, e.what() );
-    } catch (std::runtime_error& e) {
-      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
-    } catch (std::exception& e) {
-      SWIG_exception_fail(SWIG_SystemError, e.what() );
+  }
+  {
+    if (is_new_object7 && array7)
+    {
+      Py_DECREF(array7); 
     }
-    /*@SWIG@*/
-    catch (...) {
-      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+  }
+  {
+    if (is_new_object9 && array9)
+    {
+      Py_DECREF(array9); 
     }
   }
-  resultobj = SWIG_From_std_string(static_cast< std::string >(result));
   return resultobj;
 fail:
+  {
+    if (is_new_object2 && array2)
+    {
+      Py_DECREF(array2); 
+    }
+  }
+  {
+    if (is_new_object4 && array4)
+    {
+      Py_DECREF(array4); 
+    }
+  }
+  {
+    if (is_new_object7 && array7)
+    {
+      Py_DECREF(array7); 
+    }
+  }
+  {
+    if (is_new_object9 && array9)
+    {
+      Py_DECREF(array9); 
+    }
+  }
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_EMDYPhiFloat32_preprocess_CenterWeightedCentroid(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *EMDFloat32_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *obj;
+  if (!SWIG_Python_UnpackTuple(args, "swigregister", 1, 1, &obj)) return NULL;
+  SWIG_TypeNewClientData(SWIGTYPE_p_wasserstein__EMDT_float_wasserstein__DefaultArrayEvent_wasserstein__EuclideanArrayDistance_wasserstein__DefaultNetworkSimplex_t, SWIG_NewClientData(obj));
+  return SWIG_Py_Void();
+}
+
+SWIGINTERN PyObject *EMDFloat32_swiginit(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  return SWIG_Python_InitShadowInstance(args);
+}
+
+SWIGINTERN PyObject *_wrap_new_EMDYPhiFloat64(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
   PyObject *resultobj = 0;
-  wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *arg1 = (wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *) 0 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  PyObject *swig_obj[1] ;
-  
-  if (!args) SWIG_fail;
-  swig_obj[0] = args;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__EMDT_float_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDYPhiFloat32_preprocess_CenterWeightedCentroid" "', argument " "1"" of type '" "wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *""'"); 
+  double arg1 = (double) 1 ;
+  double arg2 = (double) 1 ;
+  bool arg3 = (bool) false ;
+  bool arg4 = (bool) false ;
+  bool arg5 = (bool) false ;
+  std::size_t arg6 = (std::size_t) 100000 ;
+  double arg7 = (double) 1000 ;
+  double arg8 = (double) 1 ;
+  double val1 ;
+  int ecode1 = 0 ;
+  double val2 ;
+  int ecode2 = 0 ;
+  bool val3 ;
+  int ecode3 = 0 ;
+  bool val4 ;
+  int ecode4 = 0 ;
+  bool val5 ;
+  int ecode5 = 0 ;
+  size_t val6 ;
+  int ecode6 = 0 ;
+  double val7 ;
+  int ecode7 = 0 ;
+  double val8 ;
+  int ecode8 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  PyObject * obj4 = 0 ;
+  PyObject * obj5 = 0 ;
+  PyObject * obj6 = 0 ;
+  PyObject * obj7 = 0 ;
+  char * kwnames[] = {
+    (char *)"R",  (char *)"beta",  (char *)"norm",  (char *)"do_timing",  (char *)"external_dists",  (char *)"n_iter_max",  (char *)"epsilon_large_factor",  (char *)"epsilon_small_factor",  NULL 
+  };
+  wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *result = 0 ;
+  
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|OOOOOOOO:new_EMDYPhiFloat64", kwnames, &obj0, &obj1, &obj2, &obj3, &obj4, &obj5, &obj6, &obj7)) SWIG_fail;
+  if (obj0) {
+    ecode1 = SWIG_AsVal_double(obj0, &val1);
+    if (!SWIG_IsOK(ecode1)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode1), "in method '" "new_EMDYPhiFloat64" "', argument " "1"" of type '" "double""'");
+    } 
+    arg1 = static_cast< double >(val1);
+  }
+  if (obj1) {
+    ecode2 = SWIG_AsVal_double(obj1, &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "new_EMDYPhiFloat64" "', argument " "2"" of type '" "double""'");
+    } 
+    arg2 = static_cast< double >(val2);
+  }
+  if (obj2) {
+    ecode3 = SWIG_AsVal_bool(obj2, &val3);
+    if (!SWIG_IsOK(ecode3)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "new_EMDYPhiFloat64" "', argument " "3"" of type '" "bool""'");
+    } 
+    arg3 = static_cast< bool >(val3);
+  }
+  if (obj3) {
+    ecode4 = SWIG_AsVal_bool(obj3, &val4);
+    if (!SWIG_IsOK(ecode4)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "new_EMDYPhiFloat64" "', argument " "4"" of type '" "bool""'");
+    } 
+    arg4 = static_cast< bool >(val4);
+  }
+  if (obj4) {
+    ecode5 = SWIG_AsVal_bool(obj4, &val5);
+    if (!SWIG_IsOK(ecode5)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode5), "in method '" "new_EMDYPhiFloat64" "', argument " "5"" of type '" "bool""'");
+    } 
+    arg5 = static_cast< bool >(val5);
+  }
+  if (obj5) {
+    ecode6 = SWIG_AsVal_size_t(obj5, &val6);
+    if (!SWIG_IsOK(ecode6)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode6), "in method '" "new_EMDYPhiFloat64" "', argument " "6"" of type '" "std::size_t""'");
+    } 
+    arg6 = static_cast< std::size_t >(val6);
+  }
+  if (obj6) {
+    ecode7 = SWIG_AsVal_double(obj6, &val7);
+    if (!SWIG_IsOK(ecode7)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode7), "in method '" "new_EMDYPhiFloat64" "', argument " "7"" of type '" "double""'");
+    } 
+    arg7 = static_cast< double >(val7);
+  }
+  if (obj7) {
+    ecode8 = SWIG_AsVal_double(obj7, &val8);
+    if (!SWIG_IsOK(ecode8)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode8), "in method '" "new_EMDYPhiFloat64" "', argument " "8"" of type '" "double""'");
+    } 
+    arg8 = static_cast< double >(val8);
+  }
+  {
+    try {
+      result = (wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *)new wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >(arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_wasserstein__EMDT_double_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t, SWIG_POINTER_NEW |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_delete_EMDYPhiFloat64(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *arg1 = (wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__EMDT_double_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t, SWIG_POINTER_DISOWN |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_EMDYPhiFloat64" "', argument " "1"" of type '" "wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > * >(argp1);
+  {
+    try {
+      delete arg1; 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_EMDYPhiFloat64_description(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *arg1 = (wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *) 0 ;
+  bool arg2 = (bool) true ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  bool val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"write_preprocessors",  NULL 
+  };
+  std::string result;
+  
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|O:EMDYPhiFloat64_description", kwnames, &obj0, &obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__EMDT_double_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDYPhiFloat64_description" "', argument " "1"" of type '" "wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > const *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > * >(argp1);
+  if (obj1) {
+    ecode2 = SWIG_AsVal_bool(obj1, &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "EMDYPhiFloat64_description" "', argument " "2"" of type '" "bool""'");
+    } 
+    arg2 = static_cast< bool >(val2);
+  }
+  {
+    try {
+      result = ((wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > const *)arg1)->description(arg2); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_From_std_string(static_cast< std::string >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_EMDYPhiFloat64_last_solver(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *arg1 = (wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  wasserstein::EMDSolver result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__EMDT_double_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDYPhiFloat64_last_solver" "', argument " "1"" of type '" "wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > const *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > * >(argp1);
+  {
+    try {
+      result = (wasserstein::EMDSolver)((wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > const *)arg1)->last_solver(); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_From_int(static_cast< int >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_EMDYPhiFloat64___repr__(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *arg1 = (wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  std::string result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__EMDT_double_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDYPhiFloat64___repr__" "', argument " "1"" of type '" "wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > const *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > * >(argp1);
+  {
+    try {
+      result = wasserstein_EMD_Sl_double_Sc_wasserstein_DefaultArray2Event_Sc_wasserstein_YPhiArrayDistance_Sg____repr__((wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > const *)arg1); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_From_std_string(static_cast< std::string >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_EMDYPhiFloat64_preprocess_CenterWeightedCentroid(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *arg1 = (wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__EMDT_double_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDYPhiFloat64_preprocess_CenterWeightedCentroid" "', argument " "1"" of type '" "wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > * >(argp1);
+  {
+    try {
+      wasserstein_EMD_Sl_double_Sc_wasserstein_DefaultArray2Event_Sc_wasserstein_YPhiArrayDistance_Sg__preprocess_CenterWeightedCentroid(arg1); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_EMDYPhiFloat64___call____SWIG_1(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
+  PyObject *resultobj = 0;
+  wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *arg1 = (wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *) 0 ;
+  double *arg2 = (double *) 0 ;
+  std::ptrdiff_t arg3 ;
+  double *arg4 = (double *) 0 ;
+  std::ptrdiff_t arg5 ;
+  std::ptrdiff_t arg6 ;
+  double *arg7 = (double *) 0 ;
+  std::ptrdiff_t arg8 ;
+  double *arg9 = (double *) 0 ;
+  std::ptrdiff_t arg10 ;
+  std::ptrdiff_t arg11 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyArrayObject *array2 = NULL ;
+  int is_new_object2 = 0 ;
+  PyArrayObject *array4 = NULL ;
+  int is_new_object4 = 0 ;
+  PyArrayObject *array7 = NULL ;
+  int is_new_object7 = 0 ;
+  PyArrayObject *array9 = NULL ;
+  int is_new_object9 = 0 ;
+  double result;
+  
+  if ((nobjs < 5) || (nobjs > 5)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__EMDT_double_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDYPhiFloat64___call__" "', argument " "1"" of type '" "wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > * >(argp1);
+  {
+    npy_intp size[1] = {
+      -1 
+    };
+    array2 = obj_to_array_contiguous_allow_conversion(swig_obj[1],
+      NPY_DOUBLE,
+      &is_new_object2);
+    if (!array2 || !require_dimensions(array2, 1) ||
+      !require_size(array2, size, 1)) SWIG_fail;
+    arg2 = (double*) array_data(array2);
+    arg3 = (std::ptrdiff_t) array_size(array2,0);
+  }
+  {
+    npy_intp size[2] = {
+      -1, -1 
+    };
+    array4 = obj_to_array_contiguous_allow_conversion(swig_obj[2], NPY_DOUBLE,
+      &is_new_object4);
+    if (!array4 || !require_dimensions(array4, 2) ||
+      !require_size(array4, size, 2)) SWIG_fail;
+    arg4 = (double*) array_data(array4);
+    arg5 = (std::ptrdiff_t) array_size(array4,0);
+    arg6 = (std::ptrdiff_t) array_size(array4,1);
+  }
+  {
+    npy_intp size[1] = {
+      -1 
+    };
+    array7 = obj_to_array_contiguous_allow_conversion(swig_obj[3],
+      NPY_DOUBLE,
+      &is_new_object7);
+    if (!array7 || !require_dimensions(array7, 1) ||
+      !require_size(array7, size, 1)) SWIG_fail;
+    arg7 = (double*) array_data(array7);
+    arg8 = (std::ptrdiff_t) array_size(array7,0);
+  }
+  {
+    npy_intp size[2] = {
+      -1, -1 
+    };
+    array9 = obj_to_array_contiguous_allow_conversion(swig_obj[4], NPY_DOUBLE,
+      &is_new_object9);
+    if (!array9 || !require_dimensions(array9, 2) ||
+      !require_size(array9, size, 2)) SWIG_fail;
+    arg9 = (double*) array_data(array9);
+    arg10 = (std::ptrdiff_t) array_size(array9,0);
+    arg11 = (std::ptrdiff_t) array_size(array9,1);
+  }
+  {
+    try {
+      result = (double)wasserstein_EMD_Sl_double_Sc_wasserstein_DefaultArray2Event_Sc_wasserstein_YPhiArrayDistance_Sg__operator_Sp__SP___SWIG_1(arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_From_double(static_cast< double >(result));
+  {
+    if (is_new_object2 && array2)
+    {
+      Py_DECREF(array2); 
+    }
+  }
+  {
+    if (is_new_object4 && array4)
+    {
+      Py_DECREF(array4); 
+    }
+  }
+  {
+    if (is_new_object7 && array7)
+    {
+      Py_DECREF(array7); 
+    }
+  }
+  {
+    if (is_new_object9 && array9)
+    {
+      Py_DECREF(array9); 
+    }
+  }
+  return resultobj;
+fail:
+  {
+    if (is_new_object2 && array2)
+    {
+      Py_DECREF(array2); 
+    }
+  }
+  {
+    if (is_new_object4 && array4)
+    {
+      Py_DECREF(array4); 
+    }
+  }
+  {
+    if (is_new_object7 && array7)
+    {
+      Py_DECREF(array7); 
+    }
+  }
+  {
+    if (is_new_object9 && array9)
+    {
+      Py_DECREF(array9); 
+    }
+  }
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_EMDYPhiFloat64___call____SWIG_2(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
+  PyObject *resultobj = 0;
+  wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *arg1 = (wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *) 0 ;
+  double *arg2 = (double *) 0 ;
+  std::ptrdiff_t arg3 ;
+  double *arg4 = (double *) 0 ;
+  std::ptrdiff_t arg5 ;
+  double *arg6 = (double *) 0 ;
+  std::ptrdiff_t arg7 ;
+  std::ptrdiff_t arg8 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyArrayObject *array2 = NULL ;
+  int is_new_object2 = 0 ;
+  PyArrayObject *array4 = NULL ;
+  int is_new_object4 = 0 ;
+  PyArrayObject *array6 = NULL ;
+  int is_new_object6 = 0 ;
+  double result;
+  
+  if ((nobjs < 4) || (nobjs > 4)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__EMDT_double_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDYPhiFloat64___call__" "', argument " "1"" of type '" "wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > * >(argp1);
+  {
+    npy_intp size[1] = {
+      -1 
+    };
+    array2 = obj_to_array_contiguous_allow_conversion(swig_obj[1],
+      NPY_DOUBLE,
+      &is_new_object2);
+    if (!array2 || !require_dimensions(array2, 1) ||
+      !require_size(array2, size, 1)) SWIG_fail;
+    arg2 = (double*) array_data(array2);
+    arg3 = (std::ptrdiff_t) array_size(array2,0);
+  }
+  {
+    npy_intp size[1] = {
+      -1 
+    };
+    array4 = obj_to_array_contiguous_allow_conversion(swig_obj[2],
+      NPY_DOUBLE,
+      &is_new_object4);
+    if (!array4 || !require_dimensions(array4, 1) ||
+      !require_size(array4, size, 1)) SWIG_fail;
+    arg4 = (double*) array_data(array4);
+    arg5 = (std::ptrdiff_t) array_size(array4,0);
+  }
+  {
+    npy_intp size[2] = {
+      -1, -1 
+    };
+    array6 = obj_to_array_contiguous_allow_conversion(swig_obj[3], NPY_DOUBLE,
+      &is_new_object6);
+    if (!array6 || !require_dimensions(array6, 2) ||
+      !require_size(array6, size, 2)) SWIG_fail;
+    arg6 = (double*) array_data(array6);
+    arg7 = (std::ptrdiff_t) array_size(array6,0);
+    arg8 = (std::ptrdiff_t) array_size(array6,1);
+  }
+  {
+    try {
+      result = (double)wasserstein_EMD_Sl_double_Sc_wasserstein_DefaultArray2Event_Sc_wasserstein_YPhiArrayDistance_Sg__operator_Sp__SP___SWIG_2(arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_From_double(static_cast< double >(result));
+  {
+    if (is_new_object2 && array2)
+    {
+      Py_DECREF(array2); 
+    }
+  }
+  {
+    if (is_new_object4 && array4)
+    {
+      Py_DECREF(array4); 
+    }
+  }
+  {
+    if (is_new_object6 && array6)
+    {
+      Py_DECREF(array6); 
+    }
+  }
+  return resultobj;
+fail:
+  {
+    if (is_new_object2 && array2)
+    {
+      Py_DECREF(array2); 
+    }
+  }
+  {
+    if (is_new_object4 && array4)
+    {
+      Py_DECREF(array4); 
+    }
+  }
+  {
+    if (is_new_object6 && array6)
+    {
+      Py_DECREF(array6); 
+    }
+  }
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_EMDYPhiFloat64___call__(PyObject *self, PyObject *args) {
+  Py_ssize_t argc;
+  PyObject *argv[6] = {
+    0
+  };
+  
+  if (!(argc = SWIG_Python_UnpackTuple(args, "EMDYPhiFloat64___call__", 0, 5, argv))) SWIG_fail;
+  --argc;
+  if (argc == 4) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_wasserstein__EMDT_double_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      {
+        _v = is_array(argv[1]) || PySequence_Check(argv[1]);
+      }
+      if (_v) {
+        {
+          _v = is_array(argv[2]) || PySequence_Check(argv[2]);
+        }
+        if (_v) {
+          {
+            _v = is_array(argv[3]) || PySequence_Check(argv[3]);
+          }
+          if (_v) {
+            if (argc <= 4) {
+              return _wrap_EMDYPhiFloat64___call____SWIG_2(self, argc, argv);
+            }
+            if (argc <= 5) {
+              return _wrap_EMDYPhiFloat64___call____SWIG_2(self, argc, argv);
+            }
+            return _wrap_EMDYPhiFloat64___call____SWIG_2(self, argc, argv);
+          }
+        }
+      }
+    }
+  }
+  if (argc == 5) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_wasserstein__EMDT_double_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      {
+        _v = is_array(argv[1]) || PySequence_Check(argv[1]);
+      }
+      if (_v) {
+        {
+          _v = is_array(argv[2]) || PySequence_Check(argv[2]);
+        }
+        if (_v) {
+          {
+            _v = is_array(argv[3]) || PySequence_Check(argv[3]);
+          }
+          if (_v) {
+            {
+              _v = is_array(argv[4]) || PySequence_Check(argv[4]);
+            }
+            if (_v) {
+              if (argc <= 5) {
+                return _wrap_EMDYPhiFloat64___call____SWIG_1(self, argc, argv);
+              }
+              if (argc <= 6) {
+                return _wrap_EMDYPhiFloat64___call____SWIG_1(self, argc, argv);
+              }
+              return _wrap_EMDYPhiFloat64___call____SWIG_1(self, argc, argv);
+            }
+          }
+        }
+      }
+    }
+  }
+  
+fail:
+  SWIG_Python_RaiseOrModifyTypeError("Wrong number or type of arguments for overloaded function 'EMDYPhiFloat64___call__'.\n"
+    "  Possible C/C++ prototypes are:\n"
+    "    wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >::operator ()(double *,std::ptrdiff_t,double *,std::ptrdiff_t,std::ptrdiff_t,double *,std::ptrdiff_t,double *,std::ptrdiff_t,std::ptrdiff_t)\n"
+    "    wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >::operator ()(double *,std::ptrdiff_t,double *,std::ptrdiff_t,double *,std::ptrdiff_t,std::ptrdiff_t)\n");
+  return 0;
+}
+
+
+SWIGINTERN PyObject *_wrap_EMDYPhiFloat64_lower_bound(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *arg1 = (wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *) 0 ;
+  double *arg2 = (double *) 0 ;
+  std::ptrdiff_t arg3 ;
+  double *arg4 = (double *) 0 ;
+  std::ptrdiff_t arg5 ;
+  std::ptrdiff_t arg6 ;
+  double *arg7 = (double *) 0 ;
+  std::ptrdiff_t arg8 ;
+  double *arg9 = (double *) 0 ;
+  std::ptrdiff_t arg10 ;
+  std::ptrdiff_t arg11 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyArrayObject *array2 = NULL ;
+  int is_new_object2 = 0 ;
+  PyArrayObject *array4 = NULL ;
+  int is_new_object4 = 0 ;
+  PyArrayObject *array7 = NULL ;
+  int is_new_object7 = 0 ;
+  PyArrayObject *array9 = NULL ;
+  int is_new_object9 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  PyObject * obj4 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"weights0",  (char *)"coords0",  (char *)"weights1",  (char *)"coords1",  NULL 
+  };
+  double result;
+  
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOOOO:EMDYPhiFloat64_lower_bound", kwnames, &obj0, &obj1, &obj2, &obj3, &obj4)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__EMDT_double_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDYPhiFloat64_lower_bound" "', argument " "1"" of type '" "wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > * >(argp1);
+  {
+    npy_intp size[1] = {
+      -1 
+    };
+    array2 = obj_to_array_contiguous_allow_conversion(obj1,
+      NPY_DOUBLE,
+      &is_new_object2);
+    if (!array2 || !require_dimensions(array2, 1) ||
+      !require_size(array2, size, 1)) SWIG_fail;
+    arg2 = (double*) array_data(array2);
+    arg3 = (std::ptrdiff_t) array_size(array2,0);
+  }
+  {
+    npy_intp size[2] = {
+      -1, -1 
+    };
+    array4 = obj_to_array_contiguous_allow_conversion(obj2, NPY_DOUBLE,
+      &is_new_object4);
+    if (!array4 || !require_dimensions(array4, 2) ||
+      !require_size(array4, size, 2)) SWIG_fail;
+    arg4 = (double*) array_data(array4);
+    arg5 = (std::ptrdiff_t) array_size(array4,0);
+    arg6 = (std::ptrdiff_t) array_size(array4,1);
+  }
+  {
+    npy_intp size[1] = {
+      -1 
+    };
+    array7 = obj_to_array_contiguous_allow_conversion(obj3,
+      NPY_DOUBLE,
+      &is_new_object7);
+    if (!array7 || !require_dimensions(array7, 1) ||
+      !require_size(array7, size, 1)) SWIG_fail;
+    arg7 = (double*) array_data(array7);
+    arg8 = (std::ptrdiff_t) array_size(array7,0);
+  }
+  {
+    npy_intp size[2] = {
+      -1, -1 
+    };
+    array9 = obj_to_array_contiguous_allow_conversion(obj4, NPY_DOUBLE,
+      &is_new_object9);
+    if (!array9 || !require_dimensions(array9, 2) ||
+      !require_size(array9, size, 2)) SWIG_fail;
+    arg9 = (double*) array_data(array9);
+    arg10 = (std::ptrdiff_t) array_size(array9,0);
+    arg11 = (std::ptrdiff_t) array_size(array9,1);
+  }
+  {
+    try {
+      result = (double)wasserstein_EMD_Sl_double_Sc_wasserstein_DefaultArray2Event_Sc_wasserstein_YPhiArrayDistance_Sg__lower_bound(arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_From_double(static_cast< double >(result));
+  {
+    if (is_new_object2 && array2)
+    {
+      Py_DECREF(array2); 
+    }
+  }
+  {
+    if (is_new_object4 && array4)
+    {
+      Py_DECREF(array4); 
+    }
+  }
+  {
+    if (is_new_object7 && array7)
+    {
+      Py_DECREF(array7); 
+    }
+  }
+  {
+    if (is_new_object9 && array9)
+    {
+      Py_DECREF(array9); 
+    }
+  }
+  return resultobj;
+fail:
+  {
+    if (is_new_object2 && array2)
+    {
+      Py_DECREF(array2); 
+    }
+  }
+  {
+    if (is_new_object4 && array4)
+    {
+      Py_DECREF(array4); 
+    }
+  }
+  {
+    if (is_new_object7 && array7)
+    {
+      Py_DECREF(array7); 
+    }
+  }
+  {
+    if (is_new_object9 && array9)
+    {
+      Py_DECREF(array9); 
+    }
+  }
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_EMDYPhiFloat64_upper_bound(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *arg1 = (wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *) 0 ;
+  double *arg2 = (double *) 0 ;
+  std::ptrdiff_t arg3 ;
+  double *arg4 = (double *) 0 ;
+  std::ptrdiff_t arg5 ;
+  std::ptrdiff_t arg6 ;
+  double *arg7 = (double *) 0 ;
+  std::ptrdiff_t arg8 ;
+  double *arg9 = (double *) 0 ;
+  std::ptrdiff_t arg10 ;
+  std::ptrdiff_t arg11 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyArrayObject *array2 = NULL ;
+  int is_new_object2 = 0 ;
+  PyArrayObject *array4 = NULL ;
+  int is_new_object4 = 0 ;
+  PyArrayObject *array7 = NULL ;
+  int is_new_object7 = 0 ;
+  PyArrayObject *array9 = NULL ;
+  int is_new_object9 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  PyObject * obj4 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"weights0",  (char *)"coords0",  (char *)"weights1",  (char *)"coords1",  NULL 
+  };
+  double result;
+  
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOOOO:EMDYPhiFloat64_upper_bound", kwnames, &obj0, &obj1, &obj2, &obj3, &obj4)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__EMDT_double_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDYPhiFloat64_upper_bound" "', argument " "1"" of type '" "wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > * >(argp1);
+  {
+    npy_intp size[1] = {
+      -1 
+    };
+    array2 = obj_to_array_contiguous_allow_conversion(obj1,
+      NPY_DOUBLE,
+      &is_new_object2);
+    if (!array2 || !require_dimensions(array2, 1) ||
+      !require_size(array2, size, 1)) SWIG_fail;
+    arg2 = (double*) array_data(array2);
+    arg3 = (std::ptrdiff_t) array_size(array2,0);
+  }
+  {
+    npy_intp size[2] = {
+      -1, -1 
+    };
+    array4 = obj_to_array_contiguous_allow_conversion(obj2, NPY_DOUBLE,
+      &is_new_object4);
+    if (!array4 || !require_dimensions(array4, 2) ||
+      !require_size(array4, size, 2)) SWIG_fail;
+    arg4 = (double*) array_data(array4);
+    arg5 = (std::ptrdiff_t) array_size(array4,0);
+    arg6 = (std::ptrdiff_t) array_size(array4,1);
+  }
+  {
+    npy_intp size[1] = {
+      -1 
+    };
+    array7 = obj_to_array_contiguous_allow_conversion(obj3,
+      NPY_DOUBLE,
+      &is_new_object7);
+    if (!array7 || !require_dimensions(array7, 1) ||
+      !require_size(array7, size, 1)) SWIG_fail;
+    arg7 = (double*) array_data(array7);
+    arg8 = (std::ptrdiff_t) array_size(array7,0);
+  }
+  {
+    npy_intp size[2] = {
+      -1, -1 
+    };
+    array9 = obj_to_array_contiguous_allow_conversion(obj4, NPY_DOUBLE,
+      &is_new_object9);
+    if (!array9 || !require_dimensions(array9, 2) ||
+      !require_size(array9, size, 2)) SWIG_fail;
+    arg9 = (double*) array_data(array9);
+    arg10 = (std::ptrdiff_t) array_size(array9,0);
+    arg11 = (std::ptrdiff_t) array_size(array9,1);
+  }
+  {
+    try {
+      result = (double)wasserstein_EMD_Sl_double_Sc_wasserstein_DefaultArray2Event_Sc_wasserstein_YPhiArrayDistance_Sg__upper_bound(arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_From_double(static_cast< double >(result));
+  {
+    if (is_new_object2 && array2)
+    {
+      Py_DECREF(array2); 
+    }
+  }
+  {
+    if (is_new_object4 && array4)
+    {
+      Py_DECREF(array4); 
+    }
+  }
+  {
+    if (is_new_object7 && array7)
+    {
+      Py_DECREF(array7); 
+    }
+  }
+  {
+    if (is_new_object9 && array9)
+    {
+      Py_DECREF(array9); 
+    }
+  }
+  return resultobj;
+fail:
+  {
+    if (is_new_object2 && array2)
+    {
+      Py_DECREF(array2); 
+    }
+  }
+  {
+    if (is_new_object4 && array4)
+    {
+      Py_DECREF(array4); 
+    }
+  }
+  {
+    if (is_new_object7 && array7)
+    {
+      Py_DECREF(array7); 
+    }
+  }
+  {
+    if (is_new_object9 && array9)
+    {
+      Py_DECREF(array9); 
+    }
+  }
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_EMDYPhiFloat64_within(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *arg1 = (wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *) 0 ;
+  double *arg2 = (double *) 0 ;
+  std::ptrdiff_t arg3 ;
+  double *arg4 = (double *) 0 ;
+  std::ptrdiff_t arg5 ;
+  std::ptrdiff_t arg6 ;
+  double *arg7 = (double *) 0 ;
+  std::ptrdiff_t arg8 ;
+  double *arg9 = (double *) 0 ;
+  std::ptrdiff_t arg10 ;
+  std::ptrdiff_t arg11 ;
+  double arg12 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyArrayObject *array2 = NULL ;
+  int is_new_object2 = 0 ;
+  PyArrayObject *array4 = NULL ;
+  int is_new_object4 = 0 ;
+  PyArrayObject *array7 = NULL ;
+  int is_new_object7 = 0 ;
+  PyArrayObject *array9 = NULL ;
+  int is_new_object9 = 0 ;
+  double val12 ;
+  int ecode12 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  PyObject * obj4 = 0 ;
+  PyObject * obj5 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"weights0",  (char *)"coords0",  (char *)"weights1",  (char *)"coords1",  (char *)"threshold",  NULL 
+  };
+  bool result;
+  
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOOOOO:EMDYPhiFloat64_within", kwnames, &obj0, &obj1, &obj2, &obj3, &obj4, &obj5)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__EMDT_double_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDYPhiFloat64_within" "', argument " "1"" of type '" "wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > * >(argp1);
+  {
+    npy_intp size[1] = {
+      -1 
+    };
+    array2 = obj_to_array_contiguous_allow_conversion(obj1,
+      NPY_DOUBLE,
+      &is_new_object2);
+    if (!array2 || !require_dimensions(array2, 1) ||
+      !require_size(array2, size, 1)) SWIG_fail;
+    arg2 = (double*) array_data(array2);
+    arg3 = (std::ptrdiff_t) array_size(array2,0);
+  }
+  {
+    npy_intp size[2] = {
+      -1, -1 
+    };
+    array4 = obj_to_array_contiguous_allow_conversion(obj2, NPY_DOUBLE,
+      &is_new_object4);
+    if (!array4 || !require_dimensions(array4, 2) ||
+      !require_size(array4, size, 2)) SWIG_fail;
+    arg4 = (double*) array_data(array4);
+    arg5 = (std::ptrdiff_t) array_size(array4,0);
+    arg6 = (std::ptrdiff_t) array_size(array4,1);
+  }
+  {
+    npy_intp size[1] = {
+      -1 
+    };
+    array7 = obj_to_array_contiguous_allow_conversion(obj3,
+      NPY_DOUBLE,
+      &is_new_object7);
+    if (!array7 || !require_dimensions(array7, 1) ||
+      !require_size(array7, size, 1)) SWIG_fail;
+    arg7 = (double*) array_data(array7);
+    arg8 = (std::ptrdiff_t) array_size(array7,0);
+  }
+  {
+    npy_intp size[2] = {
+      -1, -1 
+    };
+    array9 = obj_to_array_contiguous_allow_conversion(obj4, NPY_DOUBLE,
+      &is_new_object9);
+    if (!array9 || !require_dimensions(array9, 2) ||
+      !require_size(array9, size, 2)) SWIG_fail;
+    arg9 = (double*) array_data(array9);
+    arg10 = (std::ptrdiff_t) array_size(array9,0);
+    arg11 = (std::ptrdiff_t) array_size(array9,1);
+  }
+  ecode12 = SWIG_AsVal_double(obj5, &val12);
+  if (!SWIG_IsOK(ecode12)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode12), "in method '" "EMDYPhiFloat64_within" "', argument " "12"" of type '" "double""'");
+  } 
+  arg12 = static_cast< double >(val12);
+  {
+    try {
+      result = (bool)wasserstein_EMD_Sl_double_Sc_wasserstein_DefaultArray2Event_Sc_wasserstein_YPhiArrayDistance_Sg__within(arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11,arg12); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_From_bool(static_cast< bool >(result));
+  {
+    if (is_new_object2 && array2)
+    {
+      Py_DECREF(array2); 
+    }
+  }
+  {
+    if (is_new_object4 && array4)
+    {
+      Py_DECREF(array4); 
+    }
+  }
+  {
+    if (is_new_object7 && array7)
+    {
+      Py_DECREF(array7); 
+    }
+  }
+  {
+    if (is_new_object9 && array9)
+    {
+      Py_DECREF(array9); 
+    }
+  }
+  return resultobj;
+fail:
+  {
+    if (is_new_object2 && array2)
+    {
+      Py_DECREF(array2); 
+    }
+  }
+  {
+    if (is_new_object4 && array4)
+    {
+      Py_DECREF(array4); 
+    }
+  }
+  {
+    if (is_new_object7 && array7)
+    {
+      Py_DECREF(array7); 
+    }
+  }
+  {
+    if (is_new_object9 && array9)
+    {
+      Py_DECREF(array9); 
+    }
+  }
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *EMDYPhiFloat64_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *obj;
+  if (!SWIG_Python_UnpackTuple(args, "swigregister", 1, 1, &obj)) return NULL;
+  SWIG_TypeNewClientData(SWIGTYPE_p_wasserstein__EMDT_double_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t, SWIG_NewClientData(obj));
+  return SWIG_Py_Void();
+}
+
+SWIGINTERN PyObject *EMDYPhiFloat64_swiginit(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  return SWIG_Python_InitShadowInstance(args);
+}
+
+SWIGINTERN PyObject *_wrap_new_EMDYPhiFloat32(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  float arg1 = (float) 1 ;
+  float arg2 = (float) 1 ;
+  bool arg3 = (bool) false ;
+  bool arg4 = (bool) false ;
+  bool arg5 = (bool) false ;
+  std::size_t arg6 = (std::size_t) 100000 ;
+  float arg7 = (float) 1000 ;
+  float arg8 = (float) 1 ;
+  float val1 ;
+  int ecode1 = 0 ;
+  float val2 ;
+  int ecode2 = 0 ;
+  bool val3 ;
+  int ecode3 = 0 ;
+  bool val4 ;
+  int ecode4 = 0 ;
+  bool val5 ;
+  int ecode5 = 0 ;
+  size_t val6 ;
+  int ecode6 = 0 ;
+  float val7 ;
+  int ecode7 = 0 ;
+  float val8 ;
+  int ecode8 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  PyObject * obj4 = 0 ;
+  PyObject * obj5 = 0 ;
+  PyObject * obj6 = 0 ;
+  PyObject * obj7 = 0 ;
+  char * kwnames[] = {
+    (char *)"R",  (char *)"beta",  (char *)"norm",  (char *)"do_timing",  (char *)"external_dists",  (char *)"n_iter_max",  (char *)"epsilon_large_factor",  (char *)"epsilon_small_factor",  NULL 
+  };
+  wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *result = 0 ;
+  
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|OOOOOOOO:new_EMDYPhiFloat32", kwnames, &obj0, &obj1, &obj2, &obj3, &obj4, &obj5, &obj6, &obj7)) SWIG_fail;
+  if (obj0) {
+    ecode1 = SWIG_AsVal_float(obj0, &val1);
+    if (!SWIG_IsOK(ecode1)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode1), "in method '" "new_EMDYPhiFloat32" "', argument " "1"" of type '" "float""'");
+    } 
+    arg1 = static_cast< float >(val1);
+  }
+  if (obj1) {
+    ecode2 = SWIG_AsVal_float(obj1, &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "new_EMDYPhiFloat32" "', argument " "2"" of type '" "float""'");
+    } 
+    arg2 = static_cast< float >(val2);
+  }
+  if (obj2) {
+    ecode3 = SWIG_AsVal_bool(obj2, &val3);
+    if (!SWIG_IsOK(ecode3)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "new_EMDYPhiFloat32" "', argument " "3"" of type '" "bool""'");
+    } 
+    arg3 = static_cast< bool >(val3);
+  }
+  if (obj3) {
+    ecode4 = SWIG_AsVal_bool(obj3, &val4);
+    if (!SWIG_IsOK(ecode4)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "new_EMDYPhiFloat32" "', argument " "4"" of type '" "bool""'");
+    } 
+    arg4 = static_cast< bool >(val4);
+  }
+  if (obj4) {
+    ecode5 = SWIG_AsVal_bool(obj4, &val5);
+    if (!SWIG_IsOK(ecode5)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode5), "in method '" "new_EMDYPhiFloat32" "', argument " "5"" of type '" "bool""'");
+    } 
+    arg5 = static_cast< bool >(val5);
+  }
+  if (obj5) {
+    ecode6 = SWIG_AsVal_size_t(obj5, &val6);
+    if (!SWIG_IsOK(ecode6)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode6), "in method '" "new_EMDYPhiFloat32" "', argument " "6"" of type '" "std::size_t""'");
+    } 
+    arg6 = static_cast< std::size_t >(val6);
+  }
+  if (obj6) {
+    ecode7 = SWIG_AsVal_float(obj6, &val7);
+    if (!SWIG_IsOK(ecode7)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode7), "in method '" "new_EMDYPhiFloat32" "', argument " "7"" of type '" "float""'");
+    } 
+    arg7 = static_cast< float >(val7);
+  }
+  if (obj7) {
+    ecode8 = SWIG_AsVal_float(obj7, &val8);
+    if (!SWIG_IsOK(ecode8)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode8), "in method '" "new_EMDYPhiFloat32" "', argument " "8"" of type '" "float""'");
+    } 
+    arg8 = static_cast< float >(val8);
+  }
+  {
+    try {
+      result = (wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *)new wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >(arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_wasserstein__EMDT_float_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t, SWIG_POINTER_NEW |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_delete_EMDYPhiFloat32(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *arg1 = (wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__EMDT_float_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t, SWIG_POINTER_DISOWN |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_EMDYPhiFloat32" "', argument " "1"" of type '" "wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > * >(argp1);
+  {
+    try {
+      delete arg1; 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_EMDYPhiFloat32_description(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *arg1 = (wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *) 0 ;
+  bool arg2 = (bool) true ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  bool val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"write_preprocessors",  NULL 
+  };
+  std::string result;
+  
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|O:EMDYPhiFloat32_description", kwnames, &obj0, &obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__EMDT_float_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDYPhiFloat32_description" "', argument " "1"" of type '" "wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > const *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > * >(argp1);
+  if (obj1) {
+    ecode2 = SWIG_AsVal_bool(obj1, &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "EMDYPhiFloat32_description" "', argument " "2"" of type '" "bool""'");
+    } 
+    arg2 = static_cast< bool >(val2);
+  }
+  {
+    try {
+      result = ((wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > const *)arg1)->description(arg2); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_From_std_string(static_cast< std::string >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_EMDYPhiFloat32_last_solver(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *arg1 = (wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  wasserstein::EMDSolver result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__EMDT_float_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDYPhiFloat32_last_solver" "', argument " "1"" of type '" "wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > const *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > * >(argp1);
+  {
+    try {
+      result = (wasserstein::EMDSolver)((wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > const *)arg1)->last_solver(); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_From_int(static_cast< int >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_EMDYPhiFloat32___repr__(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *arg1 = (wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  std::string result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__EMDT_float_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDYPhiFloat32___repr__" "', argument " "1"" of type '" "wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > const *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > * >(argp1);
+  {
+    try {
+      result = wasserstein_EMD_Sl_float_Sc_wasserstein_DefaultArray2Event_Sc_wasserstein_YPhiArrayDistance_Sg____repr__((wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > const *)arg1); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_From_std_string(static_cast< std::string >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_EMDYPhiFloat32_preprocess_CenterWeightedCentroid(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *arg1 = (wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__EMDT_float_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDYPhiFloat32_preprocess_CenterWeightedCentroid" "', argument " "1"" of type '" "wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > * >(argp1);
+  {
+    try {
+      wasserstein_EMD_Sl_float_Sc_wasserstein_DefaultArray2Event_Sc_wasserstein_YPhiArrayDistance_Sg__preprocess_CenterWeightedCentroid(arg1); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_EMDYPhiFloat32___call____SWIG_1(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
+  PyObject *resultobj = 0;
+  wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *arg1 = (wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *) 0 ;
+  float *arg2 = (float *) 0 ;
+  std::ptrdiff_t arg3 ;
+  float *arg4 = (float *) 0 ;
+  std::ptrdiff_t arg5 ;
+  std::ptrdiff_t arg6 ;
+  float *arg7 = (float *) 0 ;
+  std::ptrdiff_t arg8 ;
+  float *arg9 = (float *) 0 ;
+  std::ptrdiff_t arg10 ;
+  std::ptrdiff_t arg11 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyArrayObject *array2 = NULL ;
+  int is_new_object2 = 0 ;
+  PyArrayObject *array4 = NULL ;
+  int is_new_object4 = 0 ;
+  PyArrayObject *array7 = NULL ;
+  int is_new_object7 = 0 ;
+  PyArrayObject *array9 = NULL ;
+  int is_new_object9 = 0 ;
+  float result;
+  
+  if ((nobjs < 5) || (nobjs > 5)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__EMDT_float_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDYPhiFloat32___call__" "', argument " "1"" of type '" "wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > * >(argp1);
+  {
+    npy_intp size[1] = {
+      -1 
+    };
+    array2 = obj_to_array_contiguous_allow_conversion(swig_obj[1],
+      NPY_FLOAT,
+      &is_new_object2);
+    if (!array2 || !require_dimensions(array2, 1) ||
+      !require_size(array2, size, 1)) SWIG_fail;
+    arg2 = (float*) array_data(array2);
+    arg3 = (std::ptrdiff_t) array_size(array2,0);
+  }
+  {
+    npy_intp size[2] = {
+      -1, -1 
+    };
+    array4 = obj_to_array_contiguous_allow_conversion(swig_obj[2], NPY_FLOAT,
+      &is_new_object4);
+    if (!array4 || !require_dimensions(array4, 2) ||
+      !require_size(array4, size, 2)) SWIG_fail;
+    arg4 = (float*) array_data(array4);
+    arg5 = (std::ptrdiff_t) array_size(array4,0);
+    arg6 = (std::ptrdiff_t) array_size(array4,1);
+  }
+  {
+    npy_intp size[1] = {
+      -1 
+    };
+    array7 = obj_to_array_contiguous_allow_conversion(swig_obj[3],
+      NPY_FLOAT,
+      &is_new_object7);
+    if (!array7 || !require_dimensions(array7, 1) ||
+      !require_size(array7, size, 1)) SWIG_fail;
+    arg7 = (float*) array_data(array7);
+    arg8 = (std::ptrdiff_t) array_size(array7,0);
+  }
+  {
+    npy_intp size[2] = {
+      -1, -1 
+    };
+    array9 = obj_to_array_contiguous_allow_conversion(swig_obj[4], NPY_FLOAT,
+      &is_new_object9);
+    if (!array9 || !require_dimensions(array9, 2) ||
+      !require_size(array9, size, 2)) SWIG_fail;
+    arg9 = (float*) array_data(array9);
+    arg10 = (std::ptrdiff_t) array_size(array9,0);
+    arg11 = (std::ptrdiff_t) array_size(array9,1);
+  }
+  {
+    try {
+      result = (float)wasserstein_EMD_Sl_float_Sc_wasserstein_DefaultArray2Event_Sc_wasserstein_YPhiArrayDistance_Sg__operator_Sp__SP___SWIG_1(arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_From_float(static_cast< float >(result));
+  {
+    if (is_new_object2 && array2)
+    {
+      Py_DECREF(array2); 
+    }
+  }
+  {
+    if (is_new_object4 && array4)
+    {
+      Py_DECREF(array4); 
+    }
+  }
+  {
+    if (is_new_object7 && array7)
+    {
+      Py_DECREF(array7); 
+    }
+  }
+  {
+    if (is_new_object9 && array9)
+    {
+      Py_DECREF(array9); 
+    }
+  }
+  return resultobj;
+fail:
+  {
+    if (is_new_object2 && array2)
+    {
+      Py_DECREF(array2); 
+    }
+  }
+  {
+    if (is_new_object4 && array4)
+    {
+      Py_DECREF(array4); 
+    }
+  }
+  {
+    if (is_new_object7 && array7)
+    {
+      Py_DECREF(array7); 
+    }
+  }
+  {
+    if (is_new_object9 && array9)
+    {
+      Py_DECREF(array9); 
+    }
+  }
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_EMDYPhiFloat32___call____SWIG_2(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
+  PyObject *resultobj = 0;
+  wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *arg1 = (wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *) 0 ;
+  float *arg2 = (float *) 0 ;
+  std::ptrdiff_t arg3 ;
+  float *arg4 = (float *) 0 ;
+  std::ptrdiff_t arg5 ;
+  float *arg6 = (float *) 0 ;
+  std::ptrdiff_t arg7 ;
+  std::ptrdiff_t arg8 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyArrayObject *array2 = NULL ;
+  int is_new_object2 = 0 ;
+  PyArrayObject *array4 = NULL ;
+  int is_new_object4 = 0 ;
+  PyArrayObject *array6 = NULL ;
+  int is_new_object6 = 0 ;
+  float result;
+  
+  if ((nobjs < 4) || (nobjs > 4)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__EMDT_float_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDYPhiFloat32___call__" "', argument " "1"" of type '" "wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > * >(argp1);
+  {
+    npy_intp size[1] = {
+      -1 
+    };
+    array2 = obj_to_array_contiguous_allow_conversion(swig_obj[1],
+      NPY_FLOAT,
+      &is_new_object2);
+    if (!array2 || !require_dimensions(array2, 1) ||
+      !require_size(array2, size, 1)) SWIG_fail;
+    arg2 = (float*) array_data(array2);
+    arg3 = (std::ptrdiff_t) array_size(array2,0);
+  }
+  {
+    npy_intp size[1] = {
+      -1 
+    };
+    array4 = obj_to_array_contiguous_allow_conversion(swig_obj[2],
+      NPY_FLOAT,
+      &is_new_object4);
+    if (!array4 || !require_dimensions(array4, 1) ||
+      !require_size(array4, size, 1)) SWIG_fail;
+    arg4 = (float*) array_data(array4);
+    arg5 = (std::ptrdiff_t) array_size(array4,0);
+  }
+  {
+    npy_intp size[2] = {
+      -1, -1 
+    };
+    array6 = obj_to_array_contiguous_allow_conversion(swig_obj[3], NPY_FLOAT,
+      &is_new_object6);
+    if (!array6 || !require_dimensions(array6, 2) ||
+      !require_size(array6, size, 2)) SWIG_fail;
+    arg6 = (float*) array_data(array6);
+    arg7 = (std::ptrdiff_t) array_size(array6,0);
+    arg8 = (std::ptrdiff_t) array_size(array6,1);
+  }
+  {
+    try {
+      result = (float)wasserstein_EMD_Sl_float_Sc_wasserstein_DefaultArray2Event_Sc_wasserstein_YPhiArrayDistance_Sg__operator_Sp__SP___SWIG_2(arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_From_float(static_cast< float >(result));
+  {
+    if (is_new_object2 && array2)
+    {
+      Py_DECREF(array2); 
+    }
+  }
+  {
+    if (is_new_object4 && array4)
+    {
+      Py_DECREF(array4); 
+    }
+  }
+  {
+    if (is_new_object6 && array6)
+    {
+      Py_DECREF(array6); 
+    }
+  }
+  return resultobj;
+fail:
+  {
+    if (is_new_object2 && array2)
+    {
+      Py_DECREF(array2); 
+    }
+  }
+  {
+    if (is_new_object4 && array4)
+    {
+      Py_DECREF(array4); 
+    }
+  }
+  {
+    if (is_new_object6 && array6)
+    {
+      Py_DECREF(array6); 
+    }
+  }
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_EMDYPhiFloat32___call__(PyObject *self, PyObject *args) {
+  Py_ssize_t argc;
+  PyObject *argv[6] = {
+    0
+  };
+  
+  if (!(argc = SWIG_Python_UnpackTuple(args, "EMDYPhiFloat32___call__", 0, 5, argv))) SWIG_fail;
+  --argc;
+  if (argc == 4) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_wasserstein__EMDT_float_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      {
+        _v = is_array(argv[1]) || PySequence_Check(argv[1]);
+      }
+      if (_v) {
+        {
+          _v = is_array(argv[2]) || PySequence_Check(argv[2]);
+        }
+        if (_v) {
+          {
+            _v = is_array(argv[3]) || PySequence_Check(argv[3]);
+          }
+          if (_v) {
+            if (argc <= 4) {
+              return _wrap_EMDYPhiFloat32___call____SWIG_2(self, argc, argv);
+            }
+            if (argc <= 5) {
+              return _wrap_EMDYPhiFloat32___call____SWIG_2(self, argc, argv);
+            }
+            return _wrap_EMDYPhiFloat32___call____SWIG_2(self, argc, argv);
+          }
+        }
+      }
+    }
+  }
+  if (argc == 5) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_wasserstein__EMDT_float_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      {
+        _v = is_array(argv[1]) || PySequence_Check(argv[1]);
+      }
+      if (_v) {
+        {
+          _v = is_array(argv[2]) || PySequence_Check(argv[2]);
+        }
+        if (_v) {
+          {
+            _v = is_array(argv[3]) || PySequence_Check(argv[3]);
+          }
+          if (_v) {
+            {
+              _v = is_array(argv[4]) || PySequence_Check(argv[4]);
+            }
+            if (_v) {
+              if (argc <= 5) {
+                return _wrap_EMDYPhiFloat32___call____SWIG_1(self, argc, argv);
+              }
+              if (argc <= 6) {
+                return _wrap_EMDYPhiFloat32___call____SWIG_1(self, argc, argv);
+              }
+              return _wrap_EMDYPhiFloat32___call____SWIG_1(self, argc, argv);
+            }
+          }
+        }
+      }
+    }
+  }
+  
+fail:
+  SWIG_Python_RaiseOrModifyTypeError("Wrong number or type of arguments for overloaded function 'EMDYPhiFloat32___call__'.\n"
+    "  Possible C/C++ prototypes are:\n"
+    "    wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >::operator ()(float *,std::ptrdiff_t,float *,std::ptrdiff_t,std::ptrdiff_t,float *,std::ptrdiff_t,float *,std::ptrdiff_t,std::ptrdiff_t)\n"
+    "    wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >::operator ()(float *,std::ptrdiff_t,float *,std::ptrdiff_t,float *,std::ptrdiff_t,std::ptrdiff_t)\n");
+  return 0;
+}
+
+
+SWIGINTERN PyObject *_wrap_EMDYPhiFloat32_lower_bound(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *arg1 = (wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *) 0 ;
+  float *arg2 = (float *) 0 ;
+  std::ptrdiff_t arg3 ;
+  float *arg4 = (float *) 0 ;
+  std::ptrdiff_t arg5 ;
+  std::ptrdiff_t arg6 ;
+  float *arg7 = (float *) 0 ;
+  std::ptrdiff_t arg8 ;
+  float *arg9 = (float *) 0 ;
+  std::ptrdiff_t arg10 ;
+  std::ptrdiff_t arg11 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyArrayObject *array2 = NULL ;
+  int is_new_object2 = 0 ;
+  PyArrayObject *array4 = NULL ;
+  int is_new_object4 = 0 ;
+  PyArrayObject *array7 = NULL ;
+  int is_new_object7 = 0 ;
+  PyArrayObject *array9 = NULL ;
+  int is_new_object9 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  PyObject * obj4 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"weights0",  (char *)"coords0",  (char *)"weights1",  (char *)"coords1",  NULL 
+  };
+  float result;
+  
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOOOO:EMDYPhiFloat32_lower_bound", kwnames, &obj0, &obj1, &obj2, &obj3, &obj4)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__EMDT_float_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDYPhiFloat32_lower_bound" "', argument " "1"" of type '" "wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > * >(argp1);
+  {
+    npy_intp size[1] = {
+      -1 
+    };
+    array2 = obj_to_array_contiguous_allow_conversion(obj1,
+      NPY_FLOAT,
+      &is_new_object2);
+    if (!array2 || !require_dimensions(array2, 1) ||
+      !require_size(array2, size, 1)) SWIG_fail;
+    arg2 = (float*) array_data(array2);
+    arg3 = (std::ptrdiff_t) array_size(array2,0);
+  }
+  {
+    npy_intp size[2] = {
+      -1, -1 
+    };
+    array4 = obj_to_array_contiguous_allow_conversion(obj2, NPY_FLOAT,
+      &is_new_object4);
+    if (!array4 || !require_dimensions(array4, 2) ||
+      !require_size(array4, size, 2)) SWIG_fail;
+    arg4 = (float*) array_data(array4);
+    arg5 = (std::ptrdiff_t) array_size(array4,0);
+    arg6 = (std::ptrdiff_t) array_size(array4,1);
+  }
+  {
+    npy_intp size[1] = {
+      -1 
+    };
+    array7 = obj_to_array_contiguous_allow_conversion(obj3,
+      NPY_FLOAT,
+      &is_new_object7);
+    if (!array7 || !require_dimensions(array7, 1) ||
+      !require_size(array7, size, 1)) SWIG_fail;
+    arg7 = (float*) array_data(array7);
+    arg8 = (std::ptrdiff_t) array_size(array7,0);
+  }
+  {
+    npy_intp size[2] = {
+      -1, -1 
+    };
+    array9 = obj_to_array_contiguous_allow_conversion(obj4, NPY_FLOAT,
+      &is_new_object9);
+    if (!array9 || !require_dimensions(array9, 2) ||
+      !require_size(array9, size, 2)) SWIG_fail;
+    arg9 = (float*) array_data(array9);
+    arg10 = (std::ptrdiff_t) array_size(array9,0);
+    arg11 = (std::ptrdiff_t) array_size(array9,1);
   }
-  arg1 = reinterpret_cast< wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > * >(argp1);
   {
     try {
-      wasserstein_EMD_Sl_float_Sc_wasserstein_DefaultArray2Event_Sc_wasserstein_YPhiArrayDistance_Sg__preprocess_CenterWeightedCentroid(arg1); 
+      result = (float)wasserstein_EMD_Sl_float_Sc_wasserstein_DefaultArray2Event_Sc_wasserstein_YPhiArrayDistance_Sg__lower_bound(arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11); 
     }
     /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
     catch (std::invalid_argument& e) {
@@ -29020,14 +32705,62 @@ SWIGINTERN PyObject *_wrap_EMDYPhiFloat32_preprocess_CenterWeightedCentroid(PyOb
       SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
     }
   }
-  resultobj = SWIG_Py_Void();
+  resultobj = SWIG_From_float(static_cast< float >(result));
+  {
+    if (is_new_object2 && array2)
+    {
+      Py_DECREF(array2); 
+    }
+  }
+  {
+    if (is_new_object4 && array4)
+    {
+      Py_DECREF(array4); 
+    }
+  }
+  {
+    if (is_new_object7 && array7)
+    {
+      Py_DECREF(array7); 
+    }
+  }
+  {
+    if (is_new_object9 && array9)
+    {
+      Py_DECREF(array9); 
+    }
+  }
   return resultobj;
 fail:
+  {
+    if (is_new_object2 && array2)
+    {
+      Py_DECREF(array2); 
+    }
+  }
+  {
+    if (is_new_object4 && array4)
+    {
+      Py_DECREF(array4); 
+    }
+  }
+  {
+    if (is_new_object7 && array7)
+    {
+      Py_DECREF(array7); 
+    }
+  }
+  {
+    if (is_new_object9 && array9)
+    {
+      Py_DECREF(array9); 
+    }
+  }
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_EMDYPhiFloat32___call____SWIG_1(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
+SWIGINTERN PyObject *_wrap_EMDYPhiFloat32_upper_bound(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
   PyObject *resultobj = 0;
   wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *arg1 = (wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *) 0 ;
   float *arg2 = (float *) 0 ;
@@ -29050,19 +32783,27 @@ SWIGINTERN PyObject *_wrap_EMDYPhiFloat32___call____SWIG_1(PyObject *SWIGUNUSEDP
   int is_new_object7 = 0 ;
   PyArrayObject *array9 = NULL ;
   int is_new_object9 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  PyObject * obj4 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"weights0",  (char *)"coords0",  (char *)"weights1",  (char *)"coords1",  NULL 
+  };
   float result;
   
-  if ((nobjs < 5) || (nobjs > 5)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__EMDT_float_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t, 0 |  0 );
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOOOO:EMDYPhiFloat32_upper_bound", kwnames, &obj0, &obj1, &obj2, &obj3, &obj4)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__EMDT_float_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDYPhiFloat32___call__" "', argument " "1"" of type '" "wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDYPhiFloat32_upper_bound" "', argument " "1"" of type '" "wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *""'"); 
   }
   arg1 = reinterpret_cast< wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > * >(argp1);
   {
     npy_intp size[1] = {
       -1 
     };
-    array2 = obj_to_array_contiguous_allow_conversion(swig_obj[1],
+    array2 = obj_to_array_contiguous_allow_conversion(obj1,
       NPY_FLOAT,
       &is_new_object2);
     if (!array2 || !require_dimensions(array2, 1) ||
@@ -29074,7 +32815,7 @@ SWIGINTERN PyObject *_wrap_EMDYPhiFloat32___call____SWIG_1(PyObject *SWIGUNUSEDP
     npy_intp size[2] = {
       -1, -1 
     };
-    array4 = obj_to_array_contiguous_allow_conversion(swig_obj[2], NPY_FLOAT,
+    array4 = obj_to_array_contiguous_allow_conversion(obj2, NPY_FLOAT,
       &is_new_object4);
     if (!array4 || !require_dimensions(array4, 2) ||
       !require_size(array4, size, 2)) SWIG_fail;
@@ -29086,7 +32827,7 @@ SWIGINTERN PyObject *_wrap_EMDYPhiFloat32___call____SWIG_1(PyObject *SWIGUNUSEDP
     npy_intp size[1] = {
       -1 
     };
-    array7 = obj_to_array_contiguous_allow_conversion(swig_obj[3],
+    array7 = obj_to_array_contiguous_allow_conversion(obj3,
       NPY_FLOAT,
       &is_new_object7);
     if (!array7 || !require_dimensions(array7, 1) ||
@@ -29098,7 +32839,7 @@ SWIGINTERN PyObject *_wrap_EMDYPhiFloat32___call____SWIG_1(PyObject *SWIGUNUSEDP
     npy_intp size[2] = {
       -1, -1 
     };
-    array9 = obj_to_array_contiguous_allow_conversion(swig_obj[4], NPY_FLOAT,
+    array9 = obj_to_array_contiguous_allow_conversion(obj4, NPY_FLOAT,
       &is_new_object9);
     if (!array9 || !require_dimensions(array9, 2) ||
       !require_size(array9, size, 2)) SWIG_fail;
@@ -29108,7 +32849,7 @@ SWIGINTERN PyObject *_wrap_EMDYPhiFloat32___call____SWIG_1(PyObject *SWIGUNUSEDP
   }
   {
     try {
-      result = (float)wasserstein_EMD_Sl_float_Sc_wasserstein_DefaultArray2Event_Sc_wasserstein_YPhiArrayDistance_Sg__operator_Sp__SP___SWIG_1(arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11); 
+      result = (float)wasserstein_EMD_Sl_float_Sc_wasserstein_DefaultArray2Event_Sc_wasserstein_YPhiArrayDistance_Sg__upper_bound(arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11); 
     }
     /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
     catch (std::invalid_argument& e) {
@@ -29186,37 +32927,54 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_EMDYPhiFloat32___call____SWIG_2(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
+SWIGINTERN PyObject *_wrap_EMDYPhiFloat32_within(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
   PyObject *resultobj = 0;
   wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *arg1 = (wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *) 0 ;
   float *arg2 = (float *) 0 ;
   std::ptrdiff_t arg3 ;
   float *arg4 = (float *) 0 ;
   std::ptrdiff_t arg5 ;
-  float *arg6 = (float *) 0 ;
-  std::ptrdiff_t arg7 ;
+  std::ptrdiff_t arg6 ;
+  float *arg7 = (float *) 0 ;
   std::ptrdiff_t arg8 ;
+  float *arg9 = (float *) 0 ;
+  std::ptrdiff_t arg10 ;
+  std::ptrdiff_t arg11 ;
+  float arg12 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyArrayObject *array2 = NULL ;
   int is_new_object2 = 0 ;
   PyArrayObject *array4 = NULL ;
   int is_new_object4 = 0 ;
-  PyArrayObject *array6 = NULL ;
-  int is_new_object6 = 0 ;
-  float result;
+  PyArrayObject *array7 = NULL ;
+  int is_new_object7 = 0 ;
+  PyArrayObject *array9 = NULL ;
+  int is_new_object9 = 0 ;
+  float val12 ;
+  int ecode12 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  PyObject * obj4 = 0 ;
+  PyObject * obj5 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"weights0",  (char *)"coords0",  (char *)"weights1",  (char *)"coords1",  (char *)"threshold",  NULL 
+  };
+  bool result;
   
-  if ((nobjs < 4) || (nobjs > 4)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__EMDT_float_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t, 0 |  0 );
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOOOOO:EMDYPhiFloat32_within", kwnames, &obj0, &obj1, &obj2, &obj3, &obj4, &obj5)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__EMDT_float_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDYPhiFloat32___call__" "', argument " "1"" of type '" "wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EMDYPhiFloat32_within" "', argument " "1"" of type '" "wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > *""'"); 
   }
   arg1 = reinterpret_cast< wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance > * >(argp1);
   {
     npy_intp size[1] = {
       -1 
     };
-    array2 = obj_to_array_contiguous_allow_conversion(swig_obj[1],
+    array2 = obj_to_array_contiguous_allow_conversion(obj1,
       NPY_FLOAT,
       &is_new_object2);
     if (!array2 || !require_dimensions(array2, 1) ||
@@ -29225,32 +32983,49 @@ SWIGINTERN PyObject *_wrap_EMDYPhiFloat32___call____SWIG_2(PyObject *SWIGUNUSEDP
     arg3 = (std::ptrdiff_t) array_size(array2,0);
   }
   {
-    npy_intp size[1] = {
-      -1 
+    npy_intp size[2] = {
+      -1, -1 
     };
-    array4 = obj_to_array_contiguous_allow_conversion(swig_obj[2],
-      NPY_FLOAT,
+    array4 = obj_to_array_contiguous_allow_conversion(obj2, NPY_FLOAT,
       &is_new_object4);
-    if (!array4 || !require_dimensions(array4, 1) ||
-      !require_size(array4, size, 1)) SWIG_fail;
+    if (!array4 || !require_dimensions(array4, 2) ||
+      !require_size(array4, size, 2)) SWIG_fail;
     arg4 = (float*) array_data(array4);
     arg5 = (std::ptrdiff_t) array_size(array4,0);
+    arg6 = (std::ptrdiff_t) array_size(array4,1);
+  }
+  {
+    npy_intp size[1] = {
+      -1 
+    };
+    array7 = obj_to_array_contiguous_allow_conversion(obj3,
+      NPY_FLOAT,
+      &is_new_object7);
+    if (!array7 || !require_dimensions(array7, 1) ||
+      !require_size(array7, size, 1)) SWIG_fail;
+    arg7 = (float*) array_data(array7);
+    arg8 = (std::ptrdiff_t) array_size(array7,0);
   }
   {
     npy_intp size[2] = {
       -1, -1 
     };
-    array6 = obj_to_array_contiguous_allow_conversion(swig_obj[3], NPY_FLOAT,
-      &is_new_object6);
-    if (!array6 || !require_dimensions(array6, 2) ||
-      !require_size(array6, size, 2)) SWIG_fail;
-    arg6 = (float*) array_data(array6);
-    arg7 = (std::ptrdiff_t) array_size(array6,0);
-    arg8 = (std::ptrdiff_t) array_size(array6,1);
+    array9 = obj_to_array_contiguous_allow_conversion(obj4, NPY_FLOAT,
+      &is_new_object9);
+    if (!array9 || !require_dimensions(array9, 2) ||
+      !require_size(array9, size, 2)) SWIG_fail;
+    arg9 = (float*) array_data(array9);
+    arg10 = (std::ptrdiff_t) array_size(array9,0);
+    arg11 = (std::ptrdiff_t) array_size(array9,1);
   }
+  ecode12 = SWIG_AsVal_float(obj5, &val12);
+  if (!SWIG_IsOK(ecode12)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode12), "in method '" "EMDYPhiFloat32_within" "', argument " "12"" of type '" "float""'");
+  } 
+  arg12 = static_cast< float >(val12);
   {
     try {
-      result = (float)wasserstein_EMD_Sl_float_Sc_wasserstein_DefaultArray2Event_Sc_wasserstein_YPhiArrayDistance_Sg__operator_Sp__SP___SWIG_2(arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8); 
+      result = (bool)wasserstein_EMD_Sl_float_Sc_wasserstein_DefaultArray2Event_Sc_wasserstein_YPhiArrayDistance_Sg__within(arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11,arg12); 
     }
     /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
     catch (std::invalid_argument& e) {
@@ -29273,7 +33048,7 @@ SWIGINTERN PyObject *_wrap_EMDYPhiFloat32___call____SWIG_2(PyObject *SWIGUNUSEDP
       SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
     }
   }
-  resultobj = SWIG_From_float(static_cast< float >(result));
+  resultobj = SWIG_From_bool(static_cast< bool >(result));
   {
     if (is_new_object2 && array2)
     {
@@ -29287,9 +33062,15 @@ SWIGINTERN PyObject *_wrap_EMDYPhiFloat32___call____SWIG_2(PyObject *SWIGUNUSEDP
     }
   }
   {
-    if (is_new_object6 && array6)
+    if (is_new_object7 && array7)
     {
-      Py_DECREF(array6); 
+      Py_DECREF(array7); 
+    }
+  }
+  {
+    if (is_new_object9 && array9)
+    {
+      Py_DECREF(array9); 
     }
   }
   return resultobj;
@@ -29307,95 +33088,18 @@ fail:
     }
   }
   {
-    if (is_new_object6 && array6)
+    if (is_new_object7 && array7)
     {
-      Py_DECREF(array6); 
-    }
-  }
-  return NULL;
-}
-
-
-SWIGINTERN PyObject *_wrap_EMDYPhiFloat32___call__(PyObject *self, PyObject *args) {
-  Py_ssize_t argc;
-  PyObject *argv[6] = {
-    0
-  };
-  
-  if (!(argc = SWIG_Python_UnpackTuple(args, "EMDYPhiFloat32___call__", 0, 5, argv))) SWIG_fail;
-  --argc;
-  if (argc == 4) {
-    int _v;
-    void *vptr = 0;
-    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_wasserstein__EMDT_float_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t, 0);
-    _v = SWIG_CheckState(res);
-    if (_v) {
-      {
-        _v = is_array(argv[1]) || PySequence_Check(argv[1]);
-      }
-      if (_v) {
-        {
-          _v = is_array(argv[2]) || PySequence_Check(argv[2]);
-        }
-        if (_v) {
-          {
-            _v = is_array(argv[3]) || PySequence_Check(argv[3]);
-          }
-          if (_v) {
-            if (argc <= 4) {
-              return _wrap_EMDYPhiFloat32___call____SWIG_2(self, argc, argv);
-            }
-            if (argc <= 5) {
-              return _wrap_EMDYPhiFloat32___call____SWIG_2(self, argc, argv);
-            }
-            return _wrap_EMDYPhiFloat32___call____SWIG_2(self, argc, argv);
-          }
-        }
-      }
+      Py_DECREF(array7); 
     }
   }
-  if (argc == 5) {
-    int _v;
-    void *vptr = 0;
-    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_wasserstein__EMDT_float_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t, 0);
-    _v = SWIG_CheckState(res);
-    if (_v) {
-      {
-        _v = is_array(argv[1]) || PySequence_Check(argv[1]);
-      }
-      if (_v) {
-        {
-          _v = is_array(argv[2]) || PySequence_Check(argv[2]);
-        }
-        if (_v) {
-          {
-            _v = is_array(argv[3]) || PySequence_Check(argv[3]);
-          }
-          if (_v) {
-            {
-              _v = is_array(argv[4]) || PySequence_Check(argv[4]);
-            }
-            if (_v) {
-              if (argc <= 5) {
-                return _wrap_EMDYPhiFloat32___call____SWIG_1(self, argc, argv);
-              }
-              if (argc <= 6) {
-                return _wrap_EMDYPhiFloat32___call____SWIG_1(self, argc, argv);
-              }
-              return _wrap_EMDYPhiFloat32___call____SWIG_1(self, argc, argv);
-            }
-          }
-        }
-      }
+  {
+    if (is_new_object9 && array9)
+    {
+      Py_DECREF(array9); 
     }
-  }
-  
-fail:
-  SWIG_Python_RaiseOrModifyTypeError("Wrong number or type of arguments for overloaded function 'EMDYPhiFloat32___call__'.\n"
-    "  Possible C/C++ prototypes are:\n"
-    "    wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >::operator ()(float *,std::ptrdiff_t,float *,std::ptrdiff_t,std::ptrdiff_t,float *,std::ptrdiff_t,float *,std::ptrdiff_t,std::ptrdiff_t)\n"
-    "    wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >::operator ()(float *,std::ptrdiff_t,float *,std::ptrdiff_t,float *,std::ptrdiff_t,std::ptrdiff_t)\n");
-  return 0;
+  }
+  return NULL;
 }
 
 
@@ -29824,25 +33528,293 @@ SWIGINTERN PyObject *_wrap_PairwiseEMDFloat64_init__SWIG_1(PyObject *SWIGUNUSEDP
   ptrdiff_t val3 ;
   int ecode3 = 0 ;
   
-  if ((nobjs < 3) || (nobjs > 3)) SWIG_fail;
+  if ((nobjs < 3) || (nobjs > 3)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDT_wasserstein__EMDT_double_wasserstein__DefaultArrayEvent_wasserstein__EuclideanArrayDistance_wasserstein__DefaultNetworkSimplex_t_double_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDFloat64_init" "', argument " "1"" of type '" "wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,double > *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,double > * >(argp1);
+  ecode2 = SWIG_AsVal_ptrdiff_t(swig_obj[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PairwiseEMDFloat64_init" "', argument " "2"" of type '" "wasserstein::index_type""'");
+  } 
+  arg2 = static_cast< wasserstein::index_type >(val2);
+  ecode3 = SWIG_AsVal_ptrdiff_t(swig_obj[2], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "PairwiseEMDFloat64_init" "', argument " "3"" of type '" "wasserstein::index_type""'");
+  } 
+  arg3 = static_cast< wasserstein::index_type >(val3);
+  {
+    try {
+      (arg1)->init(arg2,arg3); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_PairwiseEMDFloat64_reserve(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,double > *arg1 = (wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,double > *) 0 ;
+  std::size_t arg2 ;
+  bool arg3 = (bool) false ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  size_t val2 ;
+  int ecode2 = 0 ;
+  bool val3 ;
+  int ecode3 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"max_mult",  (char *)"huge_pages",  NULL 
+  };
+  
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO|O:PairwiseEMDFloat64_reserve", kwnames, &obj0, &obj1, &obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDT_wasserstein__EMDT_double_wasserstein__DefaultArrayEvent_wasserstein__EuclideanArrayDistance_wasserstein__DefaultNetworkSimplex_t_double_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDFloat64_reserve" "', argument " "1"" of type '" "wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,double > *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,double > * >(argp1);
+  ecode2 = SWIG_AsVal_size_t(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PairwiseEMDFloat64_reserve" "', argument " "2"" of type '" "std::size_t""'");
+  } 
+  arg2 = static_cast< std::size_t >(val2);
+  if (obj2) {
+    ecode3 = SWIG_AsVal_bool(obj2, &val3);
+    if (!SWIG_IsOK(ecode3)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "PairwiseEMDFloat64_reserve" "', argument " "3"" of type '" "bool""'");
+    } 
+    arg3 = static_cast< bool >(val3);
+  }
+  {
+    try {
+      (arg1)->reserve(arg2,arg3); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_PairwiseEMDFloat64_threshold(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,double > *arg1 = (wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,double > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  double result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDT_wasserstein__EMDT_double_wasserstein__DefaultArrayEvent_wasserstein__EuclideanArrayDistance_wasserstein__DefaultNetworkSimplex_t_double_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDFloat64_threshold" "', argument " "1"" of type '" "wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,double > const *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,double > * >(argp1);
+  {
+    try {
+      result = (double)((wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,double > const *)arg1)->threshold(); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_From_double(static_cast< double >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_PairwiseEMDFloat64_has_threshold(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,double > *arg1 = (wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,double > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  bool result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDT_wasserstein__EMDT_double_wasserstein__DefaultArrayEvent_wasserstein__EuclideanArrayDistance_wasserstein__DefaultNetworkSimplex_t_double_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDFloat64_has_threshold" "', argument " "1"" of type '" "wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,double > const *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,double > * >(argp1);
+  {
+    try {
+      result = (bool)((wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,double > const *)arg1)->has_threshold(); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_From_bool(static_cast< bool >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_PairwiseEMDFloat64_set_threshold(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,double > *arg1 = (wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,double > *) 0 ;
+  double arg2 = (double) std::numeric_limits< double >::max() ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  double val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"threshold",  NULL 
+  };
+  
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|O:PairwiseEMDFloat64_set_threshold", kwnames, &obj0, &obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDT_wasserstein__EMDT_double_wasserstein__DefaultArrayEvent_wasserstein__EuclideanArrayDistance_wasserstein__DefaultNetworkSimplex_t_double_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDFloat64_set_threshold" "', argument " "1"" of type '" "wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,double > *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,double > * >(argp1);
+  if (obj1) {
+    ecode2 = SWIG_AsVal_double(obj1, &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PairwiseEMDFloat64_set_threshold" "', argument " "2"" of type '" "double""'");
+    } 
+    arg2 = static_cast< double >(val2);
+  }
+  {
+    try {
+      (arg1)->set_threshold(arg2); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_PairwiseEMDFloat64_has_sweep(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,double > *arg1 = (wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,double > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  bool result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
   res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDT_wasserstein__EMDT_double_wasserstein__DefaultArrayEvent_wasserstein__EuclideanArrayDistance_wasserstein__DefaultNetworkSimplex_t_double_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDFloat64_init" "', argument " "1"" of type '" "wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,double > *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDFloat64_has_sweep" "', argument " "1"" of type '" "wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,double > const *""'"); 
   }
   arg1 = reinterpret_cast< wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,double > * >(argp1);
-  ecode2 = SWIG_AsVal_ptrdiff_t(swig_obj[1], &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PairwiseEMDFloat64_init" "', argument " "2"" of type '" "wasserstein::index_type""'");
-  } 
-  arg2 = static_cast< wasserstein::index_type >(val2);
-  ecode3 = SWIG_AsVal_ptrdiff_t(swig_obj[2], &val3);
-  if (!SWIG_IsOK(ecode3)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "PairwiseEMDFloat64_init" "', argument " "3"" of type '" "wasserstein::index_type""'");
-  } 
-  arg3 = static_cast< wasserstein::index_type >(val3);
   {
     try {
-      (arg1)->init(arg2,arg3); 
+      result = (bool)((wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,double > const *)arg1)->has_sweep(); 
     }
     /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
     catch (std::invalid_argument& e) {
@@ -29865,7 +33837,7 @@ SWIGINTERN PyObject *_wrap_PairwiseEMDFloat64_init__SWIG_1(PyObject *SWIGUNUSEDP
       SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
     }
   }
-  resultobj = SWIG_Py_Void();
+  resultobj = SWIG_From_bool(static_cast< bool >(result));
   return resultobj;
 fail:
   return NULL;
@@ -30069,6 +34041,86 @@ fail:
 }
 
 
+SWIGINTERN PyObject *_wrap_PairwiseEMDFloat64_close_pairs(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,double > *arg1 = (wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,double > *) 0 ;
+  std::ptrdiff_t **arg2 = (std::ptrdiff_t **) 0 ;
+  std::ptrdiff_t *arg3 = (std::ptrdiff_t *) 0 ;
+  std::ptrdiff_t *arg4 = (std::ptrdiff_t *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  std::ptrdiff_t *data_temp2 = NULL ;
+  std::ptrdiff_t dim1_temp2 ;
+  std::ptrdiff_t dim2_temp2 ;
+  PyObject *swig_obj[1] ;
+  
+  {
+    arg2 = &data_temp2;
+    arg3 = &dim1_temp2;
+    arg4 = &dim2_temp2;
+  }
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDT_wasserstein__EMDT_double_wasserstein__DefaultArrayEvent_wasserstein__EuclideanArrayDistance_wasserstein__DefaultNetworkSimplex_t_double_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDFloat64_close_pairs" "', argument " "1"" of type '" "wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,double > *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,double > * >(argp1);
+  {
+    try {
+      wasserstein_PairwiseEMD_Sl_wasserstein_EMD_Sl_double_Sc_wasserstein_DefaultArrayEvent_Sc_wasserstein_EuclideanArrayDistance_Sg__Sc_double_Sg__npy_close_pairs(arg1,arg2,arg3,arg4); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    npy_intp dims[2] = {
+      *arg3, *arg4 
+    };
+    PyObject* obj = PyArray_SimpleNewFromData(2, dims, NPY_INTP, (void*)(*arg2));
+    PyArrayObject* array = (PyArrayObject*) obj;
+    
+    if (!array) SWIG_fail;
+    
+#ifdef SWIGPY_USE_CAPSULE
+    PyObject* cap = PyCapsule_New((void*)(*arg2), SWIGPY_CAPSULE_NAME, free_cap);
+#else
+    PyObject* cap = PyCObject_FromVoidPtr((void*)(*arg2), free);
+#endif
+    
+#if NPY_API_VERSION < 0x00000007
+    PyArray_BASE(array) = cap;
+#else
+    PyArray_SetBaseObject(array,cap);
+#endif
+    
+    resultobj = SWIG_Python_AppendOutput(resultobj,obj);
+  }
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
 SWIGINTERN PyObject *_wrap_PairwiseEMDFloat64__reset_B_events(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,double > *arg1 = (wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,double > *) 0 ;
@@ -30193,7 +34245,204 @@ SWIGINTERN PyObject *_wrap_PairwiseEMDFloat64__add_event(PyObject *SWIGUNUSEDPAR
       SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
     }
   }
-  resultobj = SWIG_Py_Void();
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_PairwiseEMDFloat64_set_sweep(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,double > *arg1 = (wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,double > *) 0 ;
+  double *arg2 = (double *) 0 ;
+  std::ptrdiff_t arg3 ;
+  double *arg4 = (double *) 0 ;
+  std::ptrdiff_t arg5 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyArrayObject *array2 = NULL ;
+  int is_new_object2 = 0 ;
+  PyArrayObject *array4 = NULL ;
+  int is_new_object4 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"Rs",  (char *)"betas",  NULL 
+  };
+  
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOO:PairwiseEMDFloat64_set_sweep", kwnames, &obj0, &obj1, &obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDT_wasserstein__EMDT_double_wasserstein__DefaultArrayEvent_wasserstein__EuclideanArrayDistance_wasserstein__DefaultNetworkSimplex_t_double_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDFloat64_set_sweep" "', argument " "1"" of type '" "wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,double > *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,double > * >(argp1);
+  {
+    npy_intp size[1] = {
+      -1 
+    };
+    array2 = obj_to_array_contiguous_allow_conversion(obj1,
+      NPY_DOUBLE,
+      &is_new_object2);
+    if (!array2 || !require_dimensions(array2, 1) ||
+      !require_size(array2, size, 1)) SWIG_fail;
+    arg2 = (double*) array_data(array2);
+    arg3 = (std::ptrdiff_t) array_size(array2,0);
+  }
+  {
+    npy_intp size[1] = {
+      -1 
+    };
+    array4 = obj_to_array_contiguous_allow_conversion(obj2,
+      NPY_DOUBLE,
+      &is_new_object4);
+    if (!array4 || !require_dimensions(array4, 1) ||
+      !require_size(array4, size, 1)) SWIG_fail;
+    arg4 = (double*) array_data(array4);
+    arg5 = (std::ptrdiff_t) array_size(array4,0);
+  }
+  {
+    try {
+      wasserstein_PairwiseEMD_Sl_wasserstein_EMD_Sl_double_Sc_wasserstein_DefaultArrayEvent_Sc_wasserstein_EuclideanArrayDistance_Sg__Sc_double_Sg__npy_set_sweep(arg1,arg2,arg3,arg4,arg5); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    if (is_new_object2 && array2)
+    {
+      Py_DECREF(array2); 
+    }
+  }
+  {
+    if (is_new_object4 && array4)
+    {
+      Py_DECREF(array4); 
+    }
+  }
+  return resultobj;
+fail:
+  {
+    if (is_new_object2 && array2)
+    {
+      Py_DECREF(array2); 
+    }
+  }
+  {
+    if (is_new_object4 && array4)
+    {
+      Py_DECREF(array4); 
+    }
+  }
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_PairwiseEMDFloat64_sweep_emds(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,double > *arg1 = (wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,double > *) 0 ;
+  std::size_t arg2 ;
+  double **arg3 = (double **) 0 ;
+  std::ptrdiff_t *arg4 = (std::ptrdiff_t *) 0 ;
+  std::ptrdiff_t *arg5 = (std::ptrdiff_t *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  size_t val2 ;
+  int ecode2 = 0 ;
+  double *data_temp3 = NULL ;
+  std::ptrdiff_t dim1_temp3 ;
+  std::ptrdiff_t dim2_temp3 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"p",  NULL 
+  };
+  
+  {
+    arg3 = &data_temp3;
+    arg4 = &dim1_temp3;
+    arg5 = &dim2_temp3;
+  }
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:PairwiseEMDFloat64_sweep_emds", kwnames, &obj0, &obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDT_wasserstein__EMDT_double_wasserstein__DefaultArrayEvent_wasserstein__EuclideanArrayDistance_wasserstein__DefaultNetworkSimplex_t_double_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDFloat64_sweep_emds" "', argument " "1"" of type '" "wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,double > *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,double > * >(argp1);
+  ecode2 = SWIG_AsVal_size_t(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PairwiseEMDFloat64_sweep_emds" "', argument " "2"" of type '" "std::size_t""'");
+  } 
+  arg2 = static_cast< std::size_t >(val2);
+  {
+    try {
+      wasserstein_PairwiseEMD_Sl_wasserstein_EMD_Sl_double_Sc_wasserstein_DefaultArrayEvent_Sc_wasserstein_EuclideanArrayDistance_Sg__Sc_double_Sg__npy_sweep_emds(arg1,arg2,arg3,arg4,arg5); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    npy_intp dims[2] = {
+      *arg4, *arg5 
+    };
+    PyObject* obj = PyArray_SimpleNewFromData(2, dims, NPY_DOUBLE, (void*)(*arg3));
+    PyArrayObject* array = (PyArrayObject*) obj;
+    
+    if (!array) SWIG_fail;
+    
+#ifdef SWIGPY_USE_CAPSULE
+    PyObject* cap = PyCapsule_New((void*)(*arg3), SWIGPY_CAPSULE_NAME, free_cap);
+#else
+    PyObject* cap = PyCObject_FromVoidPtr((void*)(*arg3), free);
+#endif
+    
+#if NPY_API_VERSION < 0x00000007
+    PyArray_BASE(array) = cap;
+#else
+    PyArray_SetBaseObject(array,cap);
+#endif
+    
+    resultobj = SWIG_Python_AppendOutput(resultobj,obj);
+  }
   return resultobj;
 fail:
   return NULL;
@@ -30643,7 +34892,275 @@ SWIGINTERN PyObject *_wrap_PairwiseEMDFloat32_init__SWIG_1(PyObject *SWIGUNUSEDP
   arg3 = static_cast< wasserstein::index_type >(val3);
   {
     try {
-      (arg1)->init(arg2,arg3); 
+      (arg1)->init(arg2,arg3); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_PairwiseEMDFloat32_reserve(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,float > *arg1 = (wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,float > *) 0 ;
+  std::size_t arg2 ;
+  bool arg3 = (bool) false ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  size_t val2 ;
+  int ecode2 = 0 ;
+  bool val3 ;
+  int ecode3 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"max_mult",  (char *)"huge_pages",  NULL 
+  };
+  
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO|O:PairwiseEMDFloat32_reserve", kwnames, &obj0, &obj1, &obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDT_wasserstein__EMDT_float_wasserstein__DefaultArrayEvent_wasserstein__EuclideanArrayDistance_wasserstein__DefaultNetworkSimplex_t_float_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDFloat32_reserve" "', argument " "1"" of type '" "wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,float > *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,float > * >(argp1);
+  ecode2 = SWIG_AsVal_size_t(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PairwiseEMDFloat32_reserve" "', argument " "2"" of type '" "std::size_t""'");
+  } 
+  arg2 = static_cast< std::size_t >(val2);
+  if (obj2) {
+    ecode3 = SWIG_AsVal_bool(obj2, &val3);
+    if (!SWIG_IsOK(ecode3)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "PairwiseEMDFloat32_reserve" "', argument " "3"" of type '" "bool""'");
+    } 
+    arg3 = static_cast< bool >(val3);
+  }
+  {
+    try {
+      (arg1)->reserve(arg2,arg3); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_PairwiseEMDFloat32_threshold(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,float > *arg1 = (wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,float > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  float result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDT_wasserstein__EMDT_float_wasserstein__DefaultArrayEvent_wasserstein__EuclideanArrayDistance_wasserstein__DefaultNetworkSimplex_t_float_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDFloat32_threshold" "', argument " "1"" of type '" "wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,float > const *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,float > * >(argp1);
+  {
+    try {
+      result = (float)((wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,float > const *)arg1)->threshold(); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_From_float(static_cast< float >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_PairwiseEMDFloat32_has_threshold(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,float > *arg1 = (wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,float > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  bool result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDT_wasserstein__EMDT_float_wasserstein__DefaultArrayEvent_wasserstein__EuclideanArrayDistance_wasserstein__DefaultNetworkSimplex_t_float_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDFloat32_has_threshold" "', argument " "1"" of type '" "wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,float > const *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,float > * >(argp1);
+  {
+    try {
+      result = (bool)((wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,float > const *)arg1)->has_threshold(); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_From_bool(static_cast< bool >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_PairwiseEMDFloat32_set_threshold(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,float > *arg1 = (wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,float > *) 0 ;
+  float arg2 = (float) std::numeric_limits< float >::max() ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  float val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"threshold",  NULL 
+  };
+  
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|O:PairwiseEMDFloat32_set_threshold", kwnames, &obj0, &obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDT_wasserstein__EMDT_float_wasserstein__DefaultArrayEvent_wasserstein__EuclideanArrayDistance_wasserstein__DefaultNetworkSimplex_t_float_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDFloat32_set_threshold" "', argument " "1"" of type '" "wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,float > *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,float > * >(argp1);
+  if (obj1) {
+    ecode2 = SWIG_AsVal_float(obj1, &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PairwiseEMDFloat32_set_threshold" "', argument " "2"" of type '" "float""'");
+    } 
+    arg2 = static_cast< float >(val2);
+  }
+  {
+    try {
+      (arg1)->set_threshold(arg2); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_PairwiseEMDFloat32_has_sweep(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,float > *arg1 = (wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,float > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  bool result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDT_wasserstein__EMDT_float_wasserstein__DefaultArrayEvent_wasserstein__EuclideanArrayDistance_wasserstein__DefaultNetworkSimplex_t_float_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDFloat32_has_sweep" "', argument " "1"" of type '" "wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,float > const *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,float > * >(argp1);
+  {
+    try {
+      result = (bool)((wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,float > const *)arg1)->has_sweep(); 
     }
     /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
     catch (std::invalid_argument& e) {
@@ -30666,7 +35183,7 @@ SWIGINTERN PyObject *_wrap_PairwiseEMDFloat32_init__SWIG_1(PyObject *SWIGUNUSEDP
       SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
     }
   }
-  resultobj = SWIG_Py_Void();
+  resultobj = SWIG_From_bool(static_cast< bool >(result));
   return resultobj;
 fail:
   return NULL;
@@ -30870,6 +35387,86 @@ fail:
 }
 
 
+SWIGINTERN PyObject *_wrap_PairwiseEMDFloat32_close_pairs(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,float > *arg1 = (wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,float > *) 0 ;
+  std::ptrdiff_t **arg2 = (std::ptrdiff_t **) 0 ;
+  std::ptrdiff_t *arg3 = (std::ptrdiff_t *) 0 ;
+  std::ptrdiff_t *arg4 = (std::ptrdiff_t *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  std::ptrdiff_t *data_temp2 = NULL ;
+  std::ptrdiff_t dim1_temp2 ;
+  std::ptrdiff_t dim2_temp2 ;
+  PyObject *swig_obj[1] ;
+  
+  {
+    arg2 = &data_temp2;
+    arg3 = &dim1_temp2;
+    arg4 = &dim2_temp2;
+  }
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDT_wasserstein__EMDT_float_wasserstein__DefaultArrayEvent_wasserstein__EuclideanArrayDistance_wasserstein__DefaultNetworkSimplex_t_float_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDFloat32_close_pairs" "', argument " "1"" of type '" "wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,float > *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,float > * >(argp1);
+  {
+    try {
+      wasserstein_PairwiseEMD_Sl_wasserstein_EMD_Sl_float_Sc_wasserstein_DefaultArrayEvent_Sc_wasserstein_EuclideanArrayDistance_Sg__Sc_float_Sg__npy_close_pairs(arg1,arg2,arg3,arg4); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    npy_intp dims[2] = {
+      *arg3, *arg4 
+    };
+    PyObject* obj = PyArray_SimpleNewFromData(2, dims, NPY_INTP, (void*)(*arg2));
+    PyArrayObject* array = (PyArrayObject*) obj;
+    
+    if (!array) SWIG_fail;
+    
+#ifdef SWIGPY_USE_CAPSULE
+    PyObject* cap = PyCapsule_New((void*)(*arg2), SWIGPY_CAPSULE_NAME, free_cap);
+#else
+    PyObject* cap = PyCObject_FromVoidPtr((void*)(*arg2), free);
+#endif
+    
+#if NPY_API_VERSION < 0x00000007
+    PyArray_BASE(array) = cap;
+#else
+    PyArray_SetBaseObject(array,cap);
+#endif
+    
+    resultobj = SWIG_Python_AppendOutput(resultobj,obj);
+  }
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
 SWIGINTERN PyObject *_wrap_PairwiseEMDFloat32__reset_B_events(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,float > *arg1 = (wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,float > *) 0 ;
@@ -30994,7 +35591,204 @@ SWIGINTERN PyObject *_wrap_PairwiseEMDFloat32__add_event(PyObject *SWIGUNUSEDPAR
       SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
     }
   }
-  resultobj = SWIG_Py_Void();
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_PairwiseEMDFloat32_set_sweep(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,float > *arg1 = (wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,float > *) 0 ;
+  float *arg2 = (float *) 0 ;
+  std::ptrdiff_t arg3 ;
+  float *arg4 = (float *) 0 ;
+  std::ptrdiff_t arg5 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyArrayObject *array2 = NULL ;
+  int is_new_object2 = 0 ;
+  PyArrayObject *array4 = NULL ;
+  int is_new_object4 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"Rs",  (char *)"betas",  NULL 
+  };
+  
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOO:PairwiseEMDFloat32_set_sweep", kwnames, &obj0, &obj1, &obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDT_wasserstein__EMDT_float_wasserstein__DefaultArrayEvent_wasserstein__EuclideanArrayDistance_wasserstein__DefaultNetworkSimplex_t_float_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDFloat32_set_sweep" "', argument " "1"" of type '" "wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,float > *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,float > * >(argp1);
+  {
+    npy_intp size[1] = {
+      -1 
+    };
+    array2 = obj_to_array_contiguous_allow_conversion(obj1,
+      NPY_FLOAT,
+      &is_new_object2);
+    if (!array2 || !require_dimensions(array2, 1) ||
+      !require_size(array2, size, 1)) SWIG_fail;
+    arg2 = (float*) array_data(array2);
+    arg3 = (std::ptrdiff_t) array_size(array2,0);
+  }
+  {
+    npy_intp size[1] = {
+      -1 
+    };
+    array4 = obj_to_array_contiguous_allow_conversion(obj2,
+      NPY_FLOAT,
+      &is_new_object4);
+    if (!array4 || !require_dimensions(array4, 1) ||
+      !require_size(array4, size, 1)) SWIG_fail;
+    arg4 = (float*) array_data(array4);
+    arg5 = (std::ptrdiff_t) array_size(array4,0);
+  }
+  {
+    try {
+      wasserstein_PairwiseEMD_Sl_wasserstein_EMD_Sl_float_Sc_wasserstein_DefaultArrayEvent_Sc_wasserstein_EuclideanArrayDistance_Sg__Sc_float_Sg__npy_set_sweep(arg1,arg2,arg3,arg4,arg5); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    if (is_new_object2 && array2)
+    {
+      Py_DECREF(array2); 
+    }
+  }
+  {
+    if (is_new_object4 && array4)
+    {
+      Py_DECREF(array4); 
+    }
+  }
+  return resultobj;
+fail:
+  {
+    if (is_new_object2 && array2)
+    {
+      Py_DECREF(array2); 
+    }
+  }
+  {
+    if (is_new_object4 && array4)
+    {
+      Py_DECREF(array4); 
+    }
+  }
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_PairwiseEMDFloat32_sweep_emds(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,float > *arg1 = (wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,float > *) 0 ;
+  std::size_t arg2 ;
+  float **arg3 = (float **) 0 ;
+  std::ptrdiff_t *arg4 = (std::ptrdiff_t *) 0 ;
+  std::ptrdiff_t *arg5 = (std::ptrdiff_t *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  size_t val2 ;
+  int ecode2 = 0 ;
+  float *data_temp3 = NULL ;
+  std::ptrdiff_t dim1_temp3 ;
+  std::ptrdiff_t dim2_temp3 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"p",  NULL 
+  };
+  
+  {
+    arg3 = &data_temp3;
+    arg4 = &dim1_temp3;
+    arg5 = &dim2_temp3;
+  }
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:PairwiseEMDFloat32_sweep_emds", kwnames, &obj0, &obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDT_wasserstein__EMDT_float_wasserstein__DefaultArrayEvent_wasserstein__EuclideanArrayDistance_wasserstein__DefaultNetworkSimplex_t_float_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDFloat32_sweep_emds" "', argument " "1"" of type '" "wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,float > *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArrayEvent,wasserstein::EuclideanArrayDistance >,float > * >(argp1);
+  ecode2 = SWIG_AsVal_size_t(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PairwiseEMDFloat32_sweep_emds" "', argument " "2"" of type '" "std::size_t""'");
+  } 
+  arg2 = static_cast< std::size_t >(val2);
+  {
+    try {
+      wasserstein_PairwiseEMD_Sl_wasserstein_EMD_Sl_float_Sc_wasserstein_DefaultArrayEvent_Sc_wasserstein_EuclideanArrayDistance_Sg__Sc_float_Sg__npy_sweep_emds(arg1,arg2,arg3,arg4,arg5); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    npy_intp dims[2] = {
+      *arg4, *arg5 
+    };
+    PyObject* obj = PyArray_SimpleNewFromData(2, dims, NPY_FLOAT, (void*)(*arg3));
+    PyArrayObject* array = (PyArrayObject*) obj;
+    
+    if (!array) SWIG_fail;
+    
+#ifdef SWIGPY_USE_CAPSULE
+    PyObject* cap = PyCapsule_New((void*)(*arg3), SWIGPY_CAPSULE_NAME, free_cap);
+#else
+    PyObject* cap = PyCObject_FromVoidPtr((void*)(*arg3), free);
+#endif
+    
+#if NPY_API_VERSION < 0x00000007
+    PyArray_BASE(array) = cap;
+#else
+    PyArray_SetBaseObject(array,cap);
+#endif
+    
+    resultobj = SWIG_Python_AppendOutput(resultobj,obj);
+  }
   return resultobj;
 fail:
   return NULL;
@@ -31426,25 +36220,293 @@ SWIGINTERN PyObject *_wrap_PairwiseEMDYPhiFloat64_init__SWIG_1(PyObject *SWIGUNU
   ptrdiff_t val3 ;
   int ecode3 = 0 ;
   
-  if ((nobjs < 3) || (nobjs > 3)) SWIG_fail;
+  if ((nobjs < 3) || (nobjs > 3)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDT_wasserstein__EMDT_double_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t_double_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDYPhiFloat64_init" "', argument " "1"" of type '" "wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,double > *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,double > * >(argp1);
+  ecode2 = SWIG_AsVal_ptrdiff_t(swig_obj[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PairwiseEMDYPhiFloat64_init" "', argument " "2"" of type '" "wasserstein::index_type""'");
+  } 
+  arg2 = static_cast< wasserstein::index_type >(val2);
+  ecode3 = SWIG_AsVal_ptrdiff_t(swig_obj[2], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "PairwiseEMDYPhiFloat64_init" "', argument " "3"" of type '" "wasserstein::index_type""'");
+  } 
+  arg3 = static_cast< wasserstein::index_type >(val3);
+  {
+    try {
+      (arg1)->init(arg2,arg3); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_PairwiseEMDYPhiFloat64_reserve(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,double > *arg1 = (wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,double > *) 0 ;
+  std::size_t arg2 ;
+  bool arg3 = (bool) false ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  size_t val2 ;
+  int ecode2 = 0 ;
+  bool val3 ;
+  int ecode3 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"max_mult",  (char *)"huge_pages",  NULL 
+  };
+  
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO|O:PairwiseEMDYPhiFloat64_reserve", kwnames, &obj0, &obj1, &obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDT_wasserstein__EMDT_double_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t_double_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDYPhiFloat64_reserve" "', argument " "1"" of type '" "wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,double > *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,double > * >(argp1);
+  ecode2 = SWIG_AsVal_size_t(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PairwiseEMDYPhiFloat64_reserve" "', argument " "2"" of type '" "std::size_t""'");
+  } 
+  arg2 = static_cast< std::size_t >(val2);
+  if (obj2) {
+    ecode3 = SWIG_AsVal_bool(obj2, &val3);
+    if (!SWIG_IsOK(ecode3)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "PairwiseEMDYPhiFloat64_reserve" "', argument " "3"" of type '" "bool""'");
+    } 
+    arg3 = static_cast< bool >(val3);
+  }
+  {
+    try {
+      (arg1)->reserve(arg2,arg3); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_PairwiseEMDYPhiFloat64_threshold(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,double > *arg1 = (wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,double > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  double result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDT_wasserstein__EMDT_double_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t_double_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDYPhiFloat64_threshold" "', argument " "1"" of type '" "wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,double > const *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,double > * >(argp1);
+  {
+    try {
+      result = (double)((wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,double > const *)arg1)->threshold(); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_From_double(static_cast< double >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_PairwiseEMDYPhiFloat64_has_threshold(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,double > *arg1 = (wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,double > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  bool result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDT_wasserstein__EMDT_double_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t_double_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDYPhiFloat64_has_threshold" "', argument " "1"" of type '" "wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,double > const *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,double > * >(argp1);
+  {
+    try {
+      result = (bool)((wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,double > const *)arg1)->has_threshold(); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_From_bool(static_cast< bool >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_PairwiseEMDYPhiFloat64_set_threshold(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,double > *arg1 = (wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,double > *) 0 ;
+  double arg2 = (double) std::numeric_limits< double >::max() ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  double val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"threshold",  NULL 
+  };
+  
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|O:PairwiseEMDYPhiFloat64_set_threshold", kwnames, &obj0, &obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDT_wasserstein__EMDT_double_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t_double_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDYPhiFloat64_set_threshold" "', argument " "1"" of type '" "wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,double > *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,double > * >(argp1);
+  if (obj1) {
+    ecode2 = SWIG_AsVal_double(obj1, &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PairwiseEMDYPhiFloat64_set_threshold" "', argument " "2"" of type '" "double""'");
+    } 
+    arg2 = static_cast< double >(val2);
+  }
+  {
+    try {
+      (arg1)->set_threshold(arg2); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_PairwiseEMDYPhiFloat64_has_sweep(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,double > *arg1 = (wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,double > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  bool result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
   res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDT_wasserstein__EMDT_double_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t_double_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDYPhiFloat64_init" "', argument " "1"" of type '" "wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,double > *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDYPhiFloat64_has_sweep" "', argument " "1"" of type '" "wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,double > const *""'"); 
   }
   arg1 = reinterpret_cast< wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,double > * >(argp1);
-  ecode2 = SWIG_AsVal_ptrdiff_t(swig_obj[1], &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PairwiseEMDYPhiFloat64_init" "', argument " "2"" of type '" "wasserstein::index_type""'");
-  } 
-  arg2 = static_cast< wasserstein::index_type >(val2);
-  ecode3 = SWIG_AsVal_ptrdiff_t(swig_obj[2], &val3);
-  if (!SWIG_IsOK(ecode3)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "PairwiseEMDYPhiFloat64_init" "', argument " "3"" of type '" "wasserstein::index_type""'");
-  } 
-  arg3 = static_cast< wasserstein::index_type >(val3);
   {
     try {
-      (arg1)->init(arg2,arg3); 
+      result = (bool)((wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,double > const *)arg1)->has_sweep(); 
     }
     /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
     catch (std::invalid_argument& e) {
@@ -31467,7 +36529,7 @@ SWIGINTERN PyObject *_wrap_PairwiseEMDYPhiFloat64_init__SWIG_1(PyObject *SWIGUNU
       SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
     }
   }
-  resultobj = SWIG_Py_Void();
+  resultobj = SWIG_From_bool(static_cast< bool >(result));
   return resultobj;
 fail:
   return NULL;
@@ -31671,6 +36733,86 @@ fail:
 }
 
 
+SWIGINTERN PyObject *_wrap_PairwiseEMDYPhiFloat64_close_pairs(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,double > *arg1 = (wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,double > *) 0 ;
+  std::ptrdiff_t **arg2 = (std::ptrdiff_t **) 0 ;
+  std::ptrdiff_t *arg3 = (std::ptrdiff_t *) 0 ;
+  std::ptrdiff_t *arg4 = (std::ptrdiff_t *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  std::ptrdiff_t *data_temp2 = NULL ;
+  std::ptrdiff_t dim1_temp2 ;
+  std::ptrdiff_t dim2_temp2 ;
+  PyObject *swig_obj[1] ;
+  
+  {
+    arg2 = &data_temp2;
+    arg3 = &dim1_temp2;
+    arg4 = &dim2_temp2;
+  }
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDT_wasserstein__EMDT_double_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t_double_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDYPhiFloat64_close_pairs" "', argument " "1"" of type '" "wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,double > *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,double > * >(argp1);
+  {
+    try {
+      wasserstein_PairwiseEMD_Sl_wasserstein_EMD_Sl_double_Sc_wasserstein_DefaultArray2Event_Sc_wasserstein_YPhiArrayDistance_Sg__Sc_double_Sg__npy_close_pairs(arg1,arg2,arg3,arg4); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    npy_intp dims[2] = {
+      *arg3, *arg4 
+    };
+    PyObject* obj = PyArray_SimpleNewFromData(2, dims, NPY_INTP, (void*)(*arg2));
+    PyArrayObject* array = (PyArrayObject*) obj;
+    
+    if (!array) SWIG_fail;
+    
+#ifdef SWIGPY_USE_CAPSULE
+    PyObject* cap = PyCapsule_New((void*)(*arg2), SWIGPY_CAPSULE_NAME, free_cap);
+#else
+    PyObject* cap = PyCObject_FromVoidPtr((void*)(*arg2), free);
+#endif
+    
+#if NPY_API_VERSION < 0x00000007
+    PyArray_BASE(array) = cap;
+#else
+    PyArray_SetBaseObject(array,cap);
+#endif
+    
+    resultobj = SWIG_Python_AppendOutput(resultobj,obj);
+  }
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
 SWIGINTERN PyObject *_wrap_PairwiseEMDYPhiFloat64__reset_B_events(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,double > *arg1 = (wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,double > *) 0 ;
@@ -31795,7 +36937,204 @@ SWIGINTERN PyObject *_wrap_PairwiseEMDYPhiFloat64__add_event(PyObject *SWIGUNUSE
       SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
     }
   }
-  resultobj = SWIG_Py_Void();
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_PairwiseEMDYPhiFloat64_set_sweep(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,double > *arg1 = (wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,double > *) 0 ;
+  double *arg2 = (double *) 0 ;
+  std::ptrdiff_t arg3 ;
+  double *arg4 = (double *) 0 ;
+  std::ptrdiff_t arg5 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyArrayObject *array2 = NULL ;
+  int is_new_object2 = 0 ;
+  PyArrayObject *array4 = NULL ;
+  int is_new_object4 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"Rs",  (char *)"betas",  NULL 
+  };
+  
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOO:PairwiseEMDYPhiFloat64_set_sweep", kwnames, &obj0, &obj1, &obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDT_wasserstein__EMDT_double_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t_double_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDYPhiFloat64_set_sweep" "', argument " "1"" of type '" "wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,double > *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,double > * >(argp1);
+  {
+    npy_intp size[1] = {
+      -1 
+    };
+    array2 = obj_to_array_contiguous_allow_conversion(obj1,
+      NPY_DOUBLE,
+      &is_new_object2);
+    if (!array2 || !require_dimensions(array2, 1) ||
+      !require_size(array2, size, 1)) SWIG_fail;
+    arg2 = (double*) array_data(array2);
+    arg3 = (std::ptrdiff_t) array_size(array2,0);
+  }
+  {
+    npy_intp size[1] = {
+      -1 
+    };
+    array4 = obj_to_array_contiguous_allow_conversion(obj2,
+      NPY_DOUBLE,
+      &is_new_object4);
+    if (!array4 || !require_dimensions(array4, 1) ||
+      !require_size(array4, size, 1)) SWIG_fail;
+    arg4 = (double*) array_data(array4);
+    arg5 = (std::ptrdiff_t) array_size(array4,0);
+  }
+  {
+    try {
+      wasserstein_PairwiseEMD_Sl_wasserstein_EMD_Sl_double_Sc_wasserstein_DefaultArray2Event_Sc_wasserstein_YPhiArrayDistance_Sg__Sc_double_Sg__npy_set_sweep(arg1,arg2,arg3,arg4,arg5); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    if (is_new_object2 && array2)
+    {
+      Py_DECREF(array2); 
+    }
+  }
+  {
+    if (is_new_object4 && array4)
+    {
+      Py_DECREF(array4); 
+    }
+  }
+  return resultobj;
+fail:
+  {
+    if (is_new_object2 && array2)
+    {
+      Py_DECREF(array2); 
+    }
+  }
+  {
+    if (is_new_object4 && array4)
+    {
+      Py_DECREF(array4); 
+    }
+  }
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_PairwiseEMDYPhiFloat64_sweep_emds(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,double > *arg1 = (wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,double > *) 0 ;
+  std::size_t arg2 ;
+  double **arg3 = (double **) 0 ;
+  std::ptrdiff_t *arg4 = (std::ptrdiff_t *) 0 ;
+  std::ptrdiff_t *arg5 = (std::ptrdiff_t *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  size_t val2 ;
+  int ecode2 = 0 ;
+  double *data_temp3 = NULL ;
+  std::ptrdiff_t dim1_temp3 ;
+  std::ptrdiff_t dim2_temp3 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"p",  NULL 
+  };
+  
+  {
+    arg3 = &data_temp3;
+    arg4 = &dim1_temp3;
+    arg5 = &dim2_temp3;
+  }
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:PairwiseEMDYPhiFloat64_sweep_emds", kwnames, &obj0, &obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDT_wasserstein__EMDT_double_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t_double_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDYPhiFloat64_sweep_emds" "', argument " "1"" of type '" "wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,double > *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::PairwiseEMD< wasserstein::EMD< double,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,double > * >(argp1);
+  ecode2 = SWIG_AsVal_size_t(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PairwiseEMDYPhiFloat64_sweep_emds" "', argument " "2"" of type '" "std::size_t""'");
+  } 
+  arg2 = static_cast< std::size_t >(val2);
+  {
+    try {
+      wasserstein_PairwiseEMD_Sl_wasserstein_EMD_Sl_double_Sc_wasserstein_DefaultArray2Event_Sc_wasserstein_YPhiArrayDistance_Sg__Sc_double_Sg__npy_sweep_emds(arg1,arg2,arg3,arg4,arg5); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    npy_intp dims[2] = {
+      *arg4, *arg5 
+    };
+    PyObject* obj = PyArray_SimpleNewFromData(2, dims, NPY_DOUBLE, (void*)(*arg3));
+    PyArrayObject* array = (PyArrayObject*) obj;
+    
+    if (!array) SWIG_fail;
+    
+#ifdef SWIGPY_USE_CAPSULE
+    PyObject* cap = PyCapsule_New((void*)(*arg3), SWIGPY_CAPSULE_NAME, free_cap);
+#else
+    PyObject* cap = PyCObject_FromVoidPtr((void*)(*arg3), free);
+#endif
+    
+#if NPY_API_VERSION < 0x00000007
+    PyArray_BASE(array) = cap;
+#else
+    PyArray_SetBaseObject(array,cap);
+#endif
+    
+    resultobj = SWIG_Python_AppendOutput(resultobj,obj);
+  }
   return resultobj;
 fail:
   return NULL;
@@ -32245,7 +37584,275 @@ SWIGINTERN PyObject *_wrap_PairwiseEMDYPhiFloat32_init__SWIG_1(PyObject *SWIGUNU
   arg3 = static_cast< wasserstein::index_type >(val3);
   {
     try {
-      (arg1)->init(arg2,arg3); 
+      (arg1)->init(arg2,arg3); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_PairwiseEMDYPhiFloat32_reserve(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,float > *arg1 = (wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,float > *) 0 ;
+  std::size_t arg2 ;
+  bool arg3 = (bool) false ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  size_t val2 ;
+  int ecode2 = 0 ;
+  bool val3 ;
+  int ecode3 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"max_mult",  (char *)"huge_pages",  NULL 
+  };
+  
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO|O:PairwiseEMDYPhiFloat32_reserve", kwnames, &obj0, &obj1, &obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDT_wasserstein__EMDT_float_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t_float_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDYPhiFloat32_reserve" "', argument " "1"" of type '" "wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,float > *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,float > * >(argp1);
+  ecode2 = SWIG_AsVal_size_t(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PairwiseEMDYPhiFloat32_reserve" "', argument " "2"" of type '" "std::size_t""'");
+  } 
+  arg2 = static_cast< std::size_t >(val2);
+  if (obj2) {
+    ecode3 = SWIG_AsVal_bool(obj2, &val3);
+    if (!SWIG_IsOK(ecode3)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "PairwiseEMDYPhiFloat32_reserve" "', argument " "3"" of type '" "bool""'");
+    } 
+    arg3 = static_cast< bool >(val3);
+  }
+  {
+    try {
+      (arg1)->reserve(arg2,arg3); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_PairwiseEMDYPhiFloat32_threshold(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,float > *arg1 = (wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,float > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  float result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDT_wasserstein__EMDT_float_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t_float_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDYPhiFloat32_threshold" "', argument " "1"" of type '" "wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,float > const *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,float > * >(argp1);
+  {
+    try {
+      result = (float)((wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,float > const *)arg1)->threshold(); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_From_float(static_cast< float >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_PairwiseEMDYPhiFloat32_has_threshold(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,float > *arg1 = (wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,float > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  bool result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDT_wasserstein__EMDT_float_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t_float_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDYPhiFloat32_has_threshold" "', argument " "1"" of type '" "wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,float > const *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,float > * >(argp1);
+  {
+    try {
+      result = (bool)((wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,float > const *)arg1)->has_threshold(); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_From_bool(static_cast< bool >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_PairwiseEMDYPhiFloat32_set_threshold(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,float > *arg1 = (wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,float > *) 0 ;
+  float arg2 = (float) std::numeric_limits< float >::max() ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  float val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"threshold",  NULL 
+  };
+  
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|O:PairwiseEMDYPhiFloat32_set_threshold", kwnames, &obj0, &obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDT_wasserstein__EMDT_float_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t_float_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDYPhiFloat32_set_threshold" "', argument " "1"" of type '" "wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,float > *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,float > * >(argp1);
+  if (obj1) {
+    ecode2 = SWIG_AsVal_float(obj1, &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PairwiseEMDYPhiFloat32_set_threshold" "', argument " "2"" of type '" "float""'");
+    } 
+    arg2 = static_cast< float >(val2);
+  }
+  {
+    try {
+      (arg1)->set_threshold(arg2); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_PairwiseEMDYPhiFloat32_has_sweep(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,float > *arg1 = (wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,float > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  bool result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDT_wasserstein__EMDT_float_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t_float_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDYPhiFloat32_has_sweep" "', argument " "1"" of type '" "wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,float > const *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,float > * >(argp1);
+  {
+    try {
+      result = (bool)((wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,float > const *)arg1)->has_sweep(); 
     }
     /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
     catch (std::invalid_argument& e) {
@@ -32268,7 +37875,7 @@ SWIGINTERN PyObject *_wrap_PairwiseEMDYPhiFloat32_init__SWIG_1(PyObject *SWIGUNU
       SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
     }
   }
-  resultobj = SWIG_Py_Void();
+  resultobj = SWIG_From_bool(static_cast< bool >(result));
   return resultobj;
 fail:
   return NULL;
@@ -32472,6 +38079,86 @@ fail:
 }
 
 
+SWIGINTERN PyObject *_wrap_PairwiseEMDYPhiFloat32_close_pairs(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,float > *arg1 = (wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,float > *) 0 ;
+  std::ptrdiff_t **arg2 = (std::ptrdiff_t **) 0 ;
+  std::ptrdiff_t *arg3 = (std::ptrdiff_t *) 0 ;
+  std::ptrdiff_t *arg4 = (std::ptrdiff_t *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  std::ptrdiff_t *data_temp2 = NULL ;
+  std::ptrdiff_t dim1_temp2 ;
+  std::ptrdiff_t dim2_temp2 ;
+  PyObject *swig_obj[1] ;
+  
+  {
+    arg2 = &data_temp2;
+    arg3 = &dim1_temp2;
+    arg4 = &dim2_temp2;
+  }
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDT_wasserstein__EMDT_float_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t_float_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDYPhiFloat32_close_pairs" "', argument " "1"" of type '" "wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,float > *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,float > * >(argp1);
+  {
+    try {
+      wasserstein_PairwiseEMD_Sl_wasserstein_EMD_Sl_float_Sc_wasserstein_DefaultArray2Event_Sc_wasserstein_YPhiArrayDistance_Sg__Sc_float_Sg__npy_close_pairs(arg1,arg2,arg3,arg4); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    npy_intp dims[2] = {
+      *arg3, *arg4 
+    };
+    PyObject* obj = PyArray_SimpleNewFromData(2, dims, NPY_INTP, (void*)(*arg2));
+    PyArrayObject* array = (PyArrayObject*) obj;
+    
+    if (!array) SWIG_fail;
+    
+#ifdef SWIGPY_USE_CAPSULE
+    PyObject* cap = PyCapsule_New((void*)(*arg2), SWIGPY_CAPSULE_NAME, free_cap);
+#else
+    PyObject* cap = PyCObject_FromVoidPtr((void*)(*arg2), free);
+#endif
+    
+#if NPY_API_VERSION < 0x00000007
+    PyArray_BASE(array) = cap;
+#else
+    PyArray_SetBaseObject(array,cap);
+#endif
+    
+    resultobj = SWIG_Python_AppendOutput(resultobj,obj);
+  }
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
 SWIGINTERN PyObject *_wrap_PairwiseEMDYPhiFloat32__reset_B_events(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,float > *arg1 = (wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,float > *) 0 ;
@@ -32603,6 +38290,203 @@ fail:
 }
 
 
+SWIGINTERN PyObject *_wrap_PairwiseEMDYPhiFloat32_set_sweep(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,float > *arg1 = (wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,float > *) 0 ;
+  float *arg2 = (float *) 0 ;
+  std::ptrdiff_t arg3 ;
+  float *arg4 = (float *) 0 ;
+  std::ptrdiff_t arg5 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyArrayObject *array2 = NULL ;
+  int is_new_object2 = 0 ;
+  PyArrayObject *array4 = NULL ;
+  int is_new_object4 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"Rs",  (char *)"betas",  NULL 
+  };
+  
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOO:PairwiseEMDYPhiFloat32_set_sweep", kwnames, &obj0, &obj1, &obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDT_wasserstein__EMDT_float_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t_float_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDYPhiFloat32_set_sweep" "', argument " "1"" of type '" "wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,float > *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,float > * >(argp1);
+  {
+    npy_intp size[1] = {
+      -1 
+    };
+    array2 = obj_to_array_contiguous_allow_conversion(obj1,
+      NPY_FLOAT,
+      &is_new_object2);
+    if (!array2 || !require_dimensions(array2, 1) ||
+      !require_size(array2, size, 1)) SWIG_fail;
+    arg2 = (float*) array_data(array2);
+    arg3 = (std::ptrdiff_t) array_size(array2,0);
+  }
+  {
+    npy_intp size[1] = {
+      -1 
+    };
+    array4 = obj_to_array_contiguous_allow_conversion(obj2,
+      NPY_FLOAT,
+      &is_new_object4);
+    if (!array4 || !require_dimensions(array4, 1) ||
+      !require_size(array4, size, 1)) SWIG_fail;
+    arg4 = (float*) array_data(array4);
+    arg5 = (std::ptrdiff_t) array_size(array4,0);
+  }
+  {
+    try {
+      wasserstein_PairwiseEMD_Sl_wasserstein_EMD_Sl_float_Sc_wasserstein_DefaultArray2Event_Sc_wasserstein_YPhiArrayDistance_Sg__Sc_float_Sg__npy_set_sweep(arg1,arg2,arg3,arg4,arg5); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    if (is_new_object2 && array2)
+    {
+      Py_DECREF(array2); 
+    }
+  }
+  {
+    if (is_new_object4 && array4)
+    {
+      Py_DECREF(array4); 
+    }
+  }
+  return resultobj;
+fail:
+  {
+    if (is_new_object2 && array2)
+    {
+      Py_DECREF(array2); 
+    }
+  }
+  {
+    if (is_new_object4 && array4)
+    {
+      Py_DECREF(array4); 
+    }
+  }
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_PairwiseEMDYPhiFloat32_sweep_emds(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,float > *arg1 = (wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,float > *) 0 ;
+  std::size_t arg2 ;
+  float **arg3 = (float **) 0 ;
+  std::ptrdiff_t *arg4 = (std::ptrdiff_t *) 0 ;
+  std::ptrdiff_t *arg5 = (std::ptrdiff_t *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  size_t val2 ;
+  int ecode2 = 0 ;
+  float *data_temp3 = NULL ;
+  std::ptrdiff_t dim1_temp3 ;
+  std::ptrdiff_t dim2_temp3 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"p",  NULL 
+  };
+  
+  {
+    arg3 = &data_temp3;
+    arg4 = &dim1_temp3;
+    arg5 = &dim2_temp3;
+  }
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:PairwiseEMDYPhiFloat32_sweep_emds", kwnames, &obj0, &obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_wasserstein__PairwiseEMDT_wasserstein__EMDT_float_wasserstein__DefaultArray2Event_wasserstein__YPhiArrayDistance_wasserstein__DefaultNetworkSimplex_t_float_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PairwiseEMDYPhiFloat32_sweep_emds" "', argument " "1"" of type '" "wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,float > *""'"); 
+  }
+  arg1 = reinterpret_cast< wasserstein::PairwiseEMD< wasserstein::EMD< float,wasserstein::DefaultArray2Event,wasserstein::YPhiArrayDistance >,float > * >(argp1);
+  ecode2 = SWIG_AsVal_size_t(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PairwiseEMDYPhiFloat32_sweep_emds" "', argument " "2"" of type '" "std::size_t""'");
+  } 
+  arg2 = static_cast< std::size_t >(val2);
+  {
+    try {
+      wasserstein_PairwiseEMD_Sl_wasserstein_EMD_Sl_float_Sc_wasserstein_DefaultArray2Event_Sc_wasserstein_YPhiArrayDistance_Sg__Sc_float_Sg__npy_sweep_emds(arg1,arg2,arg3,arg4,arg5); 
+    }
+    /*@SWIG:/usr/local/Cellar/swig/4.0.2/share/swig/4.0.2/typemaps/exception.swg,58,SWIG_CATCH_STDEXCEPT@*/  /* catching std::exception  */
+    catch (std::invalid_argument& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::domain_error& e) {
+      SWIG_exception_fail(SWIG_ValueError, e.what() );
+    } catch (std::overflow_error& e) {
+      SWIG_exception_fail(SWIG_OverflowError, e.what() );
+    } catch (std::out_of_range& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::length_error& e) {
+      SWIG_exception_fail(SWIG_IndexError, e.what() );
+    } catch (std::runtime_error& e) {
+      SWIG_exception_fail(SWIG_RuntimeError, e.what() );
+    } catch (std::exception& e) {
+      SWIG_exception_fail(SWIG_SystemError, e.what() );
+    }
+    /*@SWIG@*/
+    catch (...) {
+      SWIG_exception_fail(SWIG_UnknownError, "unknown exception");
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    npy_intp dims[2] = {
+      *arg4, *arg5 
+    };
+    PyObject* obj = PyArray_SimpleNewFromData(2, dims, NPY_FLOAT, (void*)(*arg3));
+    PyArrayObject* array = (PyArrayObject*) obj;
+    
+    if (!array) SWIG_fail;
+    
+#ifdef SWIGPY_USE_CAPSULE
+    PyObject* cap = PyCapsule_New((void*)(*arg3), SWIGPY_CAPSULE_NAME, free_cap);
+#else
+    PyObject* cap = PyCObject_FromVoidPtr((void*)(*arg3), free);
+#endif
+    
+#if NPY_API_VERSION < 0x00000007
+    PyArray_BASE(array) = cap;
+#else
+    PyArray_SetBaseObject(array,cap);
+#endif
+    
+    resultobj = SWIG_Python_AppendOutput(resultobj,obj);
+  }
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
 SWIGINTERN PyObject *PairwiseEMDYPhiFloat32_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *obj;
   if (!SWIG_Python_UnpackTuple(args, "swigregister", 1, 1, &obj)) return NULL;
@@ -32854,7 +38738,11 @@ static PyMethodDef SwigMethods[] = {
 	 { "EMDBaseFloat64_beta", _wrap_EMDBaseFloat64_beta, METH_O, "EMDBaseFloat64_beta(EMDBaseFloat64 self) -> double"},
 	 { "EMDBaseFloat64_set_R", (PyCFunction)(void(*)(void))_wrap_EMDBaseFloat64_set_R, METH_VARARGS|METH_KEYWORDS, "EMDBaseFloat64_set_R(EMDBaseFloat64 self, double R)"},
 	 { "EMDBaseFloat64_set_beta", (PyCFunction)(void(*)(void))_wrap_EMDBaseFloat64_set_beta, METH_VARARGS|METH_KEYWORDS, "EMDBaseFloat64_set_beta(EMDBaseFloat64 self, double beta)"},
-	 { "EMDBaseFloat64_set_network_simplex_params", (PyCFunction)(void(*)(void))_wrap_EMDBaseFloat64_set_network_simplex_params, METH_VARARGS|METH_KEYWORDS, "EMDBaseFloat64_set_network_simplex_params(EMDBaseFloat64 self, std::size_t n_iter_max=100000, double epsilon_large_factor=1000, double epsilon_small_factor=1)"},
+	 { "EMDBaseFloat64_set_network_simplex_params", (PyCFunction)(void(*)(void))_wrap_EMDBaseFloat64_set_network_simplex_params, METH_VARARGS|METH_KEYWORDS, "EMDBaseFloat64_set_network_simplex_params(EMDBaseFloat64 self, std::size_t n_iter_max=100000, double epsilon_large_factor=1000, double epsilon_small_factor=1, double pivot_param0=0, double pivot_param1=0)"},
+	 { "EMDBaseFloat64_warm_start", _wrap_EMDBaseFloat64_warm_start, METH_O, "EMDBaseFloat64_warm_start(EMDBaseFloat64 self) -> bool"},
+	 { "EMDBaseFloat64_set_warm_start", (PyCFunction)(void(*)(void))_wrap_EMDBaseFloat64_set_warm_start, METH_VARARGS|METH_KEYWORDS, "EMDBaseFloat64_set_warm_start(EMDBaseFloat64 self, bool warm)"},
+	 { "EMDBaseFloat64_solver", _wrap_EMDBaseFloat64_solver, METH_O, "EMDBaseFloat64_solver(EMDBaseFloat64 self) -> wasserstein::EMDSolver"},
+	 { "EMDBaseFloat64_set_solver", (PyCFunction)(void(*)(void))_wrap_EMDBaseFloat64_set_solver, METH_VARARGS|METH_KEYWORDS, "EMDBaseFloat64_set_solver(EMDBaseFloat64 self, wasserstein::EMDSolver solver)"},
 	 { "EMDBaseFloat64_norm", _wrap_EMDBaseFloat64_norm, METH_O, "EMDBaseFloat64_norm(EMDBaseFloat64 self) -> bool"},
 	 { "EMDBaseFloat64_set_norm", (PyCFunction)(void(*)(void))_wrap_EMDBaseFloat64_set_norm, METH_VARARGS|METH_KEYWORDS, "EMDBaseFloat64_set_norm(EMDBaseFloat64 self, bool norm)"},
 	 { "EMDBaseFloat64_do_timing", _wrap_EMDBaseFloat64_do_timing, METH_O, "EMDBaseFloat64_do_timing(EMDBaseFloat64 self) -> bool"},
@@ -32879,6 +38767,7 @@ static PyMethodDef SwigMethods[] = {
 	 { "EMDBaseFloat64_duration", _wrap_EMDBaseFloat64_duration, METH_O, "EMDBaseFloat64_duration(EMDBaseFloat64 self) -> double"},
 	 { "EMDBaseFloat64_clear", _wrap_EMDBaseFloat64_clear, METH_O, "EMDBaseFloat64_clear(EMDBaseFloat64 self)"},
 	 { "EMDBaseFloat64_flows", _wrap_EMDBaseFloat64_flows, METH_O, "EMDBaseFloat64_flows(EMDBaseFloat64 self)"},
+	 { "EMDBaseFloat64_sparse_flows", _wrap_EMDBaseFloat64_sparse_flows, METH_O, "EMDBaseFloat64_sparse_flows(EMDBaseFloat64 self)"},
 	 { "EMDBaseFloat64_dists", _wrap_EMDBaseFloat64_dists, METH_O, "EMDBaseFloat64_dists(EMDBaseFloat64 self)"},
 	 { "EMDBaseFloat64_npy_node_potentials", _wrap_EMDBaseFloat64_npy_node_potentials, METH_O, "EMDBaseFloat64_npy_node_potentials(EMDBaseFloat64 self)"},
 	 { "EMDBaseFloat64_swigregister", EMDBaseFloat64_swigregister, METH_O, NULL},
@@ -32889,7 +38778,11 @@ static PyMethodDef SwigMethods[] = {
 	 { "PairwiseEMDBaseFloat64_set_beta", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDBaseFloat64_set_beta, METH_VARARGS|METH_KEYWORDS, "PairwiseEMDBaseFloat64_set_beta(PairwiseEMDBaseFloat64 self, double beta)"},
 	 { "PairwiseEMDBaseFloat64_norm", _wrap_PairwiseEMDBaseFloat64_norm, METH_O, "PairwiseEMDBaseFloat64_norm(PairwiseEMDBaseFloat64 self) -> bool"},
 	 { "PairwiseEMDBaseFloat64_set_norm", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDBaseFloat64_set_norm, METH_VARARGS|METH_KEYWORDS, "PairwiseEMDBaseFloat64_set_norm(PairwiseEMDBaseFloat64 self, bool norm)"},
-	 { "PairwiseEMDBaseFloat64_set_network_simplex_params", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDBaseFloat64_set_network_simplex_params, METH_VARARGS|METH_KEYWORDS, "PairwiseEMDBaseFloat64_set_network_simplex_params(PairwiseEMDBaseFloat64 self, std::size_t n_iter_max=100000, double epsilon_large_factor=1000, double epsilon_small_factor=1)"},
+	 { "PairwiseEMDBaseFloat64_set_network_simplex_params", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDBaseFloat64_set_network_simplex_params, METH_VARARGS|METH_KEYWORDS, "PairwiseEMDBaseFloat64_set_network_simplex_params(PairwiseEMDBaseFloat64 self, std::size_t n_iter_max=100000, double epsilon_large_factor=1000, double epsilon_small_factor=1, double pivot_param0=0, double pivot_param1=0)"},
+	 { "PairwiseEMDBaseFloat64_warm_start", _wrap_PairwiseEMDBaseFloat64_warm_start, METH_O, "PairwiseEMDBaseFloat64_warm_start(PairwiseEMDBaseFloat64 self) -> bool"},
+	 { "PairwiseEMDBaseFloat64_set_warm_start", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDBaseFloat64_set_warm_start, METH_VARARGS|METH_KEYWORDS, "PairwiseEMDBaseFloat64_set_warm_start(PairwiseEMDBaseFloat64 self, bool warm)"},
+	 { "PairwiseEMDBaseFloat64_solver", _wrap_PairwiseEMDBaseFloat64_solver, METH_O, "PairwiseEMDBaseFloat64_solver(PairwiseEMDBaseFloat64 self) -> wasserstein::EMDSolver"},
+	 { "PairwiseEMDBaseFloat64_set_solver", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDBaseFloat64_set_solver, METH_VARARGS|METH_KEYWORDS, "PairwiseEMDBaseFloat64_set_solver(PairwiseEMDBaseFloat64 self, wasserstein::EMDSolver solver)"},
 	 { "PairwiseEMDBaseFloat64_set_external_emd_handler", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDBaseFloat64_set_external_emd_handler, METH_VARARGS|METH_KEYWORDS, "PairwiseEMDBaseFloat64_set_external_emd_handler(PairwiseEMDBaseFloat64 self, ExternalEMDHandlerFloat64 handler)"},
 	 { "PairwiseEMDBaseFloat64_have_external_emd_handler", _wrap_PairwiseEMDBaseFloat64_have_external_emd_handler, METH_O, "PairwiseEMDBaseFloat64_have_external_emd_handler(PairwiseEMDBaseFloat64 self) -> bool"},
 	 { "PairwiseEMDBaseFloat64_num_threads", _wrap_PairwiseEMDBaseFloat64_num_threads, METH_O, "PairwiseEMDBaseFloat64_num_threads(PairwiseEMDBaseFloat64 self) -> int"},
@@ -32961,7 +38854,11 @@ static PyMethodDef SwigMethods[] = {
 	 { "EMDBaseFloat32_beta", _wrap_EMDBaseFloat32_beta, METH_O, "EMDBaseFloat32_beta(EMDBaseFloat32 self) -> float"},
 	 { "EMDBaseFloat32_set_R", (PyCFunction)(void(*)(void))_wrap_EMDBaseFloat32_set_R, METH_VARARGS|METH_KEYWORDS, "EMDBaseFloat32_set_R(EMDBaseFloat32 self, float R)"},
 	 { "EMDBaseFloat32_set_beta", (PyCFunction)(void(*)(void))_wrap_EMDBaseFloat32_set_beta, METH_VARARGS|METH_KEYWORDS, "EMDBaseFloat32_set_beta(EMDBaseFloat32 self, float beta)"},
-	 { "EMDBaseFloat32_set_network_simplex_params", (PyCFunction)(void(*)(void))_wrap_EMDBaseFloat32_set_network_simplex_params, METH_VARARGS|METH_KEYWORDS, "EMDBaseFloat32_set_network_simplex_params(EMDBaseFloat32 self, std::size_t n_iter_max=100000, float epsilon_large_factor=1000, float epsilon_small_factor=1)"},
+	 { "EMDBaseFloat32_set_network_simplex_params", (PyCFunction)(void(*)(void))_wrap_EMDBaseFloat32_set_network_simplex_params, METH_VARARGS|METH_KEYWORDS, "EMDBaseFloat32_set_network_simplex_params(EMDBaseFloat32 self, std::size_t n_iter_max=100000, float epsilon_large_factor=1000, float epsilon_small_factor=1, float pivot_param0=0, float pivot_param1=0)"},
+	 { "EMDBaseFloat32_warm_start", _wrap_EMDBaseFloat32_warm_start, METH_O, "EMDBaseFloat32_warm_start(EMDBaseFloat32 self) -> bool"},
+	 { "EMDBaseFloat32_set_warm_start", (PyCFunction)(void(*)(void))_wrap_EMDBaseFloat32_set_warm_start, METH_VARARGS|METH_KEYWORDS, "EMDBaseFloat32_set_warm_start(EMDBaseFloat32 self, bool warm)"},
+	 { "EMDBaseFloat32_solver", _wrap_EMDBaseFloat32_solver, METH_O, "EMDBaseFloat32_solver(EMDBaseFloat32 self) -> wasserstein::EMDSolver"},
+	 { "EMDBaseFloat32_set_solver", (PyCFunction)(void(*)(void))_wrap_EMDBaseFloat32_set_solver, METH_VARARGS|METH_KEYWORDS, "EMDBaseFloat32_set_solver(EMDBaseFloat32 self, wasserstein::EMDSolver solver)"},
 	 { "EMDBaseFloat32_norm", _wrap_EMDBaseFloat32_norm, METH_O, "EMDBaseFloat32_norm(EMDBaseFloat32 self) -> bool"},
 	 { "EMDBaseFloat32_set_norm", (PyCFunction)(void(*)(void))_wrap_EMDBaseFloat32_set_norm, METH_VARARGS|METH_KEYWORDS, "EMDBaseFloat32_set_norm(EMDBaseFloat32 self, bool norm)"},
 	 { "EMDBaseFloat32_do_timing", _wrap_EMDBaseFloat32_do_timing, METH_O, "EMDBaseFloat32_do_timing(EMDBaseFloat32 self) -> bool"},
@@ -32986,6 +38883,7 @@ static PyMethodDef SwigMethods[] = {
 	 { "EMDBaseFloat32_duration", _wrap_EMDBaseFloat32_duration, METH_O, "EMDBaseFloat32_duration(EMDBaseFloat32 self) -> double"},
 	 { "EMDBaseFloat32_clear", _wrap_EMDBaseFloat32_clear, METH_O, "EMDBaseFloat32_clear(EMDBaseFloat32 self)"},
 	 { "EMDBaseFloat32_flows", _wrap_EMDBaseFloat32_flows, METH_O, "EMDBaseFloat32_flows(EMDBaseFloat32 self)"},
+	 { "EMDBaseFloat32_sparse_flows", _wrap_EMDBaseFloat32_sparse_flows, METH_O, "EMDBaseFloat32_sparse_flows(EMDBaseFloat32 self)"},
 	 { "EMDBaseFloat32_dists", _wrap_EMDBaseFloat32_dists, METH_O, "EMDBaseFloat32_dists(EMDBaseFloat32 self)"},
 	 { "EMDBaseFloat32_npy_node_potentials", _wrap_EMDBaseFloat32_npy_node_potentials, METH_O, "EMDBaseFloat32_npy_node_potentials(EMDBaseFloat32 self)"},
 	 { "EMDBaseFloat32_swigregister", EMDBaseFloat32_swigregister, METH_O, NULL},
@@ -32996,7 +38894,11 @@ static PyMethodDef SwigMethods[] = {
 	 { "PairwiseEMDBaseFloat32_set_beta", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDBaseFloat32_set_beta, METH_VARARGS|METH_KEYWORDS, "PairwiseEMDBaseFloat32_set_beta(PairwiseEMDBaseFloat32 self, float beta)"},
 	 { "PairwiseEMDBaseFloat32_norm", _wrap_PairwiseEMDBaseFloat32_norm, METH_O, "PairwiseEMDBaseFloat32_norm(PairwiseEMDBaseFloat32 self) -> bool"},
 	 { "PairwiseEMDBaseFloat32_set_norm", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDBaseFloat32_set_norm, METH_VARARGS|METH_KEYWORDS, "PairwiseEMDBaseFloat32_set_norm(PairwiseEMDBaseFloat32 self, bool norm)"},
-	 { "PairwiseEMDBaseFloat32_set_network_simplex_params", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDBaseFloat32_set_network_simplex_params, METH_VARARGS|METH_KEYWORDS, "PairwiseEMDBaseFloat32_set_network_simplex_params(PairwiseEMDBaseFloat32 self, std::size_t n_iter_max=100000, float epsilon_large_factor=1000, float epsilon_small_factor=1)"},
+	 { "PairwiseEMDBaseFloat32_set_network_simplex_params", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDBaseFloat32_set_network_simplex_params, METH_VARARGS|METH_KEYWORDS, "PairwiseEMDBaseFloat32_set_network_simplex_params(PairwiseEMDBaseFloat32 self, std::size_t n_iter_max=100000, float epsilon_large_factor=1000, float epsilon_small_factor=1, float pivot_param0=0, float pivot_param1=0)"},
+	 { "PairwiseEMDBaseFloat32_warm_start", _wrap_PairwiseEMDBaseFloat32_warm_start, METH_O, "PairwiseEMDBaseFloat32_warm_start(PairwiseEMDBaseFloat32 self) -> bool"},
+	 { "PairwiseEMDBaseFloat32_set_warm_start", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDBaseFloat32_set_warm_start, METH_VARARGS|METH_KEYWORDS, "PairwiseEMDBaseFloat32_set_warm_start(PairwiseEMDBaseFloat32 self, bool warm)"},
+	 { "PairwiseEMDBaseFloat32_solver", _wrap_PairwiseEMDBaseFloat32_solver, METH_O, "PairwiseEMDBaseFloat32_solver(PairwiseEMDBaseFloat32 self) -> wasserstein::EMDSolver"},
+	 { "PairwiseEMDBaseFloat32_set_solver", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDBaseFloat32_set_solver, METH_VARARGS|METH_KEYWORDS, "PairwiseEMDBaseFloat32_set_solver(PairwiseEMDBaseFloat32 self, wasserstein::EMDSolver solver)"},
 	 { "PairwiseEMDBaseFloat32_set_external_emd_handler", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDBaseFloat32_set_external_emd_handler, METH_VARARGS|METH_KEYWORDS, "PairwiseEMDBaseFloat32_set_external_emd_handler(PairwiseEMDBaseFloat32 self, ExternalEMDHandlerFloat32 handler)"},
 	 { "PairwiseEMDBaseFloat32_have_external_emd_handler", _wrap_PairwiseEMDBaseFloat32_have_external_emd_handler, METH_O, "PairwiseEMDBaseFloat32_have_external_emd_handler(PairwiseEMDBaseFloat32 self) -> bool"},
 	 { "PairwiseEMDBaseFloat32_num_threads", _wrap_PairwiseEMDBaseFloat32_num_threads, METH_O, "PairwiseEMDBaseFloat32_num_threads(PairwiseEMDBaseFloat32 self) -> int"},
@@ -33088,51 +38990,72 @@ static PyMethodDef SwigMethods[] = {
 	 { "new_EMDFloat64", (PyCFunction)(void(*)(void))_wrap_new_EMDFloat64, METH_VARARGS|METH_KEYWORDS, "new_EMDFloat64(double R=1, double beta=1, bool norm=False, bool do_timing=False, bool external_dists=False, std::size_t n_iter_max=100000, double epsilon_large_factor=1000, double epsilon_small_factor=1) -> EMDFloat64"},
 	 { "delete_EMDFloat64", _wrap_delete_EMDFloat64, METH_O, "delete_EMDFloat64(EMDFloat64 self)"},
 	 { "EMDFloat64_description", (PyCFunction)(void(*)(void))_wrap_EMDFloat64_description, METH_VARARGS|METH_KEYWORDS, "EMDFloat64_description(EMDFloat64 self, bool write_preprocessors=True) -> std::string"},
+	 { "EMDFloat64_last_solver", _wrap_EMDFloat64_last_solver, METH_O, "EMDFloat64_last_solver(EMDFloat64 self) -> wasserstein::EMDSolver"},
 	 { "EMDFloat64___repr__", _wrap_EMDFloat64___repr__, METH_O, "EMDFloat64___repr__(EMDFloat64 self) -> std::string"},
 	 { "EMDFloat64_preprocess_CenterWeightedCentroid", _wrap_EMDFloat64_preprocess_CenterWeightedCentroid, METH_O, "EMDFloat64_preprocess_CenterWeightedCentroid(EMDFloat64 self)"},
 	 { "EMDFloat64___call__", _wrap_EMDFloat64___call__, METH_VARARGS, "\n"
 		"EMDFloat64___call__(EMDFloat64 self, double * weights0, double * coords0, double * weights1, double * coords1) -> double\n"
 		"EMDFloat64___call__(EMDFloat64 self, double * weights0, double * weights1, double * external_dists) -> double\n"
 		""},
+	 { "EMDFloat64_lower_bound", (PyCFunction)(void(*)(void))_wrap_EMDFloat64_lower_bound, METH_VARARGS|METH_KEYWORDS, "EMDFloat64_lower_bound(EMDFloat64 self, double * weights0, double * coords0, double * weights1, double * coords1) -> double"},
+	 { "EMDFloat64_upper_bound", (PyCFunction)(void(*)(void))_wrap_EMDFloat64_upper_bound, METH_VARARGS|METH_KEYWORDS, "EMDFloat64_upper_bound(EMDFloat64 self, double * weights0, double * coords0, double * weights1, double * coords1) -> double"},
+	 { "EMDFloat64_within", (PyCFunction)(void(*)(void))_wrap_EMDFloat64_within, METH_VARARGS|METH_KEYWORDS, "EMDFloat64_within(EMDFloat64 self, double * weights0, double * coords0, double * weights1, double * coords1, double threshold) -> bool"},
 	 { "EMDFloat64_swigregister", EMDFloat64_swigregister, METH_O, NULL},
 	 { "EMDFloat64_swiginit", EMDFloat64_swiginit, METH_VARARGS, NULL},
 	 { "new_EMDFloat32", (PyCFunction)(void(*)(void))_wrap_new_EMDFloat32, METH_VARARGS|METH_KEYWORDS, "new_EMDFloat32(float R=1, float beta=1, bool norm=False, bool do_timing=False, bool external_dists=False, std::size_t n_iter_max=100000, float epsilon_large_factor=1000, float epsilon_small_factor=1) -> EMDFloat32"},
 	 { "delete_EMDFloat32", _wrap_delete_EMDFloat32, METH_O, "delete_EMDFloat32(EMDFloat32 self)"},
 	 { "EMDFloat32_description", (PyCFunction)(void(*)(void))_wrap_EMDFloat32_description, METH_VARARGS|METH_KEYWORDS, "EMDFloat32_description(EMDFloat32 self, bool write_preprocessors=True) -> std::string"},
+	 { "EMDFloat32_last_solver", _wrap_EMDFloat32_last_solver, METH_O, "EMDFloat32_last_solver(EMDFloat32 self) -> wasserstein::EMDSolver"},
 	 { "EMDFloat32___repr__", _wrap_EMDFloat32___repr__, METH_O, "EMDFloat32___repr__(EMDFloat32 self) -> std::string"},
 	 { "EMDFloat32_preprocess_CenterWeightedCentroid", _wrap_EMDFloat32_preprocess_CenterWeightedCentroid, METH_O, "EMDFloat32_preprocess_CenterWeightedCentroid(EMDFloat32 self)"},
 	 { "EMDFloat32___call__", _wrap_EMDFloat32___call__, METH_VARARGS, "\n"
 		"EMDFloat32___call__(EMDFloat32 self, float * weights0, float * coords0, float * weights1, float * coords1) -> float\n"
 		"EMDFloat32___call__(EMDFloat32 self, float * weights0, float * weights1, float * external_dists) -> float\n"
 		""},
+	 { "EMDFloat32_lower_bound", (PyCFunction)(void(*)(void))_wrap_EMDFloat32_lower_bound, METH_VARARGS|METH_KEYWORDS, "EMDFloat32_lower_bound(EMDFloat32 self, float * weights0, float * coords0, float * weights1, float * coords1) -> float"},
+	 { "EMDFloat32_upper_bound", (PyCFunction)(void(*)(void))_wrap_EMDFloat32_upper_bound, METH_VARARGS|METH_KEYWORDS, "EMDFloat32_upper_bound(EMDFloat32 self, float * weights0, float * coords0, float * weights1, float * coords1) -> float"},
+	 { "EMDFloat32_within", (PyCFunction)(void(*)(void))_wrap_EMDFloat32_within, METH_VARARGS|METH_KEYWORDS, "EMDFloat32_within(EMDFloat32 self, float * weights0, float * coords0, float * weights1, float * coords1, float threshold) -> bool"},
 	 { "EMDFloat32_swigregister", EMDFloat32_swigregister, METH_O, NULL},
 	 { "EMDFloat32_swiginit", EMDFloat32_swiginit, METH_VARARGS, NULL},
 	 { "new_EMDYPhiFloat64", (PyCFunction)(void(*)(void))_wrap_new_EMDYPhiFloat64, METH_VARARGS|METH_KEYWORDS, "new_EMDYPhiFloat64(double R=1, double beta=1, bool norm=False, bool do_timing=False, bool external_dists=False, std::size_t n_iter_max=100000, double epsilon_large_factor=1000, double epsilon_small_factor=1) -> EMDYPhiFloat64"},
 	 { "delete_EMDYPhiFloat64", _wrap_delete_EMDYPhiFloat64, METH_O, "delete_EMDYPhiFloat64(EMDYPhiFloat64 self)"},
 	 { "EMDYPhiFloat64_description", (PyCFunction)(void(*)(void))_wrap_EMDYPhiFloat64_description, METH_VARARGS|METH_KEYWORDS, "EMDYPhiFloat64_description(EMDYPhiFloat64 self, bool write_preprocessors=True) -> std::string"},
+	 { "EMDYPhiFloat64_last_solver", _wrap_EMDYPhiFloat64_last_solver, METH_O, "EMDYPhiFloat64_last_solver(EMDYPhiFloat64 self) -> wasserstein::EMDSolver"},
 	 { "EMDYPhiFloat64___repr__", _wrap_EMDYPhiFloat64___repr__, METH_O, "EMDYPhiFloat64___repr__(EMDYPhiFloat64 self) -> std::string"},
 	 { "EMDYPhiFloat64_preprocess_CenterWeightedCentroid", _wrap_EMDYPhiFloat64_preprocess_CenterWeightedCentroid, METH_O, "EMDYPhiFloat64_preprocess_CenterWeightedCentroid(EMDYPhiFloat64 self)"},
 	 { "EMDYPhiFloat64___call__", _wrap_EMDYPhiFloat64___call__, METH_VARARGS, "\n"
 		"EMDYPhiFloat64___call__(EMDYPhiFloat64 self, double * weights0, double * coords0, double * weights1, double * coords1) -> double\n"
 		"EMDYPhiFloat64___call__(EMDYPhiFloat64 self, double * weights0, double * weights1, double * external_dists) -> double\n"
 		""},
+	 { "EMDYPhiFloat64_lower_bound", (PyCFunction)(void(*)(void))_wrap_EMDYPhiFloat64_lower_bound, METH_VARARGS|METH_KEYWORDS, "EMDYPhiFloat64_lower_bound(EMDYPhiFloat64 self, double * weights0, double * coords0, double * weights1, double * coords1) -> double"},
+	 { "EMDYPhiFloat64_upper_bound", (PyCFunction)(void(*)(void))_wrap_EMDYPhiFloat64_upper_bound, METH_VARARGS|METH_KEYWORDS, "EMDYPhiFloat64_upper_bound(EMDYPhiFloat64 self, double * weights0, double * coords0, double * weights1, double * coords1) -> double"},
+	 { "EMDYPhiFloat64_within", (PyCFunction)(void(*)(void))_wrap_EMDYPhiFloat64_within, METH_VARARGS|METH_KEYWORDS, "EMDYPhiFloat64_within(EMDYPhiFloat64 self, double * weights0, double * coords0, double * weights1, double * coords1, double threshold) -> bool"},
 	 { "EMDYPhiFloat64_swigregister", EMDYPhiFloat64_swigregister, METH_O, NULL},
 	 { "EMDYPhiFloat64_swiginit", EMDYPhiFloat64_swiginit, METH_VARARGS, NULL},
 	 { "new_EMDYPhiFloat32", (PyCFunction)(void(*)(void))_wrap_new_EMDYPhiFloat32, METH_VARARGS|METH_KEYWORDS, "new_EMDYPhiFloat32(float R=1, float beta=1, bool norm=False, bool do_timing=False, bool external_dists=False, std::size_t n_iter_max=100000, float epsilon_large_factor=1000, float epsilon_small_factor=1) -> EMDYPhiFloat32"},
 	 { "delete_EMDYPhiFloat32", _wrap_delete_EMDYPhiFloat32, METH_O, "delete_EMDYPhiFloat32(EMDYPhiFloat32 self)"},
 	 { "EMDYPhiFloat32_description", (PyCFunction)(void(*)(void))_wrap_EMDYPhiFloat32_description, METH_VARARGS|METH_KEYWORDS, "EMDYPhiFloat32_description(EMDYPhiFloat32 self, bool write_preprocessors=True) -> std::string"},
+	 { "EMDYPhiFloat32_last_solver", _wrap_EMDYPhiFloat32_last_solver, METH_O, "EMDYPhiFloat32_last_solver(EMDYPhiFloat32 self) -> wasserstein::EMDSolver"},
 	 { "EMDYPhiFloat32___repr__", _wrap_EMDYPhiFloat32___repr__, METH_O, "EMDYPhiFloat32___repr__(EMDYPhiFloat32 self) -> std::string"},
 	 { "EMDYPhiFloat32_preprocess_CenterWeightedCentroid", _wrap_EMDYPhiFloat32_preprocess_CenterWeightedCentroid, METH_O, "EMDYPhiFloat32_preprocess_CenterWeightedCentroid(EMDYPhiFloat32 self)"},
 	 { "EMDYPhiFloat32___call__", _wrap_EMDYPhiFloat32___call__, METH_VARARGS, "\n"
 		"EMDYPhiFloat32___call__(EMDYPhiFloat32 self, float * weights0, float * coords0, float * weights1, float * coords1) -> float\n"
 		"EMDYPhiFloat32___call__(EMDYPhiFloat32 self, float * weights0, float * weights1, float * external_dists) -> float\n"
 		""},
+	 { "EMDYPhiFloat32_lower_bound", (PyCFunction)(void(*)(void))_wrap_EMDYPhiFloat32_lower_bound, METH_VARARGS|METH_KEYWORDS, "EMDYPhiFloat32_lower_bound(EMDYPhiFloat32 self, float * weights0, float * coords0, float * weights1, float * coords1) -> float"},
+	 { "EMDYPhiFloat32_upper_bound", (PyCFunction)(void(*)(void))_wrap_EMDYPhiFloat32_upper_bound, METH_VARARGS|METH_KEYWORDS, "EMDYPhiFloat32_upper_bound(EMDYPhiFloat32 self, float * weights0, float * coords0, float * weights1, float * coords1) -> float"},
+	 { "EMDYPhiFloat32_within", (PyCFunction)(void(*)(void))_wrap_EMDYPhiFloat32_within, METH_VARARGS|METH_KEYWORDS, "EMDYPhiFloat32_within(EMDYPhiFloat32 self, float * weights0, float * coords0, float * weights1, float * coords1, float threshold) -> bool"},
 	 { "EMDYPhiFloat32_swigregister", EMDYPhiFloat32_swigregister, METH_O, NULL},
 	 { "EMDYPhiFloat32_swiginit", EMDYPhiFloat32_swiginit, METH_VARARGS, NULL},
 	 { "new_PairwiseEMDFloat64", (PyCFunction)(void(*)(void))_wrap_new_PairwiseEMDFloat64, METH_VARARGS|METH_KEYWORDS, "new_PairwiseEMDFloat64(double R=1, double beta=1, bool norm=False, int num_threads=-1, wasserstein::index_type print_every=-10, unsigned int verbose=1, bool request_mode=False, bool store_sym_emds_raw=True, bool throw_on_error=False, unsigned int omp_dynamic_chunksize=10, std::size_t n_iter_max=100000, double epsilon_large_factor=1000, double epsilon_small_factor=1, std::ostream & os=std::cout) -> PairwiseEMDFloat64"},
 	 { "delete_PairwiseEMDFloat64", _wrap_delete_PairwiseEMDFloat64, METH_O, "delete_PairwiseEMDFloat64(PairwiseEMDFloat64 self)"},
 	 { "PairwiseEMDFloat64_description", _wrap_PairwiseEMDFloat64_description, METH_O, "PairwiseEMDFloat64_description(PairwiseEMDFloat64 self) -> std::string"},
 	 { "PairwiseEMDFloat64_clear", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDFloat64_clear, METH_VARARGS|METH_KEYWORDS, "PairwiseEMDFloat64_clear(PairwiseEMDFloat64 self, bool free_memory=True)"},
+	 { "PairwiseEMDFloat64_reserve", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDFloat64_reserve, METH_VARARGS|METH_KEYWORDS, "PairwiseEMDFloat64_reserve(PairwiseEMDFloat64 self, std::size_t max_mult, bool huge_pages=False)"},
+	 { "PairwiseEMDFloat64_threshold", _wrap_PairwiseEMDFloat64_threshold, METH_O, "PairwiseEMDFloat64_threshold(PairwiseEMDFloat64 self) -> double"},
+	 { "PairwiseEMDFloat64_has_threshold", _wrap_PairwiseEMDFloat64_has_threshold, METH_O, "PairwiseEMDFloat64_has_threshold(PairwiseEMDFloat64 self) -> bool"},
+	 { "PairwiseEMDFloat64_set_threshold", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDFloat64_set_threshold, METH_VARARGS|METH_KEYWORDS, "PairwiseEMDFloat64_set_threshold(PairwiseEMDFloat64 self, double threshold=std::numeric_limits< double >::max())"},
+	 { "PairwiseEMDFloat64_has_sweep", _wrap_PairwiseEMDFloat64_has_sweep, METH_O, "PairwiseEMDFloat64_has_sweep(PairwiseEMDFloat64 self) -> bool"},
 	 { "PairwiseEMDFloat64_init", _wrap_PairwiseEMDFloat64_init, METH_VARARGS, "\n"
 		"PairwiseEMDFloat64_init(PairwiseEMDFloat64 self, wasserstein::index_type nev)\n"
 		"PairwiseEMDFloat64_init(PairwiseEMDFloat64 self, wasserstein::index_type nevA, wasserstein::index_type nevB)\n"
@@ -33140,14 +39063,22 @@ static PyMethodDef SwigMethods[] = {
 	 { "PairwiseEMDFloat64_compute", _wrap_PairwiseEMDFloat64_compute, METH_O, "PairwiseEMDFloat64_compute(PairwiseEMDFloat64 self)"},
 	 { "PairwiseEMDFloat64___repr__", _wrap_PairwiseEMDFloat64___repr__, METH_O, "PairwiseEMDFloat64___repr__(PairwiseEMDFloat64 self) -> std::string"},
 	 { "PairwiseEMDFloat64_preprocess_CenterWeightedCentroid", _wrap_PairwiseEMDFloat64_preprocess_CenterWeightedCentroid, METH_O, "PairwiseEMDFloat64_preprocess_CenterWeightedCentroid(PairwiseEMDFloat64 self)"},
+	 { "PairwiseEMDFloat64_close_pairs", _wrap_PairwiseEMDFloat64_close_pairs, METH_O, "PairwiseEMDFloat64_close_pairs(PairwiseEMDFloat64 self)"},
 	 { "PairwiseEMDFloat64__reset_B_events", _wrap_PairwiseEMDFloat64__reset_B_events, METH_O, "PairwiseEMDFloat64__reset_B_events(PairwiseEMDFloat64 self)"},
 	 { "PairwiseEMDFloat64__add_event", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDFloat64__add_event, METH_VARARGS|METH_KEYWORDS, "PairwiseEMDFloat64__add_event(PairwiseEMDFloat64 self, double * weights, double * coords, double event_weight=1)"},
+	 { "PairwiseEMDFloat64_set_sweep", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDFloat64_set_sweep, METH_VARARGS|METH_KEYWORDS, "PairwiseEMDFloat64_set_sweep(PairwiseEMDFloat64 self, double * Rs, double * betas)"},
+	 { "PairwiseEMDFloat64_sweep_emds", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDFloat64_sweep_emds, METH_VARARGS|METH_KEYWORDS, "PairwiseEMDFloat64_sweep_emds(PairwiseEMDFloat64 self, std::size_t p)"},
 	 { "PairwiseEMDFloat64_swigregister", PairwiseEMDFloat64_swigregister, METH_O, NULL},
 	 { "PairwiseEMDFloat64_swiginit", PairwiseEMDFloat64_swiginit, METH_VARARGS, NULL},
 	 { "new_PairwiseEMDFloat32", (PyCFunction)(void(*)(void))_wrap_new_PairwiseEMDFloat32, METH_VARARGS|METH_KEYWORDS, "new_PairwiseEMDFloat32(float R=1, float beta=1, bool norm=False, int num_threads=-1, wasserstein::index_type print_every=-10, unsigned int verbose=1, bool request_mode=False, bool store_sym_emds_raw=True, bool throw_on_error=False, unsigned int omp_dynamic_chunksize=10, std::size_t n_iter_max=100000, float epsilon_large_factor=1000, float epsilon_small_factor=1, std::ostream & os=std::cout) -> PairwiseEMDFloat32"},
 	 { "delete_PairwiseEMDFloat32", _wrap_delete_PairwiseEMDFloat32, METH_O, "delete_PairwiseEMDFloat32(PairwiseEMDFloat32 self)"},
 	 { "PairwiseEMDFloat32_description", _wrap_PairwiseEMDFloat32_description, METH_O, "PairwiseEMDFloat32_description(PairwiseEMDFloat32 self) -> std::string"},
 	 { "PairwiseEMDFloat32_clear", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDFloat32_clear, METH_VARARGS|METH_KEYWORDS, "PairwiseEMDFloat32_clear(PairwiseEMDFloat32 self, bool free_memory=True)"},
+	 { "PairwiseEMDFloat32_reserve", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDFloat32_reserve, METH_VARARGS|METH_KEYWORDS, "PairwiseEMDFloat32_reserve(PairwiseEMDFloat32 self, std::size_t max_mult, bool huge_pages=False)"},
+	 { "PairwiseEMDFloat32_threshold", _wrap_PairwiseEMDFloat32_threshold, METH_O, "PairwiseEMDFloat32_threshold(PairwiseEMDFloat32 self) -> float"},
+	 { "PairwiseEMDFloat32_has_threshold", _wrap_PairwiseEMDFloat32_has_threshold, METH_O, "PairwiseEMDFloat32_has_threshold(PairwiseEMDFloat32 self) -> bool"},
+	 { "PairwiseEMDFloat32_set_threshold", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDFloat32_set_threshold, METH_VARARGS|METH_KEYWORDS, "PairwiseEMDFloat32_set_threshold(PairwiseEMDFloat32 self, float threshold=std::numeric_limits< float >::max())"},
+	 { "PairwiseEMDFloat32_has_sweep", _wrap_PairwiseEMDFloat32_has_sweep, METH_O, "PairwiseEMDFloat32_has_sweep(PairwiseEMDFloat32 self) -> bool"},
 	 { "PairwiseEMDFloat32_init", _wrap_PairwiseEMDFloat32_init, METH_VARARGS, "\n"
 		"PairwiseEMDFloat32_init(PairwiseEMDFloat32 self, wasserstein::index_type nev)\n"
 		"PairwiseEMDFloat32_init(PairwiseEMDFloat32 self, wasserstein::index_type nevA, wasserstein::index_type nevB)\n"
@@ -33155,14 +39086,22 @@ static PyMethodDef SwigMethods[] = {
 	 { "PairwiseEMDFloat32_compute", _wrap_PairwiseEMDFloat32_compute, METH_O, "PairwiseEMDFloat32_compute(PairwiseEMDFloat32 self)"},
 	 { "PairwiseEMDFloat32___repr__", _wrap_PairwiseEMDFloat32___repr__, METH_O, "PairwiseEMDFloat32___repr__(PairwiseEMDFloat32 self) -> std::string"},
 	 { "PairwiseEMDFloat32_preprocess_CenterWeightedCentroid", _wrap_PairwiseEMDFloat32_preprocess_CenterWeightedCentroid, METH_O, "PairwiseEMDFloat32_preprocess_CenterWeightedCentroid(PairwiseEMDFloat32 self)"},
+	 { "PairwiseEMDFloat32_close_pairs", _wrap_PairwiseEMDFloat32_close_pairs, METH_O, "PairwiseEMDFloat32_close_pairs(PairwiseEMDFloat32 self)"},
 	 { "PairwiseEMDFloat32__reset_B_events", _wrap_PairwiseEMDFloat32__reset_B_events, METH_O, "PairwiseEMDFloat32__reset_B_events(PairwiseEMDFloat32 self)"},
 	 { "PairwiseEMDFloat32__add_event", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDFloat32__add_event, METH_VARARGS|METH_KEYWORDS, "PairwiseEMDFloat32__add_event(PairwiseEMDFloat32 self, float * weights, float * coords, float event_weight=1)"},
+	 { "PairwiseEMDFloat32_set_sweep", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDFloat32_set_sweep, METH_VARARGS|METH_KEYWORDS, "PairwiseEMDFloat32_set_sweep(PairwiseEMDFloat32 self, float * Rs, float * betas)"},
+	 { "PairwiseEMDFloat32_sweep_emds", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDFloat32_sweep_emds, METH_VARARGS|METH_KEYWORDS, "PairwiseEMDFloat32_sweep_emds(PairwiseEMDFloat32 self, std::size_t p)"},
 	 { "PairwiseEMDFloat32_swigregister", PairwiseEMDFloat32_swigregister, METH_O, NULL},
 	 { "PairwiseEMDFloat32_swiginit", PairwiseEMDFloat32_swiginit, METH_VARARGS, NULL},
 	 { "new_PairwiseEMDYPhiFloat64", (PyCFunction)(void(*)(void))_wrap_new_PairwiseEMDYPhiFloat64, METH_VARARGS|METH_KEYWORDS, "new_PairwiseEMDYPhiFloat64(double R=1, double beta=1, bool norm=False, int num_threads=-1, wasserstein::index_type print_every=-10, unsigned int verbose=1, bool request_mode=False, bool store_sym_emds_raw=True, bool throw_on_error=False, unsigned int omp_dynamic_chunksize=10, std::size_t n_iter_max=100000, double epsilon_large_factor=1000, double epsilon_small_factor=1, std::ostream & os=std::cout) -> PairwiseEMDYPhiFloat64"},
 	 { "delete_PairwiseEMDYPhiFloat64", _wrap_delete_PairwiseEMDYPhiFloat64, METH_O, "delete_PairwiseEMDYPhiFloat64(PairwiseEMDYPhiFloat64 self)"},
 	 { "PairwiseEMDYPhiFloat64_description", _wrap_PairwiseEMDYPhiFloat64_description, METH_O, "PairwiseEMDYPhiFloat64_description(PairwiseEMDYPhiFloat64 self) -> std::string"},
 	 { "PairwiseEMDYPhiFloat64_clear", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDYPhiFloat64_clear, METH_VARARGS|METH_KEYWORDS, "PairwiseEMDYPhiFloat64_clear(PairwiseEMDYPhiFloat64 self, bool free_memory=True)"},
+	 { "PairwiseEMDYPhiFloat64_reserve", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDYPhiFloat64_reserve, METH_VARARGS|METH_KEYWORDS, "PairwiseEMDYPhiFloat64_reserve(PairwiseEMDYPhiFloat64 self, std::size_t max_mult, bool huge_pages=False)"},
+	 { "PairwiseEMDYPhiFloat64_threshold", _wrap_PairwiseEMDYPhiFloat64_threshold, METH_O, "PairwiseEMDYPhiFloat64_threshold(PairwiseEMDYPhiFloat64 self) -> double"},
+	 { "PairwiseEMDYPhiFloat64_has_threshold", _wrap_PairwiseEMDYPhiFloat64_has_threshold, METH_O, "PairwiseEMDYPhiFloat64_has_threshold(PairwiseEMDYPhiFloat64 self) -> bool"},
+	 { "PairwiseEMDYPhiFloat64_set_threshold", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDYPhiFloat64_set_threshold, METH_VARARGS|METH_KEYWORDS, "PairwiseEMDYPhiFloat64_set_threshold(PairwiseEMDYPhiFloat64 self, double threshold=std::numeric_limits< double >::max())"},
+	 { "PairwiseEMDYPhiFloat64_has_sweep", _wrap_PairwiseEMDYPhiFloat64_has_sweep, METH_O, "PairwiseEMDYPhiFloat64_has_sweep(PairwiseEMDYPhiFloat64 self) -> bool"},
 	 { "PairwiseEMDYPhiFloat64_init", _wrap_PairwiseEMDYPhiFloat64_init, METH_VARARGS, "\n"
 		"PairwiseEMDYPhiFloat64_init(PairwiseEMDYPhiFloat64 self, wasserstein::index_type nev)\n"
 		"PairwiseEMDYPhiFloat64_init(PairwiseEMDYPhiFloat64 self, wasserstein::index_type nevA, wasserstein::index_type nevB)\n"
@@ -33170,14 +39109,22 @@ static PyMethodDef SwigMethods[] = {
 	 { "PairwiseEMDYPhiFloat64_compute", _wrap_PairwiseEMDYPhiFloat64_compute, METH_O, "PairwiseEMDYPhiFloat64_compute(PairwiseEMDYPhiFloat64 self)"},
 	 { "PairwiseEMDYPhiFloat64___repr__", _wrap_PairwiseEMDYPhiFloat64___repr__, METH_O, "PairwiseEMDYPhiFloat64___repr__(PairwiseEMDYPhiFloat64 self) -> std::string"},
 	 { "PairwiseEMDYPhiFloat64_preprocess_CenterWeightedCentroid", _wrap_PairwiseEMDYPhiFloat64_preprocess_CenterWeightedCentroid, METH_O, "PairwiseEMDYPhiFloat64_preprocess_CenterWeightedCentroid(PairwiseEMDYPhiFloat64 self)"},
+	 { "PairwiseEMDYPhiFloat64_close_pairs", _wrap_PairwiseEMDYPhiFloat64_close_pairs, METH_O, "PairwiseEMDYPhiFloat64_close_pairs(PairwiseEMDYPhiFloat64 self)"},
 	 { "PairwiseEMDYPhiFloat64__reset_B_events", _wrap_PairwiseEMDYPhiFloat64__reset_B_events, METH_O, "PairwiseEMDYPhiFloat64__reset_B_events(PairwiseEMDYPhiFloat64 self)"},
 	 { "PairwiseEMDYPhiFloat64__add_event", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDYPhiFloat64__add_event, METH_VARARGS|METH_KEYWORDS, "PairwiseEMDYPhiFloat64__add_event(PairwiseEMDYPhiFloat64 self, double * weights, double * coords, double event_weight=1)"},
+	 { "PairwiseEMDYPhiFloat64_set_sweep", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDYPhiFloat64_set_sweep, METH_VARARGS|METH_KEYWORDS, "PairwiseEMDYPhiFloat64_set_sweep(PairwiseEMDYPhiFloat64 self, double * Rs, double * betas)"},
+	 { "PairwiseEMDYPhiFloat64_sweep_emds", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDYPhiFloat64_sweep_emds, METH_VARARGS|METH_KEYWORDS, "PairwiseEMDYPhiFloat64_sweep_emds(PairwiseEMDYPhiFloat64 self, std::size_t p)"},
 	 { "PairwiseEMDYPhiFloat64_swigregister", PairwiseEMDYPhiFloat64_swigregister, METH_O, NULL},
 	 { "PairwiseEMDYPhiFloat64_swiginit", PairwiseEMDYPhiFloat64_swiginit, METH_VARARGS, NULL},
 	 { "new_PairwiseEMDYPhiFloat32", (PyCFunction)(void(*)(void))_wrap_new_PairwiseEMDYPhiFloat32, METH_VARARGS|METH_KEYWORDS, "new_PairwiseEMDYPhiFloat32(float R=1, float beta=1, bool norm=False, int num_threads=-1, wasserstein::index_type print_every=-10, unsigned int verbose=1, bool request_mode=False, bool store_sym_emds_raw=True, bool throw_on_error=False, unsigned int omp_dynamic_chunksize=10, std::size_t n_iter_max=100000, float epsilon_large_factor=1000, float epsilon_small_factor=1, std::ostream & os=std::cout) -> PairwiseEMDYPhiFloat32"},
 	 { "delete_PairwiseEMDYPhiFloat32", _wrap_delete_PairwiseEMDYPhiFloat32, METH_O, "delete_PairwiseEMDYPhiFloat32(PairwiseEMDYPhiFloat32 self)"},
 	 { "PairwiseEMDYPhiFloat32_description", _wrap_PairwiseEMDYPhiFloat32_description, METH_O, "PairwiseEMDYPhiFloat32_description(PairwiseEMDYPhiFloat32 self) -> std::string"},
 	 { "PairwiseEMDYPhiFloat32_clear", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDYPhiFloat32_clear, METH_VARARGS|METH_KEYWORDS, "PairwiseEMDYPhiFloat32_clear(PairwiseEMDYPhiFloat32 self, bool free_memory=True)"},
+	 { "PairwiseEMDYPhiFloat32_reserve", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDYPhiFloat32_reserve, METH_VARARGS|METH_KEYWORDS, "PairwiseEMDYPhiFloat32_reserve(PairwiseEMDYPhiFloat32 self, std::size_t max_mult, bool huge_pages=False)"},
+	 { "PairwiseEMDYPhiFloat32_threshold", _wrap_PairwiseEMDYPhiFloat32_threshold, METH_O, "PairwiseEMDYPhiFloat32_threshold(PairwiseEMDYPhiFloat32 self) -> float"},
+	 { "PairwiseEMDYPhiFloat32_has_threshold", _wrap_PairwiseEMDYPhiFloat32_has_threshold, METH_O, "PairwiseEMDYPhiFloat32_has_threshold(PairwiseEMDYPhiFloat32 self) -> bool"},
+	 { "PairwiseEMDYPhiFloat32_set_threshold", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDYPhiFloat32_set_threshold, METH_VARARGS|METH_KEYWORDS, "PairwiseEMDYPhiFloat32_set_threshold(PairwiseEMDYPhiFloat32 self, float threshold=std::numeric_limits< float >::max())"},
+	 { "PairwiseEMDYPhiFloat32_has_sweep", _wrap_PairwiseEMDYPhiFloat32_has_sweep, METH_O, "PairwiseEMDYPhiFloat32_has_sweep(PairwiseEMDYPhiFloat32 self) -> bool"},
 	 { "PairwiseEMDYPhiFloat32_init", _wrap_PairwiseEMDYPhiFloat32_init, METH_VARARGS, "\n"
 		"PairwiseEMDYPhiFloat32_init(PairwiseEMDYPhiFloat32 self, wasserstein::index_type nev)\n"
 		"PairwiseEMDYPhiFloat32_init(PairwiseEMDYPhiFloat32 self, wasserstein::index_type nevA, wasserstein::index_type nevB)\n"
@@ -33185,8 +39132,11 @@ static PyMethodDef SwigMethods[] = {
 	 { "PairwiseEMDYPhiFloat32_compute", _wrap_PairwiseEMDYPhiFloat32_compute, METH_O, "PairwiseEMDYPhiFloat32_compute(PairwiseEMDYPhiFloat32 self)"},
 	 { "PairwiseEMDYPhiFloat32___repr__", _wrap_PairwiseEMDYPhiFloat32___repr__, METH_O, "PairwiseEMDYPhiFloat32___repr__(PairwiseEMDYPhiFloat32 self) -> std::string"},
 	 { "PairwiseEMDYPhiFloat32_preprocess_CenterWeightedCentroid", _wrap_PairwiseEMDYPhiFloat32_preprocess_CenterWeightedCentroid, METH_O, "PairwiseEMDYPhiFloat32_preprocess_CenterWeightedCentroid(PairwiseEMDYPhiFloat32 self)"},
+	 { "PairwiseEMDYPhiFloat32_close_pairs", _wrap_PairwiseEMDYPhiFloat32_close_pairs, METH_O, "PairwiseEMDYPhiFloat32_close_pairs(PairwiseEMDYPhiFloat32 self)"},
 	 { "PairwiseEMDYPhiFloat32__reset_B_events", _wrap_PairwiseEMDYPhiFloat32__reset_B_events, METH_O, "PairwiseEMDYPhiFloat32__reset_B_events(PairwiseEMDYPhiFloat32 self)"},
 	 { "PairwiseEMDYPhiFloat32__add_event", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDYPhiFloat32__add_event, METH_VARARGS|METH_KEYWORDS, "PairwiseEMDYPhiFloat32__add_event(PairwiseEMDYPhiFloat32 self, float * weights, float * coords, float event_weight=1)"},
+	 { "PairwiseEMDYPhiFloat32_set_sweep", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDYPhiFloat32_set_sweep, METH_VARARGS|METH_KEYWORDS, "PairwiseEMDYPhiFloat32_set_sweep(PairwiseEMDYPhiFloat32 self, float * Rs, float * betas)"},
+	 { "PairwiseEMDYPhiFloat32_sweep_emds", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDYPhiFloat32_sweep_emds, METH_VARARGS|METH_KEYWORDS, "PairwiseEMDYPhiFloat32_sweep_emds(PairwiseEMDYPhiFloat32 self, std::size_t p)"},
 	 { "PairwiseEMDYPhiFloat32_swigregister", PairwiseEMDYPhiFloat32_swigregister, METH_O, NULL},
 	 { "PairwiseEMDYPhiFloat32_swiginit", PairwiseEMDYPhiFloat32_swiginit, METH_VARARGS, NULL},
 	 { NULL, NULL, 0, NULL }
@@ -33432,7 +39382,11 @@ static PyMethodDef SwigMethods_proxydocs[] = {
 	 { "EMDBaseFloat64_beta", _wrap_EMDBaseFloat64_beta, METH_O, "beta(EMDBaseFloat64 self) -> double"},
 	 { "EMDBaseFloat64_set_R", (PyCFunction)(void(*)(void))_wrap_EMDBaseFloat64_set_R, METH_VARARGS|METH_KEYWORDS, "set_R(EMDBaseFloat64 self, double R)"},
 	 { "EMDBaseFloat64_set_beta", (PyCFunction)(void(*)(void))_wrap_EMDBaseFloat64_set_beta, METH_VARARGS|METH_KEYWORDS, "set_beta(EMDBaseFloat64 self, double beta)"},
-	 { "EMDBaseFloat64_set_network_simplex_params", (PyCFunction)(void(*)(void))_wrap_EMDBaseFloat64_set_network_simplex_params, METH_VARARGS|METH_KEYWORDS, "set_network_simplex_params(EMDBaseFloat64 self, std::size_t n_iter_max=100000, double epsilon_large_factor=1000, double epsilon_small_factor=1)"},
+	 { "EMDBaseFloat64_set_network_simplex_params", (PyCFunction)(void(*)(void))_wrap_EMDBaseFloat64_set_network_simplex_params, METH_VARARGS|METH_KEYWORDS, "set_network_simplex_params(EMDBaseFloat64 self, std::size_t n_iter_max=100000, double epsilon_large_factor=1000, double epsilon_small_factor=1, double pivot_param0=0, double pivot_param1=0)"},
+	 { "EMDBaseFloat64_warm_start", _wrap_EMDBaseFloat64_warm_start, METH_O, "warm_start(EMDBaseFloat64 self) -> bool"},
+	 { "EMDBaseFloat64_set_warm_start", (PyCFunction)(void(*)(void))_wrap_EMDBaseFloat64_set_warm_start, METH_VARARGS|METH_KEYWORDS, "set_warm_start(EMDBaseFloat64 self, bool warm)"},
+	 { "EMDBaseFloat64_solver", _wrap_EMDBaseFloat64_solver, METH_O, "solver(EMDBaseFloat64 self) -> wasserstein::EMDSolver"},
+	 { "EMDBaseFloat64_set_solver", (PyCFunction)(void(*)(void))_wrap_EMDBaseFloat64_set_solver, METH_VARARGS|METH_KEYWORDS, "set_solver(EMDBaseFloat64 self, wasserstein::EMDSolver solver)"},
 	 { "EMDBaseFloat64_norm", _wrap_EMDBaseFloat64_norm, METH_O, "norm(EMDBaseFloat64 self) -> bool"},
 	 { "EMDBaseFloat64_set_norm", (PyCFunction)(void(*)(void))_wrap_EMDBaseFloat64_set_norm, METH_VARARGS|METH_KEYWORDS, "set_norm(EMDBaseFloat64 self, bool norm)"},
 	 { "EMDBaseFloat64_do_timing", _wrap_EMDBaseFloat64_do_timing, METH_O, "do_timing(EMDBaseFloat64 self) -> bool"},
@@ -33457,6 +39411,7 @@ static PyMethodDef SwigMethods_proxydocs[] = {
 	 { "EMDBaseFloat64_duration", _wrap_EMDBaseFloat64_duration, METH_O, "duration(EMDBaseFloat64 self) -> double"},
 	 { "EMDBaseFloat64_clear", _wrap_EMDBaseFloat64_clear, METH_O, "clear(EMDBaseFloat64 self)"},
 	 { "EMDBaseFloat64_flows", _wrap_EMDBaseFloat64_flows, METH_O, "flows(EMDBaseFloat64 self)"},
+	 { "EMDBaseFloat64_sparse_flows", _wrap_EMDBaseFloat64_sparse_flows, METH_O, "sparse_flows(EMDBaseFloat64 self)"},
 	 { "EMDBaseFloat64_dists", _wrap_EMDBaseFloat64_dists, METH_O, "dists(EMDBaseFloat64 self)"},
 	 { "EMDBaseFloat64_npy_node_potentials", _wrap_EMDBaseFloat64_npy_node_potentials, METH_O, "npy_node_potentials(EMDBaseFloat64 self)"},
 	 { "EMDBaseFloat64_swigregister", EMDBaseFloat64_swigregister, METH_O, NULL},
@@ -33467,7 +39422,11 @@ static PyMethodDef SwigMethods_proxydocs[] = {
 	 { "PairwiseEMDBaseFloat64_set_beta", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDBaseFloat64_set_beta, METH_VARARGS|METH_KEYWORDS, "set_beta(PairwiseEMDBaseFloat64 self, double beta)"},
 	 { "PairwiseEMDBaseFloat64_norm", _wrap_PairwiseEMDBaseFloat64_norm, METH_O, "norm(PairwiseEMDBaseFloat64 self) -> bool"},
 	 { "PairwiseEMDBaseFloat64_set_norm", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDBaseFloat64_set_norm, METH_VARARGS|METH_KEYWORDS, "set_norm(PairwiseEMDBaseFloat64 self, bool norm)"},
-	 { "PairwiseEMDBaseFloat64_set_network_simplex_params", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDBaseFloat64_set_network_simplex_params, METH_VARARGS|METH_KEYWORDS, "set_network_simplex_params(PairwiseEMDBaseFloat64 self, std::size_t n_iter_max=100000, double epsilon_large_factor=1000, double epsilon_small_factor=1)"},
+	 { "PairwiseEMDBaseFloat64_set_network_simplex_params", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDBaseFloat64_set_network_simplex_params, METH_VARARGS|METH_KEYWORDS, "set_network_simplex_params(PairwiseEMDBaseFloat64 self, std::size_t n_iter_max=100000, double epsilon_large_factor=1000, double epsilon_small_factor=1, double pivot_param0=0, double pivot_param1=0)"},
+	 { "PairwiseEMDBaseFloat64_warm_start", _wrap_PairwiseEMDBaseFloat64_warm_start, METH_O, "warm_start(PairwiseEMDBaseFloat64 self) -> bool"},
+	 { "PairwiseEMDBaseFloat64_set_warm_start", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDBaseFloat64_set_warm_start, METH_VARARGS|METH_KEYWORDS, "set_warm_start(PairwiseEMDBaseFloat64 self, bool warm)"},
+	 { "PairwiseEMDBaseFloat64_solver", _wrap_PairwiseEMDBaseFloat64_solver, METH_O, "solver(PairwiseEMDBaseFloat64 self) -> wasserstein::EMDSolver"},
+	 { "PairwiseEMDBaseFloat64_set_solver", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDBaseFloat64_set_solver, METH_VARARGS|METH_KEYWORDS, "set_solver(PairwiseEMDBaseFloat64 self, wasserstein::EMDSolver solver)"},
 	 { "PairwiseEMDBaseFloat64_set_external_emd_handler", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDBaseFloat64_set_external_emd_handler, METH_VARARGS|METH_KEYWORDS, "set_external_emd_handler(PairwiseEMDBaseFloat64 self, ExternalEMDHandlerFloat64 handler)"},
 	 { "PairwiseEMDBaseFloat64_have_external_emd_handler", _wrap_PairwiseEMDBaseFloat64_have_external_emd_handler, METH_O, "have_external_emd_handler(PairwiseEMDBaseFloat64 self) -> bool"},
 	 { "PairwiseEMDBaseFloat64_num_threads", _wrap_PairwiseEMDBaseFloat64_num_threads, METH_O, "num_threads(PairwiseEMDBaseFloat64 self) -> int"},
@@ -33539,7 +39498,11 @@ static PyMethodDef SwigMethods_proxydocs[] = {
 	 { "EMDBaseFloat32_beta", _wrap_EMDBaseFloat32_beta, METH_O, "beta(EMDBaseFloat32 self) -> float"},
 	 { "EMDBaseFloat32_set_R", (PyCFunction)(void(*)(void))_wrap_EMDBaseFloat32_set_R, METH_VARARGS|METH_KEYWORDS, "set_R(EMDBaseFloat32 self, float R)"},
 	 { "EMDBaseFloat32_set_beta", (PyCFunction)(void(*)(void))_wrap_EMDBaseFloat32_set_beta, METH_VARARGS|METH_KEYWORDS, "set_beta(EMDBaseFloat32 self, float beta)"},
-	 { "EMDBaseFloat32_set_network_simplex_params", (PyCFunction)(void(*)(void))_wrap_EMDBaseFloat32_set_network_simplex_params, METH_VARARGS|METH_KEYWORDS, "set_network_simplex_params(EMDBaseFloat32 self, std::size_t n_iter_max=100000, float epsilon_large_factor=1000, float epsilon_small_factor=1)"},
+	 { "EMDBaseFloat32_set_network_simplex_params", (PyCFunction)(void(*)(void))_wrap_EMDBaseFloat32_set_network_simplex_params, METH_VARARGS|METH_KEYWORDS, "set_network_simplex_params(EMDBaseFloat32 self, std::size_t n_iter_max=100000, float epsilon_large_factor=1000, float epsilon_small_factor=1, float pivot_param0=0, float pivot_param1=0)"},
+	 { "EMDBaseFloat32_warm_start", _wrap_EMDBaseFloat32_warm_start, METH_O, "warm_start(EMDBaseFloat32 self) -> bool"},
+	 { "EMDBaseFloat32_set_warm_start", (PyCFunction)(void(*)(void))_wrap_EMDBaseFloat32_set_warm_start, METH_VARARGS|METH_KEYWORDS, "set_warm_start(EMDBaseFloat32 self, bool warm)"},
+	 { "EMDBaseFloat32_solver", _wrap_EMDBaseFloat32_solver, METH_O, "solver(EMDBaseFloat32 self) -> wasserstein::EMDSolver"},
+	 { "EMDBaseFloat32_set_solver", (PyCFunction)(void(*)(void))_wrap_EMDBaseFloat32_set_solver, METH_VARARGS|METH_KEYWORDS, "set_solver(EMDBaseFloat32 self, wasserstein::EMDSolver solver)"},
 	 { "EMDBaseFloat32_norm", _wrap_EMDBaseFloat32_norm, METH_O, "norm(EMDBaseFloat32 self) -> bool"},
 	 { "EMDBaseFloat32_set_norm", (PyCFunction)(void(*)(void))_wrap_EMDBaseFloat32_set_norm, METH_VARARGS|METH_KEYWORDS, "set_norm(EMDBaseFloat32 self, bool norm)"},
 	 { "EMDBaseFloat32_do_timing", _wrap_EMDBaseFloat32_do_timing, METH_O, "do_timing(EMDBaseFloat32 self) -> bool"},
@@ -33564,6 +39527,7 @@ static PyMethodDef SwigMethods_proxydocs[] = {
 	 { "EMDBaseFloat32_duration", _wrap_EMDBaseFloat32_duration, METH_O, "duration(EMDBaseFloat32 self) -> double"},
 	 { "EMDBaseFloat32_clear", _wrap_EMDBaseFloat32_clear, METH_O, "clear(EMDBaseFloat32 self)"},
 	 { "EMDBaseFloat32_flows", _wrap_EMDBaseFloat32_flows, METH_O, "flows(EMDBaseFloat32 self)"},
+	 { "EMDBaseFloat32_sparse_flows", _wrap_EMDBaseFloat32_sparse_flows, METH_O, "sparse_flows(EMDBaseFloat32 self)"},
 	 { "EMDBaseFloat32_dists", _wrap_EMDBaseFloat32_dists, METH_O, "dists(EMDBaseFloat32 self)"},
 	 { "EMDBaseFloat32_npy_node_potentials", _wrap_EMDBaseFloat32_npy_node_potentials, METH_O, "npy_node_potentials(EMDBaseFloat32 self)"},
 	 { "EMDBaseFloat32_swigregister", EMDBaseFloat32_swigregister, METH_O, NULL},
@@ -33574,7 +39538,11 @@ static PyMethodDef SwigMethods_proxydocs[] = {
 	 { "PairwiseEMDBaseFloat32_set_beta", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDBaseFloat32_set_beta, METH_VARARGS|METH_KEYWORDS, "set_beta(PairwiseEMDBaseFloat32 self, float beta)"},
 	 { "PairwiseEMDBaseFloat32_norm", _wrap_PairwiseEMDBaseFloat32_norm, METH_O, "norm(PairwiseEMDBaseFloat32 self) -> bool"},
 	 { "PairwiseEMDBaseFloat32_set_norm", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDBaseFloat32_set_norm, METH_VARARGS|METH_KEYWORDS, "set_norm(PairwiseEMDBaseFloat32 self, bool norm)"},
-	 { "PairwiseEMDBaseFloat32_set_network_simplex_params", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDBaseFloat32_set_network_simplex_params, METH_VARARGS|METH_KEYWORDS, "set_network_simplex_params(PairwiseEMDBaseFloat32 self, std::size_t n_iter_max=100000, float epsilon_large_factor=1000, float epsilon_small_factor=1)"},
+	 { "PairwiseEMDBaseFloat32_set_network_simplex_params", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDBaseFloat32_set_network_simplex_params, METH_VARARGS|METH_KEYWORDS, "set_network_simplex_params(PairwiseEMDBaseFloat32 self, std::size_t n_iter_max=100000, float epsilon_large_factor=1000, float epsilon_small_factor=1, float pivot_param0=0, float pivot_param1=0)"},
+	 { "PairwiseEMDBaseFloat32_warm_start", _wrap_PairwiseEMDBaseFloat32_warm_start, METH_O, "warm_start(PairwiseEMDBaseFloat32 self) -> bool"},
+	 { "PairwiseEMDBaseFloat32_set_warm_start", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDBaseFloat32_set_warm_start, METH_VARARGS|METH_KEYWORDS, "set_warm_start(PairwiseEMDBaseFloat32 self, bool warm)"},
+	 { "PairwiseEMDBaseFloat32_solver", _wrap_PairwiseEMDBaseFloat32_solver, METH_O, "solver(PairwiseEMDBaseFloat32 self) -> wasserstein::EMDSolver"},
+	 { "PairwiseEMDBaseFloat32_set_solver", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDBaseFloat32_set_solver, METH_VARARGS|METH_KEYWORDS, "set_solver(PairwiseEMDBaseFloat32 self, wasserstein::EMDSolver solver)"},
 	 { "PairwiseEMDBaseFloat32_set_external_emd_handler", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDBaseFloat32_set_external_emd_handler, METH_VARARGS|METH_KEYWORDS, "set_external_emd_handler(PairwiseEMDBaseFloat32 self, ExternalEMDHandlerFloat32 handler)"},
 	 { "PairwiseEMDBaseFloat32_have_external_emd_handler", _wrap_PairwiseEMDBaseFloat32_have_external_emd_handler, METH_O, "have_external_emd_handler(PairwiseEMDBaseFloat32 self) -> bool"},
 	 { "PairwiseEMDBaseFloat32_num_threads", _wrap_PairwiseEMDBaseFloat32_num_threads, METH_O, "num_threads(PairwiseEMDBaseFloat32 self) -> int"},
@@ -33666,51 +39634,72 @@ static PyMethodDef SwigMethods_proxydocs[] = {
 	 { "new_EMDFloat64", (PyCFunction)(void(*)(void))_wrap_new_EMDFloat64, METH_VARARGS|METH_KEYWORDS, "new_EMDFloat64(double R=1, double beta=1, bool norm=False, bool do_timing=False, bool external_dists=False, std::size_t n_iter_max=100000, double epsilon_large_factor=1000, double epsilon_small_factor=1) -> EMDFloat64"},
 	 { "delete_EMDFloat64", _wrap_delete_EMDFloat64, METH_O, "delete_EMDFloat64(EMDFloat64 self)"},
 	 { "EMDFloat64_description", (PyCFunction)(void(*)(void))_wrap_EMDFloat64_description, METH_VARARGS|METH_KEYWORDS, "description(EMDFloat64 self, bool write_preprocessors=True) -> std::string"},
+	 { "EMDFloat64_last_solver", _wrap_EMDFloat64_last_solver, METH_O, "last_solver(EMDFloat64 self) -> wasserstein::EMDSolver"},
 	 { "EMDFloat64___repr__", _wrap_EMDFloat64___repr__, METH_O, "__repr__(EMDFloat64 self) -> std::string"},
 	 { "EMDFloat64_preprocess_CenterWeightedCentroid", _wrap_EMDFloat64_preprocess_CenterWeightedCentroid, METH_O, "preprocess_CenterWeightedCentroid(EMDFloat64 self)"},
 	 { "EMDFloat64___call__", _wrap_EMDFloat64___call__, METH_VARARGS, "\n"
 		"__call__(EMDFloat64 self, double * weights0, double * coords0, double * weights1, double * coords1) -> double\n"
 		"__call__(EMDFloat64 self, double * weights0, double * weights1, double * external_dists) -> double\n"
 		""},
+	 { "EMDFloat64_lower_bound", (PyCFunction)(void(*)(void))_wrap_EMDFloat64_lower_bound, METH_VARARGS|METH_KEYWORDS, "lower_bound(EMDFloat64 self, double * weights0, double * coords0, double * weights1, double * coords1) -> double"},
+	 { "EMDFloat64_upper_bound", (PyCFunction)(void(*)(void))_wrap_EMDFloat64_upper_bound, METH_VARARGS|METH_KEYWORDS, "upper_bound(EMDFloat64 self, double * weights0, double * coords0, double * weights1, double * coords1) -> double"},
+	 { "EMDFloat64_within", (PyCFunction)(void(*)(void))_wrap_EMDFloat64_within, METH_VARARGS|METH_KEYWORDS, "within(EMDFloat64 self, double * weights0, double * coords0, double * weights1, double * coords1, double threshold) -> bool"},
 	 { "EMDFloat64_swigregister", EMDFloat64_swigregister, METH_O, NULL},
 	 { "EMDFloat64_swiginit", EMDFloat64_swiginit, METH_VARARGS, NULL},
 	 { "new_EMDFloat32", (PyCFunction)(void(*)(void))_wrap_new_EMDFloat32, METH_VARARGS|METH_KEYWORDS, "new_EMDFloat32(float R=1, float beta=1, bool norm=False, bool do_timing=False, bool external_dists=False, std::size_t n_iter_max=100000, float epsilon_large_factor=1000, float epsilon_small_factor=1) -> EMDFloat32"},
 	 { "delete_EMDFloat32", _wrap_delete_EMDFloat32, METH_O, "delete_EMDFloat32(EMDFloat32 self)"},
 	 { "EMDFloat32_description", (PyCFunction)(void(*)(void))_wrap_EMDFloat32_description, METH_VARARGS|METH_KEYWORDS, "description(EMDFloat32 self, bool write_preprocessors=True) -> std::string"},
+	 { "EMDFloat32_last_solver", _wrap_EMDFloat32_last_solver, METH_O, "last_solver(EMDFloat32 self) -> wasserstein::EMDSolver"},
 	 { "EMDFloat32___repr__", _wrap_EMDFloat32___repr__, METH_O, "__repr__(EMDFloat32 self) -> std::string"},
 	 { "EMDFloat32_preprocess_CenterWeightedCentroid", _wrap_EMDFloat32_preprocess_CenterWeightedCentroid, METH_O, "preprocess_CenterWeightedCentroid(EMDFloat32 self)"},
 	 { "EMDFloat32___call__", _wrap_EMDFloat32___call__, METH_VARARGS, "\n"
 		"__call__(EMDFloat32 self, float * weights0, float * coords0, float * weights1, float * coords1) -> float\n"
 		"__call__(EMDFloat32 self, float * weights0, float * weights1, float * external_dists) -> float\n"
 		""},
+	 { "EMDFloat32_lower_bound", (PyCFunction)(void(*)(void))_wrap_EMDFloat32_lower_bound, METH_VARARGS|METH_KEYWORDS, "lower_bound(EMDFloat32 self, float * weights0, float * coords0, float * weights1, float * coords1) -> float"},
+	 { "EMDFloat32_upper_bound", (PyCFunction)(void(*)(void))_wrap_EMDFloat32_upper_bound, METH_VARARGS|METH_KEYWORDS, "upper_bound(EMDFloat32 self, float * weights0, float * coords0, float * weights1, float * coords1) -> float"},
+	 { "EMDFloat32_within", (PyCFunction)(void(*)(void))_wrap_EMDFloat32_within, METH_VARARGS|METH_KEYWORDS, "within(EMDFloat32 self, float * weights0, float * coords0, float * weights1, float * coords1, float threshold) -> bool"},
 	 { "EMDFloat32_swigregister", EMDFloat32_swigregister, METH_O, NULL},
 	 { "EMDFloat32_swiginit", EMDFloat32_swiginit, METH_VARARGS, NULL},
 	 { "new_EMDYPhiFloat64", (PyCFunction)(void(*)(void))_wrap_new_EMDYPhiFloat64, METH_VARARGS|METH_KEYWORDS, "new_EMDYPhiFloat64(double R=1, double beta=1, bool norm=False, bool do_timing=False, bool external_dists=False, std::size_t n_iter_max=100000, double epsilon_large_factor=1000, double epsilon_small_factor=1) -> EMDYPhiFloat64"},
 	 { "delete_EMDYPhiFloat64", _wrap_delete_EMDYPhiFloat64, METH_O, "delete_EMDYPhiFloat64(EMDYPhiFloat64 self)"},
 	 { "EMDYPhiFloat64_description", (PyCFunction)(void(*)(void))_wrap_EMDYPhiFloat64_description, METH_VARARGS|METH_KEYWORDS, "description(EMDYPhiFloat64 self, bool write_preprocessors=True) -> std::string"},
+	 { "EMDYPhiFloat64_last_solver", _wrap_EMDYPhiFloat64_last_solver, METH_O, "last_solver(EMDYPhiFloat64 self) -> wasserstein::EMDSolver"},
 	 { "EMDYPhiFloat64___repr__", _wrap_EMDYPhiFloat64___repr__, METH_O, "__repr__(EMDYPhiFloat64 self) -> std::string"},
 	 { "EMDYPhiFloat64_preprocess_CenterWeightedCentroid", _wrap_EMDYPhiFloat64_preprocess_CenterWeightedCentroid, METH_O, "preprocess_CenterWeightedCentroid(EMDYPhiFloat64 self)"},
 	 { "EMDYPhiFloat64___call__", _wrap_EMDYPhiFloat64___call__, METH_VARARGS, "\n"
 		"__call__(EMDYPhiFloat64 self, double * weights0, double * coords0, double * weights1, double * coords1) -> double\n"
 		"__call__(EMDYPhiFloat64 self, double * weights0, double * weights1, double * external_dists) -> double\n"
 		""},
+	 { "EMDYPhiFloat64_lower_bound", (PyCFunction)(void(*)(void))_wrap_EMDYPhiFloat64_lower_bound, METH_VARARGS|METH_KEYWORDS, "lower_bound(EMDYPhiFloat64 self, double * weights0, double * coords0, double * weights1, double * coords1) -> double"},
+	 { "EMDYPhiFloat64_upper_bound", (PyCFunction)(void(*)(void))_wrap_EMDYPhiFloat64_upper_bound, METH_VARARGS|METH_KEYWORDS, "upper_bound(EMDYPhiFloat64 self, double * weights0, double * coords0, double * weights1, double * coords1) -> double"},
+	 { "EMDYPhiFloat64_within", (PyCFunction)(void(*)(void))_wrap_EMDYPhiFloat64_within, METH_VARARGS|METH_KEYWORDS, "within(EMDYPhiFloat64 self, double * weights0, double * coords0, double * weights1, double * coords1, double threshold) -> bool"},
 	 { "EMDYPhiFloat64_swigregister", EMDYPhiFloat64_swigregister, METH_O, NULL},
 	 { "EMDYPhiFloat64_swiginit", EMDYPhiFloat64_swiginit, METH_VARARGS, NULL},
 	 { "new_EMDYPhiFloat32", (PyCFunction)(void(*)(void))_wrap_new_EMDYPhiFloat32, METH_VARARGS|METH_KEYWORDS, "new_EMDYPhiFloat32(float R=1, float beta=1, bool norm=False, bool do_timing=False, bool external_dists=False, std::size_t n_iter_max=100000, float epsilon_large_factor=1000, float epsilon_small_factor=1) -> EMDYPhiFloat32"},
 	 { "delete_EMDYPhiFloat32", _wrap_delete_EMDYPhiFloat32, METH_O, "delete_EMDYPhiFloat32(EMDYPhiFloat32 self)"},
 	 { "EMDYPhiFloat32_description", (PyCFunction)(void(*)(void))_wrap_EMDYPhiFloat32_description, METH_VARARGS|METH_KEYWORDS, "description(EMDYPhiFloat32 self, bool write_preprocessors=True) -> std::string"},
+	 { "EMDYPhiFloat32_last_solver", _wrap_EMDYPhiFloat32_last_solver, METH_O, "last_solver(EMDYPhiFloat32 self) -> wasserstein::EMDSolver"},
 	 { "EMDYPhiFloat32___repr__", _wrap_EMDYPhiFloat32___repr__, METH_O, "__repr__(EMDYPhiFloat32 self) -> std::string"},
 	 { "EMDYPhiFloat32_preprocess_CenterWeightedCentroid", _wrap_EMDYPhiFloat32_preprocess_CenterWeightedCentroid, METH_O, "preprocess_CenterWeightedCentroid(EMDYPhiFloat32 self)"},
 	 { "EMDYPhiFloat32___call__", _wrap_EMDYPhiFloat32___call__, METH_VARARGS, "\n"
 		"__call__(EMDYPhiFloat32 self, float * weights0, float * coords0, float * weights1, float * coords1) -> float\n"
 		"__call__(EMDYPhiFloat32 self, float * weights0, float * weights1, float * external_dists) -> float\n"
 		""},
+	 { "EMDYPhiFloat32_lower_bound", (PyCFunction)(void(*)(void))_wrap_EMDYPhiFloat32_lower_bound, METH_VARARGS|METH_KEYWORDS, "lower_bound(EMDYPhiFloat32 self, float * weights0, float * coords0, float * weights1, float * coords1) -> float"},
+	 { "EMDYPhiFloat32_upper_bound", (PyCFunction)(void(*)(void))_wrap_EMDYPhiFloat32_upper_bound, METH_VARARGS|METH_KEYWORDS, "upper_bound(EMDYPhiFloat32 self, float * weights0, float * coords0, float * weights1, float * coords1) -> float"},
+	 { "EMDYPhiFloat32_within", (PyCFunction)(void(*)(void))_wrap_EMDYPhiFloat32_within, METH_VARARGS|METH_KEYWORDS, "within(EMDYPhiFloat32 self, float * weights0, float * coords0, float * weights1, float * coords1, float threshold) -> bool"},
 	 { "EMDYPhiFloat32_swigregister", EMDYPhiFloat32_swigregister, METH_O, NULL},
 	 { "EMDYPhiFloat32_swiginit", EMDYPhiFloat32_swiginit, METH_VARARGS, NULL},
 	 { "new_PairwiseEMDFloat64", (PyCFunction)(void(*)(void))_wrap_new_PairwiseEMDFloat64, METH_VARARGS|METH_KEYWORDS, "new_PairwiseEMDFloat64(double R=1, double beta=1, bool norm=False, int num_threads=-1, wasserstein::index_type print_every=-10, unsigned int verbose=1, bool request_mode=False, bool store_sym_emds_raw=True, bool throw_on_error=False, unsigned int omp_dynamic_chunksize=10, std::size_t n_iter_max=100000, double epsilon_large_factor=1000, double epsilon_small_factor=1, std::ostream & os=std::cout) -> PairwiseEMDFloat64"},
 	 { "delete_PairwiseEMDFloat64", _wrap_delete_PairwiseEMDFloat64, METH_O, "delete_PairwiseEMDFloat64(PairwiseEMDFloat64 self)"},
 	 { "PairwiseEMDFloat64_description", _wrap_PairwiseEMDFloat64_description, METH_O, "description(PairwiseEMDFloat64 self) -> std::string"},
 	 { "PairwiseEMDFloat64_clear", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDFloat64_clear, METH_VARARGS|METH_KEYWORDS, "clear(PairwiseEMDFloat64 self, bool free_memory=True)"},
+	 { "PairwiseEMDFloat64_reserve", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDFloat64_reserve, METH_VARARGS|METH_KEYWORDS, "reserve(PairwiseEMDFloat64 self, std::size_t max_mult, bool huge_pages=False)"},
+	 { "PairwiseEMDFloat64_threshold", _wrap_PairwiseEMDFloat64_threshold, METH_O, "threshold(PairwiseEMDFloat64 self) -> double"},
+	 { "PairwiseEMDFloat64_has_threshold", _wrap_PairwiseEMDFloat64_has_threshold, METH_O, "has_threshold(PairwiseEMDFloat64 self) -> bool"},
+	 { "PairwiseEMDFloat64_set_threshold", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDFloat64_set_threshold, METH_VARARGS|METH_KEYWORDS, "set_threshold(PairwiseEMDFloat64 self, double threshold=std::numeric_limits< double >::max())"},
+	 { "PairwiseEMDFloat64_has_sweep", _wrap_PairwiseEMDFloat64_has_sweep, METH_O, "has_sweep(PairwiseEMDFloat64 self) -> bool"},
 	 { "PairwiseEMDFloat64_init", _wrap_PairwiseEMDFloat64_init, METH_VARARGS, "\n"
 		"init(PairwiseEMDFloat64 self, wasserstein::index_type nev)\n"
 		"init(PairwiseEMDFloat64 self, wasserstein::index_type nevA, wasserstein::index_type nevB)\n"
@@ -33718,14 +39707,22 @@ static PyMethodDef SwigMethods_proxydocs[] = {
 	 { "PairwiseEMDFloat64_compute", _wrap_PairwiseEMDFloat64_compute, METH_O, "compute(PairwiseEMDFloat64 self)"},
 	 { "PairwiseEMDFloat64___repr__", _wrap_PairwiseEMDFloat64___repr__, METH_O, "__repr__(PairwiseEMDFloat64 self) -> std::string"},
 	 { "PairwiseEMDFloat64_preprocess_CenterWeightedCentroid", _wrap_PairwiseEMDFloat64_preprocess_CenterWeightedCentroid, METH_O, "preprocess_CenterWeightedCentroid(PairwiseEMDFloat64 self)"},
+	 { "PairwiseEMDFloat64_close_pairs", _wrap_PairwiseEMDFloat64_close_pairs, METH_O, "close_pairs(PairwiseEMDFloat64 self)"},
 	 { "PairwiseEMDFloat64__reset_B_events", _wrap_PairwiseEMDFloat64__reset_B_events, METH_O, "_reset_B_events(PairwiseEMDFloat64 self)"},
 	 { "PairwiseEMDFloat64__add_event", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDFloat64__add_event, METH_VARARGS|METH_KEYWORDS, "_add_event(PairwiseEMDFloat64 self, double * weights, double * coords, double event_weight=1)"},
+	 { "PairwiseEMDFloat64_set_sweep", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDFloat64_set_sweep, METH_VARARGS|METH_KEYWORDS, "set_sweep(PairwiseEMDFloat64 self, double * Rs, double * betas)"},
+	 { "PairwiseEMDFloat64_sweep_emds", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDFloat64_sweep_emds, METH_VARARGS|METH_KEYWORDS, "sweep_emds(PairwiseEMDFloat64 self, std::size_t p)"},
 	 { "PairwiseEMDFloat64_swigregister", PairwiseEMDFloat64_swigregister, METH_O, NULL},
 	 { "PairwiseEMDFloat64_swiginit", PairwiseEMDFloat64_swiginit, METH_VARARGS, NULL},
 	 { "new_PairwiseEMDFloat32", (PyCFunction)(void(*)(void))_wrap_new_PairwiseEMDFloat32, METH_VARARGS|METH_KEYWORDS, "new_PairwiseEMDFloat32(float R=1, float beta=1, bool norm=False, int num_threads=-1, wasserstein::index_type print_every=-10, unsigned int verbose=1, bool request_mode=False, bool store_sym_emds_raw=True, bool throw_on_error=False, unsigned int omp_dynamic_chunksize=10, std::size_t n_iter_max=100000, float epsilon_large_factor=1000, float epsilon_small_factor=1, std::ostream & os=std::cout) -> PairwiseEMDFloat32"},
 	 { "delete_PairwiseEMDFloat32", _wrap_delete_PairwiseEMDFloat32, METH_O, "delete_PairwiseEMDFloat32(PairwiseEMDFloat32 self)"},
 	 { "PairwiseEMDFloat32_description", _wrap_PairwiseEMDFloat32_description, METH_O, "description(PairwiseEMDFloat32 self) -> std::string"},
 	 { "PairwiseEMDFloat32_clear", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDFloat32_clear, METH_VARARGS|METH_KEYWORDS, "clear(PairwiseEMDFloat32 self, bool free_memory=True)"},
+	 { "PairwiseEMDFloat32_reserve", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDFloat32_reserve, METH_VARARGS|METH_KEYWORDS, "reserve(PairwiseEMDFloat32 self, std::size_t max_mult, bool huge_pages=False)"},
+	 { "PairwiseEMDFloat32_threshold", _wrap_PairwiseEMDFloat32_threshold, METH_O, "threshold(PairwiseEMDFloat32 self) -> float"},
+	 { "PairwiseEMDFloat32_has_threshold", _wrap_PairwiseEMDFloat32_has_threshold, METH_O, "has_threshold(PairwiseEMDFloat32 self) -> bool"},
+	 { "PairwiseEMDFloat32_set_threshold", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDFloat32_set_threshold, METH_VARARGS|METH_KEYWORDS, "set_threshold(PairwiseEMDFloat32 self, float threshold=std::numeric_limits< float >::max())"},
+	 { "PairwiseEMDFloat32_has_sweep", _wrap_PairwiseEMDFloat32_has_sweep, METH_O, "has_sweep(PairwiseEMDFloat32 self) -> bool"},
 	 { "PairwiseEMDFloat32_init", _wrap_PairwiseEMDFloat32_init, METH_VARARGS, "\n"
 		"init(PairwiseEMDFloat32 self, wasserstein::index_type nev)\n"
 		"init(PairwiseEMDFloat32 self, wasserstein::index_type nevA, wasserstein::index_type nevB)\n"
@@ -33733,14 +39730,22 @@ static PyMethodDef SwigMethods_proxydocs[] = {
 	 { "PairwiseEMDFloat32_compute", _wrap_PairwiseEMDFloat32_compute, METH_O, "compute(PairwiseEMDFloat32 self)"},
 	 { "PairwiseEMDFloat32___repr__", _wrap_PairwiseEMDFloat32___repr__, METH_O, "__repr__(PairwiseEMDFloat32 self) -> std::string"},
 	 { "PairwiseEMDFloat32_preprocess_CenterWeightedCentroid", _wrap_PairwiseEMDFloat32_preprocess_CenterWeightedCentroid, METH_O, "preprocess_CenterWeightedCentroid(PairwiseEMDFloat32 self)"},
+	 { "PairwiseEMDFloat32_close_pairs", _wrap_PairwiseEMDFloat32_close_pairs, METH_O, "close_pairs(PairwiseEMDFloat32 self)"},
 	 { "PairwiseEMDFloat32__reset_B_events", _wrap_PairwiseEMDFloat32__reset_B_events, METH_O, "_reset_B_events(PairwiseEMDFloat32 self)"},
 	 { "PairwiseEMDFloat32__add_event", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDFloat32__add_event, METH_VARARGS|METH_KEYWORDS, "_add_event(PairwiseEMDFloat32 self, float * weights, float * coords, float event_weight=1)"},
+	 { "PairwiseEMDFloat32_set_sweep", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDFloat32_set_sweep, METH_VARARGS|METH_KEYWORDS, "set_sweep(PairwiseEMDFloat32 self, float * Rs, float * betas)"},
+	 { "PairwiseEMDFloat32_sweep_emds", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDFloat32_sweep_emds, METH_VARARGS|METH_KEYWORDS, "sweep_emds(PairwiseEMDFloat32 self, std::size_t p)"},
 	 { "PairwiseEMDFloat32_swigregister", PairwiseEMDFloat32_swigregister, METH_O, NULL},
 	 { "PairwiseEMDFloat32_swiginit", PairwiseEMDFloat32_swiginit, METH_VARARGS, NULL},
 	 { "new_PairwiseEMDYPhiFloat64", (PyCFunction)(void(*)(void))_wrap_new_PairwiseEMDYPhiFloat64, METH_VARARGS|METH_KEYWORDS, "new_PairwiseEMDYPhiFloat64(double R=1, double beta=1, bool norm=False, int num_threads=-1, wasserstein::index_type print_every=-10, unsigned int verbose=1, bool request_mode=False, bool store_sym_emds_raw=True, bool throw_on_error=False, unsigned int omp_dynamic_chunksize=10, std::size_t n_iter_max=100000, double epsilon_large_factor=1000, double epsilon_small_factor=1, std::ostream & os=std::cout) -> PairwiseEMDYPhiFloat64"},
 	 { "delete_PairwiseEMDYPhiFloat64", _wrap_delete_PairwiseEMDYPhiFloat64, METH_O, "delete_PairwiseEMDYPhiFloat64(PairwiseEMDYPhiFloat64 self)"},
 	 { "PairwiseEMDYPhiFloat64_description", _wrap_PairwiseEMDYPhiFloat64_description, METH_O, "description(PairwiseEMDYPhiFloat64 self) -> std::string"},
 	 { "PairwiseEMDYPhiFloat64_clear", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDYPhiFloat64_clear, METH_VARARGS|METH_KEYWORDS, "clear(PairwiseEMDYPhiFloat64 self, bool free_memory=True)"},
+	 { "PairwiseEMDYPhiFloat64_reserve", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDYPhiFloat64_reserve, METH_VARARGS|METH_KEYWORDS, "reserve(PairwiseEMDYPhiFloat64 self, std::size_t max_mult, bool huge_pages=False)"},
+	 { "PairwiseEMDYPhiFloat64_threshold", _wrap_PairwiseEMDYPhiFloat64_threshold, METH_O, "threshold(PairwiseEMDYPhiFloat64 self) -> double"},
+	 { "PairwiseEMDYPhiFloat64_has_threshold", _wrap_PairwiseEMDYPhiFloat64_has_threshold, METH_O, "has_threshold(PairwiseEMDYPhiFloat64 self) -> bool"},
+	 { "PairwiseEMDYPhiFloat64_set_threshold", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDYPhiFloat64_set_threshold, METH_VARARGS|METH_KEYWORDS, "set_threshold(PairwiseEMDYPhiFloat64 self, double threshold=std::numeric_limits< double >::max())"},
+	 { "PairwiseEMDYPhiFloat64_has_sweep", _wrap_PairwiseEMDYPhiFloat64_has_sweep, METH_O, "has_sweep(PairwiseEMDYPhiFloat64 self) -> bool"},
 	 { "PairwiseEMDYPhiFloat64_init", _wrap_PairwiseEMDYPhiFloat64_init, METH_VARARGS, "\n"
 		"init(PairwiseEMDYPhiFloat64 self, wasserstein::index_type nev)\n"
 		"init(PairwiseEMDYPhiFloat64 self, wasserstein::index_type nevA, wasserstein::index_type nevB)\n"
@@ -33748,14 +39753,22 @@ static PyMethodDef SwigMethods_proxydocs[] = {
 	 { "PairwiseEMDYPhiFloat64_compute", _wrap_PairwiseEMDYPhiFloat64_compute, METH_O, "compute(PairwiseEMDYPhiFloat64 self)"},
 	 { "PairwiseEMDYPhiFloat64___repr__", _wrap_PairwiseEMDYPhiFloat64___repr__, METH_O, "__repr__(PairwiseEMDYPhiFloat64 self) -> std::string"},
 	 { "PairwiseEMDYPhiFloat64_preprocess_CenterWeightedCentroid", _wrap_PairwiseEMDYPhiFloat64_preprocess_CenterWeightedCentroid, METH_O, "preprocess_CenterWeightedCentroid(PairwiseEMDYPhiFloat64 self)"},
+	 { "PairwiseEMDYPhiFloat64_close_pairs", _wrap_PairwiseEMDYPhiFloat64_close_pairs, METH_O, "close_pairs(PairwiseEMDYPhiFloat64 self)"},
 	 { "PairwiseEMDYPhiFloat64__reset_B_events", _wrap_PairwiseEMDYPhiFloat64__reset_B_events, METH_O, "_reset_B_events(PairwiseEMDYPhiFloat64 self)"},
 	 { "PairwiseEMDYPhiFloat64__add_event", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDYPhiFloat64__add_event, METH_VARARGS|METH_KEYWORDS, "_add_event(PairwiseEMDYPhiFloat64 self, double * weights, double * coords, double event_weight=1)"},
+	 { "PairwiseEMDYPhiFloat64_set_sweep", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDYPhiFloat64_set_sweep, METH_VARARGS|METH_KEYWORDS, "set_sweep(PairwiseEMDYPhiFloat64 self, double * Rs, double * betas)"},
+	 { "PairwiseEMDYPhiFloat64_sweep_emds", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDYPhiFloat64_sweep_emds, METH_VARARGS|METH_KEYWORDS, "sweep_emds(PairwiseEMDYPhiFloat64 self, std::size_t p)"},
 	 { "PairwiseEMDYPhiFloat64_swigregister", PairwiseEMDYPhiFloat64_swigregister, METH_O, NULL},
 	 { "PairwiseEMDYPhiFloat64_swiginit", PairwiseEMDYPhiFloat64_swiginit, METH_VARARGS, NULL},
 	 { "new_PairwiseEMDYPhiFloat32", (PyCFunction)(void(*)(void))_wrap_new_PairwiseEMDYPhiFloat32, METH_VARARGS|METH_KEYWORDS, "new_PairwiseEMDYPhiFloat32(float R=1, float beta=1, bool norm=False, int num_threads=-1, wasserstein::index_type print_every=-10, unsigned int verbose=1, bool request_mode=False, bool store_sym_emds_raw=True, bool throw_on_error=False, unsigned int omp_dynamic_chunksize=10, std::size_t n_iter_max=100000, float epsilon_large_factor=1000, float epsilon_small_factor=1, std::ostream & os=std::cout) -> PairwiseEMDYPhiFloat32"},
 	 { "delete_PairwiseEMDYPhiFloat32", _wrap_delete_PairwiseEMDYPhiFloat32, METH_O, "delete_PairwiseEMDYPhiFloat32(PairwiseEMDYPhiFloat32 self)"},
 	 { "PairwiseEMDYPhiFloat32_description", _wrap_PairwiseEMDYPhiFloat32_description, METH_O, "description(PairwiseEMDYPhiFloat32 self) -> std::string"},
 	 { "PairwiseEMDYPhiFloat32_clear", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDYPhiFloat32_clear, METH_VARARGS|METH_KEYWORDS, "clear(PairwiseEMDYPhiFloat32 self, bool free_memory=True)"},
+	 { "PairwiseEMDYPhiFloat32_reserve", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDYPhiFloat32_reserve, METH_VARARGS|METH_KEYWORDS, "reserve(PairwiseEMDYPhiFloat32 self, std::size_t max_mult, bool huge_pages=False)"},
+	 { "PairwiseEMDYPhiFloat32_threshold", _wrap_PairwiseEMDYPhiFloat32_threshold, METH_O, "threshold(PairwiseEMDYPhiFloat32 self) -> float"},
+	 { "PairwiseEMDYPhiFloat32_has_threshold", _wrap_PairwiseEMDYPhiFloat32_has_threshold, METH_O, "has_threshold(PairwiseEMDYPhiFloat32 self) -> bool"},
+	 { "PairwiseEMDYPhiFloat32_set_threshold", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDYPhiFloat32_set_threshold, METH_VARARGS|METH_KEYWORDS, "set_threshold(PairwiseEMDYPhiFloat32 self, float threshold=std::numeric_limits< float >::max())"},
+	 { "PairwiseEMDYPhiFloat32_has_sweep", _wrap_PairwiseEMDYPhiFloat32_has_sweep, METH_O, "has_sweep(PairwiseEMDYPhiFloat32 self) -> bool"},
 	 { "PairwiseEMDYPhiFloat32_init", _wrap_PairwiseEMDYPhiFloat32_init, METH_VARARGS, "\n"
 		"init(PairwiseEMDYPhiFloat32 self, wasserstein::index_type nev)\n"
 		"init(PairwiseEMDYPhiFloat32 self, wasserstein::index_type nevA, wasserstein::index_type nevB)\n"
@@ -33763,8 +39776,11 @@ static PyMethodDef SwigMethods_proxydocs[] = {
 	 { "PairwiseEMDYPhiFloat32_compute", _wrap_PairwiseEMDYPhiFloat32_compute, METH_O, "compute(PairwiseEMDYPhiFloat32 self)"},
 	 { "PairwiseEMDYPhiFloat32___repr__", _wrap_PairwiseEMDYPhiFloat32___repr__, METH_O, "__repr__(PairwiseEMDYPhiFloat32 self) -> std::string"},
 	 { "PairwiseEMDYPhiFloat32_preprocess_CenterWeightedCentroid", _wrap_PairwiseEMDYPhiFloat32_preprocess_CenterWeightedCentroid, METH_O, "preprocess_CenterWeightedCentroid(PairwiseEMDYPhiFloat32 self)"},
+	 { "PairwiseEMDYPhiFloat32_close_pairs", _wrap_PairwiseEMDYPhiFloat32_close_pairs, METH_O, "close_pairs(PairwiseEMDYPhiFloat32 self)"},
 	 { "PairwiseEMDYPhiFloat32__reset_B_events", _wrap_PairwiseEMDYPhiFloat32__reset_B_events, METH_O, "_reset_B_events(PairwiseEMDYPhiFloat32 self)"},
 	 { "PairwiseEMDYPhiFloat32__add_event", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDYPhiFloat32__add_event, METH_VARARGS|METH_KEYWORDS, "_add_event(PairwiseEMDYPhiFloat32 self, float * weights, float * coords, float event_weight=1)"},
+	 { "PairwiseEMDYPhiFloat32_set_sweep", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDYPhiFloat32_set_sweep, METH_VARARGS|METH_KEYWORDS, "set_sweep(PairwiseEMDYPhiFloat32 self, float * Rs, float * betas)"},
+	 { "PairwiseEMDYPhiFloat32_sweep_emds", (PyCFunction)(void(*)(void))_wrap_PairwiseEMDYPhiFloat32_sweep_emds, METH_VARARGS|METH_KEYWORDS, "sweep_emds(PairwiseEMDYPhiFloat32 self, std::size_t p)"},
 	 { "PairwiseEMDYPhiFloat32_swigregister", PairwiseEMDYPhiFloat32_swigregister, METH_O, NULL},
 	 { "PairwiseEMDYPhiFloat32_swiginit", PairwiseEMDYPhiFloat32_swiginit, METH_VARARGS, NULL},
 	 { NULL, NULL, 0, NULL }
@@ -34795,19 +40811,29 @@ SWIG_init(void) {
   SWIG_addvarlink(globals, "PI", Swig_var_PI_get, Swig_var_PI_set);
   SWIG_addvarlink(globals, "TWOPI", Swig_var_TWOPI_get, Swig_var_TWOPI_set);
   SWIG_addvarlink(globals, "COMPILED_WITH_OPENMP", Swig_var_COMPILED_WITH_OPENMP_get, Swig_var_COMPILED_WITH_OPENMP_set);
+  SWIG_addvarlink(globals, "COMPILED_WITH_SOLVER_STATS", Swig_var_COMPILED_WITH_SOLVER_STATS_get, Swig_var_COMPILED_WITH_SOLVER_STATS_set);
   SWIG_Python_SetConstant(d, "EMDStatus_Success",SWIG_From_int(static_cast< int >(wasserstein::EMDStatus::Success)));
   SWIG_Python_SetConstant(d, "EMDStatus_Empty",SWIG_From_int(static_cast< int >(wasserstein::EMDStatus::Empty)));
   SWIG_Python_SetConstant(d, "EMDStatus_SupplyMismatch",SWIG_From_int(static_cast< int >(wasserstein::EMDStatus::SupplyMismatch)));
   SWIG_Python_SetConstant(d, "EMDStatus_Unbounded",SWIG_From_int(static_cast< int >(wasserstein::EMDStatus::Unbounded)));
   SWIG_Python_SetConstant(d, "EMDStatus_MaxIterReached",SWIG_From_int(static_cast< int >(wasserstein::EMDStatus::MaxIterReached)));
   SWIG_Python_SetConstant(d, "EMDStatus_Infeasible",SWIG_From_int(static_cast< int >(wasserstein::EMDStatus::Infeasible)));
+  SWIG_Python_SetConstant(d, "EMDStatus_Approximate",SWIG_From_int(static_cast< int >(wasserstein::EMDStatus::Approximate)));
   SWIG_Python_SetConstant(d, "ExtraParticle_Neither",SWIG_From_int(static_cast< int >(wasserstein::ExtraParticle::Neither)));
   SWIG_Python_SetConstant(d, "ExtraParticle_Zero",SWIG_From_int(static_cast< int >(wasserstein::ExtraParticle::Zero)));
   SWIG_Python_SetConstant(d, "ExtraParticle_One",SWIG_From_int(static_cast< int >(wasserstein::ExtraParticle::One)));
+  SWIG_Python_SetConstant(d, "EMDSolver_Auto",SWIG_From_int(static_cast< int >(wasserstein::EMDSolver::Auto)));
+  SWIG_Python_SetConstant(d, "EMDSolver_NetworkSimplex",SWIG_From_int(static_cast< int >(wasserstein::EMDSolver::NetworkSimplex)));
+  SWIG_Python_SetConstant(d, "EMDSolver_Sorted1D",SWIG_From_int(static_cast< int >(wasserstein::EMDSolver::Sorted1D)));
+  SWIG_Python_SetConstant(d, "EMDSolver_Auction",SWIG_From_int(static_cast< int >(wasserstein::EMDSolver::Auction)));
+  SWIG_Python_SetConstant(d, "EMDSolver_SparseNetworkSimplex",SWIG_From_int(static_cast< int >(wasserstein::EMDSolver::SparseNetworkSimplex)));
+  SWIG_Python_SetConstant(d, "EMDSolver_Multiscale",SWIG_From_int(static_cast< int >(wasserstein::EMDSolver::Multiscale)));
   SWIG_Python_SetConstant(d, "EMDPairsStorage_Full",SWIG_From_int(static_cast< int >(wasserstein::EMDPairsStorage::Full)));
   SWIG_Python_SetConstant(d, "EMDPairsStorage_FullSymmetric",SWIG_From_int(static_cast< int >(wasserstein::EMDPairsStorage::FullSymmetric)));
   SWIG_Python_SetConstant(d, "EMDPairsStorage_FlattenedSymmetric",SWIG_From_int(static_cast< int >(wasserstein::EMDPairsStorage::FlattenedSymmetric)));
   SWIG_Python_SetConstant(d, "EMDPairsStorage_External",SWIG_From_int(static_cast< int >(wasserstein::EMDPairsStorage::External)));
+  SWIG_Python_SetConstant(d, "EMDPairsStorage_Threshold",SWIG_From_int(static_cast< int >(wasserstein::EMDPairsStorage::Threshold)));
+  SWIG_Python_SetConstant(d, "EMDPairsStorage_Sweep",SWIG_From_int(static_cast< int >(wasserstein::EMDPairsStorage::Sweep)));
   
   /* Initialize threading */
   SWIG_PYTHON_INITIALIZE_THREADS;
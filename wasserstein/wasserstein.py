@@ -337,12 +337,26 @@ EMDStatus_MaxIterReached = _wasserstein.EMDStatus_MaxIterReached
 
 EMDStatus_Infeasible = _wasserstein.EMDStatus_Infeasible
 
+EMDStatus_Approximate = _wasserstein.EMDStatus_Approximate
+
 ExtraParticle_Neither = _wasserstein.ExtraParticle_Neither
 
 ExtraParticle_Zero = _wasserstein.ExtraParticle_Zero
 
 ExtraParticle_One = _wasserstein.ExtraParticle_One
 
+EMDSolver_Auto = _wasserstein.EMDSolver_Auto
+
+EMDSolver_NetworkSimplex = _wasserstein.EMDSolver_NetworkSimplex
+
+EMDSolver_Sorted1D = _wasserstein.EMDSolver_Sorted1D
+
+EMDSolver_Auction = _wasserstein.EMDSolver_Auction
+
+EMDSolver_SparseNetworkSimplex = _wasserstein.EMDSolver_SparseNetworkSimplex
+
+EMDSolver_Multiscale = _wasserstein.EMDSolver_Multiscale
+
 EMDPairsStorage_Full = _wasserstein.EMDPairsStorage_Full
 
 EMDPairsStorage_FullSymmetric = _wasserstein.EMDPairsStorage_FullSymmetric
@@ -351,6 +365,10 @@ EMDPairsStorage_FlattenedSymmetric = _wasserstein.EMDPairsStorage_FlattenedSymme
 
 EMDPairsStorage_External = _wasserstein.EMDPairsStorage_External
 
+EMDPairsStorage_Threshold = _wasserstein.EMDPairsStorage_Threshold
+
+EMDPairsStorage_Sweep = _wasserstein.EMDPairsStorage_Sweep
+
 check_emd_status = _wasserstein.check_emd_status
 class EMDBaseFloat64(object):
     r"""Proxy of C++ wasserstein::EMDBase< double > class."""
@@ -366,6 +384,10 @@ class EMDBaseFloat64(object):
     set_R = _swig_new_instance_method(_wasserstein.EMDBaseFloat64_set_R)
     set_beta = _swig_new_instance_method(_wasserstein.EMDBaseFloat64_set_beta)
     set_network_simplex_params = _swig_new_instance_method(_wasserstein.EMDBaseFloat64_set_network_simplex_params)
+    warm_start = _swig_new_instance_method(_wasserstein.EMDBaseFloat64_warm_start)
+    set_warm_start = _swig_new_instance_method(_wasserstein.EMDBaseFloat64_set_warm_start)
+    solver = _swig_new_instance_method(_wasserstein.EMDBaseFloat64_solver)
+    set_solver = _swig_new_instance_method(_wasserstein.EMDBaseFloat64_set_solver)
     norm = _swig_new_instance_method(_wasserstein.EMDBaseFloat64_norm)
     set_norm = _swig_new_instance_method(_wasserstein.EMDBaseFloat64_set_norm)
     do_timing = _swig_new_instance_method(_wasserstein.EMDBaseFloat64_do_timing)
@@ -387,6 +409,7 @@ class EMDBaseFloat64(object):
     duration = _swig_new_instance_method(_wasserstein.EMDBaseFloat64_duration)
     clear = _swig_new_instance_method(_wasserstein.EMDBaseFloat64_clear)
     flows = _swig_new_instance_method(_wasserstein.EMDBaseFloat64_flows)
+    sparse_flows = _swig_new_instance_method(_wasserstein.EMDBaseFloat64_sparse_flows)
     dists = _swig_new_instance_method(_wasserstein.EMDBaseFloat64_dists)
     npy_node_potentials = _swig_new_instance_method(_wasserstein.EMDBaseFloat64_npy_node_potentials)
 
@@ -396,6 +419,7 @@ cvar = _wasserstein.cvar
 PI = cvar.PI
 TWOPI = cvar.TWOPI
 COMPILED_WITH_OPENMP = cvar.COMPILED_WITH_OPENMP
+COMPILED_WITH_SOLVER_STATS = cvar.COMPILED_WITH_SOLVER_STATS
 
 class PairwiseEMDBaseFloat64(object):
     r"""Proxy of C++ wasserstein::PairwiseEMDBase< double > class."""
@@ -414,6 +438,10 @@ class PairwiseEMDBaseFloat64(object):
     set_norm = _swig_new_instance_method(_wasserstein.PairwiseEMDBaseFloat64_set_norm)
     set_network_simplex_params = _swig_new_instance_method(_wasserstein.PairwiseEMDBaseFloat64_set_network_simplex_params)
 
+    warm_start = _swig_new_instance_method(_wasserstein.PairwiseEMDBaseFloat64_warm_start)
+    set_warm_start = _swig_new_instance_method(_wasserstein.PairwiseEMDBaseFloat64_set_warm_start)
+    solver = _swig_new_instance_method(_wasserstein.PairwiseEMDBaseFloat64_solver)
+    set_solver = _swig_new_instance_method(_wasserstein.PairwiseEMDBaseFloat64_set_solver)
     def set_external_emd_handler(self, handler):
         if not handler.thisown:
             raise RuntimeError('ExternalEMDHandler must own itself; perhaps it is already in use elsewhere')
@@ -574,6 +602,10 @@ class EMDBaseFloat32(object):
     set_R = _swig_new_instance_method(_wasserstein.EMDBaseFloat32_set_R)
     set_beta = _swig_new_instance_method(_wasserstein.EMDBaseFloat32_set_beta)
     set_network_simplex_params = _swig_new_instance_method(_wasserstein.EMDBaseFloat32_set_network_simplex_params)
+    warm_start = _swig_new_instance_method(_wasserstein.EMDBaseFloat32_warm_start)
+    set_warm_start = _swig_new_instance_method(_wasserstein.EMDBaseFloat32_set_warm_start)
+    solver = _swig_new_instance_method(_wasserstein.EMDBaseFloat32_solver)
+    set_solver = _swig_new_instance_method(_wasserstein.EMDBaseFloat32_set_solver)
     norm = _swig_new_instance_method(_wasserstein.EMDBaseFloat32_norm)
     set_norm = _swig_new_instance_method(_wasserstein.EMDBaseFloat32_set_norm)
     do_timing = _swig_new_instance_method(_wasserstein.EMDBaseFloat32_do_timing)
@@ -595,6 +627,7 @@ class EMDBaseFloat32(object):
     duration = _swig_new_instance_method(_wasserstein.EMDBaseFloat32_duration)
     clear = _swig_new_instance_method(_wasserstein.EMDBaseFloat32_clear)
     flows = _swig_new_instance_method(_wasserstein.EMDBaseFloat32_flows)
+    sparse_flows = _swig_new_instance_method(_wasserstein.EMDBaseFloat32_sparse_flows)
     dists = _swig_new_instance_method(_wasserstein.EMDBaseFloat32_dists)
     npy_node_potentials = _swig_new_instance_method(_wasserstein.EMDBaseFloat32_npy_node_potentials)
 
@@ -618,6 +651,10 @@ class PairwiseEMDBaseFloat32(object):
     set_norm = _swig_new_instance_method(_wasserstein.PairwiseEMDBaseFloat32_set_norm)
     set_network_simplex_params = _swig_new_instance_method(_wasserstein.PairwiseEMDBaseFloat32_set_network_simplex_params)
 
+    warm_start = _swig_new_instance_method(_wasserstein.PairwiseEMDBaseFloat32_warm_start)
+    set_warm_start = _swig_new_instance_method(_wasserstein.PairwiseEMDBaseFloat32_set_warm_start)
+    solver = _swig_new_instance_method(_wasserstein.PairwiseEMDBaseFloat32_solver)
+    set_solver = _swig_new_instance_method(_wasserstein.PairwiseEMDBaseFloat32_set_solver)
     def set_external_emd_handler(self, handler):
         if not handler.thisown:
             raise RuntimeError('ExternalEMDHandler must own itself; perhaps it is already in use elsewhere')
@@ -842,7 +879,7 @@ def _store_events(pairwise_emd, events, event_weights, gdim, mask, dtype):
 # sometimes, e.g. in the case of a single particle, they may not
 # weights are never modified due to internal copying
 # coords may be modified (e.g. by centering), so we always make a copy of them
-        weights = np.array(event[:,0], dtype=dtype, order='C', copy=False)
+        weights = np.asarray(event[:,0], dtype=dtype, order='C')
         coords = np.array(event[:,1:], dtype=dtype, order='C', copy=True)
 
 # ensure that the lifetime of these arrays lasts through the computation
@@ -861,9 +898,13 @@ class EMDFloat64(EMDBaseFloat64):
         _wasserstein.EMDFloat64_swiginit(self, _wasserstein.new_EMDFloat64(R, beta, norm, do_timing, external_dists, n_iter_max, epsilon_large_factor, epsilon_small_factor))
     __swig_destroy__ = _wasserstein.delete_EMDFloat64
     description = _swig_new_instance_method(_wasserstein.EMDFloat64_description)
+    last_solver = _swig_new_instance_method(_wasserstein.EMDFloat64_last_solver)
     __repr__ = _swig_new_instance_method(_wasserstein.EMDFloat64___repr__)
     preprocess_CenterWeightedCentroid = _swig_new_instance_method(_wasserstein.EMDFloat64_preprocess_CenterWeightedCentroid)
     __call__ = _swig_new_instance_method(_wasserstein.EMDFloat64___call__)
+    lower_bound = _swig_new_instance_method(_wasserstein.EMDFloat64_lower_bound)
+    upper_bound = _swig_new_instance_method(_wasserstein.EMDFloat64_upper_bound)
+    within = _swig_new_instance_method(_wasserstein.EMDFloat64_within)
 
 # Register EMDFloat64 in _wasserstein:
 _wasserstein.EMDFloat64_swigregister(EMDFloat64)
@@ -878,9 +919,13 @@ class EMDFloat32(EMDBaseFloat32):
         _wasserstein.EMDFloat32_swiginit(self, _wasserstein.new_EMDFloat32(R, beta, norm, do_timing, external_dists, n_iter_max, epsilon_large_factor, epsilon_small_factor))
     __swig_destroy__ = _wasserstein.delete_EMDFloat32
     description = _swig_new_instance_method(_wasserstein.EMDFloat32_description)
+    last_solver = _swig_new_instance_method(_wasserstein.EMDFloat32_last_solver)
     __repr__ = _swig_new_instance_method(_wasserstein.EMDFloat32___repr__)
     preprocess_CenterWeightedCentroid = _swig_new_instance_method(_wasserstein.EMDFloat32_preprocess_CenterWeightedCentroid)
     __call__ = _swig_new_instance_method(_wasserstein.EMDFloat32___call__)
+    lower_bound = _swig_new_instance_method(_wasserstein.EMDFloat32_lower_bound)
+    upper_bound = _swig_new_instance_method(_wasserstein.EMDFloat32_upper_bound)
+    within = _swig_new_instance_method(_wasserstein.EMDFloat32_within)
 
 # Register EMDFloat32 in _wasserstein:
 _wasserstein.EMDFloat32_swigregister(EMDFloat32)
@@ -895,9 +940,13 @@ class EMDYPhiFloat64(EMDBaseFloat64):
         _wasserstein.EMDYPhiFloat64_swiginit(self, _wasserstein.new_EMDYPhiFloat64(R, beta, norm, do_timing, external_dists, n_iter_max, epsilon_large_factor, epsilon_small_factor))
     __swig_destroy__ = _wasserstein.delete_EMDYPhiFloat64
     description = _swig_new_instance_method(_wasserstein.EMDYPhiFloat64_description)
+    last_solver = _swig_new_instance_method(_wasserstein.EMDYPhiFloat64_last_solver)
     __repr__ = _swig_new_instance_method(_wasserstein.EMDYPhiFloat64___repr__)
     preprocess_CenterWeightedCentroid = _swig_new_instance_method(_wasserstein.EMDYPhiFloat64_preprocess_CenterWeightedCentroid)
     __call__ = _swig_new_instance_method(_wasserstein.EMDYPhiFloat64___call__)
+    lower_bound = _swig_new_instance_method(_wasserstein.EMDYPhiFloat64_lower_bound)
+    upper_bound = _swig_new_instance_method(_wasserstein.EMDYPhiFloat64_upper_bound)
+    within = _swig_new_instance_method(_wasserstein.EMDYPhiFloat64_within)
 
 # Register EMDYPhiFloat64 in _wasserstein:
 _wasserstein.EMDYPhiFloat64_swigregister(EMDYPhiFloat64)
@@ -912,9 +961,13 @@ class EMDYPhiFloat32(EMDBaseFloat32):
         _wasserstein.EMDYPhiFloat32_swiginit(self, _wasserstein.new_EMDYPhiFloat32(R, beta, norm, do_timing, external_dists, n_iter_max, epsilon_large_factor, epsilon_small_factor))
     __swig_destroy__ = _wasserstein.delete_EMDYPhiFloat32
     description = _swig_new_instance_method(_wasserstein.EMDYPhiFloat32_description)
+    last_solver = _swig_new_instance_method(_wasserstein.EMDYPhiFloat32_last_solver)
     __repr__ = _swig_new_instance_method(_wasserstein.EMDYPhiFloat32___repr__)
     preprocess_CenterWeightedCentroid = _swig_new_instance_method(_wasserstein.EMDYPhiFloat32_preprocess_CenterWeightedCentroid)
     __call__ = _swig_new_instance_method(_wasserstein.EMDYPhiFloat32___call__)
+    lower_bound = _swig_new_instance_method(_wasserstein.EMDYPhiFloat32_lower_bound)
+    upper_bound = _swig_new_instance_method(_wasserstein.EMDYPhiFloat32_upper_bound)
+    within = _swig_new_instance_method(_wasserstein.EMDYPhiFloat32_within)
 
 # Register EMDYPhiFloat32 in _wasserstein:
 _wasserstein.EMDYPhiFloat32_swigregister(EMDYPhiFloat32)
@@ -936,10 +989,16 @@ class PairwiseEMDFloat64(PairwiseEMDBaseFloat64):
             del self.event_arrs
 
 
+    reserve = _swig_new_instance_method(_wasserstein.PairwiseEMDFloat64_reserve)
+    threshold = _swig_new_instance_method(_wasserstein.PairwiseEMDFloat64_threshold)
+    has_threshold = _swig_new_instance_method(_wasserstein.PairwiseEMDFloat64_has_threshold)
+    set_threshold = _swig_new_instance_method(_wasserstein.PairwiseEMDFloat64_set_threshold)
+    has_sweep = _swig_new_instance_method(_wasserstein.PairwiseEMDFloat64_has_sweep)
     init = _swig_new_instance_method(_wasserstein.PairwiseEMDFloat64_init)
     compute = _swig_new_instance_method(_wasserstein.PairwiseEMDFloat64_compute)
     __repr__ = _swig_new_instance_method(_wasserstein.PairwiseEMDFloat64___repr__)
     preprocess_CenterWeightedCentroid = _swig_new_instance_method(_wasserstein.PairwiseEMDFloat64_preprocess_CenterWeightedCentroid)
+    close_pairs = _swig_new_instance_method(_wasserstein.PairwiseEMDFloat64_close_pairs)
     _reset_B_events = _swig_new_instance_method(_wasserstein.PairwiseEMDFloat64__reset_B_events)
 
 
@@ -969,6 +1028,8 @@ class PairwiseEMDFloat64(PairwiseEMDBaseFloat64):
         _store_events(self, eventsB, event_weightsB, gdim, mask, self._float_dtype)
 
     _add_event = _swig_new_instance_method(_wasserstein.PairwiseEMDFloat64__add_event)
+    set_sweep = _swig_new_instance_method(_wasserstein.PairwiseEMDFloat64_set_sweep)
+    sweep_emds = _swig_new_instance_method(_wasserstein.PairwiseEMDFloat64_sweep_emds)
 
 # Register PairwiseEMDFloat64 in _wasserstein:
 _wasserstein.PairwiseEMDFloat64_swigregister(PairwiseEMDFloat64)
@@ -990,10 +1051,16 @@ class PairwiseEMDFloat32(PairwiseEMDBaseFloat32):
             del self.event_arrs
 
 
+    reserve = _swig_new_instance_method(_wasserstein.PairwiseEMDFloat32_reserve)
+    threshold = _swig_new_instance_method(_wasserstein.PairwiseEMDFloat32_threshold)
+    has_threshold = _swig_new_instance_method(_wasserstein.PairwiseEMDFloat32_has_threshold)
+    set_threshold = _swig_new_instance_method(_wasserstein.PairwiseEMDFloat32_set_threshold)
+    has_sweep = _swig_new_instance_method(_wasserstein.PairwiseEMDFloat32_has_sweep)
     init = _swig_new_instance_method(_wasserstein.PairwiseEMDFloat32_init)
     compute = _swig_new_instance_method(_wasserstein.PairwiseEMDFloat32_compute)
     __repr__ = _swig_new_instance_method(_wasserstein.PairwiseEMDFloat32___repr__)
     preprocess_CenterWeightedCentroid = _swig_new_instance_method(_wasserstein.PairwiseEMDFloat32_preprocess_CenterWeightedCentroid)
+    close_pairs = _swig_new_instance_method(_wasserstein.PairwiseEMDFloat32_close_pairs)
     _reset_B_events = _swig_new_instance_method(_wasserstein.PairwiseEMDFloat32__reset_B_events)
 
 
@@ -1023,6 +1090,8 @@ class PairwiseEMDFloat32(PairwiseEMDBaseFloat32):
         _store_events(self, eventsB, event_weightsB, gdim, mask, self._float_dtype)
 
     _add_event = _swig_new_instance_method(_wasserstein.PairwiseEMDFloat32__add_event)
+    set_sweep = _swig_new_instance_method(_wasserstein.PairwiseEMDFloat32_set_sweep)
+    sweep_emds = _swig_new_instance_method(_wasserstein.PairwiseEMDFloat32_sweep_emds)
 
 # Register PairwiseEMDFloat32 in _wasserstein:
 _wasserstein.PairwiseEMDFloat32_swigregister(PairwiseEMDFloat32)
@@ -1044,10 +1113,16 @@ class PairwiseEMDYPhiFloat64(PairwiseEMDBaseFloat64):
             del self.event_arrs
 
 
+    reserve = _swig_new_instance_method(_wasserstein.PairwiseEMDYPhiFloat64_reserve)
+    threshold = _swig_new_instance_method(_wasserstein.PairwiseEMDYPhiFloat64_threshold)
+    has_threshold = _swig_new_instance_method(_wasserstein.PairwiseEMDYPhiFloat64_has_threshold)
+    set_threshold = _swig_new_instance_method(_wasserstein.PairwiseEMDYPhiFloat64_set_threshold)
+    has_sweep = _swig_new_instance_method(_wasserstein.PairwiseEMDYPhiFloat64_has_sweep)
     init = _swig_new_instance_method(_wasserstein.PairwiseEMDYPhiFloat64_init)
     compute = _swig_new_instance_method(_wasserstein.PairwiseEMDYPhiFloat64_compute)
     __repr__ = _swig_new_instance_method(_wasserstein.PairwiseEMDYPhiFloat64___repr__)
     preprocess_CenterWeightedCentroid = _swig_new_instance_method(_wasserstein.PairwiseEMDYPhiFloat64_preprocess_CenterWeightedCentroid)
+    close_pairs = _swig_new_instance_method(_wasserstein.PairwiseEMDYPhiFloat64_close_pairs)
     _reset_B_events = _swig_new_instance_method(_wasserstein.PairwiseEMDYPhiFloat64__reset_B_events)
 
 
@@ -1077,6 +1152,8 @@ class PairwiseEMDYPhiFloat64(PairwiseEMDBaseFloat64):
         _store_events(self, eventsB, event_weightsB, gdim, mask, self._float_dtype)
 
     _add_event = _swig_new_instance_method(_wasserstein.PairwiseEMDYPhiFloat64__add_event)
+    set_sweep = _swig_new_instance_method(_wasserstein.PairwiseEMDYPhiFloat64_set_sweep)
+    sweep_emds = _swig_new_instance_method(_wasserstein.PairwiseEMDYPhiFloat64_sweep_emds)
 
 # Register PairwiseEMDYPhiFloat64 in _wasserstein:
 _wasserstein.PairwiseEMDYPhiFloat64_swigregister(PairwiseEMDYPhiFloat64)
@@ -1098,10 +1175,16 @@ class PairwiseEMDYPhiFloat32(PairwiseEMDBaseFloat32):
             del self.event_arrs
 
 
+    reserve = _swig_new_instance_method(_wasserstein.PairwiseEMDYPhiFloat32_reserve)
+    threshold = _swig_new_instance_method(_wasserstein.PairwiseEMDYPhiFloat32_threshold)
+    has_threshold = _swig_new_instance_method(_wasserstein.PairwiseEMDYPhiFloat32_has_threshold)
+    set_threshold = _swig_new_instance_method(_wasserstein.PairwiseEMDYPhiFloat32_set_threshold)
+    has_sweep = _swig_new_instance_method(_wasserstein.PairwiseEMDYPhiFloat32_has_sweep)
     init = _swig_new_instance_method(_wasserstein.PairwiseEMDYPhiFloat32_init)
     compute = _swig_new_instance_method(_wasserstein.PairwiseEMDYPhiFloat32_compute)
     __repr__ = _swig_new_instance_method(_wasserstein.PairwiseEMDYPhiFloat32___repr__)
     preprocess_CenterWeightedCentroid = _swig_new_instance_method(_wasserstein.PairwiseEMDYPhiFloat32_preprocess_CenterWeightedCentroid)
+    close_pairs = _swig_new_instance_method(_wasserstein.PairwiseEMDYPhiFloat32_close_pairs)
     _reset_B_events = _swig_new_instance_method(_wasserstein.PairwiseEMDYPhiFloat32__reset_B_events)
 
 
@@ -1131,6 +1214,8 @@ class PairwiseEMDYPhiFloat32(PairwiseEMDBaseFloat32):
         _store_events(self, eventsB, event_weightsB, gdim, mask, self._float_dtype)
 
     _add_event = _swig_new_instance_method(_wasserstein.PairwiseEMDYPhiFloat32__add_event)
+    set_sweep = _swig_new_instance_method(_wasserstein.PairwiseEMDYPhiFloat32_set_sweep)
+    sweep_emds = _swig_new_instance_method(_wasserstein.PairwiseEMDYPhiFloat32_sweep_emds)
 
 # Register PairwiseEMDYPhiFloat32 in _wasserstein:
 _wasserstein.PairwiseEMDYPhiFloat32_swigregister(PairwiseEMDYPhiFloat32)